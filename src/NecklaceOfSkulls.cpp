@@ -17,5792 +17,751 @@ namespace fs = std::filesystem;
 #include <SDL_image.h>
 #include <SDL_ttf.h>
 
-// JSON library
-#include "nlohmann/json.hpp"
-
 #include "constants.hpp"
 #include "config.hpp"
 #include "controls.hpp"
+#include "assets.hpp"
+#include "audio.hpp"
+#include "render.hpp"
+#include "widgets.hpp"
+#include "runner.hpp"
 #include "input.hpp"
+#include "replay.hpp"
+#include "journal.hpp"
+#include "memory.hpp"
+#include "handles.hpp"
 #include "items.hpp"
 #include "skills.hpp"
 #include "character.hpp"
 #include "story.hpp"
+#include "save.hpp"
+#include "search.hpp"
+#include "startup.hpp"
+#include "layout.hpp"
+#include "decode.hpp"
+#include "tiles.hpp"
+#include "textures.hpp"
+#include "frame.hpp"
+#include "cache.hpp"
+#include "telemetry.hpp"
+#include "soak.hpp"
+#include "state.hpp"
+#include "graphics.hpp"
+#include "screens.hpp"
 
-#if defined(_WIN32)
-
-#include <windows.h>
-#include <shlobj.h>
-
-#else
-
-#include <unistd.h>
-#include <sys/types.h>
-#include <pwd.h>
-
-#endif
-
-// forward declarations
-bool aboutScreen(SDL_Window *window, SDL_Renderer *renderer);
-bool barterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<std::pair<Item::Base, std::vector<Item::Base>>> Barter);
-bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
-bool donateScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player);
-bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skill::Base> Skills);
-bool greenMirror(SDL_Window *window, SDL_Renderer *renderer, Character::Base player, Story::Base *story);
-bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<Item::Base> &Items, Control::Type mode, int limit);
-bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> item_types, int Limit);
-bool loseSkills(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int limit);
-bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID);
-bool mapScreen(SDL_Window *window, SDL_Renderer *renderer);
-bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
-bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Control::Type mode);
-bool storyScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int id);
-bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int limit, bool back_button);
-bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Item::Base mine, Item::Base theirs);
-
-int eatScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> items, int limit);
-int giftScreen(SDL_Window *window, SDL_Renderer *renderer, Story::Base *story, Character::Base &player, std::vector<std::pair<Item::Type, int>> gifts, int default_destination);
-
-Character::Base customCharacter(SDL_Window *window, SDL_Renderer *renderer);
-Character::Base selectCharacter(SDL_Window *window, SDL_Renderer *renderer);
-Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, bool save_botton);
-
-Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
-Story::Base *renderChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
+Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
+{
+    auto screen = Frame::Screen();
 
-void clipValue(int &val, int min, int max);
-void renderAdventurer(SDL_Window *window, SDL_Renderer *renderer, TTF_Font *font, Character::Base &player, Character::Gender gender);
+    Story::Base *next = &notImplemented;
 
-SDL_Surface *createImage(const char *image)
-{
-    // Load splash image
-    auto surface = IMG_Load(image);
+    auto background = Handle::Surface(createImage("images/background.png"));
 
-    if (surface == NULL)
+    if (renderer && story->Choices.size() > 0)
     {
-        std::cerr << "Unable to load image " << image << "! SDL Error: " << SDL_GetError() << std::endl;
-    }
+        auto splash = Handle::Surface(story->Image ? createImage(story->Image) : NULL);
 
-    return surface;
-}
+        auto choices = story->Choices;
 
-void createWindow(Uint32 flags, SDL_Window **window, SDL_Renderer **renderer, const char *title, const char *icon)
-{
-    // The window we'll be rendering to
-    *window = NULL;
-    *renderer = NULL;
+        auto title = story->Title ? std::string(story->Title) : (std::string("Necklace of Skulls: ") + std::string(3 - std::to_string(std::abs(story->ID)).length(), '0') + std::to_string(std::abs(story->ID)));
 
-    // Initialize SDL
-    if (SDL_Init(flags) < 0)
-    {
-        std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
-    }
-    else
-    {
-        Recompute();
+        auto runner = Widget::Runner<>(window, renderer, title);
 
-        // Create window and renderer
-        SDL_CreateWindowAndRenderer(SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN | SDL_RENDERER_ACCELERATED, window, renderer);
+        auto &controls = runner.Controls;
 
-        SDL_SetRenderDrawBlendMode(*renderer, SDL_BLENDMODE_NONE);
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto box_space = Video.Scaled(10);
 
-        if (window == NULL || renderer == NULL)
-        {
-            std::cerr << "Window could not be created! SDL_Error: " << SDL_GetError() << std::endl;
-        }
-        else if (window)
+        for (int i = 0; i < choices.size(); i++)
         {
-            SDL_SetWindowTitle(*window, title);
-        }
+            auto text = createText(choices[i].Text, FONT_FILE, font_size, clrBK, textwidth - (4 * text_space), TTF_STYLE_NORMAL);
 
-        auto surface = createImage(icon);
+            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
 
-        if (surface)
-        {
-            // The icon is attached to the window pointer
-            SDL_SetWindowIcon(*window, surface);
+            controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < choices.size() ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
 
-            // ...and the surface containing the icon pixel data is no longer required.
-            SDL_FreeSurface(surface);
+            controls[i].W = textwidth - (4 * text_space);
 
-            surface = NULL;
+            controls[i].H = text->h;
         }
-    }
-}
-
-void renderImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y)
-{
-    if (image && renderer)
-    {
-        SDL_Rect position;
 
-        position.w = image->w;
-        position.h = image->h;
-        position.x = x;
-        position.y = y;
-
-        auto texture = SDL_CreateTextureFromSurface(renderer, image);
-
-        if (texture)
-        {
-            SDL_Rect src;
+        auto idx = choices.size();
 
-            src.w = image->w;
-            src.h = image->h;
-            src.x = 0;
-            src.y = 0;
+        controls.push_back(Button(idx, "icons/map.png", idx - 1, idx + 1, idx - 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/user.png", idx, idx + 2, idx - 1, idx + 1, startx + gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 2, "icons/items.png", idx + 1, idx + 3, idx - 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 3, "icons/back-button.png", idx + 2, idx + 3, idx - 1, idx + 3, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
 
-            SDL_RenderCopy(renderer, texture, &src, &position);
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+        runner.Duration = 5000;
 
-            SDL_DestroyTexture(texture);
+        Handle::TTF library;
 
-            texture = NULL;
-        }
-    }
-}
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
 
-int fitImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int w, int h)
-{
-    int splash_h = image->h;
-    int splash_w = w;
+        auto font = typeface.get();
 
-    if (image && renderer)
-    {
-        SDL_Rect position;
+        int splash_h = splashw;
 
-        if (w != image->w)
+        if (splash)
         {
-            splash_h = (int)((double)w / image->w * image->h);
-            splash_w = w;
-
-            if (splash_h > h)
+            if (splash->w != splashw)
             {
-                splash_h = h;
-                splash_w = (int)((double)h / image->h * image->w);
+                splash_h = (int)((double)splashw / splash->w * splash->h);
             }
         }
 
-        position.w = splash_w;
-        position.h = splash_h;
-        position.x = x;
-        position.y = y;
-
-        auto texture = SDL_CreateTextureFromSurface(renderer, image);
-
-        if (texture)
-        {
-            SDL_Rect src;
-
-            src.w = image->w;
-            src.h = image->h;
-            src.x = 0;
-            src.y = 0;
-
-            SDL_RenderCopy(renderer, texture, &src, &position);
-
-            SDL_DestroyTexture(texture);
-
-            texture = NULL;
-        }
-    }
-
-    return splash_h;
-}
-
-void stretchImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int w, int h)
-{
-    int splash_h = image->h;
-    int splash_w = w;
-
-    if (image && renderer)
-    {
-        SDL_Rect position;
-
-        position.w = w;
-        position.h = h;
-        position.x = x;
-        position.y = y;
-
-        auto texture = SDL_CreateTextureFromSurface(renderer, image);
-
-        if (texture)
-        {
-            SDL_Rect src;
+        auto &widgets = runner.Widgets;
 
-            src.w = image->w;
-            src.h = image->h;
-            src.x = 0;
-            src.y = 0;
+        auto life_header = widgets.Add<Widget::Label>("Life", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
+        auto life_box = widgets.Add<Widget::Label>("", font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
 
-            SDL_RenderCopy(renderer, texture, &src, &position);
+        auto money_header = widgets.Add<Widget::Label>("Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+        auto money_box = widgets.Add<Widget::Label>("", font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
 
-            SDL_DestroyTexture(texture);
+        auto scores_header = widgets.Add<Widget::Label>("SCORES", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+        auto scores_box = widgets.Add<Widget::Label>("", font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
 
-            texture = NULL;
-        }
-    }
-}
+        runner.Message = widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
 
-// Render a portion of the text (image) on bounded surface within the specified window
-void renderText(SDL_Renderer *renderer, SDL_Surface *text, Uint32 bg, int x, int y, int bounds, int offset)
-{
-    if (renderer)
-    {
-        if (text && renderer)
-        {
-            SDL_Rect dst;
-            SDL_Rect src;
-
-            // select portion to render
-            src.w = text->w;
-            src.h = text->h < bounds ? text->h : bounds;
-            src.y = offset;
-            src.x = 0;
-
-            // specify location within the window
-            dst.w = text->w;
-            dst.h = text->h < bounds ? text->h : bounds;
-            dst.x = x;
-            dst.y = y;
-
-            if (bg != 0)
+        runner.Update = [&]() {
+            if (background)
             {
-                SDL_SetRenderDrawColor(renderer, R(bg), G(bg), B(bg), A(bg));
-                SDL_RenderFillRect(renderer, &dst);
+                stretchImage(renderer, background.get(), 0, 0, SCREEN_WIDTH, buttony - button_space);
             }
 
-            auto texture = SDL_CreateTextureFromSurface(renderer, text);
-
-            if (texture)
+            if (splash)
             {
-                SDL_RenderCopy(renderer, texture, &src, &dst);
-
-                SDL_DestroyTexture(texture);
-
-                texture = NULL;
+                splash_h = fitImage(renderer, splash.get(), startx, starty, splashw, text_bounds);
             }
-        }
-    }
-}
-
-// create text image with line wrap limit
-SDL_Surface *createText(const char *text, const char *ttf, int font_size, SDL_Color textColor, int wrap, int style = TTF_STYLE_NORMAL)
-{
-    SDL_Surface *surface = NULL;
-
-    TTF_Init();
-
-    auto font = TTF_OpenFont(ttf, font_size);
 
-    if (font)
-    {
-        TTF_SetFontStyle(font, style);
-
-        surface = TTF_RenderText_Blended_Wrapped(font, text, textColor, wrap);
-
-        TTF_CloseFont(font);
-
-        font = NULL;
-    }
+            life_header->Visible = !splash || (splash && splash_h < (text_bounds - (boxh + infoh)));
 
-    TTF_Quit();
+            life_box->Visible = life_header->Visible;
 
-    return surface;
-}
+            money_header->Visible = !splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && !player.RitualBallStarted);
 
-void fillRect(SDL_Renderer *renderer, int w, int h, int x, int y, int color)
-{
-    SDL_Rect rect;
+            money_box->Visible = money_header->Visible;
 
-    rect.w = w;
-    rect.h = h;
-    rect.x = x;
-    rect.y = y;
+            scores_header->Visible = !splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && player.RitualBallStarted);
 
-    SDL_SetRenderDrawColor(renderer, R(color), G(color), B(color), A(color));
-    SDL_RenderFillRect(renderer, &rect);
-}
+            scores_box->Visible = scores_header->Visible;
 
-void drawRect(SDL_Renderer *renderer, int w, int h, int x, int y, int color)
-{
-    SDL_Rect rect;
+            life_header->Set("Life", player.Life > 0 ? intDB : intRD);
 
-    rect.w = w;
-    rect.h = h;
-    rect.x = x;
-    rect.y = y;
+            life_box->Set(std::to_string(player.Life));
 
-    SDL_SetRenderDrawColor(renderer, R(color), G(color), B(color), A(color));
-    SDL_RenderDrawRect(renderer, &rect);
-}
+            money_box->Set(std::to_string(player.Money) + std::string(" cacao"));
 
-void putText(SDL_Renderer *renderer, const char *text, TTF_Font *font, int space, SDL_Color fg, Uint32 bg, int style, int w, int h, int x, int y)
-{
-    if (renderer)
-    {
-        TTF_SetFontStyle(font, style);
+            scores_box->Set("Ticks: " + std::to_string(player.Ticks) + "\nCross: " + std::to_string(player.Cross));
+        };
 
-        auto surface = TTF_RenderText_Blended_Wrapped(font, text, fg, w - 2 * space);
+        runner.Draw = [&]() {
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
-        if (surface)
-        {
-            auto height = (surface->h + 2 * space) < h ? h : (surface->h + 2 * space);
+            fillRect(renderer, textwidth, text_bounds, textx, texty, BE_80);
 
-            fillRect(renderer, w, height, x, y, bg);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-            if (space > 0)
-            {
-                renderText(renderer, surface, 0, x + space, y + space, height - 2 * space, 0);
-            }
-            else
+            for (auto i = 0; i < story->Choices.size(); i++)
             {
-                renderText(renderer, surface, 0, x + (w - surface->w) / 2, y + (h - surface->h) / 2, height - 2 * space, 0);
+                if (i != runner.Current)
+                {
+                    Render::Queue.Draw(controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
+                }
             }
+        };
 
-            SDL_FreeSurface(surface);
-
-            surface = NULL;
-        }
-    }
-}
-
-void fillWindow(SDL_Renderer *renderer, Uint32 color)
-{
-    SDL_SetRenderDrawColor(renderer, R(color), G(color), B(color), A(color));
-    SDL_RenderClear(renderer);
-}
-
-void renderTextButtons(SDL_Renderer *renderer, std::vector<TextButton> controls, const char *ttf, int selected, SDL_Color fg, Uint32 bg, Uint32 bgSelected, int fontsize, int style = TTF_STYLE_NORMAL)
-{
-    if (controls.size() > 0)
-    {
-        for (auto i = 0; i < controls.size(); i++)
-        {
-            auto text = createText(controls[i].Text, ttf, fontsize, fg, controls[i].W, style);
-
-            int x = controls[i].X + (controls[i].W - text->w) / 2;
-            int y = controls[i].Y + (controls[i].H - text->h) / 2;
-
-            SDL_Rect rect;
+        runner.Act = [&](Control::Type type) {
+            auto current = runner.Current;
 
-            rect.w = controls[i].W;
-            rect.h = controls[i].H;
-            rect.x = controls[i].X;
-            rect.y = controls[i].Y;
-
-            if (i == selected)
-            {
-                SDL_SetRenderDrawColor(renderer, R(bgSelected), G(bgSelected), B(bgSelected), A(bgSelected));
-            }
-            else
+            if (type == Control::Type::ACTION && current < story->Choices.size())
             {
-                SDL_SetRenderDrawColor(renderer, R(bg), G(bg), B(bg), A(bg));
-            }
-
-            SDL_RenderFillRect(renderer, &rect);
-
-            renderText(renderer, text, bg, x, y, 2 * fontsize, 0);
-
-            SDL_FreeSurface(text);
-
-            text = NULL;
-        }
-    }
-}
+                auto &choice = story->Choices[current];
 
-void renderButtons(SDL_Renderer *renderer, std::vector<Button> controls, int current, int fg, int space, int pts)
-{
-    if (controls.size() > 0)
-    {
-        for (auto i = 0; i < controls.size(); i++)
-        {
-            renderImage(renderer, controls[i].Surface, controls[i].X, controls[i].Y);
+                auto available = Choice::Available(story->Choices, player);
 
-            SDL_Rect rect;
+                // why a choice is not available
+                auto state = Requirement::State(player);
 
-            for (auto size = pts; size >= 0; size--)
-            {
-                rect.w = controls[i].W + 2 * (space - size);
-                rect.h = controls[i].H + 2 * (space - size);
-                rect.x = controls[i].X - space + size;
-                rect.y = controls[i].Y - space + size;
+                const char *message = NULL;
 
-                if (i == current)
+                if (choice.Type == Choice::Type::NORMAL)
                 {
-                    SDL_SetRenderDrawColor(renderer, R(fg), G(fg), B(fg), A(fg));
-                    SDL_RenderDrawRect(renderer, &rect);
-                }
-            }
-        }
-    }
-}
-
-void renderButtons(SDL_Renderer *renderer, std::vector<Button> controls, int current, int fg, int space, int pts, bool scroll_up, bool scroll_dn)
-{
-    if (controls.size() > 0)
-    {
-        for (auto i = 0; i < controls.size(); i++)
-        {
-            SDL_Rect rect;
+                    next = (Story::Base *)findStory(choice.Destination);
 
-            if ((controls[i].Type == Control::Type::SCROLL_UP && scroll_up) || (controls[i].Type == Control::Type::SCROLL_DOWN && scroll_dn) || (controls[i].Type != Control::Type::SCROLL_UP && controls[i].Type != Control::Type::SCROLL_DOWN))
-            {
-                if (controls[i].Type == Control::Type::SCROLL_UP || controls[i].Type == Control::Type::SCROLL_DOWN)
-                {
-                    fillRect(renderer, controls[i].W + 2 * border_space, controls[i].H + 2 * border_space, controls[i].X - border_space, controls[i].Y - border_space, intWH);
+                    return true;
                 }
-
-                renderImage(renderer, controls[i].Surface, controls[i].X, controls[i].Y);
-            }
-
-            if (i == current)
-            {
-                if ((controls[i].Type == Control::Type::SCROLL_UP && scroll_up) || (controls[i].Type == Control::Type::SCROLL_DOWN && scroll_dn) || (controls[i].Type != Control::Type::SCROLL_UP && controls[i].Type != Control::Type::SCROLL_DOWN))
+                else if (choice.Type == Choice::Type::ITEMS)
                 {
-                    for (auto size = pts; size >= 0; size--)
+                    if (available[current])
                     {
-                        rect.w = controls[i].W + 2 * (space - size);
-                        rect.h = controls[i].H + 2 * (space - size);
-                        rect.x = controls[i].X - space + size;
-                        rect.y = controls[i].Y - space + size;
+                        next = (Story::Base *)findStory(choice.Destination);
 
-                        SDL_SetRenderDrawColor(renderer, R(fg), G(fg), B(fg), A(fg));
-                        SDL_RenderDrawRect(renderer, &rect);
+                        return true;
                     }
-                }
-            }
-        }
-    }
-}
-
-std::vector<TextButton> createHTextButtons(const char **choices, int num, int text_buttonh, int text_x, int text_y)
-{
-    auto controls = std::vector<TextButton>();
-
-    if (num > 0)
-    {
-        auto margin2 = (2.0 * Margin);
-        auto marginleft = (1.0 - margin2);
-
-        auto pixels = (int)(SCREEN_WIDTH * Margin) / 2;
-        auto width = (int)(SCREEN_WIDTH * marginleft);
-
-        auto text_spacew = width / num;
-        auto text_buttonw = text_spacew - pixels;
-        auto text_space = pixels / 2;
-
-        for (auto i = 0; i < num; i++)
-        {
-            int left = i > 0 ? i - 1 : i;
-            int right = i < num - 1 ? i + 1 : i;
-            int up = i;
-            int down = i;
-
-            auto x = text_x + i * (text_buttonw + text_space * 2) + text_space;
-
-            auto button = TextButton(i, choices[i], left, right, up, down, x, text_y, text_buttonw, text_buttonh);
-
-            controls.push_back(button);
-        }
-    }
-
-    return controls;
-}
-
-SDL_Surface *createHeaderButton(SDL_Window *window, const char *text, SDL_Color color, Uint32 bg, int w, int h, int x)
-{
-    auto button = SDL_CreateRGBSurface(0, w, h, arrow_size, 0, 0, 0, 0);
-    auto text_surface = createText(text, FONT_FILE, 18, color, w, TTF_STYLE_NORMAL);
-
-    if (button && text_surface)
-    {
-        SDL_Rect src;
-
-        src.w = text_surface->w;
-        src.h = text_surface->h;
-        src.x = 0;
-        src.y = 0;
-
-        SDL_Rect dst;
-
-        dst.w = button->w;
-        dst.h = button->h;
-        dst.x = 0;
-        dst.y = 0;
-
-        SDL_FillRect(button, &dst, bg);
-
-        dst.x = x < 0 ? (button->w - text_surface->w) / 2 : x;
-        dst.y = (button->h - text_surface->h) / 2;
-
-        SDL_BlitSurface(text_surface, &src, button, &dst);
-    }
-
-    if (text_surface)
-    {
-        SDL_FreeSurface(text_surface);
-
-        text_surface = NULL;
-    }
-
-    return button;
-}
-
-std::vector<Button> createItemList(SDL_Window *window, SDL_Renderer *renderer, std::vector<Item::Base> list, int start, int last, int limit, bool confirm_button, bool back_button)
-{
-    auto font_size = 20;
-    auto text_space = 8;
-    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-
-    auto controls = std::vector<Button>();
-
-    if (list.size() > 0)
-    {
-        for (int i = 0; i < last - start; i++)
-        {
-            auto index = start + i;
-
-            std::string item_string = list[index].Name;
-
-            if (list[index].Charge > 0)
-            {
-                item_string += " (";
-
-                if (list[index].Charge > 0)
-                {
-                    item_string += std::to_string(list[index].Charge);
-                }
-
-                item_string += ")";
-            }
-
-            auto text = createText(item_string.c_str(), FONT_FILE, font_size, clrBK, textwidth - 4 * text_space, TTF_STYLE_NORMAL);
-
-            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
-
-            controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < (last - start) ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
-
-            controls[i].W = textwidth - 4 * text_space;
-
-            controls[i].H = text->h;
-        }
-    }
-
-    auto idx = controls.size();
-
-    if (list.size() > limit)
-    {
-        if (start > 0)
-        {
-            controls.push_back(Button(idx, "icons/up-arrow.png", idx, idx, idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-
-            idx++;
-        }
-
-        if (list.size() - last > 0)
-        {
-            controls.push_back(Button(idx, "icons/down-arrow.png", idx, idx, start > 0 ? idx - 1 : idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx++;
-        }
-    }
-
-    if (confirm_button)
-    {
-        idx = controls.size();
-
-        controls.push_back(Button(idx, "icons/yes.png", idx - 1, back_button ? idx + 1 : idx, idx - 1, idx, startx, buttony, Control::Type::CONFIRM));
-    }
-
-    if (back_button)
-    {
-        idx = controls.size();
-
-        controls.push_back(Button(idx, "icons/back-button.png", idx - 1, idx, list.size() > 0 ? (last - start) : idx, idx, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-    }
-
-    return controls;
-}
-
-bool greenMirror(SDL_Window *window, SDL_Renderer *renderer, Character::Base player, Story::Base *story)
-{
-    std::string title = "Necklace of Skulls: GREEN MIRROR";
-
-    if (window && renderer)
-    {
-        auto text_space = 8;
-        auto font_size = 20;
-
-        const int future_width = SCREEN_WIDTH * (1.0 - 2.0 * Margin) - arrow_size - 2 * text_space;
-
-        std::string text;
-
-        auto done = false;
-
-        auto controls = std::vector<Button>();
+                    else
+                    {
+                        bool loaded = true;
+                        auto weapons = 0;
 
-        controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-        controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-        controls.push_back(Button(2, "icons/back-button.png", 1, 2, 1, 2, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+                        for (auto i = 0; i < choice.Items.size(); i++)
+                        {
+                            // Check if items (weapons) are loaded
+                            if ((state.Carried & Requirement::Bit(choice.Items[i].Type)) != 0)
+                            {
+                                weapons++;
 
-        auto scrollSpeed = 20;
-        auto hold = false;
-
-        auto selected = false;
-        auto current = -1;
-        auto offset = 0;
-
-        std::string future_text = "You used the GREEN MIRROR to look into your future...\n\n";
-
-        if (story->Choices.size() > 0)
-        {
-            for (auto i = 0; i < story->Choices.size(); i++)
-            {
-                if (i > 0)
-                {
-                    future_text += "\n" + std::string(future_width / 10, '-') + "\n\n";
-                }
-
-                auto simPlayer = player;
-
-                future_text += "[" + std::string(story->Choices[i].Text) + "]\n\n";
-
-                // simulate going into the future
-                auto future_story = (Story::Base *)findStory(story->Choices[i].Destination);
-
-                auto background = 0;
-
-                while (background != -1)
-                {
-                    background = future_story->Background(simPlayer);
-
-                    if (background >= 0)
-                    {
-                        future_story = (Story::Base *)findStory(background);
-                    }
-                }
-
-                future_story->Event(simPlayer);
-
-                future_text += future_story->Text;
-            }
-        }
-        else
-        {
-            auto simPlayer = player;
-
-            // simulate going into the future
-            auto future_story = (Story::Base *)findStory(story->Continue(simPlayer));
-
-            auto background = 0;
-
-            while (background != -1)
-            {
-                background = future_story->Background(simPlayer);
-
-                if (background >= 0)
-                {
-                    future_story = (Story::Base *)findStory(background);
-                }
-            }
-
-            future_story->Event(simPlayer);
-
-            future_text += "... " + std::string(future_story->Text);
-        }
-
-        auto future = createText(future_text.c_str(), FONT_FILE, font_size, clrBK, future_width - 2 * text_space, TTF_STYLE_NORMAL);
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, title.c_str());
-
-            // Fill the surface with background color
-            fillWindow(renderer, intWH);
-
-            fillRect(renderer, future_width, text_bounds, startx, starty, intBE);
-
-            renderText(renderer, future, intBE, startx + text_space, starty + text_space, text_bounds - 2 * text_space, offset);
-
-            renderButtons(renderer, controls, current, intDB, border_space, border_pts, (offset > 0), future && offset < (future->h - text_bounds + 2 * text_space));
-
-            auto scrollUp = false;
-            auto scrollDown = false;
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-                    }
-
-                    if (offset < 0)
-                    {
-                        offset = 0;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (future->h >= text_bounds - 2 * text_space)
-                    {
-                        if (offset < future->h - text_bounds + 2 * text_space)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > future->h - text_bounds + 2 * text_space)
-                        {
-                            offset = future->h - text_bounds + 2 * text_space;
-                        }
-                    }
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (future)
-        {
-            SDL_FreeSurface(future);
-
-            future = NULL;
-        }
-    }
-
-    return false;
-}
-
-bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
-{
-    std::string title = "Necklace of Skulls: Adventure Sheet";
-
-    auto done = false;
-
-    // Render the image
-    if (window && renderer)
-    {
-        auto selected = false;
-        auto current = -1;
-
-        const int back_buttonh = 48;
-        const int profilew = SCREEN_WIDTH * (1.0 - 2.0 * Margin);
-        const int profileh = 0.12 * SCREEN_HEIGHT;
-
-        auto controls = std::vector<Button>();
-
-        auto marginw = Margin * SCREEN_WIDTH;
-        auto marginh = Margin * SCREEN_HEIGHT / 2;
-
-        auto headerw = splashw;
-        auto headerh = 0.07 * SCREEN_HEIGHT;
-        auto space = 8;
-        auto font_size = 18;
-
-        auto boxh = headerh;
-
-        controls.push_back(Button(0, createHeaderButton(window, "Skills", clrWH, intDB, headerw, headerh, space), 0, 1, 0, 1, startx, starty + profileh + headerh + marginh, Control::Type::GLOSSARY));
-        controls.push_back(Button(1, createHeaderButton(window, "Possessions", clrWH, intDB, headerw, headerh, space), 0, 2, 0, 2, startx, starty + profileh + 3 * headerh + 3 * marginh + 2 * boxh, Control::Type::ACTION));
-        controls.push_back(Button(2, "icons/back-button.png", 1, 2, 1, 2, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        std::string codewords = "";
-
-        for (auto i = 0; i < player.Codewords.size(); i++)
-        {
-            if (!Codeword::IsInvisible(player.Codewords[i]))
-            {
-                if (i > 0 && codewords.length() > 0)
-                {
-                    codewords += ", ";
-                }
-
-                codewords += Codeword::Descriptions.at(player.Codewords[i]);
-            }
-        }
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        if (font)
-        {
-            while (!done)
-            {
-                SDL_SetWindowTitle(window, title.c_str());
-
-                // Fill the surface with background color
-                fillWindow(renderer, intWH);
-
-                renderAdventurer(window, renderer, font, player, Character::Gender::NONE);
-
-                if (player.Codewords.size() > 0 && codewords.length() > 0)
-                {
-                    putText(renderer, "Codewords", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + 2 * profileh + 4 * headerh + 4 * marginh + 2 * boxh);
-                    putText(renderer, codewords.c_str(), font, space, clrBK, intBE, TTF_STYLE_ITALIC, profilew - buttonw - 2 * space, boxh, startx, starty + 2 * profileh + 5 * headerh + 4 * marginh + 2 * boxh);
-                }
-
-                renderButtons(renderer, controls, current, intDB, space, space / 2);
-
-                auto scrollUp = false;
-                auto scrollDown = false;
-                auto hold = false;
-
-                done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-                if (selected && current >= 0 && current < controls.size())
-                {
-                    if (controls[current].Type == Control::Type::BACK)
-                    {
-                        break;
-                    }
-                    else if (controls[current].Type == Control::Type::GLOSSARY)
-                    {
-                        glossaryScreen(window, renderer, player.Skills);
-
-                        current = -1;
-
-                        selected = false;
-                    }
-                    else if (controls[current].Type == Control::Type::ACTION)
-                    {
-                        inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
-
-                        current = -1;
-
-                        selected = false;
-                    }
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return false;
-}
-
-bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skill::Base> Skills)
-{
-    std::string title = "Necklace of Skulls: Skills Glossary";
-
-    if (window && renderer)
-    {
-        auto space = 8;
-
-        auto font_size = 20;
-
-        const int glossary_width = SCREEN_WIDTH * (1.0 - 2.0 * Margin) - arrow_size - 2 * space;
-
-        std::string text;
-
-        for (auto i = 0; i < Skills.size(); i++)
-        {
-            if (i > 0)
-            {
-                text += "\n" + std::string(glossary_width / 10, '-') + "\n";
-            }
-
-            text += std::string(Skills[i].Name) + "\n\n";
-            text += std::string(Skills[i].Description) + "\n";
-        }
-
-        auto glossary = createText(text.c_str(), FONT_FILE, font_size, clrBK, glossary_width - 2 * space, TTF_STYLE_NORMAL);
-
-        auto quit = false;
-
-        auto controls = std::vector<Button>();
-
-        controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-        controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-        controls.push_back(Button(2, "icons/back-button.png", 1, 2, 1, 2, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        auto scrollSpeed = 20;
-        auto hold = false;
-        auto selected = false;
-        auto current = -1;
-        auto offset = 0;
-
-        while (!quit)
-        {
-            SDL_SetWindowTitle(window, title.c_str());
-
-            // Fill the surface with background color
-            fillWindow(renderer, intWH);
-
-            fillRect(renderer, glossary_width, text_bounds, startx, starty, intBE);
-            renderText(renderer, glossary, intBE, startx + space, starty + space, text_bounds - 2 * space, offset);
-
-            renderButtons(renderer, controls, current, intDB, border_space, border_pts, (offset > 0), glossary && offset < (glossary->h - text_bounds + 2 * space));
-
-            auto scrollUp = false;
-            auto scrollDown = false;
-
-            quit = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-                    }
-
-                    if (offset < 0)
-                    {
-                        offset = 0;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (glossary->h >= text_bounds - 2 * space)
-                    {
-                        if (offset < glossary->h - text_bounds + 2 * space)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > glossary->h - text_bounds + 2 * space)
-                        {
-                            offset = glossary->h - text_bounds + 2 * space;
-                        }
-                    }
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    quit = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (glossary)
-        {
-            SDL_FreeSurface(glossary);
-
-            glossary = NULL;
-        }
-    }
-
-    return false;
-}
-
-bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<Item::Base> &Items, Control::Type mode, int limit)
-{
-    if (Items.size() > 0)
-    {
-        auto font_size = 20;
-        auto text_space = 8;
-        auto scrollSpeed = 1;
-        auto display_limit = (text_bounds - text_space) / (font_size + 7 * text_space / 2);
-
-        auto offset = 0;
-
-        auto last = offset + display_limit;
-
-        if (last > Items.size())
-        {
-            last = Items.size();
-        }
-
-        const char *message = NULL;
-
-        std::string temp_message = "";
-
-        auto flash_message = false;
-
-        auto flash_color = intRD;
-
-        Uint32 start_ticks = 0;
-
-        Uint32 duration = 3000;
-
-        auto done = false;
-
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-
-        auto controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.150 * SCREEN_HEIGHT;
-        auto box_space = 10;
-        auto messageh = 0.25 * SCREEN_HEIGHT;
-
-        auto mirror_text = createText("The GREEN MIRROR disappears after one use. Do you wish to continue?", FONT_FILE, font_size, clrWH, textwidth - 2 * text_space, TTF_STYLE_NORMAL);
-        auto message_x = (SCREEN_WIDTH - textwidth) / 2;
-        auto message_y = (SCREEN_HEIGHT - messageh) / 2;
-
-        auto message_controls = std::vector<Button>();
-        message_controls.push_back(Button(0, "icons/yes.png", 0, 1, 0, 0, message_x + button_space, message_y + messageh - buttonh - button_space, Control::Type::YES));
-        message_controls.push_back(Button(1, "icons/no.png", 0, 1, 1, 1, message_x + textwidth - button_space - buttonw, message_y + messageh - buttonh - button_space, Control::Type::NO));
-
-        auto trigger_mirror = false;
-
-        while (!done)
-        {
-            last = offset + display_limit;
-
-            if (last > Items.size())
-            {
-                last = Items.size();
-            }
-
-            SDL_SetWindowTitle(window, "Necklace of Skulls: Possessions");
-
-            fillWindow(renderer, intWH);
-
-            if (flash_message)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, flash_color, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    flash_message = false;
-                }
-            }
-
-            if (!flash_message)
-            {
-                if (mode == Control::Type::DROP)
-                {
-                    putText(renderer, "You are carrying too many items. Select item(s) to DROP.", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else if (mode == Control::Type::USE)
-                {
-                    putText(renderer, "Select an item to USE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else if (mode == Control::Type::LOSE)
-                {
-                    std::string stolen_message = "DROP item(s) until only " + std::to_string(limit) + " item" + std::string(limit > 1 ? "s" : "") + " remains.";
-
-                    putText(renderer, stolen_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    putText(renderer, "You are carrying these items", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-            }
-
-            putText(renderer, "Life", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, (std::to_string(player.Life)).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-            putText(renderer, "Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-            putText(renderer, (std::to_string(player.Money) + std::string(" cacao")).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-
-            fillRect(renderer, textwidth, text_bounds, textx, texty, intBE);
-
-            for (auto idx = offset; idx < last; idx++)
-            {
-                auto i = idx - offset;
-
-                drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-            }
-
-            renderButtons(renderer, controls, trigger_mirror ? -1 : current, intDB, text_space, text_space / 2);
-
-            if (!trigger_mirror)
-            {
-                done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-            }
-            else
-            {
-                fillRect(renderer, textwidth, messageh, message_x, message_y, intLB);
-
-                renderImage(renderer, mirror_text, (SCREEN_WIDTH - mirror_text->w) / 2, message_y + text_space);
-
-                renderButtons(renderer, message_controls, current, intWH, border_space, border_pts);
-
-                done = Input::GetInput(renderer, message_controls, current, selected, scrollUp, scrollDown, hold);
-            }
-
-            if (((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold) && !trigger_mirror)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-
-                        if (offset < 0)
-                        {
-                            offset = 0;
-                        }
-
-                        last = offset + display_limit;
-
-                        if (last > Items.size())
-                        {
-                            last = Items.size();
-                        }
-
-                        controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-                        SDL_Delay(50);
-                    }
-
-                    if (offset <= 0)
-                    {
-                        current = -1;
-
-                        selected = false;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (Items.size() - last > 0)
-                    {
-                        if (offset < Items.size() - display_limit)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > Items.size() - display_limit)
-                        {
-                            offset = Items.size() - display_limit;
-                        }
-
-                        last = offset + display_limit;
-
-                        if (last > Items.size())
-                        {
-                            last = Items.size();
-                        }
-
-                        controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-                        SDL_Delay(50);
-
-                        if (offset > 0)
-                        {
-                            if (controls[current].Type != Control::Type::SCROLL_DOWN)
-                            {
-                                current++;
-                            }
-                        }
-                    }
-
-                    if (Items.size() - last <= 0)
-                    {
-                        selected = false;
-
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if ((current + offset >= 0) && (current + offset) < Items.size())
-                    {
-                        auto item = Items[current + offset];
-
-                        if (mode == Control::Type::DROP)
-                        {
-                            Items.erase(Items.begin() + (current + offset));
-
-                            if (offset > 0)
-                            {
-                                offset--;
-                            }
-
-                            last = offset + display_limit;
-
-                            if (last > Items.size())
-                            {
-                                last = Items.size();
-                            }
-
-                            controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-                            std::string description = item.Name;
-
-                            if (item.Charge == 0)
-                            {
-                                description += " (destroyed)";
-                            }
-
-                            temp_message = description + " DROPPED!";
-
-                            message = temp_message.c_str();
-
-                            flash_color = intRD;
-
-                            start_ticks = SDL_GetTicks();
-
-                            flash_message = true;
-
-                            selected = false;
-
-                            current = -1;
-                        }
-                        else if (mode == Control::Type::LOSE)
-                        {
-                            if (Items.size() > limit)
-                            {
-                                Items.erase(Items.begin() + (current + offset));
-
-                                Character::LOSE_ITEMS(player, {item.Type});
-
-                                if (offset > 0)
-                                {
-                                    offset--;
-                                }
-
-                                last = offset + display_limit;
-
-                                if (last > Items.size())
-                                {
-                                    last = Items.size();
-                                }
-
-                                controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-                                std::string description = item.Name;
-
-                                if (item.Charge == 0)
-                                {
-                                    description += " (destroyed)";
-                                }
-
-                                temp_message = description + " DROPPED!";
-
-                                message = temp_message.c_str();
-
-                                flash_color = intRD;
-
-                                start_ticks = SDL_GetTicks();
-
-                                flash_message = true;
-
-                                selected = false;
-
-                                current = -1;
-                            }
-                        }
-                        else if (mode == Control::Type::USE)
-                        {
-                            bool used_up = false;
-
-                            if (item.Type == Item::Type::PAPAYA || item.Type == Item::Type::MAIZE_CAKES)
-                            {
-                                if (player.Life < player.MAX_LIFE_LIMIT)
-                                {
-                                    Character::GAIN_LIFE(player, 1);
-
-                                    Items.erase(Items.begin() + (current + offset));
-
-                                    if (offset > 0)
-                                    {
-                                        offset--;
-                                    }
-
-                                    last = offset + display_limit;
-
-                                    if (last > Items.size())
-                                    {
-                                        last = Items.size();
-                                    }
-
-                                    controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-                                    message = "You RECOVER 1 Life Point.";
-
-                                    flash_color = intLB;
-                                }
-                                else
-                                {
-                                    message = "You are not INJURED!";
-
-                                    flash_color = intRD;
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                flash_message = true;
-                            }
-                            else if (item.Type == Item::Type::GREEN_MIRROR)
-                            {
-                                if (!trigger_mirror)
-                                {
-                                    trigger_mirror = true;
-                                }
-                            }
-
-                            if (item.Type == Item::Type::MAGIC_DRINK)
-                            {
-                                if (player.Life == player.MAX_LIFE_LIMIT)
-                                {
-                                    flash_message = true;
-
-                                    message = "You are not INJURED!";
-
-                                    flash_color = intRD;
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    flash_message = true;
-                                }
-                                else
-                                {
-                                    Character::GAIN_LIFE(player, 5);
-
-                                    message = "You RECOVER 5 Life Points.";
-
-                                    flash_color = intLB;
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    flash_message = true;
-
-                                    used_up = true;
-                                }
-                            }
-                            else if (item.Type == Item::Type::PAPAYA || item.Type == Item::Type::MAIZE_CAKES)
-                            {
-                                if (player.Life == player.MAX_LIFE_LIMIT)
-                                {
-                                    flash_message = true;
-
-                                    message = "You are not INJURED!";
-
-                                    flash_color = intRD;
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    flash_message = true;
-                                }
-                                else
-                                {
-                                    Character::GAIN_LIFE(player, 1);
-
-                                    message = "You RECOVER 1 Life Point.";
-
-                                    flash_color = intLB;
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    flash_message = true;
-
-                                    used_up = true;
-                                }
-                            }
-
-                            if (used_up)
-                            {
-                                if (Items.size() > 0)
-                                {
-                                    Items.erase(Items.begin() + (current + offset));
-
-                                    Character::LOSE_ITEMS(player, {item.Type});
-
-                                    if (offset > 0)
-                                    {
-                                        offset--;
-                                    }
-
-                                    last = offset + display_limit;
-
-                                    if (last > Items.size())
-                                    {
-                                        last = Items.size();
-                                    }
-
-                                    controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-                                }
-                            }
-
-                            selected = false;
-
-                            current = -1;
-                        }
-                    }
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = true;
-
-                    break;
-                }
-            }
-            if (selected && trigger_mirror)
-            {
-                if (message_controls[current].Type == Control::Type::YES && !hold)
-                {
-                    greenMirror(window, renderer, player, story);
-
-                    trigger_mirror = false;
-
-                    Item::REMOVE(Items, Item::GREEN_MIRROR);
-
-                    if (offset > 0)
-                    {
-                        offset--;
-                    }
-
-                    last = offset + display_limit;
-
-                    if (last > Items.size())
-                    {
-                        last = Items.size();
-                    }
-
-                    controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
-
-                    message = "The GREEN MIRROR vanishes without a trace!";
-
-                    flash_color = intLB;
-
-                    start_ticks = SDL_GetTicks();
-
-                    flash_message = true;
-                }
-                else if (message_controls[current].Type == Control::Type::NO && !hold)
-                {
-                    current = -1;
-
-                    selected = false;
-
-                    trigger_mirror = false;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return false;
-}
-
-int giftScreen(SDL_Window *window, SDL_Renderer *renderer, Story::Base *story, Character::Base &player, std::vector<std::pair<Item::Type, int>> gifts, int default_destination)
-{
-    int storyID = default_destination;
-
-    if (player.Items.size() > 0)
-    {
-        const char *message = NULL;
-
-        auto error = false;
-        auto done = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
-
-        auto controls = createItemList(window, renderer, player.Items, 0, player.Items.size(), player.Items.size(), true, true);
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-
-        auto selected_item = -1;
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, "Necklace of Skulls: Possessions");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            if (!error)
-            {
-                putText(renderer, "Select an item to GIVE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            putText(renderer, "Selected", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh));
-
-            if (selected_item >= 0 && selected_item < player.Items.size())
-            {
-                putText(renderer, player.Items[selected_item].Name.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-            }
-            else
-            {
-                fillRect(renderer, splashw, boxh, startx, starty + text_bounds - boxh, intBE);
-            }
-
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            for (auto i = 0; i < player.Items.size(); i++)
-            {
-                if (selected_item == i)
-                {
-                    drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                }
-            }
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < player.Items.size())
-                    {
-                        if (selected_item == current)
-                        {
-                            selected_item = -1;
-                        }
-                        else
-                        {
-                            selected_item = current;
-                        }
-                    }
-                }
-                else if (controls[current].Type == Control::Type::CONFIRM && !hold)
-                {
-                    if (selected_item >= 0 && selected_item < player.Items.size())
-                    {
-                        auto item = player.Items[selected_item];
-
-                        Character::LOSE_ITEMS(player, {item.Type});
-
-                        for (auto i = 0; i < gifts.size(); i++)
-                        {
-                            if (gifts[i].first == item.Type)
-                            {
-                                storyID = gifts[i].second;
-
-                                break;
-                            }
-                        }
-
-                        done = true;
-
-                        break;
-                    }
-                    else
-                    {
-                        start_ticks = SDL_GetTicks();
-
-                        message = "You have not selected anything!";
-
-                        error = true;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    storyID = story->ID;
-
-                    done = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return storyID;
-}
-
-bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int TakeLimit, bool back_button)
-{
-    auto done = false;
-
-    if (TakeLimit > 0)
-    {
-        auto font_size = 20;
-        auto text_space = 8;
-        auto scrollSpeed = 1;
-        auto limit = (text_bounds - text_space) / (font_size + 7 * text_space / 2);
-        auto offset = 0;
-        auto last = offset + limit;
-
-        if (last > items.size())
-        {
-            last = items.size();
-        }
-
-        const char *message = NULL;
-
-        auto error = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-
-        auto controls = createItemList(window, renderer, items, offset, last, limit, true, back_button);
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-
-        auto selection = std::vector<int>();
-
-        while (!done)
-        {
-            last = offset + limit;
-
-            if (last > items.size())
-            {
-                last = items.size();
-            }
-
-            SDL_SetWindowTitle(window, "Necklace of Skulls");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            if (!error)
-            {
-                std::string take_message = "";
-
-                if (items.size() > 1)
-                {
-                    if (TakeLimit > 1)
-                    {
-                        if (TakeLimit == items.size())
-                        {
-                            take_message = "You can TAKE any number of items.";
-                        }
-                        else
-                        {
-                            take_message = "You can TAKE up to " + std::to_string(TakeLimit) + " items.";
-                        }
-                    }
-                    else
-                    {
-                        take_message = "Choose an item to KEEP.";
-                    }
-                }
-                else
-                {
-                    take_message = "KEEP this item?";
-                }
-
-                putText(renderer, take_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            std::string take = "";
-
-            if (selection.size() > 0)
-            {
-                for (auto i = 0; i < selection.size(); i++)
-                {
-                    if (i > 0)
-                    {
-                        take += ", ";
-                    }
-
-                    std::string description = items[selection[i]].Name;
-
-                    if (items[selection[i]].Charge == 0)
-                    {
-                        description += " (destroyed)";
-                    }
-
-                    take += description;
-                }
-            }
-
-            putText(renderer, "SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (3 * boxh + infoh - 1));
-            putText(renderer, selection.size() > 0 ? take.c_str() : "(None)", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 3 * boxh, startx, starty + text_bounds - 3 * boxh);
-
-            fillRect(renderer, textwidth, text_bounds, textx, texty, intBE);
-
-            if (last - offset > 0)
-            {
-                for (auto i = 0; i < last - offset; i++)
-                {
-                    if (Item::FIND(selection, offset + i) >= 0)
-                    {
-                        drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                    }
-                }
-            }
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-
-                        if (offset < 0)
-                        {
-                            offset = 0;
-                        }
-
-                        last = offset + limit;
-
-                        if (last > items.size())
-                        {
-                            last = items.size();
-                        }
-
-                        controls = createItemList(window, renderer, items, offset, last, limit, true, back_button);
-
-                        SDL_Delay(50);
-                    }
-
-                    if (offset <= 0)
-                    {
-                        current = -1;
-
-                        selected = false;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (items.size() - last > 0)
-                    {
-                        if (offset < items.size() - limit)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > items.size() - limit)
-                        {
-                            offset = items.size() - limit;
-                        }
-
-                        last = offset + limit;
-
-                        if (last > items.size())
-                        {
-                            last = items.size();
-                        }
-
-                        controls = createItemList(window, renderer, items, offset, last, limit, true, back_button);
-
-                        SDL_Delay(50);
-
-                        if (offset > 0)
-                        {
-                            if (controls[current].Type != Control::Type::SCROLL_DOWN)
-                            {
-                                current++;
-                            }
-                        }
-                    }
-
-                    if (items.size() - last <= 0)
-                    {
-                        selected = false;
-
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < controls.size())
-                    {
-                        auto result = Item::FIND(selection, offset + current);
-
-                        if (result >= 0)
-                        {
-                            selection.erase(selection.begin() + result);
-                        }
-                        else
-                        {
-                            if (selection.size() < TakeLimit)
-                            {
-                                selection.push_back(offset + current);
-                            }
-                        }
-                    }
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::CONFIRM && !hold)
-                {
-                    auto take = std::vector<Item::Base>();
-
-                    for (auto i = 0; i < selection.size(); i++)
-                    {
-                        take.push_back(items[selection[i]]);
-                    }
-
-                    Character::GET_ITEMS(player, take);
-
-                    current = -1;
-
-                    selected = false;
-
-                    done = true;
-
-                    break;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = false;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return done;
-}
-
-bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> item_types, int Limit)
-{
-    auto done = false;
-
-    if (Limit > 0)
-    {
-        auto font_size = 20;
-        auto text_space = 8;
-        auto scrollSpeed = 1;
-        auto limit = (text_bounds - text_space) / (font_size + 7 * text_space / 2);
-        auto offset = 0;
-        auto last = offset + limit;
-
-        if (last > player.Items.size())
-        {
-            last = player.Items.size();
-        }
-
-        const char *message = NULL;
-
-        auto error = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-
-        auto controls = createItemList(window, renderer, player.Items, offset, last, limit, true, false);
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-
-        auto selection = std::vector<int>();
-
-        while (!done)
-        {
-            last = offset + limit;
-
-            if (last > item_types.size())
-            {
-                last = item_types.size();
-            }
-
-            SDL_SetWindowTitle(window, "Necklace of Skulls");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            if (!error)
-            {
-                std::string lose_message = "";
-
-                if (item_types.size() > 1)
-                {
-                    if (Limit > 1)
-                    {
-                        lose_message = "You must GIVE UP " + std::to_string(Limit) + " items.";
-                    }
-                    else
-                    {
-                        lose_message = "Choose an item to GIVE UP.";
-                    }
-                }
-                else
-                {
-                    lose_message = "GIVE UP this item";
-                }
-
-                putText(renderer, lose_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            std::string lose = "";
-
-            if (selection.size() > 0)
-            {
-                for (auto i = 0; i < selection.size(); i++)
-                {
-                    if (i > 0)
-                    {
-                        lose += ", ";
-                    }
-
-                    std::string description = player.Items[selection[i]].Name;
-
-                    if (player.Items[selection[i]].Charge == 0)
-                    {
-                        description += " (destroyed)";
-                    }
-
-                    lose += description;
-                }
-            }
-
-            putText(renderer, "SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (3 * boxh + infoh - 1));
-            putText(renderer, selection.size() > 0 ? lose.c_str() : "(None)", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 3 * boxh, startx, starty + text_bounds - 3 * boxh);
-
-            fillRect(renderer, textwidth, text_bounds, textx, texty, intBE);
-
-            if (last - offset > 0)
-            {
-                for (auto i = 0; i < last - offset; i++)
-                {
-                    if (Item::FIND(selection, offset + i) >= 0)
-                    {
-                        drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                    }
-                }
-            }
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-
-                        if (offset < 0)
-                        {
-                            offset = 0;
-                        }
-
-                        last = offset + limit;
-
-                        if (last > item_types.size())
-                        {
-                            last = item_types.size();
-                        }
-
-                        controls = createItemList(window, renderer, player.Items, offset, last, limit, true, false);
-
-                        SDL_Delay(50);
-                    }
-
-                    if (offset <= 0)
-                    {
-                        current = -1;
-
-                        selected = false;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (item_types.size() - last > 0)
-                    {
-                        if (offset < item_types.size() - limit)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > item_types.size() - limit)
-                        {
-                            offset = item_types.size() - limit;
-                        }
-
-                        last = offset + limit;
-
-                        if (last > item_types.size())
-                        {
-                            last = item_types.size();
-                        }
-
-                        controls = createItemList(window, renderer, player.Items, offset, last, limit, true, false);
-
-                        SDL_Delay(50);
-
-                        if (offset > 0)
-                        {
-                            if (controls[current].Type != Control::Type::SCROLL_DOWN)
-                            {
-                                current++;
-                            }
-                        }
-                    }
-
-                    if (item_types.size() - last <= 0)
-                    {
-                        selected = false;
-
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < controls.size())
-                    {
-                        auto result = Item::FIND(selection, offset + current);
-
-                        if (result >= 0)
-                        {
-                            selection.erase(selection.begin() + result);
-                        }
-                        else
-                        {
-                            if (selection.size() < Limit)
-                            {
-                                auto found = false;
-
-                                auto type = player.Items[offset + current].Type;
-
-                                for (auto i = 0; i < item_types.size(); i++)
-                                {
-                                    if (type == item_types[i])
-                                    {
-                                        found = true;
-
-                                        break;
-                                    }
-                                }
-
-                                if (found)
-                                {
-                                    selection.push_back(offset + current);
-                                }
-                                else
-                                {
-                                    error = true;
-
-                                    message = "This is unacceptable. Please choose another.";
-
-                                    start_ticks = SDL_GetTicks();
-                                }
-                            }
-                        }
-                    }
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::CONFIRM && !hold)
-                {
-                    if (selection.size() == Limit)
-                    {
-                        auto items = std::vector<Item::Base>();
-
-                        for (auto i = 0; i < player.Items.size(); i++)
-                        {
-                            auto found = false;
-
-                            for (auto j = 0; j < selection.size(); j++)
-                            {
-                                if (i == selection[j])
-                                {
-                                    found = true;
-
-                                    break;
-                                }
-                            }
-
-                            if (!found)
-                            {
-                                items.push_back(player.Items[i]);
-                            }
-                        }
-
-                        player.Items = items;
-
-                        current = -1;
-
-                        selected = false;
-
-                        done = true;
-
-                        break;
-                    }
-                    else
-                    {
-                        message = "Please select item(s) to GIVE UP";
-
-                        error = true;
-
-                        start_ticks = SDL_GetTicks();
-                    }
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return done;
-}
-
-void renderAdventurer(SDL_Window *window, SDL_Renderer *renderer, TTF_Font *font, Character::Base &player, Character::Gender gender)
-{
-    const int profilew = SCREEN_WIDTH * (1.0 - 2.0 * Margin);
-    const int profileh = 0.12 * SCREEN_HEIGHT;
-
-    auto headerw = splashw;
-    auto headerh = 0.07 * SCREEN_HEIGHT;
-    auto space = 8;
-
-    auto marginw = Margin * SCREEN_WIDTH;
-    auto marginh = Margin * SCREEN_HEIGHT / 2;
-
-    std::string skills;
-
-    for (auto i = 0; i < player.Skills.size(); i++)
-    {
-        if (i > 0)
-        {
-            skills += ", ";
-        }
-
-        skills += player.Skills[i].Name;
-    }
-
-    auto boxw = (profilew - marginw) / 2;
-    auto boxh = headerh;
-
-    std::string possessions;
-
-    for (auto i = 0; i < player.Items.size(); i++)
-    {
-        if (i > 0)
-        {
-            possessions += ", ";
-        }
-
-        possessions += player.Items[i].Name;
-
-        if (player.Items[i].Charge >= 0)
-        {
-            possessions += " (";
-
-            if (player.Items[i].Charge == 0)
-            {
-                possessions += "destroyed";
-            }
-
-            possessions += ")";
-        }
-    }
-
-    auto name_string = player.Name;
-
-    if (gender == Character::Gender::NONE)
-    {
-        if (player.Gender == Character::Gender::MALE)
-        {
-            name_string += " (Male)";
-        }
-        else if (player.Gender == Character::Gender::FEMALE)
-        {
-            name_string += " (Female)";
-        }
-    }
-
-    if (player.IsImmortal || player.IsBlessed)
-    {
-        name_string += " (";
-
-        if (player.IsImmortal)
-        {
-            name_string += "Immortal";
-
-            if (player.IsBlessed)
-            {
-                name_string += ", ";
-            }
-        }
-
-        if (player.IsBlessed)
-        {
-            name_string += "Blessed";
-        }
-
-        name_string += ")";
-    }
-
-    // Fill the surface with background color
-    fillWindow(renderer, intWH);
-
-    putText(renderer, name_string.c_str(), font, space, clrWH, intDB, TTF_STYLE_NORMAL, (player.IsImmortal || player.IsBlessed ? headerw * 2 : headerw), headerh, startx, starty);
-    putText(renderer, player.Description.c_str(), font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, profileh, startx, starty + headerh);
-
-    putText(renderer, "Skills", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + headerh + marginh);
-    putText(renderer, skills.c_str(), font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, boxh, startx, starty + profileh + 2 * headerh + marginh);
-
-    putText(renderer, "Life", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + 2 * headerh + 2 * marginh + boxh);
-    putText(renderer, std::to_string(player.Life).c_str(), font, space, clrBK, intBE, TTF_STYLE_NORMAL, boxw, boxh, startx, starty + profileh + 3 * headerh + 2 * marginh + boxh);
-
-    putText(renderer, "Money", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx + boxw + marginw, starty + profileh + 2 * headerh + 2 * marginh + boxh);
-    putText(renderer, (std::to_string(player.Money) + " cacao").c_str(), font, space, clrBK, intBE, TTF_STYLE_NORMAL, boxw, boxh, startx + boxw + marginw, starty + profileh + 3 * headerh + 2 * marginh + boxh);
-
-    putText(renderer, "Possessions", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + 3 * headerh + 3 * marginh + 2 * boxh);
-    putText(renderer, player.Items.size() > 0 ? possessions.c_str() : "(None)", font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, profileh, startx, starty + profileh + 4 * headerh + 3 * marginh + 2 * boxh);
-
-    if (gender != Character::Gender::NONE)
-    {
-        auto genderx = startx + boxw + marginw;
-        auto genderh = (int)(0.07 * SCREEN_HEIGHT) - space;
-        auto genderw = splashw / 2;
-
-        putText(renderer, "MALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, genderx, starty);
-        putText(renderer, "FEMALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, genderx + genderw + 2 * space, starty);
-
-        if (gender == Character::Gender::MALE)
-        {
-            drawRect(renderer, genderw, genderh, genderx, starty, intBK);
-        }
-        else if (gender == Character::Gender::FEMALE)
-        {
-            drawRect(renderer, genderw, genderh, genderx + genderw + 2 * space, starty, intBK);
-        }
-    }
-}
-
-std::vector<Button> skillsList(SDL_Window *window, SDL_Renderer *renderer, int start, int last, int limit)
-{
-    auto font_size = 20;
-    auto text_space = 8;
-    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-
-    auto controls = std::vector<Button>();
-
-    for (int i = 0; i < last - start; i++)
-    {
-        auto index = start + i;
-
-        std::string item_string = Skill::ALL[index].Name;
-
-        auto text = createText(item_string.c_str(), FONT_FILE, font_size, clrBK, textwidth - 4 * text_space, TTF_STYLE_NORMAL);
-
-        auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
-
-        controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < (last - start) ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
-
-        controls[i].W = textwidth - 4 * text_space;
-
-        controls[i].H = text->h;
-    }
-
-    auto idx = controls.size();
-
-    if (Skill::ALL.size() > limit)
-    {
-        if (start > 0)
-        {
-            controls.push_back(Button(idx, "icons/up-arrow.png", 0, idx, idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-
-            idx++;
-        }
-
-        if (Skill::ALL.size() - last > 0)
-        {
-            controls.push_back(Button(idx, "icons/down-arrow.png", 0, idx, start > 0 ? idx - 1 : idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, (texty + 2 * text_bounds / 3 - arrow_size - border_space), Control::Type::SCROLL_DOWN));
-
-            idx++;
-        }
-    }
-
-    idx = controls.size();
-
-    auto button_width = 100;
-    auto button_space = 25;
-    auto button_height = 48;
-
-    controls.push_back(Button(idx, createHeaderButton(window, "Glossary", clrWH, intBK, button_width, button_height, -1), idx, idx + 1, idx - 1, idx, startx, buttony, Control::Type::GLOSSARY));
-    controls.push_back(Button(idx + 1, createHeaderButton(window, "Start", clrWH, intBK, button_width, button_height, -1), idx, idx + 2, idx - 1, idx + 1, startx + (button_width + button_space), buttony, Control::Type::NEW));
-    controls.push_back(Button(idx + 2, createHeaderButton(window, "Back", clrWH, intBK, button_width, button_height, -1), idx + 1, idx + 2, idx - 1, idx + 2, startx + 2 * (button_width + button_space), buttony, Control::Type::BACK));
-
-    return controls;
-}
-
-Character::Base customCharacter(SDL_Window *window, SDL_Renderer *renderer)
-{
-    std::string title = "Necklace of Skulls: Create Character";
-
-    auto done = false;
-
-    Character::Base player = Character::Base();
-
-    auto gender = Character::Gender::NONE;
-
-    // Render the image
-    if (window && renderer)
-    {
-        auto flash_message = false;
-        auto flash_color = intRD;
-
-        std::string message = "";
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 5000;
-
-        auto selected = false;
-        auto current = -1;
-        auto character = 0;
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-        auto Limit = (int)(2 * text_bounds / 3 - text_space) / (font_size + 7 * text_space / 2);
-
-        auto offset = 0;
-
-        auto last = offset + Limit;
-
-        if (last > Skill::ALL.size())
-        {
-            last = Skill::ALL.size();
-        }
-
-        auto controls = skillsList(window, renderer, offset, last, Limit);
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-        auto scrollSpeed = 1;
-        auto selection = std::vector<int>();
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.150 * SCREEN_HEIGHT;
-        auto box_space = 10;
-
-        auto genderh = infoh;
-        auto genderw = splashw;
-
-        while (!done)
-        {
-            last = offset + Limit;
-
-            if (last > Skill::ALL.size())
-            {
-                last = Skill::ALL.size();
-            }
-
-            SDL_SetWindowTitle(window, title.c_str());
-
-            fillWindow(renderer, intWH);
-
-            std::string selection_string = "";
-
-            if (selection.size() > 0)
-            {
-                for (auto i = 0; i < selection.size(); i++)
-                {
-                    if (i > 0)
-                    {
-                        selection_string += ", ";
-                    }
-
-                    std::string description = Skill::ALL[selection[i]].Name;
-
-                    selection_string += description;
-                }
-            }
-
-            putText(renderer, "SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * boxh + infoh - 1));
-
-            putText(renderer, selection.size() > 0 ? selection_string.c_str() : "(None)", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh);
-
-            fillRect(renderer, textwidth, 2 * text_bounds / 3, textx, texty, intBE);
-
-            fillRect(renderer, textwidth, text_bounds / 3 - texty, textx, 2 * (texty + text_bounds / 3), intDB);
-
-            if (current >= 0 && current < Limit)
-            {
-                auto text = createText(Skill::ALL[current + offset].Description, FONT_FILE, font_size, clrWH, textwidth - 2 * text_space, TTF_STYLE_NORMAL);
-
-                renderText(renderer, text, intDB, textx + text_space, 2 * (texty + text_bounds / 3) + text_space, text_bounds / 3 - texty, 0);
-
-                SDL_FreeSurface(text);
-
-                text = NULL;
-            }
-
-            if (last - offset > 0)
-            {
-                for (auto i = 0; i < last - offset; i++)
-                {
-                    if (Skill::FIND_LIST(selection, offset + i) >= 0)
-                    {
-                        drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                    }
-                }
-            }
-
-            if (flash_message)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message.c_str(), font, text_space, clrWH, flash_color, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    flash_message = false;
-                }
-            }
-
-            if (!flash_message)
-            {
-                putText(renderer, "SELECT 4 Skills for your character.", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            if (gender != Character::Gender::NONE)
-            {
-                putText(renderer, "MALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, startx, starty + boxh + box_space);
-                putText(renderer, "FEMALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, startx, starty + boxh + box_space + genderh + text_space);
-
-                if (gender == Character::Gender::MALE)
-                {
-                    drawRect(renderer, genderw, genderh, startx, starty + boxh + box_space, intBK);
-                }
-                else if (gender == Character::Gender::FEMALE)
-                {
-                    drawRect(renderer, genderw, genderh, startx, starty + boxh + box_space + genderh + text_space, intBK);
-                }
-            }
-
-            renderButtons(renderer, controls, current, intDB, 8, 4);
-
-            Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-
-                        if (offset < 0)
-                        {
-                            offset = 0;
-                        }
-
-                        last = offset + Limit;
-
-                        if (last > Skill::ALL.size())
-                        {
-                            last = Skill::ALL.size();
-                        }
-
-                        controls = skillsList(window, renderer, offset, last, Limit);
-
-                        SDL_Delay(50);
-                    }
-
-                    if (offset <= 0)
-                    {
-                        current = -1;
-
-                        selected = false;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (Skill::ALL.size() - last > 0)
-                    {
-                        if (offset < Skill::ALL.size() - Limit)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > Skill::ALL.size() - Limit)
-                        {
-                            offset = Skill::ALL.size() - Limit;
-                        }
-
-                        last = offset + Limit;
-
-                        if (last > Skill::ALL.size())
-                        {
-                            last = Skill::ALL.size();
-                        }
-
-                        controls = skillsList(window, renderer, offset, last, Limit);
-
-                        SDL_Delay(50);
-
-                        if (offset > 0)
-                        {
-                            if (controls[current].Type != Control::Type::SCROLL_DOWN)
-                            {
-                                current++;
-                            }
-                        }
-                    }
-
-                    if (Skill::ALL.size() - last <= 0)
-                    {
-                        selected = false;
-
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if ((current + offset >= 0) && (current + offset) < Skill::ALL.size())
-                    {
-                        auto result = Skill::FIND_LIST(selection, current + offset);
-
-                        if (result >= 0)
-                        {
-                            selection.erase(selection.begin() + result);
-                        }
-                        else
-                        {
-                            if (selection.size() < player.SKILLS_LIMIT)
-                            {
-                                selection.push_back(offset + current);
-                            }
-                        }
-                    }
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::NEW)
-                {
-                    if (selection.size() == player.SKILLS_LIMIT)
-                    {
-                        Character::CUSTOM.Skills.clear();
-                        Character::CUSTOM.Items.clear();
-
-                        for (auto i = 0; i < selection.size(); i++)
-                        {
-                            Character::CUSTOM.Skills.push_back(Skill::ALL[selection[i]]);
-
-                            if (Skill::ALL[selection[i]].Type == Skill::Type::SWORDPLAY)
-                            {
-                                Character::CUSTOM.Items.push_back(Item::SWORD);
-                            }
-                            else if (Skill::ALL[selection[i]].Type == Skill::Type::SPELLS)
-                            {
-                                Character::CUSTOM.Items.push_back(Item::MAGIC_WAND);
-                            }
-                            else if (Skill::ALL[selection[i]].Type == Skill::Type::TARGETING)
-                            {
-                                Character::CUSTOM.Items.push_back(Item::BLOWGUN);
-                            }
-                            else if (Skill::ALL[selection[i]].Type == Skill::Type::CHARMS)
-                            {
-                                Character::CUSTOM.Items.push_back(Item::MAGIC_AMULET);
-                            }
-                        }
-
-                        Character::CUSTOM.Money = 12;
-                        Character::CUSTOM.Life = 10;
-                        Character::CUSTOM.Gender = gender;
-
-                        player = Character::CUSTOM;
-
-                        current = -1;
-
-                        selected = false;
-
-                        done = true;
-
-                        break;
-                    }
-                    else
-                    {
-                        flash_message = true;
-
-                        flash_color = intRD;
-
-                        start_ticks = SDL_GetTicks();
-
-                        message = "Please select " + std::to_string(player.SKILLS_LIMIT) + " skills.";
-
-                        selected = false;
-
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::GLOSSARY)
-                {
-                    glossaryScreen(window, renderer, Skill::ALL);
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::BACK)
-                {
-                    player = Character::Base();
-
-                    current = -1;
-
-                    selected = false;
-
-                    done = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return player;
-}
-
-Character::Base selectCharacter(SDL_Window *window, SDL_Renderer *renderer)
-{
-    std::string title = "Necklace of Skulls: Select Character";
-
-    auto done = false;
-
-    Character::Base player = Character::Classes[0];
-
-    // Render the image
-    if (window && renderer)
-    {
-        auto selected = false;
-        auto current = -1;
-        auto character = 0;
-        auto main_buttonh = 48;
-        auto font_size = 18;
-        auto font20 = 20;
-        auto gender = Character::Gender::NONE;
-
-        const char *choices[6] = {"Previous", "Next", "Glossary", "Custom", "Start", "Back"};
-
-        auto controls = createHTextButtons(choices, 6, main_buttonh, startx, SCREEN_HEIGHT * (1.0 - Margin) - main_buttonh);
-
-        controls[0].Type = Control::Type::BACK;
-        controls[1].Type = Control::Type::NEXT;
-        controls[2].Type = Control::Type::GLOSSARY;
-        controls[3].Type = Control::Type::CUSTOM;
-        controls[4].Type = Control::Type::NEW;
-        controls[5].Type = Control::Type::QUIT;
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, title.c_str());
-
-            renderAdventurer(window, renderer, font, Character::Classes[character], Character::Gender::NONE);
-
-            renderTextButtons(renderer, controls, FONT_FILE, current, clrWH, intBK, intRD, font20, TTF_STYLE_NORMAL);
-
-            auto scrollUp = false;
-            auto scrollDown = false;
-            auto hold = false;
-
-            Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected && current >= 0 && current < controls.size())
-            {
-                if (controls[current].Type == Control::Type::NEW)
-                {
-                    player = Character::Classes[character];
-
-                    player.Gender = gender;
-
-                    current = -1;
-
-                    selected = false;
-
-                    done = true;
-
-                    break;
-                }
-                else if (controls[current].Type == Control::Type::BACK)
-                {
-                    if (character > 0)
-                    {
-                        character--;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::NEXT)
-                {
-                    if (character < Character::Classes.size() - 1)
-                    {
-                        character++;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::GLOSSARY)
-                {
-                    glossaryScreen(window, renderer, Skill::ALL);
-
-                    current = -1;
-                }
-                else if (controls[current].Type == Control::Type::CUSTOM)
-                {
-                    player = customCharacter(window, renderer);
-
-                    if (player.Skills.size() == player.SKILLS_LIMIT)
-                    {
-                        current = -1;
-
-                        selected = false;
-
-                        done = true;
-
-                        break;
-                    }
-                    else
-                    {
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::QUIT)
-                {
-                    player = Character::Base();
-
-                    player.StoryID = -1;
-
-                    current = -1;
-
-                    selected = false;
-
-                    done = true;
-
-                    break;
-                }
-
-                selected = false;
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return player;
-}
-
-bool aboutScreen(SDL_Window *window, SDL_Renderer *renderer)
-{
-    auto done = false;
-
-    auto *about = "Critical IF are gamebooks with a difference. The outcomes are not random. Whether you live or die is a matter not of luck, but of judgement.\n\nTo start your adventure simply choose your character. Each character has a unique selection of four skills; these will decide which options are available to you. Also note your Life Points and your possessions.\n\nLife Points are lost each time you are wounded. If you are ever reduced to zero Life Points, you have been killed and the adventure ends. Sometimes you can recover Life Points during your adventure, but you can never have more Life Points than you started with.\n\nYou can carry up to eight possessions at a time. If you are at this limit and find something else you want, drop one of your other possessions to make room for the new item.\n\nConsider your selection of skills. They establish your special strengths, and will help you to role-play your choices during the adventrue. If you arrive at an entry which lists options for more than one of your skills, you can choose which skill to use in that situation.\n\nThat's all you need to know. Now choose your character.";
-
-    auto splash = createImage("images/skulls-vr.png");
-
-    auto text_space = 8;
-
-    auto text = createText(about, FONT_FILE, 18, clrWH, SCREEN_WIDTH * (1.0 - 3 * Margin) - splashw - 2 * text_space);
-
-    // Render the image
-    if (window && renderer && splash && text)
-    {
-        SDL_SetWindowTitle(window, "About the game");
-
-        auto selected = false;
-        auto current = -1;
-        auto font_size = 20;
-        auto about_buttonw = 150;
-        auto about_buttonh = 48;
-        auto about_buttony = (int)(SCREEN_HEIGHT * (1 - Margin) - buttonh);
-
-        std::vector<TextButton> controls = {TextButton(0, "Back", 0, 0, 0, 0, startx, about_buttony, about_buttonw, about_buttonh, Control::Type::BACK)};
-
-        while (!done)
-        {
-            fillWindow(renderer, intDB);
-
-            fitImage(renderer, splash, startx, starty, splashw, text_bounds);
-
-            fillRect(renderer, text->w + 2 * text_space, text->h + 2 * text_space, startx * 2 + splashw, starty, intDB);
-
-            renderText(renderer, text, intDB, startx * 2 + splashw + text_space, starty + text_space, SCREEN_HEIGHT * (1.0 - 2 * Margin) - 2 * text_space, 0);
-
-            renderTextButtons(renderer, controls, FONT_FILE, current, clrWH, intBK, intRD, font_size, TTF_STYLE_NORMAL);
-
-            auto scrollUp = false;
-            auto scrollDown = false;
-            auto hold = false;
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected && current >= 0 && current < controls.size() && controls[current].Type == Control::Type::BACK)
-            {
-                break;
-            }
-        }
-
-        SDL_FreeSurface(splash);
-        SDL_FreeSurface(text);
-
-        text = NULL;
-        splash = NULL;
-    }
-
-    return done;
-}
-
-#if defined(_WIN32) || defined(__arm__) || defined(__APPLE__)
-std::string time_string(long long deserialised)
-{
-    auto epoch = std::chrono::time_point<std::chrono::system_clock>();
-    auto since_epoch = std::chrono::milliseconds(deserialised);
-    std::chrono::system_clock::time_point timestamp = epoch + since_epoch;
-
-    auto in_time_t = std::chrono::system_clock::to_time_t(timestamp);
-
-    std::stringstream ss;
-
-    if (in_time_t >= 0)
-    {
-        ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d %X");
-    }
-
-    return ss.str();
-}
-#else
-std::string time_string(long deserialised)
-{
-    auto epoch = std::chrono::time_point<std::chrono::high_resolution_clock>();
-    auto since_epoch = std::chrono::milliseconds(deserialised);
-    auto timestamp = epoch + since_epoch;
-
-    auto in_time_t = std::chrono::system_clock::to_time_t(timestamp);
-
-    std::stringstream ss;
-
-    ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d %X");
-
-    return ss.str();
-}
-#endif
-
-bool saveGame(Character::Base &player, const char *overwrite)
-{
-    auto seed = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
-
-    std::ostringstream buffer;
-
-#if defined(_WIN32)
-
-    PWSTR path_str;
-
-    SHGetKnownFolderPath(FOLDERID_Documents, KF_FLAG_DEFAULT, NULL, &path_str);
-
-    std::wstring wpath(path_str);
-
-    CoTaskMemFree(path_str);
-
-    std::string save(wpath.length(), ' ');
-
-    std::copy(wpath.begin(), wpath.end(), save.begin());
-
-    save += "/Saved Games/Necklace of Skulls";
-
-    std::string path = save + "/";
-
-#else
-
-    const char *homedir;
-
-    if ((homedir = getenv("HOME")) == NULL)
-    {
-        homedir = getpwuid(getuid())->pw_dir;
-    }
-
-    std::string save = std::string(homedir) + "/Documents/Saved Games/Necklace of Skulls";
-    std::string path = save + "/";
-
-#endif
-
-    fs::create_directories(save);
-
-    if (overwrite != NULL)
-    {
-        buffer << std::string(overwrite);
-    }
-    else
-    {
-        buffer << path << std::to_string(seed) << ".save";
-    }
-
-    nlohmann::json data;
-
-    player.Epoch = seed;
-
-    data["name"] = player.Name;
-    data["description"] = player.Description;
-    data["type"] = player.Type;
-    data["gender"] = player.Gender;
-    data["life"] = player.Life;
-    data["money"] = player.Money;
-    data["itemLimit"] = player.ITEM_LIMIT;
-    data["lifeLimit"] = player.MAX_LIFE_LIMIT;
-    data["skillsLimit"] = player.SKILLS_LIMIT;
-    data["codewords"] = player.Codewords;
-    data["donation"] = player.DONATION;
-    data["isBlessed"] = player.IsBlessed;
-    data["isImmortal"] = player.IsImmortal;
-    data["ritualBallStarted"] = player.RitualBallStarted;
-    data["ticks"] = player.Ticks;
-    data["cross"] = player.Cross;
-    data["epoch"] = player.Epoch;
-
-    auto skills = std::vector<Skill::Type>();
-    auto lostSkills = std::vector<Skill::Type>();
-    auto temporarySkills = std::vector<Skill::Type>();
-
-    for (auto i = 0; i < player.Skills.size(); i++)
-    {
-        skills.push_back(player.Skills[i].Type);
-    }
-
-    for (auto i = 0; i < player.LostSkills.size(); i++)
-    {
-        lostSkills.push_back(player.LostSkills[i].Type);
-    }
-
-    data["skills"] = skills;
-    data["lostSkills"] = lostSkills;
-    data["lostMoney"] = player.LostMoney;
-    data["storyID"] = player.StoryID;
-
-    auto items = std::vector<nlohmann::json>();
-    auto lostItems = std::vector<nlohmann::json>();
-
-    for (auto i = 0; i < player.Items.size(); i++)
-    {
-        nlohmann::json item;
-
-        item.emplace("name", player.Items[i].Name);
-        item.emplace("description", player.Items[i].Description);
-        item.emplace("type", player.Items[i].Type);
-        item.emplace("charge", player.Items[i].Charge);
-
-        items.push_back(item);
-    }
-
-    for (auto i = 0; i < player.LostItems.size(); i++)
-    {
-        nlohmann::json item;
-
-        item.emplace("name", player.LostItems[i].Name);
-        item.emplace("description", player.LostItems[i].Description);
-        item.emplace("type", player.LostItems[i].Type);
-        item.emplace("charge", player.LostItems[i].Charge);
-
-        lostItems.push_back(item);
-    }
-
-    data["lostItems"] = lostItems;
-    data["items"] = items;
-
-    std::string filename = buffer.str();
-
-    std::ofstream file(filename);
-
-    file << data.dump();
-
-    file.close();
-
-    return true;
-}
-
-Character::Base loadGame(std::string file_name)
-{
-    std::ifstream ifs(file_name);
-
-    auto character = Character::Base();
-
-    if (ifs.good())
-    {
-        auto data = nlohmann::json::parse(ifs);
-
-        ifs.close();
-
-        std::string name = std::string(data["name"]);
-
-        std::string description = data["description"];
-
-        auto type = static_cast<Character::Type>((int)data["type"]);
-
-        auto gender = Character::Gender::NONE;
-
-        if (!data["gender"].is_null())
-        {
-            gender = static_cast<Character::Gender>((int)data["gender"]);
-        }
-
-        auto skills = std::vector<Skill::Base>();
-        auto items = std::vector<Item::Base>();
-        auto codewords = std::vector<Codeword::Type>();
-
-        auto lostSkills = std::vector<Skill::Base>();
-        auto lostItems = std::vector<Item::Base>();
-
-        for (auto i = 0; i < (int)data["skills"].size(); i++)
-        {
-            auto skill = static_cast<Skill::Type>((int)data["skills"][i]);
-            auto found = Skill::FIND(Skill::ALL, skill);
-
-            if (found >= 0)
-            {
-                skills.push_back(Skill::ALL[found]);
-            }
-        }
-
-        for (auto i = 0; i < (int)data["lostSkills"].size(); i++)
-        {
-            auto skill = static_cast<Skill::Type>((int)data["lostSkills"][i]);
-            auto found = Skill::FIND(Skill::ALL, skill);
-
-            if (found >= 0)
-            {
-                lostSkills.push_back(Skill::ALL[found]);
-            }
-        }
-
-        for (auto i = 0; i < (int)data["items"].size(); i++)
-        {
-            auto item_name = std::string(data["items"][i]["name"]);
-            auto item_description = std::string(data["items"][i]["description"]);
-            auto item_type = static_cast<Item::Type>((int)data["items"][i]["type"]);
-            auto item_charge = (int)data["items"][i]["charge"];
-
-            items.push_back(Item::Base(item_name.c_str(), item_description.c_str(), item_type, item_charge));
-        }
-
-        for (auto i = 0; i < (int)data["lostItems"].size(); i++)
-        {
-            auto item_name = std::string(data["lostItems"][i]["name"]);
-            auto item_description = std::string(data["lostItems"][i]["description"]);
-            auto item_type = static_cast<Item::Type>((int)data["lostItems"][i]["type"]);
-            auto item_charge = (int)data["lostItems"][i]["charge"];
-
-            lostItems.push_back(Item::Base(item_name.c_str(), item_description.c_str(), item_type, item_charge));
-        }
-
-        for (auto i = 0; i < (int)data["codewords"].size(); i++)
-        {
-            auto codeword = static_cast<Codeword::Type>((int)data["codewords"][i]);
-
-            codewords.push_back(codeword);
-        }
-
-        auto money = (int)data["money"];
-        auto life = (int)data["life"];
-
-        character = Character::Base(name.c_str(), type, description.c_str(), skills, items, codewords, life, money);
-
-        character.LostSkills = lostSkills;
-        character.LostItems = lostItems;
-        character.LostMoney = (int)data["lostMoney"];
-
-        character.ITEM_LIMIT = (int)data["itemLimit"];
-        character.MAX_LIFE_LIMIT = (int)data["lifeLimit"];
-        character.SKILLS_LIMIT = (int)data["skillsLimit"];
-        character.StoryID = (int)data["storyID"];
-
-        character.Ticks = (int)data["ticks"];
-        character.Cross = (int)data["cross"];
-
-        character.IsBlessed = (bool)data["isBlessed"];
-        character.IsImmortal = (bool)data["isImmortal"];
-        character.RitualBallStarted = (bool)data["ritualBallStarted"];
-
-        character.DONATION = (int)data["donation"];
-
-        character.Gender = gender;
-
-        try
-        {
-#if defined(_WIN32) || defined(__arm__)
-            character.Epoch = (long long)(data["epoch"]);
-#else
-            character.Epoch = (long)(data["epoch"]);
-#endif
-        }
-        catch (std::exception &ex)
-        {
-            character.Epoch = 0;
-        }
-    }
-    else
-    {
-        character.StoryID = -1;
-    }
-
-    return character;
-}
-
-std::vector<Button> createFilesList(SDL_Window *window, SDL_Renderer *renderer, std::vector<std::string> list, int start, int last, int limit, bool save_button)
-{
-    auto controls = std::vector<Button>();
-
-    auto text_space = 8;
-
-    if (list.size() > 0)
-    {
-        for (int i = 0; i < last - start; i++)
-        {
-            std::string game_string = "";
-
-            auto index = start + i;
-
-            auto character = loadGame(list[index]);
-
-#if defined(_WIN32) || defined(__arm__)
-            long long epoch_long;
-#else
-            long epoch_long;
-#endif
-
-            if (character.Epoch == 0)
-            {
-                auto epoch = list[index].substr(list[index].find_last_of("/") + 1, list[index].find_last_of(".") - list[index].find_last_of("/") - 1);
-
-#if defined(_WIN32) || defined(__arm__)
-                epoch_long = std::stoull(epoch);
-#else
-                epoch_long = std::stol(epoch);
-#endif
-            }
-            else
-            {
-                epoch_long = character.Epoch;
-            }
-
-            if (character.StoryID != -1)
-            {
-                auto storyID = std::to_string(std::abs(character.StoryID));
-
-                game_string += std::string(4 - std::to_string(index + 1).length(), '0') + std::to_string(index + 1) + ". " + character.Name + "\n";
-                game_string += "Date: " + time_string(epoch_long) + "\n";
-                game_string += "Section " + std::string(4 - storyID.length(), '0') + storyID + ": ";
-                game_string += "Life: " + std::to_string(character.Life);
-                game_string += ", Money: " + std::to_string(character.Money);
-                game_string += ", Items: " + std::to_string(character.Items.size());
-                game_string += ", Codewords: " + std::to_string(character.Codewords.size());
-            }
-
-            auto button = createHeaderButton(window, game_string.c_str(), clrWH, intDB, textwidth - 3 * button_space / 2, 0.125 * SCREEN_HEIGHT, text_space);
-
-            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
-
-            controls.push_back(Button(i, button, i, i, (i > 0 ? i - 1 : i), (i < (last - start) ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
-
-            controls[i].W = button->w;
-
-            controls[i].H = button->h;
-        }
-    }
-
-    auto idx = controls.size();
-
-    if (list.size() > limit)
-    {
-        if (start > 0)
-        {
-            controls.push_back(Button(idx, "icons/up-arrow.png", idx, idx, idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-
-            idx++;
-        }
-
-        if (list.size() - last > 0)
-        {
-            controls.push_back(Button(idx, "icons/down-arrow.png", idx, idx, start > 0 ? idx - 1 : idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx++;
-        }
-    }
-
-    controls.push_back(Button(idx, "icons/open.png", idx, idx + 1, idx > 0 ? idx - 1 : idx, idx, startx, buttony, Control::Type::LOAD));
-
-    if (save_button)
-    {
-        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, idx > 0 ? idx - 1 : idx + 1, idx + 1, startx + gridsize, buttony, Control::Type::SAVE));
-    }
-
-    idx = controls.size();
-
-    controls.push_back(Button(idx, "icons/back-button.png", idx - 1, idx, list.size() > 0 ? (last - start) : idx, idx, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-    return controls;
-}
-
-Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, bool save_botton)
-{
-    auto result = Control::Type::BACK;
-    auto done = false;
-
-    if (window && renderer)
-    {
-#if defined(_WIN32)
-        PWSTR path_str;
-
-        SHGetKnownFolderPath(FOLDERID_Documents, KF_FLAG_DEFAULT, NULL, &path_str);
-
-        std::wstring wpath(path_str);
-
-        CoTaskMemFree(path_str);
-
-        std::string save(wpath.length(), ' ');
-
-        std::copy(wpath.begin(), wpath.end(), save.begin());
-
-        save += "/Saved Games/Necklace of Skulls";
-
-        std::string path = save + "/";
-#else
-        const char *homedir;
-
-        if ((homedir = getenv("HOME")) == NULL)
-        {
-            homedir = getpwuid(getuid())->pw_dir;
-        }
-
-        std::string save = std::string(homedir) + "/Documents/Saved Games/Necklace of Skulls";
-        std::string path = save + "/";
-#endif
-
-        fs::create_directories(save);
-
-        std::vector<std::string> entries;
-
-        SDL_Surface *splash = createImage("images/filler1.png");
-
-        auto saved_games = std::multimap<std::filesystem::file_time_type, std::string, std::greater<std::filesystem::file_time_type>>();
-
-        try
-        {
-            for (const auto &entry : fs::directory_iterator(path))
-            {
-                auto time_stamp = entry.last_write_time();
-
-#if defined(_WIN32) || defined(__arm__)
-                std::string file_name = entry.path().string();
-#else
-                std::string file_name = entry.path();
-#endif
-
-                if (file_name.substr(file_name.find_last_of(".") + 1) == "save")
-                {
-                    saved_games.insert(std::make_pair(time_stamp, file_name));
-                }
-            }
-        }
-        catch (std::exception &ex)
-        {
-            std::cerr << "Unable to read save directory!" << std::endl;
-        }
-
-        for (auto const &entry : saved_games)
-        {
-            entries.push_back(entry.second);
-        }
-
-        auto font_size = 20;
-        auto text_space = 8;
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-        auto box_space = 10;
-        auto offset = 0;
-        auto limit = (text_bounds - text_space) / (boxh + 3 * text_space);
-        auto last = offset + limit;
-
-        if (last > entries.size())
-        {
-            last = entries.size();
-        }
-
-        auto controls = createFilesList(window, renderer, entries, offset, last, limit, save_botton);
-
-        auto current = -1;
-        auto selected = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-        auto scrollSpeed = 1;
-        auto space = 8;
-
-        auto selected_file = -1;
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        while (!done)
-        {
-            last = offset + limit;
-
-            if (last > entries.size())
-            {
-                last = entries.size();
-            }
-
-            SDL_SetWindowTitle(window, "Necklace of Skulls: LOAD/SAVE game");
-
-            // Fill the surface with background color
-            fillWindow(renderer, intWH);
-
-            fitImage(renderer, splash, startx, starty, splashw, text_bounds);
-
-            fillRect(renderer, textwidth, text_bounds, textx, texty, intBE);
-
-            putText(renderer, "SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * boxh + infoh - 1));
-
-            if (selected_file >= 0 && selected_file < entries.size())
-            {
-                std::string game_string = "";
-
-                auto character = loadGame(entries[selected_file]);
-
-#if defined(_WIN32) || defined(__arm__)
-                long long epoch_long;
-#else
-                long epoch_long;
-#endif
-
-                if (character.Epoch > 0)
-                {
-                    epoch_long = character.Epoch;
-                }
-                else
-                {
-                    auto epoch = entries[selected_file].substr(entries[selected_file].find_last_of("/") + 1, entries[selected_file].find_last_of(".") - entries[selected_file].find_last_of("/") - 1);
-
-#if defined(_WIN32) || defined(__arm__)
-                    epoch_long = std::stoull(epoch);
-#else
-                    epoch_long = std::stol(epoch);
-#endif
-                }
-
-                if (character.StoryID != -1)
-                {
-                    auto storyID = std::to_string(std::abs(character.StoryID));
-
-                    game_string = "Date: " + time_string(epoch_long) + "\n";
-                    game_string += std::string(4 - storyID.length(), '0') + storyID + ": " + character.Name;
-                    game_string += "\nLife: " + std::to_string(character.Life);
-                    game_string += " Money: " + std::to_string(character.Money);
-                }
-
-                putText(renderer, game_string.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh);
-            }
-            else
-            {
-                fillRect(renderer, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh, intBE);
-            }
-
-            if (last - offset > 0)
-            {
-                for (auto i = 0; i < last - offset; i++)
-                {
-                    if (offset + i == selected_file)
-                    {
-                        for (auto size = 4; size >= 0; size--)
-                        {
-                            drawRect(renderer, controls[i].W + 2 * text_space - 2 * size, controls[i].H + 2 * text_space - 2 * size, controls[i].X - text_space + size, controls[i].Y - text_space + size, intBK);
-                        }
-                    }
-                }
-            }
-
-            renderButtons(renderer, controls, current, intDB, border_space, border_pts);
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold)
-            {
-                if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
-                {
-                    if (offset > 0)
-                    {
-                        offset -= scrollSpeed;
-
-                        if (offset < 0)
-                        {
-                            offset = 0;
-                        }
-
-                        last = offset + limit;
-
-                        if (last > entries.size())
-                        {
-                            last = entries.size();
-                        }
-
-                        controls = createFilesList(window, renderer, entries, offset, last, limit, save_botton);
-
-                        SDL_Delay(50);
-                    }
-
-                    if (offset <= 0)
-                    {
-                        current = -1;
-
-                        selected = false;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                {
-                    if (entries.size() - last > 0)
-                    {
-                        if (offset < entries.size() - limit)
-                        {
-                            offset += scrollSpeed;
-                        }
-
-                        if (offset > entries.size() - limit)
-                        {
-                            offset = entries.size() - limit;
-                        }
-
-                        last = offset + limit;
-
-                        if (last > entries.size())
-                        {
-                            last = entries.size();
-                        }
-
-                        controls = createFilesList(window, renderer, entries, offset, last, limit, save_botton);
-
-                        SDL_Delay(50);
-
-                        if (offset > 0)
-                        {
-                            if (controls[current].Type != Control::Type::SCROLL_DOWN)
-                            {
-                                current++;
-                            }
-                        }
-                    }
-
-                    if (entries.size() - last <= 0)
-                    {
-                        selected = false;
-
-                        current = -1;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (offset + current == selected_file)
-                    {
-                        selected_file = -1;
-                    }
-                    else
-                    {
-                        selected_file = offset + current;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::LOAD && !hold)
-                {
-                    if (selected_file >= 0 && selected_file < entries.size())
-                    {
-                        player = loadGame(entries[selected_file]);
-
-                        result = Control::Type::LOAD;
-
-                        done = true;
-
-                        break;
-                    }
-                }
-                else if (controls[current].Type == Control::Type::SAVE && !hold)
-                {
-                    if (selected_file != -1)
-                    {
-                        saveGame(player, entries[selected_file].c_str());
-                    }
-                    else
-                    {
-                        saveGame(player, NULL);
-                    }
-
-                    result = Control::Type::SAVE;
-
-                    done = true;
-
-                    break;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    result = Control::Type::BACK;
-
-                    done = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        if (splash)
-        {
-            SDL_FreeSurface(splash);
-
-            splash = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return result;
-}
-
-bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Item::Base mine, Item::Base theirs)
-{
-    auto done = false;
-
-    if (Character::VERIFY_ITEMS(player, {mine.Type}))
-    {
-        const char *message = NULL;
-
-        auto error = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto font_size = 20;
-        auto text_space = 8;
-        auto box_space = 10;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
-
-        auto controls = std::vector<Button>();
-
-        auto idx = 0;
-
-        controls.push_back(Button(idx, "icons/yes.png", idx, idx + 1, idx, idx, startx, buttony, Control::Type::ACTION));
-        controls.push_back(Button(idx + 1, "icons/back-button.png", idx, idx + 1, idx, idx + 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, "Make a Donation");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            if (!error)
-            {
-                putText(renderer, "TRADE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            putText(renderer, "Life", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, (std::to_string(player.Life)).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-            putText(renderer, "Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-            putText(renderer, (std::to_string(player.Money) + std::string(" cacao")).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
-
-            std::string trade_text = "Trade " + std::string(mine.Name) + " for " + std::string(theirs.Name) + "?";
-            putText(renderer, trade_text.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, textwidth, boxh, textx + text_space, texty + text_space);
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    Character::LOSE_ITEMS(player, {mine.Type});
-                    Character::GET_ITEMS(player, {theirs});
-
-                    done = true;
-
-                    current = -1;
-
-                    selected = false;
-
-                    break;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = false;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return done;
-}
-
-bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Control::Type mode)
-{
-    auto shop = mode == Control::Type::BUY ? story->Shop : story->Sell;
-
-    if (shop.size() > 0)
-    {
-        std::string message;
-
-        auto error = false;
-        auto purchased = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto done = false;
-        auto controls = std::vector<Button>();
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
-
-        auto idx = 0;
-
-        for (auto i = shop.begin(); i != shop.end(); i++)
-        {
-            auto item = i->first;
-            auto price = i->second;
-
-            std::string choice = item.Name;
-
-            if (mode == Control::Type::BUY)
-            {
-                if (item.Charge == 0)
-                {
-                    choice += " (destroyed)";
-                }
-            }
-
-            choice += " (" + std::to_string(price) + " cacao)";
-
-            auto text = createText(choice.c_str(), FONT_FILE, 16, clrBK, textwidth + button_space, TTF_STYLE_NORMAL);
-
-            auto y = (idx > 0 ? controls[idx - 1].Y + controls[idx - 1].H + 3 * text_space : texty + 2 * text_space);
-
-            controls.push_back(Button(idx, text, idx, idx, (idx > 0 ? idx - 1 : idx), (idx < shop.size() ? idx + 1 : idx), textx + 2 * text_space, y, Control::Type::ACTION));
-
-            controls[idx].W = textwidth + button_space;
-
-            controls[idx].H = text->h;
-
-            idx++;
-        }
-
-        controls.push_back(Button(idx, "icons/items.png", idx - 1, idx + 1, idx - 1, idx + 1, startx, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 1, "icons/back-button.png", idx, idx + 1, idx - 1, idx + 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto box_space = 10;
-
-        while (!done)
-        {
-            if (story->Title)
-            {
-                SDL_SetWindowTitle(window, story->Title);
-            }
-            else
-            {
-                SDL_SetWindowTitle(window, "Necklace of Skulls: Shop");
-            }
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message.c_str(), font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-            else if (purchased)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    purchased = false;
-                }
-            }
-
-            if (!error && !purchased)
-            {
-                if (mode == Control::Type::BUY)
-                {
-                    putText(renderer, "Select an item to BUY", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    putText(renderer, "You may SELL your items at prices indicated here", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-            }
-
-            putText(renderer, "Possessions", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, (std::to_string(player.Items.size()) + std::string(" item(s)")).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-            putText(renderer, "Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-            putText(renderer, (std::to_string(player.Money) + std::string(" cacao")).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            for (auto i = 0; i < shop.size(); i++)
-            {
-                if (i != current)
-                {
-                    drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                }
-            }
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < shop.size())
-                    {
-                        auto element = shop.at(current);
-                        auto item = element.first;
-                        auto price = element.second;
-
-                        if (mode == Control::Type::BUY)
-                        {
-                            if (player.Money >= price)
-                            {
-                                if (Item::IsUnique(item.Type) && Character::VERIFY_ITEMS(player, {item.Type}))
-                                {
-                                    message = "You already have this item!";
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    purchased = false;
-
-                                    error = true;
-                                }
-                                else
-                                {
-                                    Character::GET_ITEMS(player, {item});
-
-                                    player.Money -= price;
-
-                                    while (!Character::VERIFY_POSSESSIONS(player))
-                                    {
-                                        inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
-                                    }
-
-                                    std::string description = item.Name;
-
-                                    if (item.Charge == 0)
-                                    {
-                                        description += " (destroyed)";
-                                    }
-
-                                    message = description + " purchased.";
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    purchased = true;
-
-                                    error = false;
-                                }
-                            }
-                            else
-                            {
-                                message = "You do not have enough cacao to buy that!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                purchased = false;
-
-                                error = true;
-                            }
-                        }
-                        else if (mode == Control::Type::SELL)
-                        {
-                            auto result = Item::FIND_TYPE(player.Items, item.Type);
-
-                            if (result >= 0)
-                            {
-                                message = std::string(item.Name) + " SOLD.";
-
-                                start_ticks = SDL_GetTicks();
-
-                                purchased = true;
-
-                                error = false;
-
-                                Character::GAIN_MONEY(player, price);
-
-                                if (Item::COUNT_TYPES(player.Items, item.Type) > 1)
-                                {
-                                    auto least = Item::FIND_LEAST(player.Items, item.Type);
-
-                                    if (least >= 0)
-                                    {
-                                        player.Items.erase(player.Items.begin() + least);
-                                    }
-                                }
-                                else
-                                {
-                                    Character::LOSE_ITEMS(player, {item.Type});
-                                }
-                            }
-                            else
-                            {
-                                message = "You do not have that item!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                purchased = false;
-
-                                error = true;
-                            }
-                        }
-                    }
-                }
-                else if (controls[current].Type == Control::Type::USE && !hold)
-                {
-                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return false;
-}
-
-bool barterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<std::pair<Item::Base, std::vector<Item::Base>>> Barter)
-{
-    if (Barter.size() > 0)
-    {
-        std::string message;
-
-        auto error = false;
-        auto bartered = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto done = false;
-        auto controls = std::vector<Button>();
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
-
-        auto idx = 0;
-
-        for (auto i = Barter.begin(); i != Barter.end(); i++)
-        {
-            auto item = i->first;
-            auto trade = i->second;
-
-            std::string choice = item.Name;
-
-            auto text = createText(choice.c_str(), FONT_FILE, 16, clrBK, textwidth + button_space, TTF_STYLE_NORMAL);
-
-            auto y = (idx > 0 ? controls[idx - 1].Y + controls[idx - 1].H + 3 * text_space : texty + 2 * text_space);
-
-            controls.push_back(Button(idx, text, idx, idx, (idx > 0 ? idx - 1 : idx), (idx < Barter.size() ? idx + 1 : idx), textx + 2 * text_space, y, Control::Type::ACTION));
-
-            controls[idx].W = textwidth + button_space;
-
-            controls[idx].H = text->h;
-
-            idx++;
-        }
-
-        controls.push_back(Button(idx, "icons/items.png", idx - 1, idx + 1, idx - 1, idx + 1, startx, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 1, "icons/back-button.png", idx, idx + 1, idx - 1, idx + 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto box_space = 10;
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, "Necklace of Skulls: Barter");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message.c_str(), font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-            else if (bartered)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    bartered = false;
-                }
-            }
-
-            if (!error && !bartered)
-            {
-                putText(renderer, "Select an item to BARTER", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            putText(renderer, "Possessions", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, (std::to_string(player.Items.size()) + std::string(" item(s)")).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-            putText(renderer, "Exchange for", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-
-            if (current >= 0 && current < Barter.size())
-            {
-                std::string goods = "";
-
-                for (auto j = 0; j < Barter[current].second.size(); j++)
-                {
-                    if (j > 0)
-                    {
-                        goods += ", ";
-                    }
-
-                    goods += Barter[current].second[j].Name;
-                }
-
-                putText(renderer, goods.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-            }
-            else
-            {
-                fillRect(renderer, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space), intBE);
-            }
-
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            for (auto i = 0; i < Barter.size(); i++)
-            {
-                if (i != current)
-                {
-                    drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                }
-            }
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < Barter.size())
-                    {
-                        auto element = Barter.at(current);
-                        auto item = element.first;
-                        auto goods = element.second;
-
-                        auto result = Item::FIND_TYPE(player.Items, item.Type);
-
-                        if (result >= 0)
-                        {
-                            message = std::string(item.Name) + " BARTERED.";
-
-                            start_ticks = SDL_GetTicks();
-
-                            bartered = true;
-
-                            error = false;
-
-                            if (Item::COUNT_TYPES(player.Items, item.Type) > 1)
-                            {
-                                auto least = Item::FIND_LEAST(player.Items, item.Type);
-
-                                if (least >= 0)
-                                {
-                                    player.Items.erase(player.Items.begin() + least);
-                                }
-                            }
-                            else
-                            {
-                                Character::LOSE_ITEMS(player, {item.Type});
-                            }
-
-                            Character::GET_ITEMS(player, goods);
-                        }
-                        else
-                        {
-                            message = "You do not have that item!";
-
-                            start_ticks = SDL_GetTicks();
-
-                            bartered = false;
-
-                            error = true;
-                        }
-                    }
-                }
-                else if (controls[current].Type == Control::Type::USE && !hold)
-                {
-                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = true;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return false;
-}
-
-bool donateScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player)
-{
-    auto done = false;
-
-    if (player.Money > 0)
-    {
-        const char *message = NULL;
-
-        auto error = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto font_size = 20;
-        auto text_space = 8;
-        auto box_space = 10;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
-
-        auto controls = std::vector<Button>();
-
-        auto idx = 0;
-
-        auto button_plus = createHeaderButton(window, "+", clrWH, intDB, arrow_size, arrow_size, -1);
-        auto button_minus = createHeaderButton(window, "-", clrWH, intDB, arrow_size, arrow_size, -1);
-        auto button_size = 35;
-
-        controls.push_back(Button(idx, button_plus, idx, idx + 1, idx, idx + 2, textx + 2 * text_space, texty + button_size + 2 * box_space, Control::Type::PLUS));
-        controls.push_back(Button(idx + 1, button_minus, idx, idx + 1, idx, idx + 2, textx + 2 * text_space + button_space + arrow_size, texty + button_size + 2 * box_space, Control::Type::MINUS));
-        controls.push_back(Button(idx + 2, "icons/yes.png", idx + 2, idx + 2, idx + 1, idx + 2, startx, buttony, Control::Type::CONFIRM));
-        controls.push_back(Button(idx + 3, "icons/back-button.png", idx + 3, idx + 3, idx, idx + 3, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-        auto donation = 1;
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, "Make a Donation");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            if (!error)
-            {
-                putText(renderer, "Select amount to DONATE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            putText(renderer, "Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, (std::to_string(player.Money) + std::string(" cacao")).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-            putText(renderer, "Life", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-            putText(renderer, (std::to_string(player.Life)).c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
-
-            std::string donation_text = "DONATE " + (std::to_string(donation)) + " cacao";
-            putText(renderer, donation_text.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, textwidth, button_size, textx + text_space, texty + text_space);
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::CONFIRM && !hold)
-                {
-                    player.DONATION = donation;
-
-                    player.Money -= donation;
-
-                    done = true;
-
-                    current = -1;
-
-                    selected = false;
-
-                    break;
-                }
-                else if (controls[current].Type == Control::Type::PLUS && !hold)
-                {
-                    if (donation < player.Money)
-                    {
-                        donation++;
-                    }
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::MINUS && !hold)
-                {
-                    if (donation > 0)
-                    {
-                        donation--;
-                    }
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = false;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    return done;
-}
-
-int eatScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int limit)
-{
-    auto consumed = 0;
-    auto done = false;
-
-    auto filtered_items = std::vector<Item::Base>();
-
-    for (auto i = 0; i < player.Items.size(); i++)
-    {
-        if (Item::VERIFY(items, player.Items[i]))
-        {
-            filtered_items.push_back(player.Items[i]);
-        }
-    }
-
-    if (player.Items.size() > 0 && filtered_items.size() > 0)
-    {
-        const char *message = NULL;
-
-        auto error = false;
-
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
-
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
-
-        auto controls = createItemList(window, renderer, filtered_items, 0, filtered_items.size(), filtered_items.size(), true, true);
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-
-        auto selection = std::vector<int>();
-
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, "Necklace of Skulls");
-
-            fillWindow(renderer, intWH);
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            if (!error)
-            {
-                std::string eat_message = "Select " + std::string((limit > 1) ? "provisions" : "provision") + " to EAT." + (limit > 1 ? (" You can EAT up to " + std::to_string(limit) + " provisions.") : "");
-
-                putText(renderer, eat_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
-
-            std::string eat = "";
-
-            if (selection.size() > 0)
-            {
-                for (auto i = 0; i < selection.size(); i++)
-                {
-                    if (i > 0)
-                    {
-                        eat += ", ";
-                    }
-
-                    eat += filtered_items[selection[i]].Name;
-                }
-            }
-
-            putText(renderer, "SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, selection.size() > 0 ? eat.c_str() : "(None)", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
-
-            for (auto i = 0; i < filtered_items.size(); i++)
-            {
-                if (std::find(selection.begin(), selection.end(), i) != selection.end())
-                {
-                    drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                }
-            }
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < filtered_items.size())
-                    {
-                        if (std::find(selection.begin(), selection.end(), current) != selection.end())
-                        {
-                            selection.erase(std::find(selection.begin(), selection.end(), current));
-                        }
-                        else
-                        {
-                            if (selection.size() < limit)
-                            {
-                                selection.push_back(current);
-                            }
-                        }
-                    }
-
-                    current = -1;
-
-                    selected = false;
-                }
-                else if (controls[current].Type == Control::Type::CONFIRM && !hold)
-                {
-                    for (auto i = 0; i < selection.size(); i++)
-                    {
-                        Character::LOSE_ITEMS(player, {filtered_items[selection[i]].Type});
-                    }
-
-                    consumed = selection.size();
-
-                    current = -1;
-
-                    selected = false;
-
-                    done = true;
-
-                    break;
-                }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
-                {
-                    done = false;
-
-                    break;
-                }
-            }
-        }
-
-        if (font)
-        {
-            TTF_CloseFont(font);
-
-            font = NULL;
-        }
-
-        TTF_Quit();
-    }
-
-    if (filtered_items.size() <= 0)
-    {
-        consumed = -1;
-    }
-
-    return consumed;
-}
-
-bool mapScreen(SDL_Window *window, SDL_Renderer *renderer)
-{
-    auto done = false;
-
-    auto splash = createImage("images/map-one-world.png");
-    auto texture = SDL_CreateTextureFromSurface(renderer, splash);
-    auto background = createImage("images/background.png");
-
-    // Render the image
-    if (window && renderer && splash && texture && background)
-    {
-        SDL_SetWindowTitle(window, "Map: One World");
-
-        auto selected = false;
-        auto current = -1;
-
-        auto marginw = (1.0 - 2.0 * Margin) * SCREEN_WIDTH;
-
-        std::vector<Button> controls = {Button(0, "icons/back-button.png", 0, 0, 0, 0, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK)};
-
-        int offset_x = (marginw - (double)text_bounds / splash->h * splash->w) / 2;
-
-        while (!done)
-        {
-            // Fill the surface with background color
-            fillWindow(renderer, intWH);
-
-            stretchImage(renderer, background, 0, 0, SCREEN_WIDTH, buttony - button_space);
-
-            fitImage(renderer, splash, startx + offset_x, starty, marginw, text_bounds);
-
-            renderButtons(renderer, controls, current, intDB, 8, 4);
-
-            auto scrollUp = false;
-            auto scrollDown = false;
-            auto hold = false;
-
-            if (splash && texture)
-            {
-                auto mousex = 0;
-                auto mousey = 0;
-
-                auto state = SDL_GetMouseState(&mousex, &mousey);
-
-                auto zoomw = (int)(0.40 * (double)(marginw - 2 * offset_x));
-                auto zoomh = (int)(0.40 * (double)text_bounds);
-
-                if (zoomw > zoomh)
-                {
-                    zoomw = zoomh;
-                }
-                else
-                {
-                    zoomh = zoomw;
-                }
-
-                clipValue(zoomw, 0, splash->w);
-                clipValue(zoomh, 0, splash->h);
-
-                auto boundx = (int)((double)text_bounds / splash->h * (double)splash->w);
-
-                if ((mousex >= startx + offset_x) && mousex <= (startx + offset_x + boundx) && mousey >= starty && mousey <= (starty + text_bounds))
-                {
-                    auto scalex = (double)(mousex - (startx + offset_x)) / boundx;
-                    auto scaley = (double)(mousey - starty) / text_bounds;
-
-                    auto centerx = (int)(scalex * (double)splash->w);
-                    auto centery = (int)(scaley * (double)splash->h);
-
-                    clipValue(centerx, zoomw / 2, splash->w - zoomw / 2);
-                    clipValue(centery, zoomh / 2, splash->h - zoomh / 2);
-
-                    if (texture)
-                    {
-                        SDL_Rect src;
-
-                        src.w = zoomw;
-                        src.h = zoomh;
-                        src.x = centerx - zoomw / 2;
-                        src.y = centery - zoomh / 2;
-
-                        SDL_Rect dst;
-
-                        dst.w = zoomw;
-                        dst.h = zoomh;
-                        dst.x = mousex + buttonw / 4;
-                        dst.y = mousey - (buttonh / 4 + zoomh);
-
-                        clipValue(dst.x, buttonw / 4, SCREEN_WIDTH - buttonw / 4 - zoomw);
-                        clipValue(dst.y, buttonh / 4, SCREEN_HEIGHT - buttonh / 4 - zoomh);
-
-                        SDL_RenderCopy(renderer, texture, &src, &dst);
-
-                        drawRect(renderer, dst.w, dst.h, dst.x, dst.y, intBK);
-                    }
-                }
-            }
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected && current >= 0 && current < controls.size() && controls[current].Type == Control::Type::BACK)
-            {
-                break;
-            }
-        }
-
-        SDL_FreeSurface(splash);
-        SDL_DestroyTexture(texture);
-        SDL_FreeSurface(background);
-
-        splash = NULL;
-        texture = NULL;
-        background = NULL;
-    }
-
-    return done;
-}
-
-Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
-{
-    Story::Base *next = &notImplemented;
-
-    auto error = false;
-    const char *message = NULL;
-
-    Uint32 start_ticks = 0;
-    Uint32 duration = 5000;
-
-    auto background = createImage("images/background.png");
-
-    if (renderer && story->Choices.size() > 0)
-    {
-        SDL_Surface *splash = NULL;
-
-        if (story->Image)
-        {
-            splash = createImage(story->Image);
-        }
-
-        auto choices = story->Choices;
-
-        auto selected = false;
-        auto current = -1;
-        auto done = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
-
-        auto controls = std::vector<Button>();
-
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-        auto boxh = 0.125 * SCREEN_HEIGHT;
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto box_space = 10;
-
-        for (int i = 0; i < choices.size(); i++)
-        {
-            auto text = createText(choices[i].Text, FONT_FILE, font_size, clrBK, textwidth - (4 * text_space), TTF_STYLE_NORMAL);
-
-            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
-
-            controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < choices.size() ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
-
-            controls[i].W = textwidth - (4 * text_space);
-
-            controls[i].H = text->h;
-        }
-
-        auto idx = choices.size();
-
-        controls.push_back(Button(idx, "icons/map.png", idx - 1, idx + 1, idx - 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/user.png", idx, idx + 2, idx - 1, idx + 1, startx + gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 2, "icons/items.png", idx + 1, idx + 3, idx - 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 3, "icons/back-button.png", idx + 2, idx + 3, idx - 1, idx + 3, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        TTF_Init();
-
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
-
-        int splash_h = splashw;
-
-        if (splash)
-        {
-            if (splash->w != splashw)
-            {
-                splash_h = (int)((double)splashw / splash->w * splash->h);
-            }
-        }
-
-        while (!done)
-        {
-            if (story->Title)
-            {
-                SDL_SetWindowTitle(window, story->Title);
-            }
-            else
-            {
-                SDL_SetWindowTitle(window, (std::string("Necklace of Skulls: ") + std::string(3 - std::to_string(std::abs(story->ID)).length(), '0') + std::to_string(std::abs(story->ID))).c_str());
-            }
-
-            fillWindow(renderer, intWH);
-
-            if (background)
-            {
-                stretchImage(renderer, background, 0, 0, SCREEN_WIDTH, buttony - button_space);
-            }
-
-            if (splash)
-            {
-                splash_h = fitImage(renderer, splash, startx, starty, splashw, text_bounds);
-            }
-
-            if (!splash || (splash && splash_h < (text_bounds - (boxh + infoh))))
-            {
-                putText(renderer, "Life", font, text_space, clrWH, player.Life > 0 ? intDB : intRD, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-                putText(renderer, (std::to_string(player.Life)).c_str(), font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
-
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-            }
-
-            if (!splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && !player.RitualBallStarted))
-            {
-                putText(renderer, "Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-                putText(renderer, (std::to_string(player.Money) + std::string(" cacao")).c_str(), font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-            }
-
-            if (!splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && player.RitualBallStarted))
-            {
-                putText(renderer, "SCORES", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
-
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-                std::string score_string = "Ticks: " + std::to_string(player.Ticks) + "\nCross: " + std::to_string(player.Cross);
-
-                putText(renderer, score_string.c_str(), font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
-
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-            }
-
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
-                {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else
-                {
-                    error = false;
-                }
-            }
-
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-            fillRect(renderer, textwidth, text_bounds, textx, texty, BE_80);
-
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
-
-            for (auto i = 0; i < story->Choices.size(); i++)
-            {
-                if (i != current)
-                {
-                    drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
-                }
-            }
-
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
-
-            if (selected && current >= 0 && current < controls.size())
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
-                {
-                    if (current >= 0 && current < story->Choices.size())
-                    {
-                        if (story->Choices[current].Type == Choice::Type::NORMAL)
-                        {
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::ITEMS)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_ITEMS(player, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                bool loaded = true;
-                                auto weapons = 0;
-
-                                for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                                {
-                                    // Check if items (weapons) are loaded
-                                    if (Item::VERIFY(player.Items, story->Choices[current].Items[i]))
-                                    {
-                                        weapons++;
-
-                                        loaded = false;
-                                    }
-                                }
-
-                                if (!loaded && weapons > 0)
-                                {
-                                    if (weapons > 1)
-                                    {
-                                        message = "The weapons you are carrying are not loaded!";
-                                    }
-                                    else
-                                    {
-                                        message = "The weapon you are carrying is not loaded!";
-                                    }
-                                }
-                                else
-                                {
-                                    if (story->Choices[current].Items.size() > 1)
-                                    {
-                                        message = "You do not have the required items!";
-                                    }
-                                    else
-                                    {
-                                        message = "You do not have the required item!";
-                                    }
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::ANY_ITEM)
-                        {
-                            if (Character::VERIFY_ITEMS_ANY(player, story->Choices[current].Items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have any of the required items that can be used.";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::CODEWORD)
-                        {
-                            if (Character::VERIFY_CODEWORDS(player, story->Choices[current].Codewords))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have the required codeword(s)!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GET_ITEMS)
-                        {
-                            Character::GET_ITEMS(player, {story->Choices[current].Items});
-
-                            while (!Character::VERIFY_POSSESSIONS(player))
-                            {
-                                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
-                            }
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::TAKE)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            Character::LOSE_ITEMS(player, items);
-
-                            auto finished = false;
-
-                            while (!finished)
-                            {
-                                finished = takeScreen(window, renderer, player, story->Choices[current].Items, story->Choices[current].Value, false);
-                            }
-
-                            while (!Character::VERIFY_POSSESSIONS(player))
-                            {
-                                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
-                            }
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::PAY_WITH)
-                        {
-                            if (story->Choices[current].Items.size() > 0)
-                            {
-                                int count = Item::COUNT_TYPES(player.Items, story->Choices[current].Items[0].Type);
-
-                                if (count >= story->Choices[current].Value)
-                                {
-                                    for (auto i = 0; i < story->Choices[current].Value; i++)
-                                    {
-                                        Character::LOSE_ITEMS(player, {story->Choices[current].Items[0].Type});
-                                    }
-
-                                    next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                    done = true;
-
-                                    break;
-                                }
-                                else
-                                {
-                                    message = "You do not have the enough!";
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    error = true;
-                                }
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SELL)
-                        {
-                            if (story->Choices[current].Items.size() > 0)
-                            {
-                                int count = Item::COUNT_TYPES(player.Items, story->Choices[current].Items[0].Type);
-
-                                if (count > 0)
-                                {
-                                    Character::LOSE_ITEMS(player, {story->Choices[current].Items[0].Type});
-
-                                    Character::GAIN_MONEY(player, story->Choices[current].Value);
-
-                                    next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                    done = true;
-
-                                    break;
-                                }
-                                else
-                                {
-                                    message = "You do not have that!";
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    error = true;
-                                }
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_ITEMS)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_ITEMS(player, items))
-                            {
-                                Character::LOSE_ITEMS(player, items);
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have the required item(s)!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GIVE)
-                        {
-                            if (player.Items.size() >= story->Choices[current].Value)
-                            {
-                                auto limit = player.Items.size() - story->Choices[current].Value;
-
-                                while (player.Items.size() > limit)
-                                {
-                                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::LOSE, limit);
-                                }
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else if (player.Items.size() > 0)
-                            {
-                                Character::LOSE_POSSESSIONS(player);
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else if (player.Items.size() == 0)
-                            {
-                                message = "You do not have anything to give!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::BRIBE)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            loseItems(window, renderer, player, items, story->Choices[current].Value);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GET_CODEWORD)
-                        {
-                            Character::GET_CODEWORDS(player, story->Choices[current].Codewords);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_CODEWORD)
-                        {
-                            Character::REMOVE_CODEWORD(player, story->Choices[current].Codewords[0]);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GIVE_ITEMS)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_ITEMS(player, items))
-                            {
-                                Character::LOSE_ITEMS(player, items);
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have the required item(s)!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_ALL)
-                        {
-                            Character::LOSE_ALL(player);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_MONEY)
-                        {
-                            if (player.Money >= story->Choices[current].Value)
-                            {
-                                player.Money -= story->Choices[current].Value;
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have enough money!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GAIN_MONEY)
-                        {
-                            player.Money += story->Choices[current].Value;
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::MONEY)
-                        {
-                            if (player.Money >= story->Choices[current].Value)
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have enough money!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LIFE)
-                        {
-                            Character::GAIN_LIFE(player, story->Choices[current].Value);
-
-                            if (player.Life > 0)
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-                            }
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::EAT)
-                        {
-                            auto threshold = story->Choices[current].Value;
-
-                            auto consumed = eatScreen(window, renderer, player, story->Choices[current].Items, threshold);
-
-                            if (consumed >= 0)
-                            {
-                                Character::GAIN_LIFE(player, consumed - threshold);
-
-                                if (player.Life > 0)
-                                {
-                                    next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                    done = true;
-
-                                    break;
-                                }
-                                else
-                                {
-                                    message = "You died of hunger! This adventure is now over.";
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    error = true;
-                                }
-                            }
-                            else
-                            {
-                                message = "There is nothing in possessions that you can eat.";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::EAT_HEAL)
-                        {
-                            auto threshold = story->Choices[current].Value;
-
-                            auto consumed = eatScreen(window, renderer, player, story->Choices[current].Items, threshold);
-
-                            if (consumed >= 0)
-                            {
-                                Character::GAIN_LIFE(player, threshold);
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "There is nothing in possessions that you can eat.";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL_ANY)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_SKILL_ANY_ITEMS(player, story->Choices[current].Skill, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    message = "You do not have any of the required item(s) to use with this skill!";
-                                }
-                                else
-                                {
-                                    message = "You do not possess the required skill!";
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL)
-                        {
-                            if (Character::VERIFY_SKILL(player, story->Choices[current].Skill))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    auto result = Character::FIND_SKILL(player, story->Choices[current].Skill);
-
-                                    auto item = player.Skills[result].Requirement;
-
-                                    if (Item::FIND_TYPE(player.Items, item) >= 0)
-                                    {
-                                        message = "The item you are carrying is not loaded!";
-                                    }
-                                    else
-                                    {
-                                        message = "You do not have the required item to use with this skill!";
-                                    }
-                                }
-                                else
-                                {
-                                    message = "You do not possess the required skill!";
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL_ITEM)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::HAS_SKILL(player, story->Choices[current].Skill) && Character::VERIFY_ITEMS(player, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    message = "You do not have the required item!";
-                                }
-                                else
-                                {
-                                    message = "You do not possess the required skill!";
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::DONATE)
-                        {
-                            if (player.Money > 0)
-                            {
-                                auto result = donateScreen(window, renderer, player);
-
-                                if (result)
-                                {
-                                    next = (Story::Base *)findStory(story->Choices[current].Destination);
-                                }
-                                else
-                                {
-                                    next = story;
-                                }
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have any money!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
+                                loaded = false;
                             }
                         }
-                        else if (story->Choices[current].Type == Choice::Type::GIFT)
-                        {
-                            if (player.Items.size() > 0)
-                            {
-                                auto nextID = giftScreen(window, renderer, story, player, story->Choices[current].Gifts, story->Choices[current].Destination);
-
-                                next = (Story::Base *)findStory(nextID);
-
-                                done = true;
 
-                                break;
+                        if (!loaded && weapons > 0)
+                        {
+                            if (weapons > 1)
+                            {
+                                message = "The weapons you are carrying are not loaded!";
                             }
                             else
                             {
-                                message = "You do not have any items to give!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
+                                message = "The weapon you are carrying is not loaded!";
                             }
                         }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_SKILLS)
+                        else
                         {
-                            int limit = story->Choices[current].Value;
-
-                            auto result = loseSkills(window, renderer, player, limit);
-
-                            if (!result)
+                            if (choice.Items.size() > 1)
                             {
-                                continue;
+                                message = "You do not have the required items!";
                             }
                             else
                             {
-                                if (player.Skills.size() <= limit)
-                                {
-                                    auto nextID = story->Choices[current].Destination;
-
-                                    if (nextID != story->ID)
-                                    {
-                                        next = (Story::Base *)findStory(nextID);
-                                    }
-                                    else
-                                    {
-                                        next = story;
-                                    }
-
-                                    done = true;
-
-                                    break;
-                                }
+                                message = "You do not have the required item!";
                             }
                         }
+
+                        runner.Flash(message);
                     }
                 }
-                else if (controls[current].Type == Control::Type::CHARACTER && !hold)
+                else if (choice.Type == Choice::Type::ANY_ITEM)
                 {
-                    characterScreen(window, renderer, player, story);
+                    if (available[current])
+                    {
+                        next = (Story::Base *)findStory(choice.Destination);
 
-                    current = -1;
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have any of the required items that can be used.";
 
-                    selected = false;
+                        runner.Flash(message);
+                    }
                 }
-                else if (controls[current].Type == Control::Type::USE && !hold)
+                else if (choice.Type == Choice::Type::CODEWORD)
                 {
-                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
+                    if (available[current])
+                    {
+                        next = (Story::Base *)findStory(choice.Destination);
 
-                    current = -1;
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have the required codeword(s)!";
 
-                    selected = false;
+                        runner.Flash(message);
+                    }
                 }
-                else if (controls[current].Type == Control::Type::MAP && !hold)
+                else if (choice.Type == Choice::Type::GET_ITEMS)
                 {
-                    mapScreen(window, renderer);
+                    Character::GET_ITEMS(player, {choice.Items});
+
+                    while (!Character::VERIFY_POSSESSIONS(player))
+                    {
+                        inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
+                    }
 
-                    current = -1;
+                    next = (Story::Base *)findStory(choice.Destination);
 
-                    selected = false;
+                    return true;
                 }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
+                else if (choice.Type == Choice::Type::TAKE)
                 {
-                    next = story;
+                    auto items = std::vector<Item::Type>();
 
-                    done = true;
+                    for (auto i = 0; i < choice.Items.size(); i++)
+                    {
+                        items.push_back(choice.Items[i].Type);
+                    }
 
-                    break;
-                }
-            }
-        }
+                    Character::LOSE_ITEMS(player, items);
 
-        if (font)
-        {
-            TTF_CloseFont(font);
+                    auto finished = false;
 
-            font = NULL;
-        }
+                    while (!finished)
+                    {
+                        finished = takeScreen(window, renderer, player, choice.Items, choice.Value, false);
+                    }
 
-        TTF_Quit();
+                    while (!Character::VERIFY_POSSESSIONS(player))
+                    {
+                        inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
+                    }
 
-        if (splash)
-        {
-            SDL_FreeSurface(splash);
+                    next = (Story::Base *)findStory(choice.Destination);
 
-            splash = NULL;
-        }
-    }
+                    return true;
+                }
+                else if (choice.Type == Choice::Type::PAY_WITH)
+                {
+                    if (choice.Items.size() > 0)
+                    {
+                        if (available[current])
+                        {
+                            for (auto i = 0; i < choice.Value; i++)
+                            {
+                                Character::LOSE_ITEMS(player, {choice.Items[0].Type});
+                            }
 
-    if (background)
-    {
-        SDL_FreeSurface(background);
+                            next = (Story::Base *)findStory(choice.Destination);
 
-        background = NULL;
-    }
+                            return true;
+                        }
+                        else
+                        {
+                            message = "You do not have the enough!";
 
-    return next;
-}
+                            runner.Flash(message);
+                        }
+                    }
+                }
+                else if (choice.Type == Choice::Type::SELL)
+                {
+                    if (choice.Items.size() > 0)
+                    {
+                        if (available[current])
+                        {
+                            Character::LOSE_ITEMS(player, {choice.Items[0].Type});
 
-std::vector<Button> createSkillControls(std::vector<Skill::Base> Skills)
-{
-    auto font_size = 20;
-    auto text_space = 8;
-    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+                            Character::GAIN_MONEY(player, choice.Value);
 
-    auto controls = std::vector<Button>();
+                            next = (Story::Base *)findStory(choice.Destination);
 
-    for (auto idx = 0; idx < Skills.size(); idx++)
-    {
-        auto text = createText(Skills[idx].Name, FONT_FILE, font_size, clrBK, textwidth + button_space, TTF_STYLE_NORMAL);
+                            return true;
+                        }
+                        else
+                        {
+                            message = "You do not have that!";
+
+                            runner.Flash(message);
+                        }
+                    }
+                }
+                else if (choice.Type == Choice::Type::LOSE_ITEMS)
+                {
+                    auto items = std::vector<Item::Type>();
 
-        auto y = (idx > 0 ? controls[idx - 1].Y + controls[idx - 1].H + 3 * text_space : texty + 2 * text_space);
+                    for (auto i = 0; i < choice.Items.size(); i++)
+                    {
+                        items.push_back(choice.Items[i].Type);
+                    }
 
-        controls.push_back(Button(idx, text, idx, idx, (idx > 0 ? idx - 1 : idx), (idx < Skills.size() ? idx + 1 : idx), textx + 2 * text_space, y, Control::Type::ACTION));
+                    if (available[current])
+                    {
+                        Character::LOSE_ITEMS(player, items);
 
-        controls[idx].W = textwidth + button_space;
+                        next = (Story::Base *)findStory(choice.Destination);
 
-        controls[idx].H = text->h;
-    }
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have the required item(s)!";
 
-    return controls;
-}
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::GIVE)
+                {
+                    if (player.Items.size() >= choice.Value)
+                    {
+                        auto limit = player.Items.size() - choice.Value;
 
-bool loseSkills(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int limit)
-{
-    auto done = false;
+                        while (player.Items.size() > limit)
+                        {
+                            inventoryScreen(window, renderer, player, story, player.Items, Control::Type::LOSE, limit);
+                        }
 
-    if (player.Skills.size() > limit)
-    {
-        const char *message = NULL;
+                        next = (Story::Base *)findStory(choice.Destination);
 
-        auto error = false;
+                        return true;
+                    }
+                    else if (player.Items.size() > 0)
+                    {
+                        Character::LOSE_POSSESSIONS(player);
 
-        Uint32 start_ticks = 0;
-        Uint32 duration = 3000;
+                        next = (Story::Base *)findStory(choice.Destination);
 
-        auto font_size = 20;
-        auto text_space = 8;
-        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+                        return true;
+                    }
+                    else if (player.Items.size() == 0)
+                    {
+                        message = "You do not have anything to give!";
 
-        auto controls = createSkillControls(player.Skills);
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::BRIBE)
+                {
+                    auto items = std::vector<Item::Type>();
 
-        auto idx = player.Skills.size();
+                    for (auto i = 0; i < choice.Items.size(); i++)
+                    {
+                        items.push_back(choice.Items[i].Type);
+                    }
 
-        controls.push_back(Button(idx, "icons/yes.png", idx - 1, idx + 1, idx - 1, idx, startx, buttony, Control::Type::CONFIRM));
-        controls.push_back(Button(idx + 1, "icons/back-button.png", idx, idx + 1, idx - 1, idx + 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+                    loseItems(window, renderer, player, items, choice.Value);
 
-        TTF_Init();
+                    next = (Story::Base *)findStory(choice.Destination);
 
-        auto font = TTF_OpenFont(FONT_FILE, font_size);
+                    return true;
+                }
+                else if (choice.Type == Choice::Type::GET_CODEWORD)
+                {
+                    Character::GET_CODEWORDS(player, choice.Codewords);
 
-        auto selected = false;
-        auto current = -1;
-        auto quit = false;
-        auto scrollUp = false;
-        auto scrollDown = false;
-        auto hold = false;
+                    next = (Story::Base *)findStory(choice.Destination);
 
-        auto infoh = 0.07 * SCREEN_HEIGHT;
-        auto boxh = 0.125 * SCREEN_HEIGHT;
+                    return true;
+                }
+                else if (choice.Type == Choice::Type::LOSE_CODEWORD)
+                {
+                    Character::REMOVE_CODEWORD(player, choice.Codewords[0]);
 
-        auto selection = std::vector<Skill::Base>();
+                    next = (Story::Base *)findStory(choice.Destination);
 
-        while (!done)
-        {
-            SDL_SetWindowTitle(window, "Necklace of Skulls");
+                    return true;
+                }
+                else if (choice.Type == Choice::Type::GIVE_ITEMS)
+                {
+                    auto items = std::vector<Item::Type>();
+
+                    for (auto i = 0; i < choice.Items.size(); i++)
+                    {
+                        items.push_back(choice.Items[i].Type);
+                    }
+
+                    if (available[current])
+                    {
+                        Character::LOSE_ITEMS(player, items);
 
-            fillWindow(renderer, intWH);
+                        next = (Story::Base *)findStory(choice.Destination);
 
-            if (error)
-            {
-                if ((SDL_GetTicks() - start_ticks) < duration)
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have the required item(s)!";
+
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::LOSE_ALL)
                 {
-                    putText(renderer, message, font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
+                    Character::LOSE_ALL(player);
+
+                    next = (Story::Base *)findStory(choice.Destination);
+
+                    return true;
                 }
-                else
+                else if (choice.Type == Choice::Type::LOSE_MONEY)
                 {
-                    error = false;
+                    if (available[current])
+                    {
+                        player.Money -= choice.Value;
+
+                        next = (Story::Base *)findStory(choice.Destination);
+
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have enough money!";
+
+                        runner.Flash(message);
+                    }
                 }
-            }
+                else if (choice.Type == Choice::Type::GAIN_MONEY)
+                {
+                    player.Money += choice.Value;
 
-            if (!error)
-            {
-                std::string lose_message = "Select " + std::string((player.SKILLS_LIMIT - limit) > 1 ? std::string(std::to_string(player.SKILLS_LIMIT - limit) + " skills") : "a skill") + " to LOSE.";
+                    next = (Story::Base *)findStory(choice.Destination);
 
-                putText(renderer, lose_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-            }
+                    return true;
+                }
+                else if (choice.Type == Choice::Type::MONEY)
+                {
+                    if (available[current])
+                    {
+                        next = (Story::Base *)findStory(choice.Destination);
 
-            std::string to_lose = "";
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have enough money!";
 
-            if (selection.size() > 0)
-            {
-                for (auto i = 0; i < selection.size(); i++)
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::LIFE)
                 {
-                    if (i > 0)
+                    Character::GAIN_LIFE(player, choice.Value);
+
+                    if (player.Life > 0)
                     {
-                        to_lose += ", ";
+                        next = (Story::Base *)findStory(choice.Destination);
                     }
 
-                    to_lose += std::string(selection[i].Name);
+                    return true;
                 }
-            }
+                else if (choice.Type == Choice::Type::EAT)
+                {
+                    auto threshold = choice.Value;
 
-            putText(renderer, "SKILLS", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
-            putText(renderer, selection.size() > 0 ? to_lose.c_str() : "(None)", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
+                    auto consumed = eatScreen(window, renderer, player, choice.Items, threshold);
 
-            fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
+                    if (consumed >= 0)
+                    {
+                        Character::GAIN_LIFE(player, consumed - threshold);
 
-            for (auto i = 0; i < player.Skills.size(); i++)
-            {
-                if (Skill::VERIFY(selection, player.Skills[i]))
-                {
-                    drawRect(renderer, controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
+                        if (player.Life > 0)
+                        {
+                            next = (Story::Base *)findStory(choice.Destination);
+
+                            return true;
+                        }
+                        else
+                        {
+                            message = "You died of hunger! This adventure is now over.";
+
+                            runner.Flash(message);
+                        }
+                    }
+                    else
+                    {
+                        message = "There is nothing in possessions that you can eat.";
+
+                        runner.Flash(message);
+                    }
                 }
-            }
+                else if (choice.Type == Choice::Type::EAT_HEAL)
+                {
+                    auto threshold = choice.Value;
 
-            renderButtons(renderer, controls, current, intDB, text_space, text_space / 2);
+                    auto consumed = eatScreen(window, renderer, player, choice.Items, threshold);
 
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+                    if (consumed >= 0)
+                    {
+                        Character::GAIN_LIFE(player, threshold);
 
-            if (selected)
-            {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
+                        next = (Story::Base *)findStory(choice.Destination);
+
+                        return true;
+                    }
+                    else
+                    {
+                        message = "There is nothing in possessions that you can eat.";
+
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::SKILL_ANY)
                 {
-                    if (current >= 0 && current < player.Skills.size())
+                    if (available[current])
+                    {
+                        next = (Story::Base *)findStory(choice.Destination);
+
+                        return true;
+                    }
+                    else
                     {
-                        if (Skill::VERIFY(selection, player.Skills[current]))
+                        if ((state.Skills & Requirement::Bit(choice.Skill)) != 0)
                         {
-                            Skill::REMOVE(selection, player.Skills[current]);
+                            message = "You do not have any of the required item(s) to use with this skill!";
                         }
                         else
                         {
-                            if (selection.size() < (player.SKILLS_LIMIT - limit))
+                            message = "You do not possess the required skill!";
+                        }
+
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::SKILL)
+                {
+                    if (available[current])
+                    {
+                        next = (Story::Base *)findStory(choice.Destination);
+
+                        return true;
+                    }
+                    else
+                    {
+                        if ((state.Skills & Requirement::Bit(choice.Skill)) != 0)
+                        {
+                            auto result = Character::FIND_SKILL(player, choice.Skill);
+
+                            auto item = player.Skills[result].Requirement;
+
+                            if ((state.Carried & Requirement::Bit(item)) != 0)
                             {
-                                Skill::ADD(selection, player.Skills[current]);
+                                message = "The item you are carrying is not loaded!";
                             }
+                            else
+                            {
+                                message = "You do not have the required item to use with this skill!";
+                            }
+                        }
+                        else
+                        {
+                            message = "You do not possess the required skill!";
                         }
+
+                        runner.Flash(message);
                     }
+                }
+                else if (choice.Type == Choice::Type::SKILL_ITEM)
+                {
+                    if (available[current])
+                    {
+                        next = (Story::Base *)findStory(choice.Destination);
 
-                    current = -1;
+                        return true;
+                    }
+                    else
+                    {
+                        if ((state.Skills & Requirement::Bit(choice.Skill)) != 0)
+                        {
+                            message = "You do not have the required item!";
+                        }
+                        else
+                        {
+                            message = "You do not possess the required skill!";
+                        }
 
-                    selected = false;
+                        runner.Flash(message);
+                    }
                 }
-                else if (controls[current].Type == Control::Type::CONFIRM && !hold)
+                else if (choice.Type == Choice::Type::DONATE)
                 {
-                    if (selection.size() > 0 && ((player.SKILLS_LIMIT - selection.size()) <= limit))
+                    if (available[current])
                     {
-                        auto skills = std::vector<Skill::Type>();
+                        auto result = donateScreen(window, renderer, player);
 
-                        for (auto i = 0; i < selection.size(); i++)
+                        if (result)
+                        {
+                            next = (Story::Base *)findStory(choice.Destination);
+                        }
+                        else
                         {
-                            skills.push_back(selection[i].Type);
+                            next = story;
                         }
 
-                        Character::LOSE_SKILLS(player, skills);
+                        return true;
+                    }
+                    else
+                    {
+                        message = "You do not have any money!";
+
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::GIFT)
+                {
+                    if (available[current])
+                    {
+                        auto nextID = giftScreen(window, renderer, story, player, choice.Gifts, choice.Destination);
 
-                        done = true;
+                        next = (Story::Base *)findStory(nextID);
 
-                        break;
+                        return true;
                     }
                     else
                     {
-                        message = "Please complete your selection";
+                        message = "You do not have any items to give!";
+
+                        runner.Flash(message);
+                    }
+                }
+                else if (choice.Type == Choice::Type::LOSE_SKILLS)
+                {
+                    int limit = choice.Value;
 
-                        start_ticks = SDL_GetTicks();
+                    auto result = loseSkills(window, renderer, player, limit);
 
-                        error = true;
+                    if (!result)
+                    {
+                        return false;
                     }
+                    else
+                    {
+                        if (player.Skills.size() <= limit)
+                        {
+                            auto nextID = choice.Destination;
 
-                    current = -1;
+                            if (nextID != story->ID)
+                            {
+                                next = (Story::Base *)findStory(nextID);
+                            }
+                            else
+                            {
+                                next = story;
+                            }
 
-                    selected = false;
+                            return true;
+                        }
+                    }
+                }
+            }
+            else if (type == Control::Type::CHARACTER || type == Control::Type::USE || type == Control::Type::MAP)
+            {
+                if (type == Control::Type::CHARACTER)
+                {
+                    characterScreen(window, renderer, player, story);
                 }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
+                else if (type == Control::Type::USE)
                 {
-                    done = false;
-
-                    break;
+                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
+                }
+                else
+                {
+                    mapScreen(window, renderer);
                 }
+
+                runner.Current = -1;
+
+                runner.Selected = false;
             }
-        }
+            else if (type == Control::Type::BACK)
+            {
+                next = story;
 
-        if (font)
-        {
-            TTF_CloseFont(font);
+                return true;
+            }
 
-            font = NULL;
-        }
+            return false;
+        };
 
-        TTF_Quit();
+        runner.Run();
     }
 
-    return done;
+    return next;
 }
 
 Story::Base *renderChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
@@ -5829,55 +788,95 @@ void clipValue(int &val, int min, int max)
     }
     if (val > max)
     {
-        val = max;
+        val = max;
+    }
+}
+
+// Width of the section text on the story screen
+int storyTextWidth()
+{
+    return ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * Video.Scaled(8);
+}
+
+// Bake the line breaks of all sections for every supported resolution
+bool bakeLayouts(const char *file)
+{
+    Handle::TTF library;
+
+    InitializeStories();
+
+    for (auto &resolution : Layout::RESOLUTIONS)
+    {
+        Video.Resize(resolution.first, resolution.second);
+
+        Layout::Bake(FONT_FILE, Video.Scaled(20), storyTextWidth());
     }
+
+    return Layout::Save(file);
 }
 
 bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
 {
+    auto screen = Frame::Screen();
+
     auto quit = false;
 
-    auto space = 8;
-    auto font_size = 20;
-    auto text_space = 8;
+    auto space = Video.Scaled(8);
+    auto font_size = Video.Scaled(20);
+    auto text_space = Video.Scaled(8);
+
+    Handle::TTF library;
 
-    TTF_Init();
+    Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
 
-    auto font = TTF_OpenFont(FONT_FILE, font_size);
+    auto font = typeface.get();
 
-    auto messageh = 0.25 * SCREEN_HEIGHT;
     auto infoh = 0.07 * SCREEN_HEIGHT;
     auto boxh = 0.125 * SCREEN_HEIGHT;
-    auto box_space = 10;
+    auto box_space = Video.Scaled(10);
 
-    auto background = createImage("images/background.png");
+    auto background = Handle::Surface(createImage("images/background.png"));
 
-    Character::Base saveCharacter;
+    auto runner = Widget::Runner<>(window, renderer, "Necklace of Skulls");
 
-    std::vector<Button> controls = std::vector<Button>();
+    runner.Space = border_space;
+    runner.Points = border_pts;
+    runner.Duration = 5000;
 
-    while (!quit)
-    {
-        auto flash_message = false;
+    auto &widgets = runner.Widgets;
+
+    auto life_header = widgets.Add<Widget::Label>("Life", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
+    auto life_box = widgets.Add<Widget::Label>("", font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
 
-        auto flash_color = intRD;
+    auto money_header = widgets.Add<Widget::Label>("Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+    auto money_box = widgets.Add<Widget::Label>("", font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
 
-        const char *message = NULL;
+    auto scores_header = widgets.Add<Widget::Label>("SCORES", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+    auto scores_box = widgets.Add<Widget::Label>("", font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
 
-        Uint32 start_ticks = 0;
+    runner.Message = widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+    auto ending_box = widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
 
-        Uint32 duration = 5000;
+    // the text of the section, scrolled by the runner
+    runner.Text = widgets.Add<Widget::Scroll>((SDL_Surface *)NULL, BE_80, space, Video.Scaled(20), textwidth, text_bounds, textx, texty);
+
+    Character::Base saveCharacter;
 
+    while (!quit)
+    {
         player.StoryID = story->ID;
 
+        Replay::Session.Section(story->ID, State::Hash(player));
+
         // capture player state before running the story
         saveCharacter = player;
 
         auto run_once = true;
 
-        SDL_Surface *splash = NULL;
-        SDL_Texture *splashTexture = NULL;
-        SDL_Surface *text = NULL;
+        // released at the end of each section
+        Handle::Surface splash;
+        Handle::Texture splashTexture;
+        Handle::Surface text;
 
         if (run_once)
         {
@@ -5893,13 +892,45 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
             }
 
             story->Event(player);
+
+            Journal::Push(player);
+
+            Telemetry::Push(Telemetry::Kind::SECTION, story->ID, player.Life);
+
+            Soak::Section(player);
+
+            if (story->Type == Story::Type::DOOM)
+            {
+                Telemetry::Push(Telemetry::Kind::DOOM, story->ID);
+            }
+            else if (player.Life <= 0)
+            {
+                Telemetry::Push(Telemetry::Kind::DEATH, story->ID);
+            }
+
+            Memory::Set(Memory::Type::PLAYER, Character::Footprint(player));
+
+            Audio::Play(Audio::Effect::PAGE);
+
+            Audio::Music(story->Music);
+
+            // decode the pictures of the next sections while the player reads this one
+            for (auto &choice : story->Choices)
+            {
+                auto next = (Story::Base *)findStory(choice.Destination);
+
+                if (next && next->Image)
+                {
+                    Decode::Request(next->Image, Decode::Priority::PREFETCH);
+                }
+            }
         }
 
-        int splash_h = 250;
+        int splash_h = Video.Scaled(250);
 
         if (story->Image)
         {
-            splash = createImage(story->Image);
+            splash.reset(createImage(story->Image));
         }
 
         if (splash)
@@ -5909,17 +940,29 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
                 splash_h = (int)((double)splashw / splash->w * splash->h);
             }
 
-            splashTexture = SDL_CreateTextureFromSurface(renderer, splash);
+            splashTexture.reset(Memory::CreateTexture(renderer, splash.get()));
         }
 
         if (story->Text)
         {
-            auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * space;
+            auto textwidth = storyTextWidth();
 
-            text = createText(story->Text, FONT_FILE, font_size, clrBK, textwidth, TTF_STYLE_NORMAL);
+            // line breaks baked by "make layouts", unless the text was changed by the section
+            auto baked = Layout::Find(story->ID, font_size, textwidth, story->Text);
+
+            if (baked)
+            {
+                text.reset(Layout::Render(typeface.get(), story->Text, *baked, clrBK));
+            }
+            else
+            {
+                text.reset(createText(story->Text, FONT_FILE, font_size, clrBK, textwidth, TTF_STYLE_NORMAL));
+            }
         }
 
-        auto compact = (text && text->h <= text_bounds - 2 * text_space) || text == NULL;
+        auto compact = (text && text->h <= text_bounds - 2 * text_space) || !text;
+
+        auto &controls = runner.Controls;
 
         if (story->Controls == Story::Controls::STANDARD)
         {
@@ -5961,490 +1004,303 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
 
         auto trigger_blessing = player.IsBlessed && saveCharacter.Life > player.Life;
 
-        auto bless_text = createText("You have lost some Life Points. Do you wish to use the War God's Blessing?", FONT_FILE, font_size, clrWH, textwidth - 2 * text_space, TTF_STYLE_NORMAL);
-        auto message_x = (SCREEN_WIDTH - textwidth) / 2;
-        auto message_y = (SCREEN_HEIGHT - messageh) / 2;
-
-        auto message_controls = std::vector<Button>();
-        message_controls.push_back(Button(0, "icons/yes.png", 0, 1, 0, 0, message_x + button_space, message_y + messageh - buttonh - button_space, Control::Type::YES));
-        message_controls.push_back(Button(1, "icons/no.png", 0, 1, 1, 1, message_x + textwidth - button_space - buttonw, message_y + messageh - buttonh - button_space, Control::Type::NO));
-
-        // Render the image
-        if (window && renderer)
+        if (story->Title)
+        {
+            runner.Title = story->Title;
+        }
+        else
         {
-            auto scrollSpeed = 20;
-            auto hold = false;
+            runner.Title = std::string("Necklace of Skulls: ") + std::string(3 - std::to_string(std::abs(story->ID)).length(), '0') + std::to_string(std::abs(story->ID));
+        }
 
-            auto selected = false;
-            auto current = -1;
-            auto offset = 0;
+        runner.Text->Text = text.get();
 
-            while (!quit)
-            {
-                if (story->Title)
-                {
-                    SDL_SetWindowTitle(window, story->Title);
-                }
-                else
-                {
-                    SDL_SetWindowTitle(window, (std::string("Necklace of Skulls: ") + std::string(3 - std::to_string(std::abs(story->ID)).length(), '0') + std::to_string(std::abs(story->ID))).c_str());
-                }
+        runner.Text->Offset = 0;
 
-                fillWindow(renderer, intWH);
+        runner.Current = -1;
 
-                // Fill the surface with background
-                stretchImage(renderer, background, 0, 0, SCREEN_WIDTH, buttony - button_space);
+        runner.Selected = false;
 
-                if (splash)
-                {
-                    splash_h = fitImage(renderer, splash, startx, texty, splashw, text_bounds);
-                }
+        runner.Update = [&]() {
+            // Fill the surface with background
+            stretchImage(renderer, background.get(), 0, 0, SCREEN_WIDTH, buttony - button_space);
 
-                if (!splash || (splash && splash_h < (text_bounds - (boxh + infoh))))
-                {
-                    putText(renderer, "Life", font, text_space, clrWH, (player.Life > 0 ? intDB : intRD), TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
+            if (splash)
+            {
+                splash_h = fitImage(renderer, splash.get(), startx, texty, splashw, text_bounds);
+            }
 
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            life_header->Visible = !splash || (splash && splash_h < (text_bounds - (boxh + infoh)));
 
-                    putText(renderer, (std::to_string(player.Life)).c_str(), font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
+            life_box->Visible = life_header->Visible;
 
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-                }
+            money_header->Visible = !splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && !player.RitualBallStarted);
 
-                if (!splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && !player.RitualBallStarted))
-                {
-                    putText(renderer, "Money", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+            money_box->Visible = money_header->Visible;
 
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            scores_header->Visible = !splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && player.RitualBallStarted);
 
-                    putText(renderer, (std::to_string(player.Money) + std::string(" cacao")).c_str(), font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
+            scores_box->Visible = scores_header->Visible;
 
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-                }
+            life_header->Set("Life", player.Life > 0 ? intDB : intRD);
 
-                if (!splash || ((splash && splash_h < text_bounds - (2 * (boxh + infoh) + box_space)) && player.RitualBallStarted))
-                {
-                    putText(renderer, "SCORES", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+            life_box->Set(std::to_string(player.Life));
 
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            money_box->Set(std::to_string(player.Money) + std::string(" cacao"));
 
-                    std::string score_string = "Ticks: " + std::to_string(player.Ticks) + "\nCross: " + std::to_string(player.Cross);
+            scores_box->Set("Ticks: " + std::to_string(player.Ticks) + "\nCross: " + std::to_string(player.Cross));
 
-                    putText(renderer, score_string.c_str(), font, text_space, clrBK, BE_80, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
+            if (story->Type == Story::Type::DOOM)
+            {
+                ending_box->Set("You have failed. This adventure is over.", intRD);
+            }
+            else if (player.Life <= 0)
+            {
+                ending_box->Set("You have died. This adventure is over.", intRD);
+            }
+            else if (story->Type == Story::Type::RESTART)
+            {
+                ending_box->Set("It is time to begin a new adventure.", intLB);
+            }
+            else if (story->Type == Story::Type::GOOD)
+            {
+                ending_box->Set("You have defeated Necklace of Skulls! This adventure is over. Further adventure awaits!", intLB);
+            }
+            else
+            {
+                ending_box->Set("");
+            }
+        };
 
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-                }
+        // zoom into the picture under the mouse
+        runner.Draw = [&]() {
+            if (splash)
+            {
+                auto mousex = 0;
+                auto mousey = 0;
 
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+                auto state = SDL_GetMouseState(&mousex, &mousey);
 
-                fillRect(renderer, textwidth, text_bounds, textx, texty, BE_80);
+                Video.Pixels(mousex, mousey);
 
-                if (story->Text && text)
-                {
-                    renderText(renderer, text, 0, textx + space, texty + space, text_bounds - 2 * space, offset);
-                }
+                auto zoomw = (int)(0.80 * (double)textwidth);
+                auto zoomh = (int)(0.80 * (double)text_bounds);
+
+                clipValue(zoomw, 0, splash->w);
+                clipValue(zoomh, 0, splash->h);
 
-                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+                auto boundx = splashw;
 
-                if (flash_message)
+                if (splash_h == text_bounds)
                 {
-                    if ((SDL_GetTicks() - start_ticks) < duration)
-                    {
-                        putText(renderer, message, font, text_space, clrWH, flash_color, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                    }
-                    else
-                    {
-                        flash_message = false;
-                    }
+                    boundx = (int)((double)splash_h / splash->h * (double)splash->w);
                 }
 
-                auto scrollUp = false;
-                auto scrollDown = false;
-
-                if (splash)
+                if (mousex >= startx && mousex <= (startx + boundx) && mousey >= starty && mousey <= (starty + splash_h))
                 {
-                    auto mousex = 0;
-                    auto mousey = 0;
+                    auto scalex = (double)(mousex - startx) / boundx;
+                    auto scaley = (double)(mousey - starty) / splash_h;
 
-                    auto state = SDL_GetMouseState(&mousex, &mousey);
+                    int centerx = (int)(scalex * (double)splash->w);
+                    int centery = (int)(scaley * (double)splash->h);
 
-                    auto zoomw = (int)(0.80 * (double)textwidth);
-                    auto zoomh = (int)(0.80 * (double)text_bounds);
-
-                    clipValue(zoomw, 0, splash->w);
-                    clipValue(zoomh, 0, splash->h);
-
-                    auto boundx = splashw;
-
-                    if (splash_h == text_bounds)
-                    {
-                        boundx = (int)((double)splash_h / splash->h * (double)splash->w);
-                    }
+                    clipValue(centerx, zoomw / 2, splash->w - zoomw / 2);
+                    clipValue(centery, zoomh / 2, splash->h - zoomh / 2);
 
-                    if (mousex >= startx && mousex <= (startx + boundx) && mousey >= starty && mousey <= (starty + splash_h))
+                    if (splashTexture)
                     {
-                        auto scalex = (double)(mousex - startx) / boundx;
-                        auto scaley = (double)(mousey - starty) / splash_h;
-
-                        int centerx = (int)(scalex * (double)splash->w);
-                        int centery = (int)(scaley * (double)splash->h);
-
-                        clipValue(centerx, zoomw / 2, splash->w - zoomw / 2);
-                        clipValue(centery, zoomh / 2, splash->h - zoomh / 2);
-
-                        if (splashTexture)
-                        {
-                            SDL_Rect src;
+                        SDL_Rect src;
 
-                            src.w = zoomw;
-                            src.h = zoomh;
-                            src.x = centerx - zoomw / 2;
-                            src.y = centery - zoomh / 2;
+                        src.w = zoomw;
+                        src.h = zoomh;
+                        src.x = centerx - zoomw / 2;
+                        src.y = centery - zoomh / 2;
 
-                            SDL_Rect dst;
+                        SDL_Rect dst;
 
-                            dst.w = zoomw;
-                            dst.h = zoomh;
-                            dst.x = (textx + (textwidth - zoomw) / 2);
-                            dst.y = (texty + (text_bounds - zoomh) / 2);
+                        dst.w = zoomw;
+                        dst.h = zoomh;
+                        dst.x = (textx + (textwidth - zoomw) / 2);
+                        dst.y = (texty + (text_bounds - zoomh) / 2);
 
-                            SDL_RenderCopy(renderer, splashTexture, &src, &dst);
-                            drawRect(renderer, dst.w, dst.h, dst.x, dst.y, intBK);
-                        }
+                        SDL_RenderCopy(renderer, splashTexture.get(), &src, &dst);
+                        drawRect(renderer, dst.w, dst.h, dst.x, dst.y, intBK);
                     }
                 }
+            }
+        };
 
-                if (story->Type == Story::Type::DOOM)
-                {
-                    putText(renderer, "You have failed. This adventure is over.", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else if (player.Life <= 0)
-                {
-                    putText(renderer, "You have died. This adventure is over.", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else if (story->Type == Story::Type::RESTART)
-                {
-                    putText(renderer, "It is time to begin a new adventure.", font, text_space, clrWH, intLB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-                else if (story->Type == Story::Type::GOOD)
-                {
-                    putText(renderer, "You have defeated Necklace of Skulls! This adventure is over. Further adventure awaits!", font, text_space, clrWH, intLB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
-                }
-
-                renderButtons(renderer, controls, trigger_blessing ? -1 : current, intDB, border_space, border_pts, (!compact && offset > 0), (!compact && text && offset < (text->h - text_bounds + 2 * space)));
-
-                if (trigger_blessing)
-                {
-                    fillRect(renderer, textwidth, messageh, message_x, message_y, intLB);
-
-                    renderImage(renderer, bless_text, (SCREEN_WIDTH - bless_text->w) / 2, message_y + text_space);
-
-                    renderButtons(renderer, message_controls, current, intWH, border_space, border_pts);
-                }
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::CHARACTER)
+            {
+                characterScreen(window, renderer, player, story);
+            }
+            else if (type == Control::Type::MAP)
+            {
+                mapScreen(window, renderer);
+            }
+            else if (type == Control::Type::USE)
+            {
+                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
+            }
+            else if (type == Control::Type::SHOP || type == Control::Type::SELL)
+            {
+                shopScreen(window, renderer, player, story, type == Control::Type::SHOP ? Control::Type::BUY : Control::Type::SELL);
+            }
+            else if (type == Control::Type::TRADE)
+            {
+                tradeScreen(window, renderer, player, story->Trade.first, story->Trade.second);
+            }
+            else if (type == Control::Type::BARTER)
+            {
+                barterScreen(window, renderer, player, story, story->Barter);
+            }
+            else if (type == Control::Type::GAME)
+            {
+                auto result = gameScreen(window, renderer, saveCharacter, true);
 
-                if (trigger_blessing)
-                {
-                    quit = Input::GetInput(renderer, message_controls, current, selected, scrollUp, scrollDown, hold);
-                }
-                else
+                if (result == Control::Type::SAVE)
                 {
-                    quit = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+                    runner.Flash("Game saved!", intDB);
                 }
-
-                if (!trigger_blessing && ((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold))
+                else if (result == Control::Type::LOAD)
                 {
-                    if (controls[current].Type == Control::Type::SCROLL_UP || (controls[current].Type == Control::Type::SCROLL_UP && hold) || scrollUp)
+                    if (saveCharacter.StoryID >= 0 && saveCharacter.Life > 0)
                     {
-                        if (text)
-                        {
-                            if (offset > 0)
-                            {
-                                offset -= scrollSpeed;
-                            }
+                        player = saveCharacter;
 
-                            if (offset < 0)
-                            {
-                                offset = 0;
-                            }
-                        }
-                    }
-                    else if (controls[current].Type == Control::Type::SCROLL_DOWN || ((controls[current].Type == Control::Type::SCROLL_DOWN && hold) || scrollDown))
-                    {
-                        if (text)
-                        {
-                            if (text->h >= text_bounds - 2 * space)
-                            {
-                                if (offset < text->h - text_bounds + 2 * space)
-                                {
-                                    offset += scrollSpeed;
-                                }
-
-                                if (offset > text->h - text_bounds + 2 * space)
-                                {
-                                    offset = text->h - text_bounds + 2 * space;
-                                }
-                            }
-                        }
-                    }
-                    else if (controls[current].Type == Control::Type::CHARACTER && !hold)
-                    {
-                        characterScreen(window, renderer, player, story);
+                        story = (Story::Base *)findStory(saveCharacter.StoryID);
 
-                        current = -1;
+                        runner.Flash("Game loaded!", intDB);
 
-                        selected = false;
+                        return true;
                     }
-                    else if (controls[current].Type == Control::Type::MAP && !hold)
+                }
+            }
+            else if (type == Control::Type::NEXT)
+            {
+                if (story->LimitSkills > 0)
+                {
+                    if (!loseSkills(window, renderer, player, story->LimitSkills))
                     {
-                        mapScreen(window, renderer);
-
-                        current = -1;
-
-                        selected = false;
+                        return false;
                     }
-                    else if (controls[current].Type == Control::Type::USE && !hold)
-                    {
-                        inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
 
-                        current = -1;
+                    story->LimitSkills = 0;
+                }
 
-                        selected = false;
-                    }
-                    else if ((controls[current].Type == Control::Type::SHOP || controls[current].Type == Control::Type::SELL) && !hold)
+                if (story->Take.size() > 0 && story->Limit > 0)
+                {
+                    if (!takeScreen(window, renderer, player, story->Take, story->Limit, true))
                     {
-                        if (controls[current].Type == Control::Type::SHOP)
-                        {
-                            shopScreen(window, renderer, player, story, Control::Type::BUY);
-                        }
-                        else
-                        {
-                            shopScreen(window, renderer, player, story, Control::Type::SELL);
-                        }
-
-                        current = -1;
-
-                        selected = false;
+                        return false;
                     }
-                    else if (controls[current].Type == Control::Type::TRADE && !hold)
-                    {
-                        tradeScreen(window, renderer, player, story->Trade.first, story->Trade.second);
 
-                        current = -1;
+                    story->Limit = 0;
+                }
 
-                        selected = false;
-                    }
-                    else if (controls[current].Type == Control::Type::BARTER && !hold)
+                if (story->Limit > 0 && story->ToLose.size() > story->Limit)
+                {
+                    while (story->ToLose.size() > story->Limit)
                     {
-                        barterScreen(window, renderer, player, story, story->Barter);
-
-                        current = -1;
-
-                        selected = false;
+                        inventoryScreen(window, renderer, player, story, story->ToLose, Control::Type::LOSE, story->Limit);
                     }
-                    else if (controls[current].Type == Control::Type::GAME && !hold)
-                    {
-                        auto result = gameScreen(window, renderer, saveCharacter, true);
-
-                        if (result == Control::Type::SAVE)
-                        {
-                            message = "Game saved!";
-
-                            start_ticks = SDL_GetTicks();
-
-                            flash_message = true;
-
-                            flash_color = intDB;
-                        }
-                        else if (result == Control::Type::LOAD)
-                        {
-                            if (saveCharacter.StoryID >= 0 && saveCharacter.Life > 0)
-                            {
-                                player = saveCharacter;
-
-                                story = (Story::Base *)findStory(saveCharacter.StoryID);
-
-                                message = "Game loaded!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                flash_message = true;
+                }
 
-                                flash_color = intDB;
+                while (!Character::VERIFY_POSSESSIONS(player))
+                {
+                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
+                }
 
-                                break;
-                            }
-                        }
+                auto next = renderChoices(window, renderer, player, story);
 
-                        current = -1;
+                if (next->ID != story->ID)
+                {
+                    Telemetry::Push(Telemetry::Kind::CHOICE, story->ID, next->ID);
 
-                        selected = false;
-                    }
-                    else if (controls[current].Type == Control::Type::NEXT && !hold)
+                    if (story->Bye)
                     {
-                        if (story->LimitSkills > 0)
-                        {
-                            auto done = loseSkills(window, renderer, player, story->LimitSkills);
-
-                            if (!done)
-                            {
-                                continue;
-                            }
-                            else
-                            {
-                                story->LimitSkills = 0;
-                            }
-                        }
-
-                        if (story->Take.size() > 0 && story->Limit > 0)
-                        {
-                            auto done = takeScreen(window, renderer, player, story->Take, story->Limit, true);
-
-                            if (!done)
-                            {
-                                continue;
-                            }
-                            else
-                            {
-                                story->Limit = 0;
-                            }
-                        }
+                        auto bye = Handle::Surface(createText(story->Bye, FONT_FILE, font_size + Video.Scaled(4), clrBK, (SCREEN_WIDTH * (1.0 - 2.0 * Margin)) - 2 * text_space, TTF_STYLE_NORMAL));
+                        auto forward = Handle::Surface(createImage("icons/next.png"));
 
-                        if (story->Limit > 0 && story->ToLose.size() > story->Limit)
+                        if (bye && forward)
                         {
-                            while (story->ToLose.size() > story->Limit)
-                            {
-                                inventoryScreen(window, renderer, player, story, story->ToLose, Control::Type::LOSE, story->Limit);
-                            }
-                        }
-
-                        while (!Character::VERIFY_POSSESSIONS(player))
-                        {
-                            inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
-                        }
-
-                        current = -1;
-
-                        selected = false;
-
-                        auto next = renderChoices(window, renderer, player, story);
-
-                        if (next->ID != story->ID)
-                        {
-                            if (story->Bye)
-                            {
-                                auto bye = createText(story->Bye, FONT_FILE, font_size + 4, clrBK, (SCREEN_WIDTH * (1.0 - 2.0 * Margin)) - 2 * text_space, TTF_STYLE_NORMAL);
-                                auto forward = createImage("icons/next.png");
-
-                                if (bye && forward)
-                                {
-                                    fillWindow(renderer, intWH);
-
-                                    stretchImage(renderer, background, 0, 0, SCREEN_WIDTH, buttony - button_space);
-
-                                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-                                    fillRect(renderer, (1.0 - 2.0 * Margin) * SCREEN_WIDTH, bye->h + 2 * text_space, startx, ((buttony - button_space) - (bye->h + 2 * text_space)) / 2, BE_80);
+                            fillWindow(renderer, intWH);
 
-                                    renderText(renderer, bye, 0, (SCREEN_WIDTH - bye->w) / 2, ((buttony - button_space) - bye->h) / 2, (buttony - button_space), 0);
+                            stretchImage(renderer, background.get(), 0, 0, SCREEN_WIDTH, buttony - button_space);
 
-                                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+                            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
-                                    renderImage(renderer, forward, SCREEN_WIDTH * (1.0 - Margin) - buttonw - button_space, buttony);
+                            fillRect(renderer, (1.0 - 2.0 * Margin) * SCREEN_WIDTH, bye->h + 2 * text_space, startx, ((buttony - button_space) - (bye->h + 2 * text_space)) / 2, BE_80);
 
-                                    SDL_RenderPresent(renderer);
+                            renderText(renderer, bye.get(), 0, (SCREEN_WIDTH - bye->w) / 2, ((buttony - button_space) - bye->h) / 2, (buttony - button_space), 0);
 
-                                    Input::WaitForNext(renderer);
+                            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-                                    SDL_FreeSurface(bye);
+                            renderImage(renderer, forward.get(), SCREEN_WIDTH * (1.0 - Margin) - buttonw - button_space, buttony);
 
-                                    bye = NULL;
+                            Memory::Draw(renderer);
 
-                                    SDL_FreeSurface(forward);
+                            SDL_RenderPresent(renderer);
 
-                                    forward = NULL;
-                                }
-                            }
-
-                            story = next;
-
-                            break;
-                        }
-                        else if (player.Life <= 0)
-                        {
-                            controls = Story::ExitControls(compact);
+                            Input::WaitForNext(renderer);
                         }
                     }
-                    else if (controls[current].Type == Control::Type::BACK && !hold)
-                    {
-                        quit = true;
-
-                        break;
-                    }
-                }
-                else if (trigger_blessing && (selected && current >= 0 && current < message_controls.size()))
-                {
-                    if (message_controls[current].Type == Control::Type::YES && !hold)
-                    {
-                        player.IsBlessed = false;
-
-                        player.Life = saveCharacter.Life;
 
-                        trigger_blessing = false;
+                    story = next;
 
-                        message = "You used the blessing to RECOVER the LOST Life Points.";
-
-                        start_ticks = SDL_GetTicks();
-
-                        flash_message = true;
+                    return true;
+                }
+                else if (player.Life <= 0)
+                {
+                    Telemetry::Push(Telemetry::Kind::DEATH, story->ID);
 
-                        flash_color = intLB;
-                    }
-                    else
-                    {
-                        trigger_blessing = false;
-                    }
+                    controls = Story::ExitControls(compact);
                 }
             }
-        }
+            else if (type == Control::Type::BACK)
+            {
+                quit = true;
 
-        if (splash)
-        {
-            SDL_FreeSurface(splash);
+                return true;
+            }
 
-            splash = NULL;
-        }
+            // back on this screen from another one
+            runner.Current = -1;
 
-        if (splashTexture)
-        {
-            SDL_DestroyTexture(splashTexture);
+            runner.Selected = false;
 
-            splashTexture = NULL;
-        }
+            return false;
+        };
 
-        if (text)
+        // Render the image
+        if (window && renderer)
         {
-            SDL_FreeSurface(text);
-
-            text = NULL;
-        }
-    }
+            if (trigger_blessing)
+            {
+                auto blessing = Widget::Question("You have lost some Life Points. Do you wish to use the War God's Blessing?", font_size, text_space, textwidth);
 
-    if (background)
-    {
-        SDL_FreeSurface(background);
+                if (runner.Ask(blessing))
+                {
+                    player.IsBlessed = false;
 
-        background = NULL;
-    }
+                    player.Life = saveCharacter.Life;
 
-    if (font)
-    {
-        TTF_CloseFont(font);
+                    runner.Flash("You used the blessing to RECOVER the LOST Life Points.", intLB);
+                }
+            }
 
-        font = NULL;
+            if (runner.Run())
+            {
+                quit = true;
+            }
+        }
+        else
+        {
+            quit = true;
+        }
     }
 
-    TTF_Quit();
-
     return quit;
 }
 
@@ -6452,72 +1308,112 @@ bool storyScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pl
 {
     auto story = (Story::Base *)findStory(id);
 
+    Replay::Session.Character(characterString(player));
+
+    Journal::Begin();
+
     return processStory(window, renderer, player, story);
 }
 
 bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID)
 {
-    auto font_size = 20;
+    auto screen = Frame::Screen();
+
+    auto font_size = Video.Scaled(20);
 
     auto *introduction = "The sole survivor of an expedition brings news of disaster. Your twin brother is lost in the trackless western sierra. Resolving to find out his fate, you leave the safety of your home far behind. Your quest takes you to lost jungle cities, across mountains and seas, and even into the depths of the underworld.\n\nYou will plunge into the eerie world of Mayan myth. You will confront ghosts and gods, bargain for your life against wily demons, find allies and enemies among both the living and the dead. If you are breave enough to survive the dangers of the spirit-haunted western desert, you must still confront the wizard called Necklace of skulls in a deadly contest whose stakes are nothing less than your own soul.";
 
-    auto splash = createImage("images/skulls-cover.png");
+    auto wrap = (int)(SCREEN_WIDTH * (1.0 - 3.0 * Margin) - splashw);
 
-    auto text = createText(introduction, FONT_FILE, font_size, clrWH, SCREEN_WIDTH * (1.0 - 3.0 * Margin) - splashw);
+    SDL_Surface *cover = NULL;
 
-    auto title = "Necklace of Skulls";
+    SDL_Surface *description = NULL;
 
-    InitializeStories();
+    Startup::Run("cover", [&cover]() { cover = createImage("images/skulls-cover.png"); });
 
-    Character::Base Player;
+    Startup::Run("icons", []() { Asset::Preload("icons"); });
 
-    // Render window
-    if (window && renderer && splash && text)
+    auto text_width = storyTextWidth();
+
+    Startup::Run("layouts", [font_size, text_width]() { Layout::Load(Layout::FILE, font_size, text_width); });
+
+    // SDL_ttf is not thread-safe, the text is rasterized here while the workers load the rest
+    Startup::Main("introduction", [&description, introduction, font_size, wrap]() { description = createText(introduction, FONT_FILE, font_size, clrWH, wrap); });
+
+    auto quit = false;
+
+    // placeholder with a progress bar while the stories and the assets are loading
+    while (Startup::Pending() > 0)
     {
-        SDL_SetWindowTitle(window, title);
+        if (renderer)
+        {
+            auto barh = Video.Scaled(8);
 
-        const char *choices[4] = {"New Game", "Load Game", "About", "Exit"};
+            fillWindow(renderer, intDB);
 
-        auto current = -1;
+            fillRect(renderer, (int)(SCREEN_WIDTH * (1.0 - 2.0 * Margin) * Startup::Progress()), barh, startx, (SCREEN_HEIGHT - barh) / 2, intWH);
 
-        auto selected = false;
+            Frame::Present(renderer);
+        }
 
-        auto main_buttonh = 48;
+        SDL_Event event;
 
-        auto controls = createHTextButtons(choices, 4, main_buttonh, startx, SCREEN_HEIGHT * (1.0 - Margin) - main_buttonh);
+        if (Frame::Wait(&event, true) && event.type == SDL_QUIT)
+        {
+            quit = true;
+        }
+    }
 
-        controls[0].Type = Control::Type::NEW;
-        controls[1].Type = Control::Type::LOAD;
-        controls[2].Type = Control::Type::ABOUT;
-        controls[3].Type = Control::Type::QUIT;
+    Startup::Wait();
 
-        auto done = false;
+    auto splash = Handle::Surface(cover);
 
-        auto text_space = 8;
+    auto text = Handle::Surface(description);
 
-        auto first = true;
+    auto title = "Necklace of Skulls";
 
-        while (!done)
-        {
-            // Fill the surface with background
-            fillWindow(renderer, intDB);
+    Character::Base Player;
+
+    if (quit)
+    {
+        return false;
+    }
+
+    // Render window
+    if (window && renderer && splash && text)
+    {
+        const char *choices[4] = {"New Game", "Load Game", "About", "Exit"};
+
+        auto main_buttonh = Video.Scaled(48);
+
+        auto runner = Widget::Runner<TextButton>(window, renderer, title);
 
-            fitImage(renderer, splash, startx, starty, splashw, text_bounds);
+        runner.Controls = createHTextButtons(choices, 4, main_buttonh, startx, SCREEN_HEIGHT * (1.0 - Margin) - main_buttonh);
 
-            fillRect(renderer, text->w + 2 * text_space, text->h + 2 * text_space, startx * 2 + splashw, texty, intDB);
+        runner.Controls[0].Type = Control::Type::NEW;
+        runner.Controls[1].Type = Control::Type::LOAD;
+        runner.Controls[2].Type = Control::Type::ABOUT;
+        runner.Controls[3].Type = Control::Type::QUIT;
 
-            renderText(renderer, text, intDB, startx * 2 + splashw + text_space, starty + text_space, SCREEN_HEIGHT * (1.0 - 2 * Margin) - 2 * text_space, 0);
+        runner.Background = intDB;
 
-            renderTextButtons(renderer, controls, FONT_FILE, current, clrWH, intBK, intRD, font_size, TTF_STYLE_NORMAL);
+        runner.FontSize = font_size;
 
-            auto scrollUp = false;
-            auto scrollDown = false;
-            auto hold = false;
+        auto text_space = Video.Scaled(8);
 
-            Control::Type result;
+        runner.Widgets.Add<Widget::Scroll>(text.get(), intDB, text_space, 0, text->w + 2 * text_space, std::min(text->h + 2 * text_space, (int)(SCREEN_HEIGHT * (1.0 - 2 * Margin))), startx * 2 + splashw, texty);
 
+        auto first = true;
+
+        runner.Update = [&]() {
+            fitImage(renderer, splash.get(), startx, starty, splashw, text_bounds);
+        };
+
+        runner.Draw = [&]() {
             if (first)
             {
+                auto &controls = runner.Controls;
+
                 SDL_Event user_event;
 
                 user_event.type = SDL_MOUSEMOTION;
@@ -6535,113 +1431,382 @@ bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID)
                 SDL_PumpEvents();
 
                 first = false;
-            }
 
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+                Startup::Mark("interactive");
+
+                if (Startup::Report)
+                {
+                    Startup::Print(std::cerr);
+                }
+            }
+        };
 
-            if (selected && current >= 0 && current < controls.size())
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::NEW)
             {
-                switch (controls[current].Type)
+                Player = selectCharacter(window, renderer);
+
+                if (Player.StoryID != -1)
                 {
-                case Control::Type::NEW:
+                    storyScreen(window, renderer, Player, storyID);
+                }
 
-                    Player = selectCharacter(window, renderer);
+                storyID = 0;
+            }
+            else if (type == Control::Type::ABOUT)
+            {
+                aboutScreen(window, renderer);
+            }
+            else if (type == Control::Type::LOAD)
+            {
+                auto result = gameScreen(window, renderer, Player, false);
 
-                    if (Player.StoryID != -1)
+                if (result == Control::Type::LOAD)
+                {
+                    // TODO: add sanity check to the loaded player
+                    if (Player.StoryID >= 0 && Player.Life > 0)
                     {
-                        storyScreen(window, renderer, Player, storyID);
+                        storyScreen(window, renderer, Player, Player.StoryID);
                     }
+                }
+            }
+            else if (type == Control::Type::QUIT)
+            {
+                return true;
+            }
 
-                    current = -1;
+            runner.Current = -1;
 
-                    selected = false;
+            runner.Selected = false;
 
-                    storyID = 0;
+            return false;
+        };
 
-                    break;
+        runner.Run();
+    }
+
+    return false;
+}
 
-                case Control::Type::ABOUT:
+int main(int argc, char **argv)
+{
+    Startup::Begin();
+
+    SDL_Window *window = NULL;
+    SDL_Renderer *renderer = NULL;
 
-                    aboutScreen(window, renderer);
+    auto title = "Necklace of Skulls";
 
-                    current = -1;
+    auto storyID = 0;
 
-                    selected = false;
+    auto story_arg = false;
 
-                    break;
+    auto record = std::string();
+    auto replay = std::string();
 
-                case Control::Type::LOAD:
+    auto memory = false;
 
-                    result = gameScreen(window, renderer, Player, false);
+    auto search = std::string();
 
-                    if (result == Control::Type::LOAD)
-                    {
-                        // TODO: add sanity check to the loaded player
-                        if (Player.StoryID >= 0 && Player.Life > 0)
-                        {
-                            storyScreen(window, renderer, Player, Player.StoryID);
-                        }
-                    }
+    auto jump = false;
 
-                    current = -1;
+    auto telemetry = false;
 
-                    selected = false;
+    auto soak = false;
 
-                    break;
+    // Usage: NecklaceOfSkulls.exe [--resolution WIDTHxHEIGHT] [--fullscreen] [--highdpi] [--record FILE | --replay FILE [--realtime]] [--memory] [--budget NAME=MB] [--mute] [--search WORDS [--jump]] [--startup-report] [--fps N] [--no-vsync] [--frame-report] [--no-image-cache] [--telemetry] [--soak MINUTES [--seed N] [--soak-log FILE]] [--bake-layouts FILE] [--bake-tiles IMAGE] [story]
+    for (auto arg = 1; arg < argc; arg++)
+    {
+        auto option = std::string(argv[arg]);
 
-                case Control::Type::QUIT:
+        if (option == "--fullscreen")
+        {
+            Video.Fullscreen = true;
+        }
+        else if (option == "--highdpi")
+        {
+            Video.HighDPI = true;
+        }
+        else if (option == "--resolution" && arg + 1 < argc)
+        {
+            arg++;
 
-                    done = true;
+            auto width = 0;
+            auto height = 0;
 
-                    break;
+            if (std::sscanf(argv[arg], "%dx%d", &width, &height) == 2 && width > 0 && height > 0)
+            {
+                Video.WindowWidth = width;
+                Video.WindowHeight = height;
+            }
+            else
+            {
+                std::cerr << "Invalid resolution: " << argv[arg] << std::endl;
+            }
+        }
+        else if (option == "--record" && arg + 1 < argc)
+        {
+            arg++;
 
-                default:
+            record = argv[arg];
+        }
+        else if (option == "--replay" && arg + 1 < argc)
+        {
+            arg++;
 
-                    selected = false;
+            replay = argv[arg];
+        }
+        else if (option == "--realtime")
+        {
+            Replay::Session.Realtime = true;
+        }
+        else if (option == "--memory")
+        {
+            // memory overlay (F3) and report on exit
+            memory = true;
 
-                    done = false;
+            Memory::Overlay = true;
+        }
+        else if (option == "--search" && arg + 1 < argc)
+        {
+            arg++;
 
-                    break;
-                }
+            search = argv[arg];
+        }
+        else if (option == "--jump")
+        {
+            // start at the first section found by --search
+            jump = true;
+        }
+        else if (option == "--startup-report")
+        {
+            // time to first frame, time to interactive and loading task times
+            Startup::Report = true;
+        }
+        else if (option == "--fps" && arg + 1 < argc)
+        {
+            arg++;
+
+            // frame cap while animating, 0 leaves the pacing to vsync
+            auto fps = std::atoi(argv[arg]);
+
+            if (fps >= 0)
+            {
+                Frame::Cap = fps;
+            }
+            else
+            {
+                std::cerr << "Invalid frame rate: " << argv[arg] << std::endl;
+            }
+        }
+        else if (option == "--no-vsync")
+        {
+            Frame::VSync = false;
+        }
+        else if (option == "--frame-report")
+        {
+            // frames presented and CPU utilization on exit
+            Frame::Report = true;
+        }
+        else if (option == "--no-image-cache")
+        {
+            // decode every image from its PNG
+            Cache::Enabled = false;
+        }
+        else if (option == "--telemetry")
+        {
+            // log sections, choices, deaths and trades for TelemetryHeatmap.exe
+            telemetry = true;
+        }
+        else if (option == "--soak" && arg + 1 < argc)
+        {
+            arg++;
+
+            // random walk through the game under the dummy video driver, fails if memory or files keep growing
+            Soak::Minutes = std::atof(argv[arg]);
+
+            soak = Soak::Minutes > 0;
+
+            if (!soak)
+            {
+                std::cerr << "Invalid soak duration: " << argv[arg] << std::endl;
+            }
+        }
+        else if (option == "--seed" && arg + 1 < argc)
+        {
+            arg++;
+
+            Soak::Seed = (unsigned int)std::strtoul(argv[arg], NULL, 10);
+        }
+        else if (option == "--soak-log" && arg + 1 < argc)
+        {
+            arg++;
+
+            Soak::Log = argv[arg];
+        }
+        else if (option == "--bake-layouts" && arg + 1 < argc)
+        {
+            arg++;
+
+            // offline step of "make layouts"
+            if (!bakeLayouts(argv[arg]))
+            {
+                std::cerr << "Unable to write layouts to " << argv[arg] << std::endl;
+
+                return 1;
             }
 
-            SDL_SetWindowTitle(window, title);
+            return 0;
+        }
+        else if (option == "--bake-tiles" && arg + 1 < argc)
+        {
+            arg++;
+
+            // offline step of "make tiles"
+            auto directory = std::string(Tiles::DIRECTORY) + "/" + fs::path(argv[arg]).stem().string();
+
+            return Tiles::Bake(argv[arg], directory) ? 0 : 1;
         }
+        else if (option == "--mute")
+        {
+            Audio::Mute = true;
+        }
+        else if (option == "--budget" && arg + 1 < argc)
+        {
+            arg++;
 
-        SDL_FreeSurface(splash);
-        SDL_FreeSurface(text);
+            if (!Memory::Budget(argv[arg]))
+            {
+                std::cerr << "Invalid memory budget: " << argv[arg] << std::endl;
+            }
+        }
+        else
+        {
+            storyID = std::atoi(argv[arg]);
 
-        splash = NULL;
-        text = NULL;
+            story_arg = true;
+        }
     }
 
-    return false;
-}
+    if (search.length() > 0)
+    {
+        InitializeStories();
 
-int main(int argc, char **argv)
-{
-    SDL_Window *window = NULL;
-    SDL_Renderer *renderer = NULL;
+        Search::Build();
 
-    auto title = "Necklace of Skulls";
+        auto start = std::chrono::steady_clock::now();
+
+        auto found = Search::Find(search);
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        for (auto id : found)
+        {
+            auto story = (Story::Base *)findStory(id);
+
+            std::cout << id << "\t" << (story->Title ? story->Title : "") << std::endl;
+        }
+
+        std::cerr << found.size() << " section(s) found in " << elapsed << " us (" << Search::Words() << " words indexed)" << std::endl;
+
+        if (!jump || found.empty())
+        {
+            return found.empty() ? 1 : 0;
+        }
+
+        storyID = found[0];
+
+        story_arg = true;
+    }
+
+    if (replay.length() > 0 && Replay::Session.Load(replay))
+    {
+        // recreate the recorded session
+        if (Video.WindowWidth == 0 && Video.WindowHeight == 0 && !Video.HighDPI)
+        {
+            Video.WindowWidth = Replay::Session.Width;
+            Video.WindowHeight = Replay::Session.Height;
+        }
+
+        if (!story_arg)
+        {
+            storyID = Replay::Session.Story;
+        }
+    }
+    else if (record.length() > 0)
+    {
+        Replay::Session.Create(record);
+    }
+
+    if (soak)
+    {
+        Soak::Start();
+    }
+
+    // the stories do not need SDL and load while the window is being created
+    if (search.length() == 0)
+    {
+        Startup::Run("stories", InitializeStories);
+    }
+
+    // decoded images kept by earlier runs
+    Cache::Open();
 
     createWindow(SDL_INIT_VIDEO, &window, &renderer, title, "icons/maya.png");
 
+    Startup::Mark("window");
+
+    // show the window right away
+    if (renderer)
+    {
+        fillWindow(renderer, intDB);
+
+        SDL_RenderPresent(renderer);
+    }
+
+    Startup::Mark("first frame");
+
+    Decode::Start();
+
     auto numGamePads = Input::InitializeGamePads();
 
-    auto quit = false;
+    // falls back to silence when there is no audio device
+    Audio::Initialize();
 
-    auto storyID = 0;
+    Replay::Session.Start(storyID);
+
+    // autosave (not while replaying or soaking, so as not to overwrite the player's autosave)
+    if (!Replay::Session.Replaying() && !Soak::Active)
+    {
+        auto save = savePath();
+
+        std::error_code error;
+
+        fs::create_directories(save, error);
+
+        if (Journal::Recover(save))
+        {
+            std::cerr << "Recovered the last session into " << save << "/" << Journal::SNAPSHOT << std::endl;
+        }
 
-    if (argc > 1)
+        Journal::Start(save);
+    }
+
+    if (telemetry)
     {
-        storyID = std::atoi(argv[1]);
+        Telemetry::Start(savePath() + "/" + Telemetry::DIRECTORY);
     }
 
+    auto quit = false;
+
     if (window)
     {
         quit = mainScreen(window, renderer, storyID);
 
+        Textures::Clear();
+
+        Memory::Discard();
+
         // Destroy window and renderer
         SDL_DestroyRenderer(renderer);
 
@@ -6652,10 +1817,44 @@ int main(int argc, char **argv)
         window = NULL;
     }
 
+    // the loading tasks are normally joined by mainScreen
+    Startup::Wait();
+
+    Journal::Stop();
+
+    Telemetry::Stop();
+
+    Replay::Session.Close();
+
+    Audio::Shutdown();
+
+    Decode::Stop();
+
+    if (memory || Memory::Exceeded())
+    {
+        Memory::Report(std::cerr);
+    }
+
+    if (Frame::Report)
+    {
+        Frame::Print(std::cerr);
+    }
+
+    Asset::Clear();
+
+    Widget::ListRows.Clear();
+
+    Widget::TextRows.Clear();
+
     // Quit SDL subsystems
     IMG_Quit();
 
     SDL_Quit();
 
+    if (Soak::Active)
+    {
+        return Soak::Finish(std::cerr);
+    }
+
     return 0;
 }
@@ -0,0 +1,1494 @@
+// Story graph analyzer
+//
+// Extracts the section graph from the story sources without compiling them: choice destinations, the values returned by
+// Continue and Background, destinations patched in Event and gift tables. Reports dangling links (sections that would end
+// up in notImplemented), unreachable sections, cycles and sections that can only be reached with certain codewords.
+//
+// Usage: StoryAnalyzer.exe [story.cpp story000.cpp ...] [--dot story.dot] [--json story.json] [--quiet]
+//
+// Exits with a non-zero status when there are dangling links or sections that are not registered correctly.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace Analyzer
+{
+    enum class Token
+    {
+        IDENT = 0,
+        NUMBER,
+        STRING,
+        PUNCT
+    };
+
+    class Lexeme
+    {
+    public:
+        Analyzer::Token Type = Analyzer::Token::PUNCT;
+
+        std::string Text = "";
+
+        // Source range and line
+        size_t Begin = 0;
+        size_t End = 0;
+
+        int Line = 0;
+
+        bool Is(const char *text)
+        {
+            return Type != Analyzer::Token::STRING && Text == text;
+        }
+    };
+
+    class Edge
+    {
+    public:
+        int From = -1;
+
+        int To = -1;
+
+        // choice, continue, background, event, gift
+        std::string Kind = "";
+
+        // Requirements on the choice and conditions of the enclosing if/else blocks
+        std::vector<std::string> Conditions = std::vector<std::string>();
+
+        // Codewords that must be present for this edge to be taken
+        std::vector<std::string> Codewords = std::vector<std::string>();
+
+        std::string File = "";
+
+        int Line = 0;
+    };
+
+    class Section
+    {
+    public:
+        int ID = -1;
+
+        std::string Class = "";
+
+        std::string File = "";
+
+        int Line = 0;
+
+        // Section ends the game (GOOD, DOOM or RESTART)
+        bool Ending = false;
+
+        // Codewords given to the player in this section
+        std::vector<std::string> Grants = std::vector<std::string>();
+
+        std::vector<Analyzer::Edge> Edges = std::vector<Analyzer::Edge>();
+
+        // Return values that are not literals and could not be resolved
+        std::vector<int> Unresolved = std::vector<int>();
+    };
+
+    bool IsIdent(char c)
+    {
+        return std::isalnum((unsigned char)c) || c == '_';
+    }
+
+    std::vector<Analyzer::Lexeme> Tokenize(const std::string &source)
+    {
+        auto tokens = std::vector<Analyzer::Lexeme>();
+
+        auto line = 1;
+
+        size_t i = 0;
+
+        while (i < source.length())
+        {
+            auto c = source[i];
+
+            if (c == '\n')
+            {
+                line++;
+
+                i++;
+            }
+            else if (std::isspace((unsigned char)c))
+            {
+                i++;
+            }
+            else if (c == '/' && i + 1 < source.length() && source[i + 1] == '/')
+            {
+                while (i < source.length() && source[i] != '\n')
+                {
+                    i++;
+                }
+            }
+            else if (c == '/' && i + 1 < source.length() && source[i + 1] == '*')
+            {
+                i += 2;
+
+                while (i + 1 < source.length() && !(source[i] == '*' && source[i + 1] == '/'))
+                {
+                    if (source[i] == '\n')
+                    {
+                        line++;
+                    }
+
+                    i++;
+                }
+
+                i += 2;
+            }
+            else if (c == '#')
+            {
+                // preprocessor directives
+                while (i < source.length() && source[i] != '\n')
+                {
+                    i++;
+                }
+            }
+            else if (c == '"' || c == '\'')
+            {
+                Analyzer::Lexeme token;
+
+                token.Type = Analyzer::Token::STRING;
+                token.Begin = i;
+                token.Line = line;
+
+                i++;
+
+                while (i < source.length() && source[i] != c)
+                {
+                    if (source[i] == '\\')
+                    {
+                        i++;
+                    }
+                    else if (source[i] == '\n')
+                    {
+                        line++;
+                    }
+
+                    i++;
+                }
+
+                i++;
+
+                token.End = i;
+
+                tokens.push_back(token);
+            }
+            else if (std::isdigit((unsigned char)c))
+            {
+                Analyzer::Lexeme token;
+
+                token.Type = Analyzer::Token::NUMBER;
+                token.Begin = i;
+                token.Line = line;
+
+                while (i < source.length() && (IsIdent(source[i]) || source[i] == '.'))
+                {
+                    i++;
+                }
+
+                token.End = i;
+                token.Text = source.substr(token.Begin, token.End - token.Begin);
+
+                tokens.push_back(token);
+            }
+            else if (IsIdent(c))
+            {
+                Analyzer::Lexeme token;
+
+                token.Type = Analyzer::Token::IDENT;
+                token.Begin = i;
+                token.Line = line;
+
+                // qualified names (e.g. Codeword::Type::ANGEL) are kept as a single identifier
+                while (i < source.length() && (IsIdent(source[i]) || (source[i] == ':' && i + 2 < source.length() && source[i + 1] == ':' && IsIdent(source[i + 2]))))
+                {
+                    i += (source[i] == ':') ? 2 : 1;
+                }
+
+                token.End = i;
+                token.Text = source.substr(token.Begin, token.End - token.Begin);
+
+                tokens.push_back(token);
+            }
+            else
+            {
+                Analyzer::Lexeme token;
+
+                token.Type = Analyzer::Token::PUNCT;
+                token.Begin = i;
+                token.End = i + 1;
+                token.Line = line;
+                token.Text = std::string(1, c);
+
+                tokens.push_back(token);
+
+                i++;
+            }
+        }
+
+        return tokens;
+    }
+
+    // Index of the token that closes the bracket at tokens[open]
+    size_t Match(std::vector<Analyzer::Lexeme> &tokens, size_t open)
+    {
+        auto opening = tokens[open].Text;
+        auto closing = opening == "(" ? ")" : (opening == "{" ? "}" : "]");
+
+        auto depth = 0;
+
+        for (auto i = open; i < tokens.size(); i++)
+        {
+            if (tokens[i].Type == Analyzer::Token::PUNCT)
+            {
+                if (tokens[i].Text == opening)
+                {
+                    depth++;
+                }
+                else if (tokens[i].Text == closing)
+                {
+                    depth--;
+
+                    if (depth == 0)
+                    {
+                        return i;
+                    }
+                }
+            }
+        }
+
+        return tokens.size();
+    }
+
+    // Source text of tokens [begin, end] with whitespace collapsed
+    std::string Text(const std::string &source, std::vector<Analyzer::Lexeme> &tokens, size_t begin, size_t end)
+    {
+        auto text = std::string();
+
+        if (begin <= end && end < tokens.size())
+        {
+            auto raw = source.substr(tokens[begin].Begin, tokens[end].End - tokens[begin].Begin);
+
+            auto space = false;
+
+            for (auto c : raw)
+            {
+                if (std::isspace((unsigned char)c))
+                {
+                    space = true;
+                }
+                else
+                {
+                    if (space && text.length() > 0)
+                    {
+                        text += ' ';
+                    }
+
+                    text += c;
+
+                    space = false;
+                }
+            }
+        }
+
+        return text;
+    }
+
+    // Split the arguments of the call whose '(' is at tokens[open] into [begin, end] token ranges
+    std::vector<std::pair<size_t, size_t>> Arguments(std::vector<Analyzer::Lexeme> &tokens, size_t open, size_t close)
+    {
+        auto arguments = std::vector<std::pair<size_t, size_t>>();
+
+        auto depth = 0;
+
+        auto begin = open + 1;
+
+        for (auto i = open + 1; i < close; i++)
+        {
+            auto &token = tokens[i];
+
+            if (token.Type == Analyzer::Token::PUNCT)
+            {
+                if (token.Text == "(" || token.Text == "{" || token.Text == "[")
+                {
+                    depth++;
+                }
+                else if (token.Text == ")" || token.Text == "}" || token.Text == "]")
+                {
+                    depth--;
+                }
+                else if (token.Text == "," && depth == 0)
+                {
+                    arguments.push_back({begin, i - 1});
+
+                    begin = i + 1;
+                }
+            }
+        }
+
+        if (begin < close)
+        {
+            arguments.push_back({begin, close - 1});
+        }
+
+        return arguments;
+    }
+
+    // Integer literal (optionally negative) spanning tokens [begin, end], returns false if it is anything else
+    bool Literal(std::vector<Analyzer::Lexeme> &tokens, size_t begin, size_t end, int &value)
+    {
+        if (begin == end && tokens[begin].Type == Analyzer::Token::NUMBER)
+        {
+            value = std::atoi(tokens[begin].Text.c_str());
+
+            return true;
+        }
+        else if (begin + 1 == end && tokens[begin].Is("-") && tokens[end].Type == Analyzer::Token::NUMBER)
+        {
+            value = -std::atoi(tokens[end].Text.c_str());
+
+            return true;
+        }
+
+        return false;
+    }
+
+    std::string Suffix(const std::string &name)
+    {
+        auto pos = name.rfind("::");
+
+        return pos == std::string::npos ? name : name.substr(pos + 2);
+    }
+
+    // Codewords a condition requires, i.e. VERIFY_CODEWORDS calls that are not negated. Disjunctions do not require anything.
+    std::vector<std::string> Required(std::vector<Analyzer::Lexeme> &tokens, size_t begin, size_t end)
+    {
+        auto codewords = std::vector<std::string>();
+
+        for (auto i = begin; i <= end && i < tokens.size(); i++)
+        {
+            if (tokens[i].Is("|"))
+            {
+                return std::vector<std::string>();
+            }
+        }
+
+        for (auto i = begin; i <= end && i < tokens.size(); i++)
+        {
+            if (tokens[i].Type == Analyzer::Token::IDENT && Suffix(tokens[i].Text) == "VERIFY_CODEWORDS" && i + 1 <= end && tokens[i + 1].Is("("))
+            {
+                auto close = Match(tokens, i + 1);
+
+                if (!(i > begin && tokens[i - 1].Is("!")))
+                {
+                    for (auto j = i + 2; j < close; j++)
+                    {
+                        if (tokens[j].Type == Analyzer::Token::IDENT && tokens[j].Text.find("Codeword::") == 0)
+                        {
+                            codewords.push_back(Suffix(tokens[j].Text));
+                        }
+                    }
+                }
+
+                i = close;
+            }
+        }
+
+        return codewords;
+    }
+
+    class Frame
+    {
+    public:
+        std::string Method = "";
+
+        std::vector<std::string> Conditions = std::vector<std::string>();
+
+        std::vector<std::string> Codewords = std::vector<std::string>();
+    };
+
+    class Graph
+    {
+    public:
+        std::map<int, Analyzer::Section> Sections = std::map<int, Analyzer::Section>();
+
+        // Story classes without an ID
+        std::vector<std::string> Anonymous = std::vector<std::string>();
+
+        // Class and line of sections whose ID is used by more than one class
+        std::vector<std::pair<std::string, int>> Redefined = std::vector<std::pair<std::string, int>>();
+
+        // Instance -> class
+        std::map<std::string, std::string> Instances = std::map<std::string, std::string>();
+
+        // Instances in the order they are registered in InitializeStories (or the InitializeStories of each part)
+        std::vector<std::string> Registered = std::vector<std::string>();
+
+        // Source file being parsed
+        std::string File = "";
+
+        // Parse one Story::Base subclass whose body spans tokens (open, close)
+        void Class(const std::string &source, std::vector<Analyzer::Lexeme> &tokens, std::string name, size_t open, size_t close)
+        {
+            Analyzer::Section section;
+
+            section.Class = name;
+            section.File = File;
+            section.Line = tokens[open].Line;
+
+            auto frames = std::vector<Analyzer::Frame>();
+
+            auto candidate = std::string();
+
+            // conditions of the last if/else/loop header, applied to the block that follows
+            auto pending = std::vector<std::string>();
+            auto pending_codewords = std::vector<std::string>();
+            auto has_pending = false;
+
+            // named tables of {item, destination} pairs
+            auto tables = std::map<std::string, std::vector<std::pair<std::string, int>>>();
+
+            auto parens = 0;
+
+            auto has_id = false;
+
+            for (auto i = open + 1; i < close; i++)
+            {
+                auto &token = tokens[i];
+
+                if (token.Type == Analyzer::Token::STRING)
+                {
+                    continue;
+                }
+
+                if (token.Is("("))
+                {
+                    parens++;
+                }
+                else if (token.Is(")"))
+                {
+                    parens--;
+                }
+                else if (token.Is("{"))
+                {
+                    Analyzer::Frame frame;
+
+                    if (frames.empty())
+                    {
+                        frame.Method = candidate;
+                    }
+                    else
+                    {
+                        frame = frames.back();
+
+                        auto &previous = tokens[i - 1];
+
+                        auto block = parens == 0 && (previous.Is(")") || previous.Is("else") || previous.Is("{") || previous.Is("}") || previous.Is(";") || previous.Is("do"));
+
+                        if (block && has_pending)
+                        {
+                            frame.Conditions.insert(frame.Conditions.end(), pending.begin(), pending.end());
+                            frame.Codewords.insert(frame.Codewords.end(), pending_codewords.begin(), pending_codewords.end());
+
+                            has_pending = false;
+                        }
+                    }
+
+                    frames.push_back(frame);
+                }
+                else if (token.Is("}"))
+                {
+                    if (!frames.empty())
+                    {
+                        frames.pop_back();
+                    }
+                }
+                else if (token.Type == Analyzer::Token::IDENT)
+                {
+                    auto next = i + 1 < close ? &tokens[i + 1] : NULL;
+
+                    if (frames.empty())
+                    {
+                        if (next && next->Is("("))
+                        {
+                            candidate = token.Text;
+                        }
+
+                        continue;
+                    }
+
+                    auto &frame = frames.back();
+
+                    if ((token.Is("if") || token.Is("while") || token.Is("switch")) && next && next->Is("("))
+                    {
+                        auto end = Match(tokens, i + 1);
+
+                        pending = {token.Text + " (" + Text(source, tokens, i + 2, end - 1) + ")"};
+                        pending_codewords = token.Is("if") ? Required(tokens, i + 2, end - 1) : std::vector<std::string>();
+                        has_pending = true;
+
+                        i = end;
+                    }
+                    else if (token.Is("for") && next && next->Is("("))
+                    {
+                        auto end = Match(tokens, i + 1);
+
+                        pending = {"for (" + Text(source, tokens, i + 2, end - 1) + ")"};
+                        pending_codewords.clear();
+                        has_pending = true;
+
+                        i = end;
+                    }
+                    else if (token.Is("else"))
+                    {
+                        pending = {"else"};
+                        pending_codewords.clear();
+                        has_pending = true;
+                    }
+                    else if (token.Is("ID") && next && next->Is("=") && frames.size() == 1 && frame.Method == name)
+                    {
+                        auto value = 0;
+
+                        if (i + 2 < close && Literal(tokens, i + 2, tokens[i + 2].Is("-") ? i + 3 : i + 2, value))
+                        {
+                            section.ID = value;
+
+                            has_id = true;
+                        }
+                    }
+                    else if (token.Is("Type") && next && next->Is("=") && !tokens[i - 1].Is(".") && i + 2 < close)
+                    {
+                        auto type = Suffix(tokens[i + 2].Text);
+
+                        if (tokens[i + 2].Text.find("Story::Type::") == 0 && (type == "GOOD" || type == "DOOM" || type == "RESTART"))
+                        {
+                            section.Ending = true;
+                        }
+                    }
+                    else if (Suffix(token.Text) == "GET_CODEWORDS" && next && next->Is("("))
+                    {
+                        auto end = Match(tokens, i + 1);
+
+                        for (auto j = i + 2; j < end; j++)
+                        {
+                            if (tokens[j].Type == Analyzer::Token::IDENT && tokens[j].Text.find("Codeword::") == 0)
+                            {
+                                section.Grants.push_back(Suffix(tokens[j].Text));
+                            }
+                        }
+
+                        i = end;
+                    }
+                    else if (next && next->Is("=") && i + 2 < close && tokens[i + 2].Is("{"))
+                    {
+                        // {item, destination} tables, e.g. gifts
+                        auto end = Match(tokens, i + 2);
+
+                        auto table = std::vector<std::pair<std::string, int>>();
+
+                        for (auto j = i + 3; j + 4 < end; j++)
+                        {
+                            auto value = 0;
+
+                            if (tokens[j].Is("{") && tokens[j + 1].Type == Analyzer::Token::IDENT && tokens[j + 2].Is(",") && Literal(tokens, j + 3, j + 3, value) && tokens[j + 4].Is("}"))
+                            {
+                                table.push_back({Suffix(tokens[j + 1].Text), value});
+                            }
+                        }
+
+                        if (table.size() > 0)
+                        {
+                            tables[token.Text] = table;
+                        }
+                    }
+                    else if (token.Is("Choice::Base") && next && next->Is("("))
+                    {
+                        auto end = Match(tokens, i + 1);
+
+                        auto arguments = Arguments(tokens, i + 1, end);
+
+                        auto destination = 0;
+
+                        if (arguments.size() >= 2 && Literal(tokens, arguments[1].first, arguments[1].second, destination))
+                        {
+                            Analyzer::Edge edge;
+
+                            edge.From = section.ID;
+                            edge.To = destination;
+                            edge.Kind = "choice";
+                            edge.Line = token.Line;
+                            edge.Conditions = frame.Conditions;
+                            edge.Codewords = frame.Codewords;
+
+                            auto codewords = std::vector<std::string>();
+
+                            auto type = std::string("CODEWORD");
+
+                            for (auto a = 2; a < arguments.size(); a++)
+                            {
+                                auto requirement = Text(source, tokens, arguments[a].first, arguments[a].second);
+
+                                if (tables.count(requirement) > 0)
+                                {
+                                    for (auto &gift : tables[requirement])
+                                    {
+                                        Analyzer::Edge gifted = edge;
+
+                                        gifted.To = gift.second;
+                                        gifted.Kind = "gift";
+                                        gifted.Conditions.push_back("give " + gift.first);
+
+                                        section.Edges.push_back(gifted);
+                                    }
+                                }
+
+                                if (tokens[arguments[a].first].Text.find("Choice::Type::") == 0)
+                                {
+                                    type = Suffix(tokens[arguments[a].first].Text);
+                                }
+
+                                for (auto j = arguments[a].first; j <= arguments[a].second; j++)
+                                {
+                                    if (tokens[j].Type == Analyzer::Token::IDENT && tokens[j].Text.find("Codeword::") == 0)
+                                    {
+                                        codewords.push_back(Suffix(tokens[j].Text));
+                                    }
+                                }
+
+                                edge.Conditions.push_back(requirement);
+                            }
+
+                            // only CODEWORD choices require codewords, GET_CODEWORD and LOSE_CODEWORD are effects
+                            if (type == "CODEWORD")
+                            {
+                                edge.Codewords.insert(edge.Codewords.end(), codewords.begin(), codewords.end());
+                            }
+
+                            section.Edges.push_back(edge);
+                        }
+
+                        i = end;
+                    }
+                    else if (token.Is("Destination") && i > 0 && tokens[i - 1].Is(".") && next && next->Is("="))
+                    {
+                        auto value = 0;
+
+                        if (i + 2 < close && Literal(tokens, i + 2, tokens[i + 2].Is("-") ? i + 3 : i + 2, value))
+                        {
+                            Analyzer::Edge edge;
+
+                            edge.From = section.ID;
+                            edge.To = value;
+                            edge.Kind = "event";
+                            edge.Line = token.Line;
+                            edge.Conditions = frame.Conditions;
+                            edge.Codewords = frame.Codewords;
+
+                            section.Edges.push_back(edge);
+                        }
+                    }
+                    else if (token.Is("return") && (frame.Method == "Continue" || frame.Method == "Background"))
+                    {
+                        auto end = i + 1;
+
+                        while (end < close && !tokens[end].Is(";"))
+                        {
+                            end++;
+                        }
+
+                        auto value = 0;
+
+                        if (end > i + 1 && Literal(tokens, i + 1, end - 1, value))
+                        {
+                            // -1 means no jump
+                            if (value >= 0)
+                            {
+                                Analyzer::Edge edge;
+
+                                edge.From = section.ID;
+                                edge.To = value;
+                                edge.Kind = frame.Method == "Continue" ? "continue" : "background";
+                                edge.Line = token.Line;
+                                edge.Conditions = frame.Conditions;
+                                edge.Codewords = frame.Codewords;
+
+                                section.Edges.push_back(edge);
+                            }
+                        }
+                        else
+                        {
+                            section.Unresolved.push_back(token.Line);
+                        }
+
+                        i = end;
+                    }
+                }
+            }
+
+            // edges were created before the ID may have been seen
+            for (auto &edge : section.Edges)
+            {
+                edge.From = section.ID;
+                edge.File = File;
+            }
+
+            if (!has_id)
+            {
+                Anonymous.push_back(name);
+            }
+            else if (section.ID < 0)
+            {
+                // placeholders such as NotImplemented
+            }
+            else if (Sections.count(section.ID) > 0)
+            {
+                Redefined.push_back({name, section.ID});
+            }
+            else
+            {
+                Sections[section.ID] = section;
+            }
+        }
+
+        void Parse(const std::string &source, std::string file)
+        {
+            File = file;
+
+            auto tokens = Tokenize(source);
+
+            for (size_t i = 0; i < tokens.size(); i++)
+            {
+                auto &token = tokens[i];
+
+                if (token.Is("class") && i + 5 < tokens.size() && tokens[i + 2].Is(":") && tokens[i + 3].Is("public") && tokens[i + 4].Is("Story::Base") && tokens[i + 5].Is("{"))
+                {
+                    auto close = Match(tokens, i + 5);
+
+                    Class(source, tokens, tokens[i + 1].Text, i + 5, close);
+
+                    i = close;
+                }
+                else if (token.Is("auto") && i + 5 < tokens.size() && tokens[i + 1].Type == Analyzer::Token::IDENT && tokens[i + 2].Is("=") && tokens[i + 3].Type == Analyzer::Token::IDENT && tokens[i + 4].Is("(") && tokens[i + 5].Is(")"))
+                {
+                    Instances[tokens[i + 1].Text] = tokens[i + 3].Text;
+                }
+                else if (token.Is("Stories") && i + 2 < tokens.size() && ((tokens[i + 1].Is("=") && tokens[i + 2].Is("{")) || (tokens[i + 1].Is(".") && tokens[i + 2].Is("insert"))))
+                {
+                    // Stories = {...} or Stories.insert(Stories.end(), {...})
+                    auto open = i + 2;
+
+                    while (open < tokens.size() && !tokens[open].Is("{"))
+                    {
+                        open++;
+                    }
+
+                    if (open >= tokens.size())
+                    {
+                        break;
+                    }
+
+                    auto close = Match(tokens, open);
+
+                    for (auto j = open + 1; j + 1 < close; j++)
+                    {
+                        if (tokens[j].Is("&") && tokens[j + 1].Type == Analyzer::Token::IDENT)
+                        {
+                            Registered.push_back(tokens[j + 1].Text);
+                        }
+                    }
+
+                    i = close;
+                }
+            }
+        }
+    };
+
+    class Report
+    {
+    public:
+        // IDs that findStory can find
+        std::set<int> Known = std::set<int>();
+
+        // Registration problems (duplicates, mismatched instances, classes never registered)
+        std::vector<std::string> Registration = std::vector<std::string>();
+
+        std::vector<Analyzer::Edge> Dangling = std::vector<Analyzer::Edge>();
+
+        std::vector<int> Unreachable = std::vector<int>();
+
+        // Reachable, but only through edges that require codewords: section -> codewords on its incoming gated edges
+        std::map<int, std::set<std::string>> Gated = std::map<int, std::set<std::string>>();
+
+        // Gated sections that only lead to other gated sections: section -> gated sections linking to it
+        std::map<int, std::set<int>> Via = std::map<int, std::set<int>>();
+
+        // Strongly connected components with more than one section (or a section that links to itself)
+        std::vector<std::vector<int>> Cycles = std::vector<std::vector<int>>();
+
+        // Sections without exits that are not endings
+        std::vector<int> DeadEnds = std::vector<int>();
+
+        std::vector<std::pair<int, int>> Unresolved = std::vector<std::pair<int, int>>();
+    };
+
+    std::set<int> Reach(Analyzer::Graph &graph, std::set<int> &known, int start, bool codewords)
+    {
+        auto visited = std::set<int>();
+
+        auto stack = std::vector<int>();
+
+        if (known.count(start) > 0)
+        {
+            stack.push_back(start);
+
+            visited.insert(start);
+        }
+
+        while (!stack.empty())
+        {
+            auto id = stack.back();
+
+            stack.pop_back();
+
+            for (auto &edge : graph.Sections[id].Edges)
+            {
+                if (known.count(edge.To) > 0 && visited.count(edge.To) == 0 && (codewords || edge.Codewords.empty()))
+                {
+                    visited.insert(edge.To);
+
+                    stack.push_back(edge.To);
+                }
+            }
+        }
+
+        return visited;
+    }
+
+    // Tarjan's strongly connected components (iterative)
+    std::vector<std::vector<int>> Components(Analyzer::Graph &graph, std::set<int> &known)
+    {
+        auto components = std::vector<std::vector<int>>();
+
+        auto index = std::map<int, int>();
+        auto low = std::map<int, int>();
+        auto onstack = std::set<int>();
+        auto stack = std::vector<int>();
+
+        auto counter = 0;
+
+        for (auto root : known)
+        {
+            if (index.count(root) > 0)
+            {
+                continue;
+            }
+
+            // (section, next edge to visit)
+            auto work = std::vector<std::pair<int, size_t>>();
+
+            work.push_back({root, 0});
+
+            index[root] = low[root] = counter++;
+
+            stack.push_back(root);
+
+            onstack.insert(root);
+
+            while (!work.empty())
+            {
+                auto id = work.back().first;
+
+                auto &edges = graph.Sections[id].Edges;
+
+                if (work.back().second < edges.size())
+                {
+                    auto to = edges[work.back().second].To;
+
+                    work.back().second++;
+
+                    if (known.count(to) == 0)
+                    {
+                        continue;
+                    }
+
+                    if (index.count(to) == 0)
+                    {
+                        index[to] = low[to] = counter++;
+
+                        stack.push_back(to);
+
+                        onstack.insert(to);
+
+                        work.push_back({to, 0});
+                    }
+                    else if (onstack.count(to) > 0)
+                    {
+                        low[id] = std::min(low[id], index[to]);
+                    }
+                }
+                else
+                {
+                    work.pop_back();
+
+                    if (!work.empty())
+                    {
+                        auto parent = work.back().first;
+
+                        low[parent] = std::min(low[parent], low[id]);
+                    }
+
+                    if (low[id] == index[id])
+                    {
+                        auto component = std::vector<int>();
+
+                        auto member = -1;
+
+                        do
+                        {
+                            member = stack.back();
+
+                            stack.pop_back();
+
+                            onstack.erase(member);
+
+                            component.push_back(member);
+
+                        } while (member != id);
+
+                        std::sort(component.begin(), component.end());
+
+                        auto loops = component.size() > 1;
+
+                        if (!loops)
+                        {
+                            for (auto &edge : edges)
+                            {
+                                if (edge.To == id)
+                                {
+                                    loops = true;
+                                }
+                            }
+                        }
+
+                        if (loops)
+                        {
+                            components.push_back(component);
+                        }
+                    }
+                }
+            }
+        }
+
+        std::sort(components.begin(), components.end());
+
+        return components;
+    }
+
+    std::string Digits(const std::string &name)
+    {
+        auto digits = std::string();
+
+        for (auto c : name)
+        {
+            if (std::isdigit((unsigned char)c))
+            {
+                digits += c;
+            }
+        }
+
+        return digits;
+    }
+
+    Analyzer::Report Analyze(Analyzer::Graph &graph)
+    {
+        Analyzer::Report report;
+
+        auto ids = std::map<std::string, int>();
+
+        for (auto &section : graph.Sections)
+        {
+            ids[section.second.Class] = section.first;
+        }
+
+        auto registered = std::map<int, std::vector<std::string>>();
+
+        auto classes = std::set<std::string>();
+
+        for (auto &instance : graph.Registered)
+        {
+            if (graph.Instances.count(instance) == 0 || ids.count(graph.Instances[instance]) == 0)
+            {
+                report.Registration.push_back(instance + " is not an instance of a story section");
+
+                continue;
+            }
+
+            auto name = graph.Instances[instance];
+
+            auto id = ids[name];
+
+            classes.insert(name);
+
+            registered[id].push_back(instance);
+
+            report.Known.insert(id);
+
+            auto digits = Digits(instance);
+
+            if (digits.length() > 0 && std::atoi(digits.c_str()) != id)
+            {
+                report.Registration.push_back(instance + " is an instance of " + name + " (section " + std::to_string(id) + ")");
+            }
+        }
+
+        for (auto &id : registered)
+        {
+            if (id.second.size() > 1)
+            {
+                auto names = std::string();
+
+                for (auto &instance : id.second)
+                {
+                    names += (names.length() > 0 ? ", " : "") + instance;
+                }
+
+                report.Registration.push_back("section " + std::to_string(id.first) + " is registered more than once (" + names + ")");
+            }
+        }
+
+        for (auto &section : graph.Sections)
+        {
+            if (classes.count(section.second.Class) == 0)
+            {
+                report.Registration.push_back(section.second.Class + " (section " + std::to_string(section.first) + ") is never registered");
+            }
+        }
+
+        for (auto &name : graph.Anonymous)
+        {
+            report.Registration.push_back(name + " has no ID");
+        }
+
+        for (auto &redefined : graph.Redefined)
+        {
+            report.Registration.push_back(redefined.first + " redefines section " + std::to_string(redefined.second));
+        }
+
+        for (auto id : report.Known)
+        {
+            auto &section = graph.Sections[id];
+
+            for (auto &edge : section.Edges)
+            {
+                if (report.Known.count(edge.To) == 0)
+                {
+                    report.Dangling.push_back(edge);
+                }
+            }
+
+            for (auto line : section.Unresolved)
+            {
+                report.Unresolved.push_back({id, line});
+            }
+
+            if (section.Edges.empty() && !section.Ending)
+            {
+                report.DeadEnds.push_back(id);
+            }
+        }
+
+        auto reachable = Reach(graph, report.Known, 0, true);
+
+        auto open = Reach(graph, report.Known, 0, false);
+
+        for (auto id : report.Known)
+        {
+            if (reachable.count(id) == 0)
+            {
+                report.Unreachable.push_back(id);
+            }
+            else if (open.count(id) == 0)
+            {
+                report.Gated[id] = std::set<std::string>();
+            }
+        }
+
+        for (auto id : reachable)
+        {
+            for (auto &edge : graph.Sections[id].Edges)
+            {
+                if (report.Gated.count(edge.To) > 0)
+                {
+                    report.Gated[edge.To].insert(edge.Codewords.begin(), edge.Codewords.end());
+
+                    if (edge.Codewords.empty())
+                    {
+                        report.Via[edge.To].insert(id);
+                    }
+                }
+            }
+        }
+
+        report.Cycles = Components(graph, report.Known);
+
+        return report;
+    }
+
+    std::string Join(const std::vector<std::string> &items, const char *separator)
+    {
+        auto joined = std::string();
+
+        for (auto i = 0; i < items.size(); i++)
+        {
+            joined += (i > 0 ? separator : "") + items[i];
+        }
+
+        return joined;
+    }
+
+    std::string Escape(const std::string &text)
+    {
+        auto escaped = std::string();
+
+        for (auto c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                escaped += '\\';
+            }
+
+            escaped += c;
+        }
+
+        return escaped;
+    }
+
+    void WriteDOT(Analyzer::Graph &graph, Analyzer::Report &report, std::ostream &out)
+    {
+        out << "digraph story {" << std::endl;
+        out << "    node [shape=box, fontsize=10];" << std::endl;
+
+        for (auto id : report.Known)
+        {
+            auto &section = graph.Sections[id];
+
+            out << "    " << id << " [label=\"" << id << "\"";
+
+            if (std::find(report.Unreachable.begin(), report.Unreachable.end(), id) != report.Unreachable.end())
+            {
+                out << ", style=filled, fillcolor=gray";
+            }
+            else if (report.Gated.count(id) > 0)
+            {
+                out << ", style=filled, fillcolor=lightblue";
+            }
+            else if (section.Ending)
+            {
+                out << ", shape=doubleoctagon";
+            }
+
+            out << "];" << std::endl;
+        }
+
+        for (auto id : report.Known)
+        {
+            for (auto &edge : graph.Sections[id].Edges)
+            {
+                out << "    " << edge.From << " -> " << edge.To << " [";
+
+                auto attributes = std::vector<std::string>();
+
+                if (edge.Kind != "choice")
+                {
+                    attributes.push_back("style=dashed");
+                }
+
+                if (edge.Codewords.size() > 0)
+                {
+                    attributes.push_back("color=blue, label=\"" + Escape(Join(edge.Codewords, ", ")) + "\"");
+                }
+
+                if (report.Known.count(edge.To) == 0)
+                {
+                    attributes.push_back("color=red");
+                }
+
+                out << Join(attributes, ", ") << "];" << std::endl;
+            }
+        }
+
+        for (auto &edge : report.Dangling)
+        {
+            out << "    " << edge.To << " [label=\"" << edge.To << "\", color=red, fontcolor=red];" << std::endl;
+        }
+
+        out << "}" << std::endl;
+    }
+
+    nlohmann::json ToJSON(Analyzer::Graph &graph, Analyzer::Report &report)
+    {
+        nlohmann::json data;
+
+        auto sections = std::vector<nlohmann::json>();
+
+        for (auto id : report.Known)
+        {
+            auto &section = graph.Sections[id];
+
+            nlohmann::json node;
+
+            node["id"] = id;
+            node["class"] = section.Class;
+            node["file"] = section.File;
+            node["line"] = section.Line;
+            node["ending"] = section.Ending;
+            node["grants"] = section.Grants;
+
+            auto edges = std::vector<nlohmann::json>();
+
+            for (auto &edge : section.Edges)
+            {
+                nlohmann::json link;
+
+                link["to"] = edge.To;
+                link["kind"] = edge.Kind;
+                link["file"] = edge.File;
+                link["line"] = edge.Line;
+                link["conditions"] = edge.Conditions;
+                link["codewords"] = edge.Codewords;
+
+                edges.push_back(link);
+            }
+
+            node["edges"] = edges;
+
+            sections.push_back(node);
+        }
+
+        data["sections"] = sections;
+
+        // compact adjacency (section -> distinct destinations), e.g. for prefetching
+        auto adjacency = nlohmann::json::object();
+
+        for (auto id : report.Known)
+        {
+            auto destinations = std::set<int>();
+
+            for (auto &edge : graph.Sections[id].Edges)
+            {
+                destinations.insert(edge.To);
+            }
+
+            adjacency[std::to_string(id)] = std::vector<int>(destinations.begin(), destinations.end());
+        }
+
+        data["adjacency"] = adjacency;
+
+        auto dangling = std::vector<nlohmann::json>();
+
+        for (auto &edge : report.Dangling)
+        {
+            nlohmann::json link;
+
+            link["from"] = edge.From;
+            link["to"] = edge.To;
+            link["kind"] = edge.Kind;
+            link["file"] = edge.File;
+            link["line"] = edge.Line;
+
+            dangling.push_back(link);
+        }
+
+        data["dangling"] = dangling;
+        data["unreachable"] = report.Unreachable;
+        data["dead_ends"] = report.DeadEnds;
+        data["cycles"] = report.Cycles;
+        data["registration"] = report.Registration;
+
+        auto gated = nlohmann::json::object();
+
+        for (auto &section : report.Gated)
+        {
+            gated[std::to_string(section.first)] = std::vector<std::string>(section.second.begin(), section.second.end());
+        }
+
+        data["codeword_gated"] = gated;
+
+        return data;
+    }
+
+    void Print(Analyzer::Graph &graph, Analyzer::Report &report, std::ostream &out)
+    {
+        auto edges = 0;
+
+        for (auto id : report.Known)
+        {
+            edges += graph.Sections[id].Edges.size();
+        }
+
+        out << "Sections: " << report.Known.size() << ", links: " << edges << std::endl;
+
+        for (auto &problem : report.Registration)
+        {
+            out << "Registration: " << problem << std::endl;
+        }
+
+        for (auto &edge : report.Dangling)
+        {
+            out << "Dangling: " << edge.From << " -> " << edge.To << " (" << edge.Kind << ", " << edge.File << ":" << edge.Line << ")" << std::endl;
+        }
+
+        for (auto &unresolved : report.Unresolved)
+        {
+            out << "Unresolved: section " << unresolved.first << " returns a computed value (" << graph.Sections[unresolved.first].File << ":" << unresolved.second << ")" << std::endl;
+        }
+
+        for (auto id : report.Unreachable)
+        {
+            out << "Unreachable: " << id << " (" << graph.Sections[id].Class << ")" << std::endl;
+        }
+
+        for (auto id : report.DeadEnds)
+        {
+            out << "Dead end: " << id << " has no exits and is not an ending" << std::endl;
+        }
+
+        for (auto &section : report.Gated)
+        {
+            out << "Codeword-gated: " << section.first;
+
+            if (section.second.size() > 0)
+            {
+                out << " requires " << Join(std::vector<std::string>(section.second.begin(), section.second.end()), " or ");
+            }
+
+            if (report.Via.count(section.first) > 0)
+            {
+                auto via = std::vector<std::string>();
+
+                for (auto id : report.Via[section.first])
+                {
+                    via.push_back(std::to_string(id));
+                }
+
+                out << (section.second.size() > 0 ? ", or" : "") << " through " << Join(via, ", ");
+            }
+
+            out << std::endl;
+        }
+
+        out << "Cycles: " << report.Cycles.size() << std::endl;
+
+        for (auto &cycle : report.Cycles)
+        {
+            auto members = std::vector<std::string>();
+
+            for (auto id : cycle)
+            {
+                members.push_back(std::to_string(id));
+            }
+
+            out << "    [" << Join(members, ", ") << "]" << std::endl;
+        }
+    }
+} // namespace Analyzer
+
+int main(int argc, char **argv)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    auto inputs = std::vector<std::string>();
+    auto dot = std::string();
+    auto json = std::string();
+
+    auto quiet = false;
+
+    for (auto i = 1; i < argc; i++)
+    {
+        auto arg = std::string(argv[i]);
+
+        if (arg == "--dot" && i + 1 < argc)
+        {
+            dot = argv[++i];
+        }
+        else if (arg == "--json" && i + 1 < argc)
+        {
+            json = argv[++i];
+        }
+        else if (arg == "--quiet")
+        {
+            quiet = true;
+        }
+        else
+        {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty())
+    {
+        inputs = {"story.cpp", "story000.cpp", "story100.cpp", "story200.cpp", "story300.cpp", "story400.cpp"};
+    }
+
+    Analyzer::Graph graph;
+
+    for (auto &input : inputs)
+    {
+        std::ifstream ifs(input, std::ios::binary);
+
+        if (!ifs.good())
+        {
+            std::cerr << "Unable to open " << input << "!" << std::endl;
+
+            return 2;
+        }
+
+        std::stringstream buffer;
+
+        buffer << ifs.rdbuf();
+
+        ifs.close();
+
+        graph.Parse(buffer.str(), input);
+    }
+
+    auto report = Analyzer::Analyze(graph);
+
+    if (!quiet)
+    {
+        Analyzer::Print(graph, report, std::cout);
+    }
+
+    if (dot.length() > 0)
+    {
+        std::ofstream out(dot);
+
+        Analyzer::WriteDOT(graph, report, out);
+
+        out.close();
+    }
+
+    if (json.length() > 0)
+    {
+        std::ofstream out(json);
+
+        out << Analyzer::ToJSON(graph, report).dump(4) << std::endl;
+
+        out.close();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Analyzed " << inputs.size() << " files in " << elapsed << " ms" << std::endl;
+
+    return (report.Dangling.size() > 0 || report.Registration.size() > 0) ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+#ifndef __ASSETS__HPP__
+#define __ASSETS__HPP__
+
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "cache.hpp"
+#include "constants.hpp"
+#include "memory.hpp"
+#include "textures.hpp"
+
+namespace Asset
+{
+    // Icons pre-scaled for the current framebuffer, regenerated whenever the resolution changes
+    inline std::map<std::string, SDL_Surface *> Icons = std::map<std::string, SDL_Surface *>();
+
+    inline int Generation = -1;
+
+    inline void Clear()
+    {
+        for (auto &icon : Icons)
+        {
+            if (icon.second)
+            {
+                Memory::FreeSurface(icon.second);
+
+                icon.second = NULL;
+            }
+        }
+
+        Icons.clear();
+    }
+
+    // Resample surface into a new 32-bit ARGB surface of the given size
+    inline SDL_Surface *Resize(SDL_Surface *surface, int w, int h)
+    {
+        SDL_Surface *scaled = NULL;
+
+        if (surface && w > 0 && h > 0)
+        {
+            auto converted = Memory::Track(Memory::Type::ICONS, SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0));
+
+            if (converted)
+            {
+                scaled = Memory::Track(Memory::Type::ICONS, SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888));
+
+                if (scaled)
+                {
+                    if (SDL_SoftStretchLinear(converted, NULL, scaled, NULL) != 0)
+                    {
+                        std::cerr << "Unable to scale image! SDL Error: " << SDL_GetError() << std::endl;
+
+                        Memory::FreeSurface(scaled);
+
+                        scaled = NULL;
+                    }
+                }
+
+                Memory::FreeSurface(converted);
+
+                converted = NULL;
+            }
+        }
+
+        return scaled;
+    }
+
+    // Scaled icon kept in the cache (not a copy), NULL if it cannot be loaded
+    inline SDL_Surface *Load(const char *file)
+    {
+        if (Generation != Video.Generation)
+        {
+            Clear();
+
+            Generation = Video.Generation;
+        }
+
+        if (Icons.count(file) == 0)
+        {
+            auto key = Cache::Key(file, Video.Scale);
+
+            auto cached = Memory::Track(Memory::Type::ICONS, Cache::Load(key));
+
+            if (cached)
+            {
+                Icons[file] = cached;
+
+                return cached;
+            }
+
+            auto surface = Memory::Track(Memory::Type::ICONS, IMG_Load(file));
+
+            if (surface && Video.Scale != 1.0)
+            {
+                auto scaled = Resize(surface, Video.Scaled(surface->w), Video.Scaled(surface->h));
+
+                if (scaled)
+                {
+                    Memory::FreeSurface(surface);
+
+                    surface = scaled;
+                }
+            }
+
+            if (surface == NULL)
+            {
+                return NULL;
+            }
+
+            Icons[file] = Textures::Native(Memory::Type::ICONS, surface);
+
+            Cache::Store(key, Icons[file]);
+        }
+
+        return Icons[file];
+    }
+
+    // Returns a copy (owned by the caller) of the icon scaled to the current resolution
+    inline SDL_Surface *Icon(const char *file)
+    {
+        auto icon = Load(file);
+
+        if (icon == NULL)
+        {
+            return NULL;
+        }
+
+        return Memory::Track(Memory::Type::BUTTONS, SDL_ConvertSurface(icon, icon->format, 0));
+    }
+
+    // Scale every icon in the directory ahead of time. Not thread-safe: nothing else may use the icons meanwhile.
+    inline void Preload(const char *directory)
+    {
+        std::error_code error;
+
+        for (auto &entry : std::filesystem::directory_iterator(directory, error))
+        {
+            if (entry.path().extension() == ".png")
+            {
+                // keys match the paths used by the buttons, e.g. "icons/exit.png"
+                Load((std::string(directory) + "/" + entry.path().filename().string()).c_str());
+            }
+        }
+    }
+} // namespace Asset
+
+#endif
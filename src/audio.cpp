@@ -0,0 +1,273 @@
+#include <condition_variable>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include "audio.hpp"
+#include "memory.hpp"
+
+namespace Audio
+{
+    const int EFFECTS = (int)Audio::Effect::COUNT;
+
+    const char *EffectFiles[EFFECTS] = {"sounds/button.wav", "sounds/page.wav"};
+
+    // Decoded effects, NULL if the file could not be loaded
+    Mix_Chunk *Effects[EFFECTS] = {NULL, NULL};
+
+    bool Open = false;
+
+    // Opens music files and starts them off the render thread. Only the latest request is kept if tracks are switched
+    // faster than they can be opened.
+    class Streamer
+    {
+    private:
+        std::thread worker;
+
+        std::mutex lock;
+
+        std::condition_variable signal;
+
+        bool running = false;
+
+        bool pending = false;
+
+        std::string request = "";
+
+        std::string playing = "";
+
+        Mix_Music *music = NULL;
+
+        void change(std::string file)
+        {
+            std::error_code error;
+
+            // tracks that are not installed are skipped without a warning, the current one keeps playing
+            if (file == playing || !std::filesystem::exists(file, error))
+            {
+                return;
+            }
+
+            auto next = Mix_LoadMUS(file.c_str());
+
+            if (next == NULL)
+            {
+                std::cerr << "Unable to load music " << file << "! Mix Error: " << Mix_GetError() << std::endl;
+
+                return;
+            }
+
+            if (music)
+            {
+                Mix_FadeOutMusic(Audio::FADE);
+
+                // waits for the fade out to finish (on this thread), the next track starts after it
+                Mix_FreeMusic(music);
+            }
+
+            music = next;
+
+            playing = file;
+
+            Mix_FadeInMusic(music, -1, Audio::FADE);
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> guard(lock);
+
+            while (running)
+            {
+                signal.wait(guard, [this] { return pending || !running; });
+
+                if (pending && running)
+                {
+                    auto file = request;
+
+                    pending = false;
+
+                    guard.unlock();
+
+                    change(file);
+
+                    guard.lock();
+                }
+            }
+
+            if (music)
+            {
+                Mix_HaltMusic();
+
+                Mix_FreeMusic(music);
+
+                music = NULL;
+            }
+
+            playing = "";
+        }
+
+    public:
+        void Start()
+        {
+            if (!running)
+            {
+                running = true;
+
+                worker = std::thread(&Audio::Streamer::run, this);
+            }
+        }
+
+        void Play(const char *file)
+        {
+            if (running && file)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    request = file;
+
+                    pending = true;
+                }
+
+                signal.notify_one();
+            }
+        }
+
+        void Stop()
+        {
+            if (running)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    running = false;
+                }
+
+                signal.notify_one();
+
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        ~Streamer()
+        {
+            Stop();
+        }
+    };
+
+    Audio::Streamer Tracks = Audio::Streamer();
+
+    bool Initialize()
+    {
+        if (Open || Audio::Mute)
+        {
+            return Open;
+        }
+
+        if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0)
+        {
+            std::cerr << "Audio disabled: " << SDL_GetError() << std::endl;
+
+            return false;
+        }
+
+        if (Mix_OpenAudio(Audio::FREQUENCY, MIX_DEFAULT_FORMAT, 2, Audio::BUFFER) != 0)
+        {
+            std::cerr << "Audio disabled: " << Mix_GetError() << std::endl;
+
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+
+            return false;
+        }
+
+        Mix_AllocateChannels(Audio::CHANNELS);
+
+        for (auto i = 0; i < EFFECTS; i++)
+        {
+            std::error_code error;
+
+            // an effect that is not installed is silent, only a file that cannot be decoded is reported
+            if (!std::filesystem::exists(EffectFiles[i], error))
+            {
+                continue;
+            }
+
+            Effects[i] = Mix_LoadWAV(EffectFiles[i]);
+
+            if (Effects[i])
+            {
+                Memory::Add(Memory::Type::AUDIO, (long long)Effects[i]->alen + sizeof(Mix_Chunk));
+            }
+            else
+            {
+                std::cerr << "Unable to load sound " << EffectFiles[i] << "! Mix Error: " << Mix_GetError() << std::endl;
+            }
+        }
+
+        Open = true;
+
+        Tracks.Start();
+
+        return true;
+    }
+
+    bool Available()
+    {
+        return Open;
+    }
+
+    void Play(Audio::Effect effect)
+    {
+        auto i = (int)effect;
+
+        if (Open && i >= 0 && i < EFFECTS && Effects[i])
+        {
+            // any free channel, the effect is dropped if all of them are busy
+            Mix_PlayChannel(-1, Effects[i], 0);
+        }
+    }
+
+    void Music(const char *file)
+    {
+        if (Open)
+        {
+            Tracks.Play(file);
+        }
+    }
+
+    void Shutdown()
+    {
+        if (!Open)
+        {
+            return;
+        }
+
+        Tracks.Stop();
+
+        for (auto i = 0; i < EFFECTS; i++)
+        {
+            if (Effects[i])
+            {
+                Memory::Remove(Memory::Type::AUDIO, (long long)Effects[i]->alen + sizeof(Mix_Chunk));
+
+                Mix_FreeChunk(Effects[i]);
+
+                Effects[i] = NULL;
+            }
+        }
+
+        Mix_CloseAudio();
+
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+
+        Open = false;
+    }
+} // namespace Audio
@@ -0,0 +1,46 @@
+#ifndef __AUDIO__HPP__
+#define __AUDIO__HPP__
+
+// Music and sound effects (audio.cpp). Music tracks are streamed from disk by SDL_mixer, which decodes them on its
+// audio thread. Tracks are opened and switched on a background thread so that a section change never waits on the
+// disk. Effects are decoded once at startup and mixed from memory. Without an audio device (or with --mute) every call
+// does nothing. The sound files are optional: the game plays silently without sounds/ or music/.
+namespace Audio
+{
+    enum class Effect
+    {
+        BUTTON = 0, // a control was selected
+        PAGE,       // a new section is shown
+        COUNT
+    };
+
+    const int FREQUENCY = 44100;
+
+    // Mixer buffer in sample frames, 512 frames at 44.1 kHz keep an effect within 12 ms of its trigger
+    const int BUFFER = 512;
+
+    const int CHANNELS = 8;
+
+    // The playing track fades out over this many milliseconds, then the next one fades in. SDL_mixer streams one music
+    // track at a time, so the two do not overlap.
+    const int FADE = 1000;
+
+    // Disable audio (--mute)
+    inline bool Mute = false;
+
+    // Open the audio device, preload the effects and start the music thread. Returns false if audio is unavailable.
+    bool Initialize();
+
+    bool Available();
+
+    // Never blocks
+    void Play(Audio::Effect effect);
+
+    // Switch to another looping track, NULL keeps the current track playing. Never blocks.
+    void Music(const char *file);
+
+    // Stop the music, wait for the music thread and close the device
+    void Shutdown();
+} // namespace Audio
+
+#endif
@@ -0,0 +1,481 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <SDL.h>
+
+#include "save.hpp"
+#include "textures.hpp"
+#include "cache.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Cache
+{
+    const char MAGIC[4] = {'S', 'K', 'P', 'X'};
+
+    const Uint32 VERSION = 1;
+
+    // at the start of every blob, followed by Height rows of Pitch bytes
+    struct Header
+    {
+        char Magic[4];
+
+        Uint32 Version;
+
+        Uint32 Format;
+
+        Sint32 Width;
+
+        Sint32 Height;
+
+        Sint32 Pitch;
+
+        Uint32 Blending;
+
+        Uint32 Reserved;
+    };
+
+    // Read-only view of a whole file, memory-mapped where available
+    class Mapping
+    {
+    public:
+        const Uint8 *Data = NULL;
+
+        size_t Size = 0;
+
+#if defined(_WIN32)
+        std::vector<Uint8> Buffer = std::vector<Uint8>();
+#endif
+
+        Mapping(const std::string &file)
+        {
+#if defined(_WIN32)
+            std::ifstream in(file, std::ios::binary);
+
+            if (in.is_open())
+            {
+                Buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+                Data = Buffer.data();
+
+                Size = Buffer.size();
+            }
+#else
+            auto fd = open(file.c_str(), O_RDONLY);
+
+            if (fd >= 0)
+            {
+                struct stat info;
+
+                if (fstat(fd, &info) == 0 && info.st_size > 0)
+                {
+                    auto mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                    if (mapped != MAP_FAILED)
+                    {
+                        Data = (const Uint8 *)mapped;
+
+                        Size = (size_t)info.st_size;
+                    }
+                }
+
+                // the mapping stays valid after the descriptor is closed
+                close(fd);
+            }
+#endif
+        }
+
+        ~Mapping()
+        {
+#if !defined(_WIN32)
+            if (Data)
+            {
+                munmap((void *)Data, Size);
+            }
+#endif
+        }
+
+        Mapping(const Mapping &) = delete;
+
+        Mapping &operator=(const Mapping &) = delete;
+    };
+
+    // Sidecar index in the cache folder: the content hash of every source image with the size and modification time it
+    // was computed for, one "hash size time path" line each
+    const char *const INDEX = "index.txt";
+
+    class Source
+    {
+    public:
+        Uint64 Hash = 0;
+
+        uintmax_t Size = 0;
+
+        long long Time = 0;
+    };
+
+    std::string Folder = std::string();
+
+    std::mutex Lock;
+
+    // read once in Open, source images are only hashed again when their size or modification time changes
+    std::unordered_map<std::string, Cache::Source> Sources = std::unordered_map<std::string, Cache::Source>();
+
+    void Write(std::ostream &out, const std::string &path, const Cache::Source &source)
+    {
+        out << std::hex << std::setfill('0') << std::setw(16) << source.Hash << std::dec << " " << source.Size << " " << source.Time << " " << path << std::endl;
+    }
+
+    // with the lock held
+    void LoadIndex(const std::string &folder)
+    {
+        auto index = folder + "/" + Cache::INDEX;
+
+        std::ifstream in(index);
+
+        std::string line;
+
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+
+            auto source = Cache::Source();
+
+            std::string path;
+
+            // later lines replace earlier ones
+            if (fields >> std::hex >> source.Hash >> std::dec >> source.Size >> source.Time && std::getline(fields >> std::ws, path) && !path.empty())
+            {
+                Sources[path] = source;
+            }
+        }
+
+        in.close();
+
+        // written compacted (one line per image) and renamed, lines appended by Key follow
+        auto temporary = index + ".tmp";
+
+        std::ofstream out(temporary);
+
+        for (auto &source : Sources)
+        {
+            Cache::Write(out, source.first, source.second);
+        }
+
+        out.close();
+
+        std::error_code error;
+
+        if (out.fail())
+        {
+            fs::remove(temporary, error);
+        }
+        else
+        {
+            fs::rename(temporary, index, error);
+        }
+    }
+
+    // FNV-1a (64-bit)
+    Uint64 Hash(Uint64 hash, const Uint8 *data, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ data[i]) * 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    void Open()
+    {
+        if (!Cache::Enabled)
+        {
+            return;
+        }
+
+        auto folder = savePath() + "/" + Cache::DIRECTORY;
+
+        std::error_code error;
+
+        fs::create_directories(folder, error);
+
+        if (error)
+        {
+            std::cerr << "Unable to create the image cache " << folder << "! " << error.message() << std::endl;
+
+            return;
+        }
+
+        auto blobs = std::vector<std::pair<fs::file_time_type, fs::path>>();
+
+        auto total = (uintmax_t)0;
+
+        for (auto &entry : fs::directory_iterator(folder, error))
+        {
+            if (entry.is_regular_file(error))
+            {
+                if (entry.path().filename() == Cache::INDEX)
+                {
+                    continue;
+                }
+
+                // leftovers of interrupted writes
+                if (entry.path().extension() != ".px")
+                {
+                    fs::remove(entry.path(), error);
+
+                    continue;
+                }
+
+                total += entry.file_size(error);
+
+                blobs.push_back({entry.last_write_time(error), entry.path()});
+            }
+        }
+
+        // least recently used first
+        std::sort(blobs.begin(), blobs.end());
+
+        auto limit = (uintmax_t)Cache::MAX_MEGABYTES * 1024 * 1024;
+
+        for (auto &blob : blobs)
+        {
+            if (total <= limit)
+            {
+                break;
+            }
+
+            auto size = fs::file_size(blob.second, error);
+
+            if (fs::remove(blob.second, error))
+            {
+                total -= size;
+            }
+        }
+
+        std::lock_guard<std::mutex> guard(Lock);
+
+        Cache::LoadIndex(folder);
+
+        Folder = folder;
+    }
+
+    // Content hash of the source image, from the index unless the file changed since it was hashed
+    bool Fingerprint(const char *file, Uint64 &hash)
+    {
+        std::error_code error;
+
+        auto size = fs::file_size(file, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        auto time = (long long)fs::last_write_time(file, error).time_since_epoch().count();
+
+        if (error)
+        {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            auto found = Sources.find(file);
+
+            if (found != Sources.end() && found->second.Size == size && found->second.Time == time)
+            {
+                hash = found->second.Hash;
+
+                return true;
+            }
+        }
+
+        auto source = Cache::Mapping(file);
+
+        if (source.Data == NULL)
+        {
+            return false;
+        }
+
+        auto entry = Cache::Source();
+
+        entry.Hash = Cache::Hash(14695981039346656037ULL, source.Data, source.Size);
+
+        entry.Size = size;
+
+        entry.Time = time;
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            Sources[file] = entry;
+
+            std::ofstream out(Folder + "/" + Cache::INDEX, std::ios::app);
+
+            Cache::Write(out, file, entry);
+        }
+
+        hash = entry.Hash;
+
+        return true;
+    }
+
+    std::string Key(const char *file, double scale)
+    {
+        if (!Cache::Enabled || Folder.empty() || file == NULL)
+        {
+            return std::string();
+        }
+
+        Uint64 hash = 0;
+
+        if (!Cache::Fingerprint(file, hash))
+        {
+            return std::string();
+        }
+
+        auto format = Textures::Format();
+
+        // scale in thousandths, so the name does not depend on how the double prints
+        auto scaled = (Sint64)(scale * 1000.0 + 0.5);
+
+        std::ostringstream name;
+
+        name << std::hex << std::setfill('0') << std::setw(16) << hash << "-" << std::dec << scaled << "-" << std::hex << format << ".px";
+
+        return name.str();
+    }
+
+    SDL_Surface *Load(const std::string &key)
+    {
+        if (key.empty())
+        {
+            return NULL;
+        }
+
+        auto file = Folder + "/" + key;
+
+        auto blob = Cache::Mapping(file);
+
+        if (blob.Data == NULL || blob.Size < sizeof(Cache::Header))
+        {
+            return NULL;
+        }
+
+        Cache::Header header;
+
+        std::memcpy(&header, blob.Data, sizeof(header));
+
+        if (std::memcmp(header.Magic, Cache::MAGIC, sizeof(header.Magic)) != 0 || header.Version != Cache::VERSION || header.Format != Textures::Format() || header.Width <= 0 || header.Height <= 0 || header.Pitch <= 0 || blob.Size != sizeof(header) + (size_t)header.Pitch * header.Height)
+        {
+            return NULL;
+        }
+
+        auto surface = SDL_CreateRGBSurfaceWithFormat(0, header.Width, header.Height, SDL_BITSPERPIXEL(header.Format), header.Format);
+
+        if (surface == NULL)
+        {
+            return NULL;
+        }
+
+        auto row = std::min(surface->pitch, header.Pitch);
+
+        auto pixels = blob.Data + sizeof(header);
+
+        for (auto y = 0; y < header.Height; y++)
+        {
+            std::memcpy((Uint8 *)surface->pixels + y * surface->pitch, pixels + y * header.Pitch, row);
+        }
+
+        SDL_SetSurfaceBlendMode(surface, (SDL_BlendMode)header.Blending);
+
+        // most recently used last when the cache is pruned
+        std::error_code error;
+
+        fs::last_write_time(file, fs::file_time_type::clock::now(), error);
+
+        return surface;
+    }
+
+    void Store(const std::string &key, SDL_Surface *surface)
+    {
+        if (key.empty() || surface == NULL || surface->format->format != Textures::Format() || SDL_MUSTLOCK(surface))
+        {
+            return;
+        }
+
+        Cache::Header header;
+
+        std::memcpy(header.Magic, Cache::MAGIC, sizeof(header.Magic));
+
+        header.Version = Cache::VERSION;
+
+        header.Format = surface->format->format;
+
+        header.Width = surface->w;
+
+        header.Height = surface->h;
+
+        header.Pitch = surface->pitch;
+
+        SDL_BlendMode blending = SDL_BLENDMODE_NONE;
+
+        SDL_GetSurfaceBlendMode(surface, &blending);
+
+        header.Blending = (Uint32)blending;
+
+        header.Reserved = 0;
+
+        // written under a name of its own and renamed, so other threads and later runs never see a partial blob
+        std::ostringstream temporary;
+
+        temporary << Folder << "/" << key << "." << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+
+        auto output = fopen(temporary.str().c_str(), "wb");
+
+        if (output == NULL)
+        {
+            return;
+        }
+
+        auto written = fwrite(&header, sizeof(header), 1, output) == 1 && fwrite(surface->pixels, (size_t)surface->pitch * surface->h, 1, output) == 1;
+
+        written = fclose(output) == 0 && written;
+
+        std::error_code error;
+
+        if (written)
+        {
+            fs::rename(temporary.str(), Folder + "/" + key, error);
+        }
+
+        if (!written || error)
+        {
+            fs::remove(temporary.str(), error);
+        }
+    }
+} // namespace Cache
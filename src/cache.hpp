@@ -0,0 +1,39 @@
+#ifndef __CACHE__HPP__
+#define __CACHE__HPP__
+
+#include <string>
+
+#include <SDL.h>
+
+// Decoded images on disk (cache.cpp). The pixels of an image, already scaled and converted to the renderer's texture
+// format, are kept as a raw blob in the saved games folder and memory-mapped on the next start instead of decoding the
+// PNG again. Blobs are named after a hash of the image's contents, the scale and the pixel format, so a changed image
+// or another resolution or renderer simply misses and the stale blobs are pruned, the least recently used first. The
+// content hashes are kept in an index next to the blobs and only computed again when an image's size or modification
+// time changes.
+namespace Cache
+{
+    // Folder under the saved games folder
+    const char *const DIRECTORY = "cache";
+
+    // Megabytes kept at most
+    const int MAX_MEGABYTES = 256;
+
+    // Off with --no-image-cache
+    inline bool Enabled = true;
+
+    // Create the folder, prune it and read the index (before any image is loaded)
+    void Open();
+
+    // Blob name of the image at the scale in the preferred texture format, empty if the cache is off or the image
+    // cannot be read
+    std::string Key(const char *file, double scale);
+
+    // Surface with the cached pixels (owned by the caller), NULL on a miss
+    SDL_Surface *Load(const std::string &key);
+
+    // Keep the pixels of the surface. Safe on any thread.
+    void Store(const std::string &key, SDL_Surface *surface);
+} // namespace Cache
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef __CATALOGUE__HPP__
+#define __CATALOGUE__HPP__
+
+// The codewords, skills and items of the game, in one place. Each list is an X-macro: codewords.hpp, skills.hpp and
+// items.hpp expand it into their enumeration and into constexpr tables indexed by it, so the names, descriptions,
+// requirements and flags are fixed at compile time and looked up in O(1). The order is the order of the enumerations:
+// saved games, replays and State hashes store the values, so new entries go at the end of their list.
+
+// X(type, name, invisible)
+#define SKULLS_CODEWORDS(X) \
+    X(ANGEL, "Angel", false) \
+    X(BLESSING, "Blessing", false) \
+    X(CALABASH, "Calabash", false) \
+    X(CENOTE, "Cenote", false) \
+    X(EB, "Eb", false) \
+    X(IGNIS, "Ignis", false) \
+    X(OLMEK, "Olmek", false) \
+    X(PAKAL, "Pakal", false) \
+    X(POKTAPOK, "Poktapok", false) \
+    X(PSYCHODUCT, "Psychoduct", false) \
+    X(SAKBE, "Sakbe", false) \
+    X(SALVATION, "Salvation", false) \
+    X(SHADE, "Shade", false) \
+    X(VENUS, "Venus", false) \
+    X(ZAZ, "Zaz", false) \
+    X(ZOTZ, "Zotz", false)
+
+// X(type, name, description, required item)
+#define SKULLS_SKILLS(X) \
+    X(AGILITY, "AGILITY", "The ability to perform acrobatic feats, run, climb, balance and leap. A character with this skill is nimble and dexterous.", NONE) \
+    X(CHARMS, "CHARMS", "The expert use of magical wards to protect you from danger. Also includes that most elusive of qualities: luck. You must possess a MAGIC AMULET to use this skill.", MAGIC_AMULET) \
+    X(CUNNING, "CUNNING", "The ability to think on your feet and devise clever schemes for getting out of trouble. Useful in countless situations.", NONE) \
+    X(ETIQUETTE, "ETIQUETTE", "Understanding of the courtly manners which are essential to proper conduct in the upper echelons of the nobility.", NONE) \
+    X(FOLKLORE, "FOLKLORE", "Knowledge of myth and legend, and how best to deal with supernatural menaces such as garlic against vampires, silver bullets against a werewolf, and so on.", NONE) \
+    X(ROGUERY, "ROGUERY", "The traditional repertoire of a thief's tricks: picking pockets, opening locks, and skulking unseen in the shadows.", NONE) \
+    X(SEAFARING, "SEAFARING", "Knowing all about life at sea, including the ability to handle anything from a rowing boat right up to a large sailing ship.", NONE) \
+    X(SPELLS, "SPELLS", "A range of magical effects encompassing illusions, elemental effects, commands, and summonings. You must possess a MAGIC WAND to use this skill.", MAGIC_WAND) \
+    X(SWORDPLAY, "SWORDPLAY", "The best fighting skill. You must possess a SWORD to use this skill.", SWORD) \
+    X(TARGETING, "TARGETING", "A long-range attack skill. You must possess a BLOWGUN to use this skill.", BLOWGUN) \
+    X(UNARMED_COMBAT, "UNARMED COMBAT", "Fisticuffs, wrestling holds, jabs and kicks, and the tricks of infighting. Not as effective as SWORDPLAY, but you do not need weapons - your own body is the weapon!", NONE) \
+    X(WILDERNESS_LORE, "WILDERNESS LORE", "A talent for survival in the wild - whether it be forest, desert, swamp or mountain peak.", NONE)
+
+// X(type, name, unique)
+#define SKULLS_ITEMS(X) \
+    X(SWORD, "SWORD", false) \
+    X(BLOWGUN, "BLOWGUN", false) \
+    X(MAGIC_AMULET, "MAGIC AMULET", false) \
+    X(MAGIC_WAND, "MAGIC WAND", false) \
+    X(MAIZE_CAKES, "MAIZE CAKES", false) \
+    X(JADE_BEAD, "JADE BEAD", false) \
+    X(LETTER_OF_INTRODUCTION, "LETTER OF INTRODUCTION", true) \
+    X(MAN_OF_GOLD, "MAN OF GOLD", false) \
+    X(WATERSKIN, "WATERSKIN", false) \
+    X(ROPE, "ROPE", false) \
+    X(FIREBRAND, "FIREBRAND", false) \
+    X(POT_OF_DYE, "POT OF DYE", false) \
+    X(CHILLI_PEPPERS, "CHILLI PEPPERS", false) \
+    X(PAPAYA, "PAPAYA", false) \
+    X(SERPENT_BRACELET, "SERPENT BRACELET", true) \
+    X(GREEN_MIRROR, "GREEN MIRROR", true) \
+    X(MAGIC_DRINK, "MAGIC DRINK", false) \
+    X(JADE_SWORD, "JADE SWORD", true) \
+    X(OWL, "OWL", true) \
+    X(TERRACOTTA_EFFIGY, "TERRACOTTA EFFIGY", true) \
+    X(INCENSE, "INCENSE", false) \
+    X(LOBSTER_POT, "LOBSTER POT", true) \
+    X(SHAWL, "SHAWL", true) \
+    X(PARCEL_OF_SALT, "PARCEL OF SALT", false) \
+    X(SALTED_MEAT, "SALTED MEAT", false) \
+    X(HAUNCH_OF_VENISON, "HAUNCH OF VENISON", false) \
+    X(FLINT_KNIFE, "FLINT KNIFE", false) \
+    X(BLANKET, "BLANKET", false) \
+    X(GOLD_DIADEM, "GOLD DIADEM", true) \
+    X(BROTHERS_SKULL, "BROTHER's SKULL", true) \
+    X(GOLDEN_HELMET, "GOLDEN HELMET", true) \
+    X(CHALICE_OF_LIFE, "CHALICE OF LIFE", true) \
+    X(STONE, "STONE", false) \
+    X(PADDLE, "PADDLE", false) \
+    X(LUMP_OF_CHARCOAL, "LUMP OF CHARCOAL", false) \
+    X(HAMMER, "HAMMER", false) \
+    X(HYDRA_BLOOD_BALL, "HYDRA BLOOD BALL", true) \
+    X(SPEAR, "SPEAR", false) \
+    X(POLE, "POLE", false) \
+    X(IVORY_RING, "IVORY RING", false) \
+    X(SHELL_NECKLACE, "SHELL NECKLACE", false)
+
+#endif
@@ -6,6 +6,7 @@
 #include "codewords.hpp"
 #include "items.hpp"
 #include "skills.hpp"
+#include "memory.hpp"
 
 namespace Character
 {
@@ -130,18 +131,42 @@ namespace Character
         }
     };
 
-    auto WARRIOR = Base("The Warrior", Character::Type::WARRIOR, "A proud noble of the Maya people, and strong in the arts of war, you tolerate no insolence from any man.", {Skill::AGILITY, Skill::ETIQUETTE, Skill::SWORDPLAY, Skill::UNARMED_COMBAT}, {Item::SWORD}, 10);
-    auto HUNTER = Base("The Hunter", Character::Type::HUNTER, "You can keep pace with the deer of the woods, wrestle jaguars, and your blowgun can bring down a bird in flight. Your sharp instincts make you almost a creature of the wild yourself.", {Skill::AGILITY, Skill::TARGETING, Skill::UNARMED_COMBAT, Skill::WILDERNESS_LORE}, {Item::BLOWGUN}, 10);
-    auto MYSTIC = Base("The Mystic", Character::Type::MYSTIC, "You feel that other's lives are mundane. You learnt your skills from solitary, exploration and the dreams that came while you lay asleep under the stars.", {Skill::AGILITY, Skill::CHARMS, Skill::TARGETING, Skill::WILDERNESS_LORE}, {Item::MAGIC_AMULET, Item::BLOWGUN}, 10);
-    auto WAYFARER = Base("The Wayfarer", Character::Type::WAYFARER, "You have travelled widely and witnessed countless strange sights. Your wanderings have taught you many useful skills.", {Skill::CUNNING, Skill::FOLKLORE, Skill::SEAFARING, Skill::WILDERNESS_LORE}, {}, 10);
-    auto MERCHANT = Base("The Merchant", Character::Type::MERCHANT, "Daring adventure, subtle villainy, and always one eye open for a tidy profit -- these are your tenets.", {Skill::CUNNING, Skill::ROGUERY, Skill::SEAFARING, Skill::SWORDPLAY}, {Item::SWORD}, 15);
-    auto ACOLYTE = Base("The Acolyte", Character::Type::ACOLYTE, "You are master of many skills, but you know it is the god who shape man's destiny.", {Skill::ETIQUETTE, Skill::FOLKLORE, Skill::SPELLS, Skill::SWORDPLAY}, {Item::MAGIC_WAND, Item::SWORD}, 10);
-    auto SORCERER = Base("The Sorcerer", Character::Type::SORCERER, "Born into a high clan, you were schooled in sorcery by priests and wise men. Now you can twist reality itself to suit your wishes.", {Skill::CHARMS, Skill::ETIQUETTE, Skill::ROGUERY, Skill::SPELLS}, {Item::MAGIC_AMULET, Item::MAGIC_WAND}, 10);
-    auto CUSTOM = Character::Base("Custom Character", Character::Type::CUSTOM, "This is a player generated character.", {}, {}, 10);
+    inline auto WARRIOR = Base("The Warrior", Character::Type::WARRIOR, "A proud noble of the Maya people, and strong in the arts of war, you tolerate no insolence from any man.", {Skill::AGILITY, Skill::ETIQUETTE, Skill::SWORDPLAY, Skill::UNARMED_COMBAT}, {Item::SWORD}, 10);
+    inline auto HUNTER = Base("The Hunter", Character::Type::HUNTER, "You can keep pace with the deer of the woods, wrestle jaguars, and your blowgun can bring down a bird in flight. Your sharp instincts make you almost a creature of the wild yourself.", {Skill::AGILITY, Skill::TARGETING, Skill::UNARMED_COMBAT, Skill::WILDERNESS_LORE}, {Item::BLOWGUN}, 10);
+    inline auto MYSTIC = Base("The Mystic", Character::Type::MYSTIC, "You feel that other's lives are mundane. You learnt your skills from solitary, exploration and the dreams that came while you lay asleep under the stars.", {Skill::AGILITY, Skill::CHARMS, Skill::TARGETING, Skill::WILDERNESS_LORE}, {Item::MAGIC_AMULET, Item::BLOWGUN}, 10);
+    inline auto WAYFARER = Base("The Wayfarer", Character::Type::WAYFARER, "You have travelled widely and witnessed countless strange sights. Your wanderings have taught you many useful skills.", {Skill::CUNNING, Skill::FOLKLORE, Skill::SEAFARING, Skill::WILDERNESS_LORE}, {}, 10);
+    inline auto MERCHANT = Base("The Merchant", Character::Type::MERCHANT, "Daring adventure, subtle villainy, and always one eye open for a tidy profit -- these are your tenets.", {Skill::CUNNING, Skill::ROGUERY, Skill::SEAFARING, Skill::SWORDPLAY}, {Item::SWORD}, 15);
+    inline auto ACOLYTE = Base("The Acolyte", Character::Type::ACOLYTE, "You are master of many skills, but you know it is the god who shape man's destiny.", {Skill::ETIQUETTE, Skill::FOLKLORE, Skill::SPELLS, Skill::SWORDPLAY}, {Item::MAGIC_WAND, Item::SWORD}, 10);
+    inline auto SORCERER = Base("The Sorcerer", Character::Type::SORCERER, "Born into a high clan, you were schooled in sorcery by priests and wise men. Now you can twist reality itself to suit your wishes.", {Skill::CHARMS, Skill::ETIQUETTE, Skill::ROGUERY, Skill::SPELLS}, {Item::MAGIC_AMULET, Item::MAGIC_WAND}, 10);
+    inline auto CUSTOM = Character::Base("Custom Character", Character::Type::CUSTOM, "This is a player generated character.", {}, {}, 10);
 
-    std::vector<Character::Base> Classes = {WARRIOR, HUNTER, MYSTIC, WAYFARER, MERCHANT, ACOLYTE, SORCERER};
+    inline std::vector<Character::Base> Classes = {WARRIOR, HUNTER, MYSTIC, WAYFARER, MERCHANT, ACOLYTE, SORCERER};
 
-    int FIND_ITEM(Character::Base &player, Item::Type item)
+    // Bytes used by a character, including its lists
+    inline long long Footprint(Character::Base &player)
+    {
+        long long bytes = sizeof(Character::Base) + Memory::Bytes(player.Name) + Memory::Bytes(player.Description);
+
+        bytes += (player.Skills.capacity() + player.LostSkills.capacity()) * sizeof(Skill::Base);
+
+        bytes += (player.Items.capacity() + player.LostItems.capacity()) * sizeof(Item::Base);
+
+        bytes += player.Codewords.capacity() * sizeof(Codeword::Type);
+
+        for (auto &item : player.Items)
+        {
+            bytes += Memory::Bytes(item.Name) + Memory::Bytes(item.Description);
+        }
+
+        for (auto &item : player.LostItems)
+        {
+            bytes += Memory::Bytes(item.Name) + Memory::Bytes(item.Description);
+        }
+
+        return bytes;
+    }
+
+    inline int FIND_ITEM(Character::Base &player, Item::Type item)
     {
         auto found = -1;
 
@@ -161,7 +186,7 @@ namespace Character
         return found;
     }
 
-    int FIND_SKILL(Character::Base &player, Skill::Type skill)
+    inline int FIND_SKILL(Character::Base &player, Skill::Type skill)
     {
         auto found = -1;
 
@@ -181,7 +206,7 @@ namespace Character
         return found;
     }
 
-    bool VERIFY_ITEMS(Character::Base &player, std::vector<Item::Type> items)
+    inline bool VERIFY_ITEMS(Character::Base &player, std::vector<Item::Type> items)
     {
         auto found = 0;
 
@@ -201,7 +226,7 @@ namespace Character
         return found >= items.size();
     }
 
-    int COUNT_ITEMS(Character::Base &player, std::vector<Item::Base> items)
+    inline int COUNT_ITEMS(Character::Base &player, std::vector<Item::Base> items)
     {
         auto found = 0;
 
@@ -216,13 +241,13 @@ namespace Character
         return found;
     }
 
-    bool VERIFY_ITEMS_ANY(Character::Base &player, std::vector<Item::Base> items)
+    inline bool VERIFY_ITEMS_ANY(Character::Base &player, std::vector<Item::Base> items)
     {
         return Character::COUNT_ITEMS(player, items) > 0;
     }
 
     // Checks if player has the skill and the required item
-    bool VERIFY_SKILL(Character::Base &player, Skill::Type skill)
+    inline bool VERIFY_SKILL(Character::Base &player, Skill::Type skill)
     {
         auto found = false;
 
@@ -248,7 +273,7 @@ namespace Character
         return found;
     }
 
-    bool VERIFY_ANY_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
+    inline bool VERIFY_ANY_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
     {
         auto found = false;
 
@@ -268,7 +293,7 @@ namespace Character
         return found;
     }
 
-    bool VERIFY_ALL_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
+    inline bool VERIFY_ALL_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
     {
         auto found = 0;
 
@@ -286,7 +311,7 @@ namespace Character
         return found == skills.size();
     }
 
-    bool HAS_SKILL(Character::Base &player, Skill::Type skill)
+    inline bool HAS_SKILL(Character::Base &player, Skill::Type skill)
     {
         auto found = false;
 
@@ -306,7 +331,7 @@ namespace Character
         return found;
     }
 
-    int FIND_SKILL_ITEMS(Character::Base &player, Skill::Type skill, std::vector<Item::Type> items)
+    inline int FIND_SKILL_ITEMS(Character::Base &player, Skill::Type skill, std::vector<Item::Type> items)
     {
         auto found = 0;
 
@@ -331,23 +356,23 @@ namespace Character
     }
 
     // verify that player has the skill and ANY of the items
-    bool VERIFY_SKILL_ANY_ITEMS(Character::Base &player, Skill::Type skill, std::vector<Item::Type> items)
+    inline bool VERIFY_SKILL_ANY_ITEMS(Character::Base &player, Skill::Type skill, std::vector<Item::Type> items)
     {
         return Character::FIND_SKILL_ITEMS(player, skill, items) > 0;
     }
 
     // verify that player has the skill and ALL of the items
-    bool VERIFY_SKILL_ALL_ITEMS(Character::Base &player, Skill::Type skill, std::vector<Item::Type> items)
+    inline bool VERIFY_SKILL_ALL_ITEMS(Character::Base &player, Skill::Type skill, std::vector<Item::Type> items)
     {
         return Character::FIND_SKILL_ITEMS(player, skill, items) >= items.size();
     }
 
-    bool VERIFY_SKILL_ITEM(Character::Base &player, Skill::Type skill, Item::Type item)
+    inline bool VERIFY_SKILL_ITEM(Character::Base &player, Skill::Type skill, Item::Type item)
     {
         return Character::VERIFY_SKILL_ALL_ITEMS(player, skill, {item});
     }
 
-    int FIND_CODEWORD(Character::Base &player, Codeword::Type codeword)
+    inline int FIND_CODEWORD(Character::Base &player, Codeword::Type codeword)
     {
         auto found = -1;
 
@@ -367,7 +392,7 @@ namespace Character
         return found;
     }
 
-    int FIND_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
+    inline int FIND_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
     {
         auto found = 0;
 
@@ -387,37 +412,37 @@ namespace Character
         return found;
     }
 
-    bool VERIFY_CODEWORDS_ANY(Character::Base &player, std::vector<Codeword::Type> codewords)
+    inline bool VERIFY_CODEWORDS_ANY(Character::Base &player, std::vector<Codeword::Type> codewords)
     {
         return Character::FIND_CODEWORDS(player, codewords) > 0;
     }
 
-    bool VERIFY_CODEWORDS_ALL(Character::Base &player, std::vector<Codeword::Type> codewords)
+    inline bool VERIFY_CODEWORDS_ALL(Character::Base &player, std::vector<Codeword::Type> codewords)
     {
         return Character::FIND_CODEWORDS(player, codewords) == codewords.size();
     }
 
-    bool VERIFY_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
+    inline bool VERIFY_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
     {
         return Character::VERIFY_CODEWORDS_ALL(player, codewords);
     }
 
-    bool VERIFY_LIFE(Character::Base &player, int threshold = 0)
+    inline bool VERIFY_LIFE(Character::Base &player, int threshold = 0)
     {
         return player.Life > threshold;
     }
 
-    bool VERIFY_POSSESSIONS(Character::Base &player)
+    inline bool VERIFY_POSSESSIONS(Character::Base &player)
     {
         return player.Items.size() <= player.ITEM_LIMIT;
     }
 
-    void GET_ITEMS(Character::Base &player, std::vector<Item::Base> items)
+    inline void GET_ITEMS(Character::Base &player, std::vector<Item::Base> items)
     {
         player.Items.insert(player.Items.end(), items.begin(), items.end());
     }
 
-    void GET_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
+    inline void GET_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
     {
         for (auto i = 0; i < codewords.size(); i++)
         {
@@ -428,7 +453,7 @@ namespace Character
         }
     }
 
-    void REMOVE_CODEWORD(Character::Base &player, Codeword::Type codeword)
+    inline void REMOVE_CODEWORD(Character::Base &player, Codeword::Type codeword)
     {
         if (Character::VERIFY_CODEWORDS(player, {codeword}))
         {
@@ -441,7 +466,7 @@ namespace Character
         }
     }
 
-    void GET_UNIQUE_ITEMS(Character::Base &player, std::vector<Item::Base> items)
+    inline void GET_UNIQUE_ITEMS(Character::Base &player, std::vector<Item::Base> items)
     {
         for (auto i = 0; i < items.size(); i++)
         {
@@ -452,7 +477,7 @@ namespace Character
         }
     }
 
-    void LOSE_ITEMS(Character::Base &player, std::vector<Item::Type> items)
+    inline void LOSE_ITEMS(Character::Base &player, std::vector<Item::Type> items)
     {
         if (player.Items.size() > 0 && items.size() > 0)
         {
@@ -468,7 +493,7 @@ namespace Character
         }
     }
 
-    void LOSE_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
+    inline void LOSE_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
     {
         if (player.Skills.size() > 0 && skills.size() > 0)
         {
@@ -486,7 +511,7 @@ namespace Character
         }
     }
 
-    void GAIN_LIFE(Character::Base &player, int life)
+    inline void GAIN_LIFE(Character::Base &player, int life)
     {
         if ((life < 0 && !player.IsImmortal) || life > 0)
         {
@@ -503,7 +528,7 @@ namespace Character
         }
     }
 
-    void GAIN_MONEY(Character::Base &player, int money)
+    inline void GAIN_MONEY(Character::Base &player, int money)
     {
         player.Money += money;
 
@@ -518,14 +543,14 @@ namespace Character
         }
     }
 
-    void LOSE_POSSESSIONS(Character::Base &player)
+    inline void LOSE_POSSESSIONS(Character::Base &player)
     {
         player.LostItems = player.Items;
 
         player.Items.clear();
     }
 
-    void LOSE_ALL(Character::Base &player)
+    inline void LOSE_ALL(Character::Base &player)
     {
         player.LostMoney = player.LostMoney;
         player.Money = 0;
@@ -533,7 +558,7 @@ namespace Character
         Character::LOSE_POSSESSIONS(player);
     }
 
-    void SCORE(Character::Base &player, int &scorer, int score)
+    inline void SCORE(Character::Base &player, int &scorer, int score)
     {
         scorer += score;
 
@@ -0,0 +1,506 @@
+// Standard IO
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+// Using SDL
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "config.hpp"
+#include "controls.hpp"
+#include "handles.hpp"
+#include "render.hpp"
+#include "widgets.hpp"
+#include "runner.hpp"
+#include "input.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "story.hpp"
+#include "graphics.hpp"
+#include "screens.hpp"
+
+AdventureSheet::AdventureSheet(TTF_Font *font)
+{
+    const int profilew = SCREEN_WIDTH * (1.0 - 2.0 * Margin);
+    const int profileh = 0.12 * SCREEN_HEIGHT;
+
+    auto headerw = splashw;
+    auto headerh = 0.07 * SCREEN_HEIGHT;
+    auto space = Video.Scaled(8);
+
+    auto marginw = Margin * SCREEN_WIDTH;
+    auto marginh = Margin * SCREEN_HEIGHT / 2;
+
+    auto boxw = (profilew - marginw) / 2;
+    auto boxh = headerh;
+
+    // the header is twice as wide when the name carries a status
+    name = widgets.Add<Widget::Label>("", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty);
+    status = widgets.Add<Widget::Label>("", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw * 2, headerh, startx, starty);
+    description = widgets.Add<Widget::Label>("", font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, profileh, startx, starty + headerh);
+
+    widgets.Add<Widget::Label>("Skills", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + headerh + marginh);
+    skills = widgets.Add<Widget::Label>("", font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, boxh, startx, starty + profileh + 2 * headerh + marginh);
+
+    widgets.Add<Widget::Label>("Life", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + 2 * headerh + 2 * marginh + boxh);
+    life = widgets.Add<Widget::Label>("", font, space, clrBK, intBE, TTF_STYLE_NORMAL, boxw, boxh, startx, starty + profileh + 3 * headerh + 2 * marginh + boxh);
+
+    widgets.Add<Widget::Label>("Money", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx + boxw + marginw, starty + profileh + 2 * headerh + 2 * marginh + boxh);
+    money = widgets.Add<Widget::Label>("", font, space, clrBK, intBE, TTF_STYLE_NORMAL, boxw, boxh, startx + boxw + marginw, starty + profileh + 3 * headerh + 2 * marginh + boxh);
+
+    widgets.Add<Widget::Label>("Possessions", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + 3 * headerh + 3 * marginh + 2 * boxh);
+    possessions = widgets.Add<Widget::Label>("", font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, profileh, startx, starty + profileh + 4 * headerh + 3 * marginh + 2 * boxh);
+
+    genderx = startx + boxw + marginw;
+    genderh = (int)(0.07 * SCREEN_HEIGHT) - space;
+    genderw = splashw / 2;
+    genderspace = 2 * space;
+
+    male = widgets.Add<Widget::Label>("MALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, genderx, starty);
+    female = widgets.Add<Widget::Label>("FEMALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, genderx + genderw + genderspace, starty);
+}
+
+void AdventureSheet::Render(SDL_Renderer *renderer, Character::Base &player, Character::Gender gender)
+{
+    std::string skills_string;
+
+    for (auto i = 0; i < player.Skills.size(); i++)
+    {
+        if (i > 0)
+        {
+            skills_string += ", ";
+        }
+
+        skills_string += player.Skills[i].Name;
+    }
+
+    std::string possessions_string;
+
+    for (auto i = 0; i < player.Items.size(); i++)
+    {
+        if (i > 0)
+        {
+            possessions_string += ", ";
+        }
+
+        possessions_string += player.Items[i].Name;
+
+        if (player.Items[i].Charge >= 0)
+        {
+            possessions_string += " (";
+
+            if (player.Items[i].Charge == 0)
+            {
+                possessions_string += "destroyed";
+            }
+
+            possessions_string += ")";
+        }
+    }
+
+    auto name_string = player.Name;
+
+    if (gender == Character::Gender::NONE)
+    {
+        if (player.Gender == Character::Gender::MALE)
+        {
+            name_string += " (Male)";
+        }
+        else if (player.Gender == Character::Gender::FEMALE)
+        {
+            name_string += " (Female)";
+        }
+    }
+
+    if (player.IsImmortal || player.IsBlessed)
+    {
+        name_string += " (";
+
+        if (player.IsImmortal)
+        {
+            name_string += "Immortal";
+
+            if (player.IsBlessed)
+            {
+                name_string += ", ";
+            }
+        }
+
+        if (player.IsBlessed)
+        {
+            name_string += "Blessed";
+        }
+
+        name_string += ")";
+    }
+
+    name->Visible = !(player.IsImmortal || player.IsBlessed);
+
+    status->Visible = !name->Visible;
+
+    (name->Visible ? name : status)->Set(name_string);
+
+    description->Set(player.Description);
+
+    skills->Set(skills_string);
+
+    life->Set(std::to_string(player.Life));
+
+    money->Set(std::to_string(player.Money) + " cacao");
+
+    possessions->Set(player.Items.size() > 0 ? possessions_string : "(None)");
+
+    male->Visible = gender != Character::Gender::NONE;
+
+    female->Visible = gender != Character::Gender::NONE;
+
+    // Fill the surface with background color
+    fillWindow(renderer, intWH);
+
+    widgets.Render(renderer);
+
+    if (gender == Character::Gender::MALE)
+    {
+        drawRect(renderer, genderw, genderh, genderx, starty, intBK);
+    }
+    else if (gender == Character::Gender::FEMALE)
+    {
+        drawRect(renderer, genderw, genderh, genderx + genderw + genderspace, starty, intBK);
+    }
+}
+
+std::vector<Button> skillsList(SDL_Window *window, SDL_Renderer *renderer, int start, int last, int limit)
+{
+    auto font_size = Video.Scaled(20);
+    auto text_space = Video.Scaled(8);
+    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+
+    auto controls = std::vector<Button>();
+
+    for (int i = 0; i < last - start; i++)
+    {
+        auto index = start + i;
+
+        std::string item_string = Skill::ALL[index].Name;
+
+        auto text = listRow(item_string, font_size, textwidth - 4 * text_space);
+
+        auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
+
+        controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < (last - start) ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
+
+        controls[i].W = textwidth - 4 * text_space;
+
+        controls[i].H = text->h;
+    }
+
+    auto idx = controls.size();
+
+    if (Skill::ALL.size() > limit)
+    {
+        if (start > 0)
+        {
+            controls.push_back(Button(idx, "icons/up-arrow.png", 0, idx, idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+
+            idx++;
+        }
+
+        if (Skill::ALL.size() - last > 0)
+        {
+            controls.push_back(Button(idx, "icons/down-arrow.png", 0, idx, start > 0 ? idx - 1 : idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, (texty + 2 * text_bounds / 3 - arrow_size - border_space), Control::Type::SCROLL_DOWN));
+
+            idx++;
+        }
+    }
+
+    idx = controls.size();
+
+    auto button_width = Video.Scaled(100);
+    auto button_space = Video.Scaled(25);
+    auto button_height = Video.Scaled(48);
+
+    controls.push_back(Button(idx, createHeaderButton(window, "Glossary", clrWH, intBK, button_width, button_height, -1), idx, idx + 1, idx - 1, idx, startx, buttony, Control::Type::GLOSSARY));
+    controls.push_back(Button(idx + 1, createHeaderButton(window, "Start", clrWH, intBK, button_width, button_height, -1), idx, idx + 2, idx - 1, idx + 1, startx + (button_width + button_space), buttony, Control::Type::NEW));
+    controls.push_back(Button(idx + 2, createHeaderButton(window, "Back", clrWH, intBK, button_width, button_height, -1), idx + 1, idx + 2, idx - 1, idx + 2, startx + 2 * (button_width + button_space), buttony, Control::Type::BACK));
+
+    return controls;
+}
+
+Character::Base customCharacter(SDL_Window *window, SDL_Renderer *renderer)
+{
+    auto screen = Frame::Screen();
+
+    Character::Base player = Character::Base();
+
+    auto gender = Character::Gender::NONE;
+
+    // Render the image
+    if (window && renderer)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto selection = std::vector<int>();
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.150 * SCREEN_HEIGHT;
+        auto box_space = Video.Scaled(10);
+
+        auto genderh = infoh;
+        auto genderw = splashw;
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls: Create Character");
+
+        runner.Duration = 5000;
+
+        runner.Limit = (int)(2 * text_bounds / 3 - text_space) / (font_size + 7 * text_space / 2);
+
+        runner.Count = [&]() {
+            return (int)Skill::ALL.size();
+        };
+
+        runner.List = [&]() {
+            return skillsList(window, renderer, runner.Offset, runner.Last(), runner.Limit);
+        };
+
+        runner.Refresh();
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth, 2 * text_bounds / 3, textx, texty);
+        runner.Widgets.Add<Widget::Panel>(intDB, textwidth, text_bounds / 3 - texty, textx, 2 * (texty + text_bounds / 3));
+
+        runner.Widgets.Add<Widget::Label>("SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * boxh + infoh - 1));
+        auto selected_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh);
+
+        auto description_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, textwidth, text_bounds / 3 - texty, textx, 2 * (texty + text_bounds / 3));
+
+        runner.Message = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+        runner.Status = runner.Widgets.Add<Widget::Label>("SELECT 4 Skills for your character.", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        auto male_box = runner.Widgets.Add<Widget::Label>("MALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, startx, starty + boxh + box_space);
+        auto female_box = runner.Widgets.Add<Widget::Label>("FEMALE", font, -1, clrBK, intWH, TTF_STYLE_NORMAL, genderw, genderh, startx, starty + boxh + box_space + genderh + text_space);
+
+        runner.Update = [&]() {
+            std::string selection_string = "";
+
+            for (auto i = 0; i < selection.size(); i++)
+            {
+                selection_string += (i > 0 ? ", " : "") + std::string(Skill::ALL[selection[i]].Name);
+            }
+
+            selected_box->Set(selection.size() > 0 ? selection_string : "(None)");
+
+            description_box->Set(runner.Current >= 0 && runner.Current < runner.Last() - runner.Offset ? Skill::ALL[runner.Current + runner.Offset].Description : "");
+
+            male_box->Visible = gender != Character::Gender::NONE;
+
+            female_box->Visible = gender != Character::Gender::NONE;
+        };
+
+        runner.Draw = [&]() {
+            markSelection(runner.Controls, selection, runner.Offset, runner.Last(), text_space);
+
+            if (gender == Character::Gender::MALE)
+            {
+                drawRect(renderer, genderw, genderh, startx, starty + boxh + box_space, intBK);
+            }
+            else if (gender == Character::Gender::FEMALE)
+            {
+                drawRect(renderer, genderw, genderh, startx, starty + boxh + box_space + genderh + text_space, intBK);
+            }
+        };
+
+        runner.Act = [&](Control::Type type) {
+            auto index = runner.Current + runner.Offset;
+
+            if (type == Control::Type::ACTION && index < Skill::ALL.size())
+            {
+                auto result = Skill::FIND_LIST(selection, index);
+
+                if (result >= 0)
+                {
+                    selection.erase(selection.begin() + result);
+                }
+                else if (selection.size() < player.SKILLS_LIMIT)
+                {
+                    selection.push_back(index);
+                }
+            }
+            else if (type == Control::Type::NEW)
+            {
+                if (selection.size() == player.SKILLS_LIMIT)
+                {
+                    Character::CUSTOM.Skills.clear();
+                    Character::CUSTOM.Items.clear();
+
+                    for (auto i = 0; i < selection.size(); i++)
+                    {
+                        Character::CUSTOM.Skills.push_back(Skill::ALL[selection[i]]);
+
+                        if (Skill::ALL[selection[i]].Type == Skill::Type::SWORDPLAY)
+                        {
+                            Character::CUSTOM.Items.push_back(Item::SWORD);
+                        }
+                        else if (Skill::ALL[selection[i]].Type == Skill::Type::SPELLS)
+                        {
+                            Character::CUSTOM.Items.push_back(Item::MAGIC_WAND);
+                        }
+                        else if (Skill::ALL[selection[i]].Type == Skill::Type::TARGETING)
+                        {
+                            Character::CUSTOM.Items.push_back(Item::BLOWGUN);
+                        }
+                        else if (Skill::ALL[selection[i]].Type == Skill::Type::CHARMS)
+                        {
+                            Character::CUSTOM.Items.push_back(Item::MAGIC_AMULET);
+                        }
+                    }
+
+                    Character::CUSTOM.Money = 12;
+                    Character::CUSTOM.Life = 10;
+                    Character::CUSTOM.Gender = gender;
+
+                    player = Character::CUSTOM;
+
+                    return true;
+                }
+
+                runner.Flash("Please select " + std::to_string(player.SKILLS_LIMIT) + " skills.");
+
+                runner.Current = -1;
+            }
+            else if (type == Control::Type::GLOSSARY)
+            {
+                glossaryScreen(window, renderer, std::vector<Skill::Base>(Skill::ALL.begin(), Skill::ALL.end()));
+
+                runner.Current = -1;
+            }
+
+            return type == Control::Type::BACK;
+        };
+
+        runner.Run();
+    }
+
+    return player;
+}
+
+Character::Base selectCharacter(SDL_Window *window, SDL_Renderer *renderer)
+{
+    auto screen = Frame::Screen();
+
+    Character::Base player = Character::Classes[0];
+
+    // Render the image
+    if (window && renderer)
+    {
+        auto character = 0;
+        auto main_buttonh = Video.Scaled(48);
+        auto font_size = Video.Scaled(18);
+        auto gender = Character::Gender::NONE;
+
+        const char *choices[6] = {"Previous", "Next", "Glossary", "Custom", "Start", "Back"};
+
+        auto runner = Widget::Runner<TextButton>(window, renderer, "Necklace of Skulls: Select Character");
+
+        runner.Controls = createHTextButtons(choices, 6, main_buttonh, startx, SCREEN_HEIGHT * (1.0 - Margin) - main_buttonh);
+
+        runner.Controls[0].Type = Control::Type::BACK;
+        runner.Controls[1].Type = Control::Type::NEXT;
+        runner.Controls[2].Type = Control::Type::GLOSSARY;
+        runner.Controls[3].Type = Control::Type::CUSTOM;
+        runner.Controls[4].Type = Control::Type::NEW;
+        runner.Controls[5].Type = Control::Type::QUIT;
+
+        runner.FontSize = Video.Scaled(20);
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto sheet = AdventureSheet(font);
+
+        runner.Update = [&]() {
+            sheet.Render(renderer, Character::Classes[character], Character::Gender::NONE);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::NEW)
+            {
+                player = Character::Classes[character];
+
+                player.Gender = gender;
+
+                return true;
+            }
+            else if (type == Control::Type::BACK)
+            {
+                if (character > 0)
+                {
+                    character--;
+                }
+            }
+            else if (type == Control::Type::NEXT)
+            {
+                if (character < Character::Classes.size() - 1)
+                {
+                    character++;
+                }
+            }
+            else if (type == Control::Type::GLOSSARY)
+            {
+                glossaryScreen(window, renderer, std::vector<Skill::Base>(Skill::ALL.begin(), Skill::ALL.end()));
+
+                runner.Current = -1;
+            }
+            else if (type == Control::Type::CUSTOM)
+            {
+                player = customCharacter(window, renderer);
+
+                runner.Current = -1;
+
+                return player.Skills.size() == player.SKILLS_LIMIT;
+            }
+
+            else if (type == Control::Type::QUIT)
+            {
+                player = Character::Base();
+
+                player.StoryID = -1;
+
+                return true;
+            }
+
+            return false;
+        };
+
+        if (runner.Run())
+        {
+            // closing the window goes back to the main menu
+            player = Character::Base();
+
+            player.StoryID = -1;
+        }
+    }
+
+    return player;
+}
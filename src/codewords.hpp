@@ -1,66 +1,42 @@
 #ifndef __CODEWORDS__HPP__
 #define __CODEWORDS__HPP__
 
-#include <map>
+#include "catalogue.hpp"
 
 namespace Codeword
 {
     enum class Type
     {
         NONE = -1,
-        ANGEL,
-        BLESSING,
-        CALABASH,
-        CENOTE,
-        EB,
-        IGNIS,
-        OLMEK,
-        PAKAL,
-        POKTAPOK,
-        PSYCHODUCT,
-        SAKBE,
-        SALVATION,
-        SHADE,
-        VENUS,
-        ZAZ,
-        ZOTZ
+#define CODEWORD_TYPE(type, name, invisible) type,
+        SKULLS_CODEWORDS(CODEWORD_TYPE)
+#undef CODEWORD_TYPE
     };
 
-    std::map<Codeword::Type, const char *> Descriptions = {
-        {Codeword::Type::ANGEL, "Angel"},
-        {Codeword::Type::BLESSING, "Blessing"},
-        {Codeword::Type::CALABASH, "Calabash"},
-        {Codeword::Type::CENOTE, "Cenote"},
-        {Codeword::Type::EB, "Eb"},
-        {Codeword::Type::IGNIS, "Ignis"},
-        {Codeword::Type::OLMEK, "Olmek"},
-        {Codeword::Type::PAKAL, "Pakal"},
-        {Codeword::Type::POKTAPOK, "Poktapok"},
-        {Codeword::Type::PSYCHODUCT, "Psychoduct"},
-        {Codeword::Type::SAKBE, "Sakbe"},
-        {Codeword::Type::SALVATION, "Salvation"},
-        {Codeword::Type::SHADE, "Shade"},
-        {Codeword::Type::VENUS, "Venus"},
-        {Codeword::Type::ZAZ, "Zaz"},
-        {Codeword::Type::ZOTZ, "Zotz"}};
+#define CODEWORD_NAME(type, name, invisible) name,
+    inline constexpr const char *NAMES[] = {SKULLS_CODEWORDS(CODEWORD_NAME)};
+#undef CODEWORD_NAME
 
-    std::vector<Codeword::Type> Invisible = {};
+#define CODEWORD_INVISIBLE(type, name, invisible) invisible,
+    inline constexpr bool INVISIBLE[] = {SKULLS_CODEWORDS(CODEWORD_INVISIBLE)};
+#undef CODEWORD_INVISIBLE
 
-    bool IsInvisible(Codeword::Type codeword)
-    {
-        auto invisible = false;
+    constexpr int COUNT = sizeof(NAMES) / sizeof(NAMES[0]);
 
-        for (auto i = 0; i < Codeword::Invisible.size(); i++)
-        {
-            if (Codeword::Invisible[i] == codeword)
-            {
-                invisible = true;
+    constexpr bool IsValid(Codeword::Type codeword)
+    {
+        return (int)codeword >= 0 && (int)codeword < Codeword::COUNT;
+    }
 
-                break;
-            }
-        }
+    // Display name ("" for NONE or an unknown value)
+    constexpr const char *Description(Codeword::Type codeword)
+    {
+        return Codeword::IsValid(codeword) ? Codeword::NAMES[(int)codeword] : "";
+    }
 
-        return invisible;
+    constexpr bool IsInvisible(Codeword::Type codeword)
+    {
+        return Codeword::IsValid(codeword) && Codeword::INVISIBLE[(int)codeword];
     }
 
 } // namespace Codeword
@@ -1,12 +1,33 @@
 #ifndef __CONFIG__HPP__
 #define __CONFIG__HPP__
 
-// Future re-scalable, HD mode
+// Re-scalable (HD) mode. All layout is specified against the 980 x 700 design size and scaled to the actual framebuffer
 class Config
 {
 public:
-    int SCREEN_WIDTH = 1024;
-    int SCREEN_HEIGHT = 768;
+    // Design (reference) resolution
+    static const int BASE_WIDTH = 980;
+    static const int BASE_HEIGHT = 700;
+
+    // Framebuffer size in pixels
+    int SCREEN_WIDTH = 980;
+    int SCREEN_HEIGHT = 700;
+
+    // Requested window size in screen coordinates (0 = use the design size or the desktop when fullscreen)
+    int WindowWidth = 0;
+    int WindowHeight = 0;
+
+    bool Fullscreen = false;
+    bool HighDPI = false;
+
+    // Pixels per design unit
+    double Scale = 1.0;
+
+    // Framebuffer pixels per window (mouse) coordinate
+    double PixelRatio = 1.0;
+
+    // Bumped every time the framebuffer size changes so that scaled assets can be regenerated
+    int Generation = 0;
 
     double Margin = 0.05;
 
@@ -30,8 +51,33 @@ public:
     int headerw;
     int profilew;
 
+    // Convert a size in design units (pixels at 980 x 700) to framebuffer pixels
+    int Scaled(int pixels)
+    {
+        auto scaled = (int)(pixels * Scale + 0.5);
+
+        return (pixels > 0 && scaled < 1) ? 1 : scaled;
+    }
+
+    // Convert window (mouse) coordinates to framebuffer pixels
+    void Pixels(int &x, int &y)
+    {
+        x = (int)(x * PixelRatio);
+        y = (int)(y * PixelRatio);
+    }
+
     void ComputeBounds()
     {
+        buttonw = Scaled(64);
+        buttonh = Scaled(64);
+
+        button_space = Scaled(20);
+        border_space = Scaled(8);
+        border_pts = Scaled(4);
+        arrow_size = Scaled(32);
+
+        splashw = 0.30 * (SCREEN_WIDTH * (1.0 - 3.0 * Margin));
+
         startx = (SCREEN_WIDTH * Margin);
         starty = (SCREEN_HEIGHT * Margin);
 
@@ -50,24 +96,33 @@ public:
         headerw = 0.6 * splashw;
     }
 
-    Config()
+    // Set the framebuffer size and derive the scale factor and the layout from it
+    void Resize(int width, int height)
     {
-        SCREEN_WIDTH = 800;
-        SCREEN_HEIGHT = 600;
+        if (width > 0 && height > 0)
+        {
+            SCREEN_WIDTH = width;
+            SCREEN_HEIGHT = height;
+
+            auto scalex = (double)SCREEN_WIDTH / BASE_WIDTH;
+            auto scaley = (double)SCREEN_HEIGHT / BASE_HEIGHT;
+
+            Scale = scalex < scaley ? scalex : scaley;
 
-        splashw = 250;
+            Generation++;
 
-        ComputeBounds();
+            ComputeBounds();
+        }
     }
 
-    Config(int width, int height)
+    Config()
     {
-        SCREEN_WIDTH = width;
-        SCREEN_HEIGHT = height;
-
-        splashw = 0.30 * (1.0 - 3.0 * Margin) * SCREEN_WIDTH;
+        Resize(BASE_WIDTH, BASE_HEIGHT);
+    }
 
-        ComputeBounds();
+    Config(int width, int height)
+    {
+        Resize(width, height);
     }
 };
 
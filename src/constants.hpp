@@ -3,7 +3,9 @@
 
 #include <SDL.h>
 
-const char *FONT_FILE = "fonts/bookman-old-style.ttf";
+#include "config.hpp"
+
+inline const char *FONT_FILE = "fonts/bookman-old-style.ttf";
 
 const SDL_Color clrBK = {0, 0, 0, 0};
 const SDL_Color clrDB = {7, 7, 58, 0};
@@ -38,49 +40,39 @@ const Uint32 BE_80 = 0xBBF5F5DC;
 // Light Blue in ARG format
 const Uint32 intLB = 0xFF0A64AD;
 
-Uint8 R(Uint32 c) { return (Uint8)((c & 0xFF0000) >> 16); }
-Uint8 G(Uint32 c) { return (Uint8)((c & 0x00FF00) >> 8); }
-Uint8 B(Uint32 c) { return (Uint8)(c & 0x0000FF); }
-Uint8 A(Uint32 c) { return (Uint8)(c >> 24); }
-
-// Screen dimension constants
-int SCREEN_WIDTH = 980;
-int SCREEN_HEIGHT = 700;
-
-double Margin = 0.05;
-
-int splashw = 0.30 * (SCREEN_WIDTH * (1.0 - 3.0 * Margin));
-int startx = (SCREEN_WIDTH * Margin);
-int starty = (SCREEN_HEIGHT * Margin);
-int textx = startx * 2 + splashw;
-int texty = starty;
-int buttonw = 64;
-int buttonh = 64;
-int buttony = (int)(SCREEN_HEIGHT * (1.0 - Margin) - buttonh);
-
-int button_space = 20;
-int gridsize = buttonw + button_space;
-int border_space = 8;
-int border_pts = 4;
-int arrow_size = 32;
-int text_bounds = SCREEN_HEIGHT * (1.0 - Margin * 2.0) - buttonh - button_space * 2;
-int textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-
-void Recompute()
+inline Uint8 R(Uint32 c) { return (Uint8)((c & 0xFF0000) >> 16); }
+inline Uint8 G(Uint32 c) { return (Uint8)((c & 0x00FF00) >> 8); }
+inline Uint8 B(Uint32 c) { return (Uint8)(c & 0x0000FF); }
+inline Uint8 A(Uint32 c) { return (Uint8)(c >> 24); }
+
+// Screen dimensions and layout, scaled to the actual framebuffer (see config.hpp)
+inline Config Video = Config();
+
+inline int &SCREEN_WIDTH = Video.SCREEN_WIDTH;
+inline int &SCREEN_HEIGHT = Video.SCREEN_HEIGHT;
+
+inline double &Margin = Video.Margin;
+
+inline int &splashw = Video.splashw;
+inline int &startx = Video.startx;
+inline int &starty = Video.starty;
+inline int &textx = Video.textx;
+inline int &texty = Video.texty;
+inline int &buttonw = Video.buttonw;
+inline int &buttonh = Video.buttonh;
+inline int &buttony = Video.buttony;
+
+inline int &button_space = Video.button_space;
+inline int &gridsize = Video.gridsize;
+inline int &border_space = Video.border_space;
+inline int &border_pts = Video.border_pts;
+inline int &arrow_size = Video.arrow_size;
+inline int &text_bounds = Video.text_bounds;
+inline int &textwidth = Video.textwidth;
+
+inline void Recompute()
 {
-    splashw = 0.30 * (SCREEN_WIDTH * (1.0 - 3.0 * Margin));
-
-    startx = (SCREEN_WIDTH * Margin);
-    starty = (SCREEN_HEIGHT * Margin);
-
-    textx = startx * 2 + splashw;
-    texty = starty;
-
-    buttony = (int)(SCREEN_HEIGHT * (1.0 - Margin) - buttonh);
-    gridsize = buttonw + button_space;
-
-    textwidth = ((1.0 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
-    text_bounds = SCREEN_HEIGHT * (1.0 - Margin * 2.0) - buttonh - button_space * 2;
+    Video.ComputeBounds();
 }
 
 #endif
@@ -7,6 +7,10 @@
 #include <SDL.h>
 #include <SDL_image.h>
 
+#include "assets.hpp"
+#include "handles.hpp"
+#include "memory.hpp"
+
 namespace Control
 {
     enum class Type
@@ -104,7 +108,7 @@ class Button : public Control::Base
 private:
     SDL_Surface *createImage(const char *file)
     {
-        auto surface = IMG_Load(File);
+        auto surface = Asset::Icon(file);
 
         if (surface == NULL)
         {
@@ -130,7 +134,7 @@ private:
         X = x;
         Y = y;
 
-        Surface = createImage(file);
+        Surface = Handle::Share(createImage(file));
     }
 
     void construct(int id, int left, int right, int up, int down, int x, int y)
@@ -144,10 +148,29 @@ private:
         Y = y;
     }
 
+    void copy(const Button &src)
+    {
+        ID = src.ID;
+        Type = src.Type;
+        File = src.File;
+        Left = src.Left;
+        Right = src.Right;
+        Up = src.Up;
+        Down = src.Down;
+        X = src.X;
+        Y = src.Y;
+        W = src.W;
+        H = src.H;
+
+        // the image is never changed, copies share it
+        Surface = src.Surface;
+    }
+
 public:
     const char *File = NULL;
 
-    SDL_Surface *Surface = NULL;
+    // Shared with copies of the button (and with the pool it came from), freed with its last owner
+    Handle::SharedSurface Surface;
 
     Button()
     {
@@ -165,11 +188,12 @@ public:
         construct(id, file, left, right, up, down, x, y);
     }
 
+    // Takes ownership of image
     Button(int id, SDL_Surface *image, int left, int right, int up, int down, int x, int y, Control::Type type)
     {
         Type = type;
 
-        Surface = image;
+        Surface = Handle::Share(Memory::Track(Memory::Type::BUTTONS, image));
 
         if (Surface)
         {
@@ -180,70 +204,43 @@ public:
         construct(id, left, right, up, down, x, y);
     }
 
-    // constructor for making deep copies of Button controls
-    Button(const Button &src)
+    // Shares a pooled image (e.g. a list row), the pool keeps its attribution
+    Button(int id, Handle::SharedSurface image, int left, int right, int up, int down, int x, int y, Control::Type type)
     {
-        ID = src.ID;
-        Type = src.Type;
-        File = src.File;
-        Left = src.Left;
-        Right = src.Right;
-        Up = src.Up;
-        Down = src.Down;
-        X = src.X;
-        Y = src.Y;
-        W = src.W;
-        H = src.H;
+        Type = type;
+
+        Surface = image;
 
-        if (src.Surface)
+        if (Surface)
         {
-            Surface = SDL_ConvertSurface(src.Surface, src.Surface->format, 0);
+            W = Surface->w;
+            H = Surface->h;
         }
+
+        construct(id, left, right, up, down, x, y);
+    }
+
+    // copies share the image
+    Button(const Button &src)
+    {
+        copy(src);
     }
 
-    // operator overload for making deep copies of Button controls
+    // copies share the image
     Button &operator=(const Button &src)
     {
         // self-assignment protection
         if (this != &src)
         {
-            ID = src.ID;
-            Type = src.Type;
-            File = src.File;
-            Left = src.Left;
-            Right = src.Right;
-            Up = src.Up;
-            Down = src.Down;
-            X = src.X;
-            Y = src.Y;
-            W = src.W;
-            H = src.H;
-
-            if (Surface)
-            {
-                SDL_FreeSurface(Surface);
-
-                Surface = NULL;
-            }
-
-            if (src.Surface)
-            {
-                Surface = SDL_ConvertSurface(src.Surface, src.Surface->format, 0);
-            }
+            copy(src);
         }
 
         return *this;
     }
 
-    // free allocated surface
-    ~Button()
-    {
-        if (Surface)
-        {
-            SDL_FreeSurface(Surface);
+    // moving a button (e.g. when the control vectors grow or are rebuilt) transfers the image without touching its owners
+    Button(Button &&src) = default;
 
-            Surface = NULL;
-        }
-    }
+    Button &operator=(Button &&src) = default;
 };
 #endif
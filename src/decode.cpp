@@ -0,0 +1,343 @@
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "memory.hpp"
+#include "textures.hpp"
+#include "cache.hpp"
+#include "decode.hpp"
+
+namespace Decode
+{
+    class Job
+    {
+    public:
+        std::promise<SDL_Surface *> Promise;
+
+        std::shared_future<SDL_Surface *> Future;
+
+        SDL_Surface *Surface = NULL;
+
+        bool Done = false;
+
+        bool Taken = false;
+
+        // a prefetch that nobody asked for yet, only these can be dropped
+        Decode::Priority Priority = Decode::Priority::PREFETCH;
+
+        // order of the requests, for dropping the oldest
+        long long Order = 0;
+
+        Job(long long order, Decode::Priority priority)
+        {
+            Future = Promise.get_future().share();
+
+            Order = order;
+
+            Priority = priority;
+        }
+    };
+
+    std::mutex Lock;
+
+    std::condition_variable Signal;
+
+    std::vector<std::thread> Workers = std::vector<std::thread>();
+
+    bool Running = false;
+
+    // files waiting for a worker, one queue per priority
+    std::deque<std::string> Queues[2];
+
+    // requested images that were not taken yet
+    std::map<std::string, std::shared_ptr<Decode::Job>> Jobs = std::map<std::string, std::shared_ptr<Decode::Job>>();
+
+    long long Requests = 0;
+
+    SDL_Surface *Load(const std::string &file)
+    {
+        auto key = Cache::Key(file.c_str(), 1.0);
+
+        auto surface = Memory::Track(Memory::Type::IMAGES, Cache::Load(key));
+
+        if (surface)
+        {
+            return surface;
+        }
+
+        surface = Textures::Native(Memory::Type::IMAGES, Memory::Track(Memory::Type::IMAGES, IMG_Load(file.c_str())));
+
+        if (surface == NULL)
+        {
+            std::cerr << "Unable to load image " << file << "! SDL Error: " << SDL_GetError() << std::endl;
+        }
+        else
+        {
+            Cache::Store(key, surface);
+        }
+
+        return surface;
+    }
+
+    // Drop the oldest decoded prefetches that nobody asked for (with the lock held)
+    void Trim()
+    {
+        while (true)
+        {
+            auto ready = 0;
+
+            auto oldest = Jobs.end();
+
+            for (auto job = Jobs.begin(); job != Jobs.end(); job++)
+            {
+                if (job->second->Done && job->second->Priority == Decode::Priority::PREFETCH)
+                {
+                    ready++;
+
+                    if (oldest == Jobs.end() || job->second->Order < oldest->second->Order)
+                    {
+                        oldest = job;
+                    }
+                }
+            }
+
+            if (ready <= Decode::MAX_READY)
+            {
+                break;
+            }
+
+            Memory::FreeSurface(oldest->second->Surface);
+
+            oldest->second->Surface = NULL;
+
+            oldest->second->Taken = true;
+
+            Jobs.erase(oldest);
+        }
+    }
+
+    void Work()
+    {
+        std::unique_lock<std::mutex> guard(Lock);
+
+        while (true)
+        {
+            Signal.wait(guard, [] { return !Running || !Queues[0].empty() || !Queues[1].empty(); });
+
+            if (!Running)
+            {
+                break;
+            }
+
+            auto &queue = !Queues[0].empty() ? Queues[0] : Queues[1];
+
+            auto file = queue.front();
+
+            queue.pop_front();
+
+            auto job = Jobs[file];
+
+            guard.unlock();
+
+            auto surface = Decode::Load(file);
+
+            guard.lock();
+
+            job->Surface = surface;
+
+            job->Done = true;
+
+            job->Promise.set_value(surface);
+
+            Decode::Trim();
+        }
+    }
+
+    void Start(int workers)
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        if (Running)
+        {
+            return;
+        }
+
+        if (workers <= 0)
+        {
+            workers = std::min(4, std::max(1, (int)std::thread::hardware_concurrency() - 1));
+        }
+
+        // SDL_image initializes its decoders lazily, which is not thread-safe
+        IMG_Init(IMG_INIT_PNG);
+
+        Running = true;
+
+        for (auto i = 0; i < workers; i++)
+        {
+            Workers.push_back(std::thread(Decode::Work));
+        }
+    }
+
+    // Queue or promote the job (with the lock held)
+    std::shared_ptr<Decode::Job> Queue(const std::string &file, Decode::Priority priority)
+    {
+        auto existing = Jobs.find(file);
+
+        if (existing != Jobs.end())
+        {
+            auto &prefetch = Queues[(int)Decode::Priority::PREFETCH];
+
+            auto queued = std::find(prefetch.begin(), prefetch.end(), file);
+
+            if (priority == Decode::Priority::NOW)
+            {
+                // claimed, kept until it is taken
+                existing->second->Priority = Decode::Priority::NOW;
+
+                if (queued != prefetch.end())
+                {
+                    prefetch.erase(queued);
+
+                    Queues[(int)Decode::Priority::NOW].push_back(file);
+                }
+            }
+
+            return existing->second;
+        }
+
+        auto job = std::make_shared<Decode::Job>(Requests++, priority);
+
+        Jobs[file] = job;
+
+        Queues[(int)priority].push_back(file);
+
+        Signal.notify_one();
+
+        return job;
+    }
+
+    std::shared_future<SDL_Surface *> Request(const char *file, Decode::Priority priority)
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        if (!Running || file == NULL)
+        {
+            auto promise = std::promise<SDL_Surface *>();
+
+            promise.set_value(NULL);
+
+            return promise.get_future().share();
+        }
+
+        return Decode::Queue(file, priority)->Future;
+    }
+
+    SDL_Surface *Take(const char *file)
+    {
+        if (file == NULL)
+        {
+            return NULL;
+        }
+
+        std::shared_ptr<Decode::Job> job = NULL;
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            if (Running)
+            {
+                job = Decode::Queue(file, Decode::Priority::NOW);
+            }
+        }
+
+        if (job == NULL)
+        {
+            return Decode::Load(file);
+        }
+
+        auto surface = job->Future.get();
+
+        auto owner = false;
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            if (!job->Taken)
+            {
+                job->Taken = true;
+
+                owner = true;
+
+                auto entry = Jobs.find(file);
+
+                if (entry != Jobs.end() && entry->second == job)
+                {
+                    Jobs.erase(entry);
+                }
+            }
+        }
+
+        // someone else took the image first, or it was dropped, or the pool stopped before decoding it
+        return owner ? surface : Decode::Load(file);
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            if (!Running)
+            {
+                return;
+            }
+
+            Running = false;
+        }
+
+        Signal.notify_all();
+
+        for (auto &worker : Workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+
+        Workers.clear();
+
+        std::lock_guard<std::mutex> guard(Lock);
+
+        for (auto &job : Jobs)
+        {
+            if (job.second->Done)
+            {
+                Memory::FreeSurface(job.second->Surface);
+            }
+            else
+            {
+                // wakes anyone still waiting, they decode the image themselves
+                job.second->Promise.set_value(NULL);
+            }
+
+            job.second->Taken = true;
+        }
+
+        Jobs.clear();
+
+        Queues[0].clear();
+
+        Queues[1].clear();
+    }
+} // namespace Decode
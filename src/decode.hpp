@@ -0,0 +1,35 @@
+#ifndef __DECODE__HPP__
+#define __DECODE__HPP__
+
+#include <future>
+
+#include <SDL.h>
+
+// Image decoding on a pool of worker threads (decode.cpp). Images the player needs now are decoded before any
+// speculative (prefetch) requests. Decoded surfaces wait in the pool until they are taken, and only the texture upload
+// is left to the render thread. Without the pool (before Start or after Stop) images are decoded on the calling thread.
+namespace Decode
+{
+    enum class Priority
+    {
+        NOW = 0,
+        PREFETCH
+    };
+
+    // Decoded prefetches kept waiting to be taken, the oldest are dropped first. Images requested NOW are never dropped.
+    const int MAX_READY = 6;
+
+    // Start the workers (0: one less than the number of cores, at least 1 and at most 4)
+    void Start(int workers = 0);
+
+    // Queue the image unless it is already queued or decoded. A NOW request moves a queued prefetch to the front.
+    std::shared_future<SDL_Surface *> Request(const char *file, Decode::Priority priority);
+
+    // Wait for the image and take ownership of the surface (NULL if it cannot be decoded)
+    SDL_Surface *Take(const char *file);
+
+    // Join the workers and free the surfaces that were never taken
+    void Stop();
+} // namespace Decode
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef __FRAME__HPP__
+#define __FRAME__HPP__
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <SDL.h>
+
+// Frame pacing. A static screen sleeps in SDL_WaitEvent and draws nothing until an event arrives. Screens that
+// animate (held scroll buttons, timed messages, panning the map) wake up once per frame, never faster than the cap,
+// and presents are synchronized with the display refresh when the driver supports it.
+namespace Frame
+{
+    // Frames per second while animating (--fps), 0 leaves the pacing to vsync
+    inline int Cap = 60;
+
+    // Present at the display refresh (--no-vsync turns it off)
+    inline bool VSync = true;
+
+    // Print the frame count and CPU utilization on exit (--frame-report)
+    inline bool Report = false;
+
+    // Milliseconds between repeats of a held scroll button
+    inline const Uint32 REPEAT = 50;
+
+    inline Uint32 LastPresent = 0;
+
+    // Earliest timed wake-up requested for the current screen, 0 if none
+    inline Uint32 Wake = 0;
+
+    // The last wait was for an animation frame, only then is the next present held back to the frame interval
+    inline bool Animating = false;
+
+    inline Uint32 StartTicks = 0;
+
+    inline std::clock_t StartClock = 0;
+
+    inline long long Frames = 0;
+
+    inline long long Sleeps = 0;
+
+    // Before the renderer is created
+    inline void Initialize()
+    {
+        SDL_SetHint(SDL_HINT_RENDER_VSYNC, Frame::VSync ? "1" : "0");
+
+        Frame::StartTicks = SDL_GetTicks();
+
+        Frame::StartClock = std::clock();
+    }
+
+    inline Uint32 Interval()
+    {
+        return Frame::Cap > 0 ? 1000 / Frame::Cap : 0;
+    }
+
+    // Wake up at the given time even if there are no events, e.g. when a message expires
+    inline void Until(Uint32 ticks)
+    {
+        if (Frame::Wake == 0 || ticks < Frame::Wake)
+        {
+            Frame::Wake = ticks;
+        }
+    }
+
+    // While animating, present no sooner than one frame interval after the previous one so that redraws requested in
+    // between are coalesced. Redraws in response to input are presented at once.
+    inline void Present(SDL_Renderer *renderer)
+    {
+        auto interval = Frame::Interval();
+
+        auto elapsed = SDL_GetTicks() - Frame::LastPresent;
+
+        if (Frame::Animating && interval > 0 && elapsed < interval)
+        {
+            SDL_Delay(interval - elapsed);
+        }
+
+        SDL_RenderPresent(renderer);
+
+        Frame::LastPresent = SDL_GetTicks();
+
+        Frame::Frames++;
+    }
+
+    // Next event, false if the screen should be drawn again without one: after a frame interval (or the given
+    // period) while animating, or at the wake-up time. Otherwise the thread sleeps until something happens.
+    inline bool Wait(SDL_Event *event, bool animating, Uint32 period = 0)
+    {
+        auto now = SDL_GetTicks();
+
+        Frame::Animating = animating;
+
+        auto timed = false;
+
+        Uint32 timeout = 0;
+
+        if (animating)
+        {
+            auto interval = period > 0 ? period : Frame::Interval();
+
+            auto elapsed = now - Frame::LastPresent;
+
+            timeout = elapsed < interval ? interval - elapsed : 0;
+
+            timed = true;
+        }
+
+        if (Frame::Wake != 0)
+        {
+            auto remaining = (Sint32)(Frame::Wake - now) > 0 ? Frame::Wake - now : 0;
+
+            if (!timed || remaining < timeout)
+            {
+                timeout = remaining;
+            }
+
+            timed = true;
+        }
+
+        if (!timed)
+        {
+            Frame::Sleeps++;
+
+            return SDL_WaitEvent(event) != 0;
+        }
+
+        if (SDL_WaitEventTimeout(event, (int)timeout) != 0)
+        {
+            return true;
+        }
+
+        if (Frame::Wake != 0 && (Sint32)(SDL_GetTicks() - Frame::Wake) >= 0)
+        {
+            Frame::Wake = 0;
+        }
+
+        return false;
+    }
+
+    // Declared at the top of each screen: a wake-up requested by the screen it was entered from does not fire on this
+    // one, and is restored when it returns
+    class Screen
+    {
+    private:
+        Uint32 wake = 0;
+
+    public:
+        Screen()
+        {
+            wake = Frame::Wake;
+
+            Frame::Wake = 0;
+
+            Frame::Animating = false;
+        }
+
+        Screen(const Screen &) = delete;
+
+        Screen &operator=(const Screen &) = delete;
+
+        ~Screen()
+        {
+            Frame::Wake = wake;
+
+            Frame::Animating = false;
+        }
+    };
+
+    inline void Print(std::ostream &out)
+    {
+        auto wall = (double)(SDL_GetTicks() - Frame::StartTicks) / 1000.0;
+
+        auto cpu = (double)(std::clock() - Frame::StartClock) / CLOCKS_PER_SEC;
+
+        out << "Frames: " << Frame::Frames << " presented, " << Frame::Sleeps << " idle waits" << std::endl;
+
+        out << std::fixed << std::setprecision(1);
+
+        out << "Time: " << wall << " s, CPU " << cpu << " s";
+
+        if (wall > 0)
+        {
+            out << " (" << 100.0 * cpu / wall << "% of one core, " << (double)Frame::Frames / wall << " frames per second)";
+        }
+
+        out << std::endl;
+
+        out << std::defaultfloat;
+    }
+} // namespace Frame
+
+#endif
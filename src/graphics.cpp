@@ -0,0 +1,1023 @@
+// Standard IO
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+// Using SDL
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "config.hpp"
+#include "controls.hpp"
+#include "assets.hpp"
+#include "render.hpp"
+#include "widgets.hpp"
+#include "items.hpp"
+#include "story.hpp"
+#include "graphics.hpp"
+#include "handles.hpp"
+#include "decode.hpp"
+#include "textures.hpp"
+#include "frame.hpp"
+
+SDL_Surface *createImage(const char *image)
+{
+    // Load splash image (already decoded if it was prefetched)
+    return Decode::Take(image);
+}
+
+void createWindow(Uint32 flags, SDL_Window **window, SDL_Renderer **renderer, const char *title, const char *icon)
+{
+    // The window we'll be rendering to
+    *window = NULL;
+    *renderer = NULL;
+
+    // Initialize SDL
+    if (SDL_Init(flags) < 0)
+    {
+        std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
+    }
+    else
+    {
+        Uint32 window_flags = SDL_WINDOW_SHOWN;
+
+        if (Video.Fullscreen)
+        {
+            window_flags |= SDL_WINDOW_FULLSCREEN_DESKTOP;
+        }
+
+        if (Video.HighDPI)
+        {
+            window_flags |= SDL_WINDOW_ALLOW_HIGHDPI;
+        }
+
+        auto window_w = Video.WindowWidth > 0 ? Video.WindowWidth : Config::BASE_WIDTH;
+        auto window_h = Video.WindowHeight > 0 ? Video.WindowHeight : Config::BASE_HEIGHT;
+
+        // Smooth filtering for images drawn at a size other than their own
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+
+        // vsync and the frame clock
+        Frame::Initialize();
+
+        // Create window and renderer
+        SDL_CreateWindowAndRenderer(window_w, window_h, window_flags | SDL_RENDERER_ACCELERATED, window, renderer);
+
+        if (*window && *renderer)
+        {
+            // Lay out against the native framebuffer (no logical size, so nothing gets upscaled by the GPU)
+            auto output_w = window_w;
+            auto output_h = window_h;
+
+            SDL_GetRendererOutputSize(*renderer, &output_w, &output_h);
+
+            SDL_GetWindowSize(*window, &window_w, &window_h);
+
+            Video.PixelRatio = window_w > 0 ? (double)output_w / window_w : 1.0;
+
+            Video.Resize(output_w, output_h);
+
+            // surfaces are converted to this format when they are loaded
+            Textures::Initialize(*renderer);
+        }
+
+        SDL_SetRenderDrawBlendMode(*renderer, SDL_BLENDMODE_NONE);
+
+        if (window == NULL || renderer == NULL)
+        {
+            std::cerr << "Window could not be created! SDL_Error: " << SDL_GetError() << std::endl;
+        }
+        else if (window)
+        {
+            SDL_SetWindowTitle(*window, title);
+        }
+
+        // the surface containing the icon pixel data is no longer required once it is attached to the window
+        auto surface = Handle::Surface(createImage(icon));
+
+        if (surface)
+        {
+            SDL_SetWindowIcon(*window, surface.get());
+        }
+    }
+}
+
+void renderImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y)
+{
+    if (image && renderer)
+    {
+        SDL_Rect position;
+
+        position.w = image->w;
+        position.h = image->h;
+        position.x = x;
+        position.y = y;
+
+        auto texture = Textures::Get(renderer, image);
+
+        if (texture)
+        {
+            SDL_Rect src;
+
+            src.w = image->w;
+            src.h = image->h;
+            src.x = 0;
+            src.y = 0;
+
+            SDL_RenderCopy(renderer, texture, &src, &position);
+        }
+    }
+}
+
+int fitImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int w, int h)
+{
+    int splash_h = image->h;
+    int splash_w = w;
+
+    if (image && renderer)
+    {
+        SDL_Rect position;
+
+        if (w != image->w)
+        {
+            splash_h = (int)((double)w / image->w * image->h);
+            splash_w = w;
+
+            if (splash_h > h)
+            {
+                splash_h = h;
+                splash_w = (int)((double)h / image->h * image->w);
+            }
+        }
+
+        position.w = splash_w;
+        position.h = splash_h;
+        position.x = x;
+        position.y = y;
+
+        auto texture = Textures::Get(renderer, image);
+
+        if (texture)
+        {
+            SDL_Rect src;
+
+            src.w = image->w;
+            src.h = image->h;
+            src.x = 0;
+            src.y = 0;
+
+            SDL_RenderCopy(renderer, texture, &src, &position);
+        }
+    }
+
+    return splash_h;
+}
+
+void stretchImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int w, int h)
+{
+    int splash_h = image->h;
+    int splash_w = w;
+
+    if (image && renderer)
+    {
+        SDL_Rect position;
+
+        position.w = w;
+        position.h = h;
+        position.x = x;
+        position.y = y;
+
+        auto texture = Textures::Get(renderer, image);
+
+        if (texture)
+        {
+            SDL_Rect src;
+
+            src.w = image->w;
+            src.h = image->h;
+            src.x = 0;
+            src.y = 0;
+
+            SDL_RenderCopy(renderer, texture, &src, &position);
+        }
+    }
+}
+
+// Render a portion of the text (image) on bounded surface within the specified window
+void renderText(SDL_Renderer *renderer, SDL_Surface *text, Uint32 bg, int x, int y, int bounds, int offset)
+{
+    if (renderer)
+    {
+        if (text && renderer)
+        {
+            SDL_Rect dst;
+            SDL_Rect src;
+
+            // select portion to render
+            src.w = text->w;
+            src.h = text->h < bounds ? text->h : bounds;
+            src.y = offset;
+            src.x = 0;
+
+            // specify location within the window
+            dst.w = text->w;
+            dst.h = text->h < bounds ? text->h : bounds;
+            dst.x = x;
+            dst.y = y;
+
+            if (bg != 0)
+            {
+                Render::SetColor(renderer, bg);
+                SDL_RenderFillRect(renderer, &dst);
+            }
+
+            auto texture = Textures::Get(renderer, text);
+
+            if (texture)
+            {
+                SDL_RenderCopy(renderer, texture, &src, &dst);
+            }
+        }
+    }
+}
+
+// create text image with line wrap limit
+SDL_Surface *createText(const char *text, const char *ttf, int font_size, SDL_Color textColor, int wrap, int style)
+{
+    SDL_Surface *surface = NULL;
+
+    Handle::TTF library;
+
+    auto font = Handle::Font(Memory::OpenFont(ttf, font_size));
+
+    if (font)
+    {
+        TTF_SetFontStyle(font.get(), style);
+
+        surface = Textures::Native(Memory::Type::TEXT, Memory::Track(Memory::Type::TEXT, TTF_RenderText_Blended_Wrapped(font.get(), text, textColor, wrap)));
+    }
+
+    return surface;
+}
+
+void fillRect(SDL_Renderer *renderer, int w, int h, int x, int y, int color)
+{
+    SDL_Rect rect;
+
+    rect.w = w;
+    rect.h = h;
+    rect.x = x;
+    rect.y = y;
+
+    Render::SetColor(renderer, color);
+    SDL_RenderFillRect(renderer, &rect);
+}
+
+void drawRect(SDL_Renderer *renderer, int w, int h, int x, int y, int color)
+{
+    SDL_Rect rect;
+
+    rect.w = w;
+    rect.h = h;
+    rect.x = x;
+    rect.y = y;
+
+    Render::SetColor(renderer, color);
+    SDL_RenderDrawRect(renderer, &rect);
+}
+
+// Key of a rasterized string in the text pool
+std::string textKey(std::string source, int size, int style, SDL_Color fg, int wrap, const char *text)
+{
+    auto color = ((Uint32)fg.r << 24) | ((Uint32)fg.g << 16) | ((Uint32)fg.b << 8) | fg.a;
+
+    return source + ":" + std::to_string(size) + ":" + std::to_string(style) + ":" + std::to_string(color) + ":" + std::to_string(wrap) + ":" + text;
+}
+
+void putText(SDL_Renderer *renderer, const char *text, TTF_Font *font, int space, SDL_Color fg, Uint32 bg, int style, int w, int h, int x, int y)
+{
+    if (renderer && font && text)
+    {
+        // the font is identified by its address and height (fonts are reopened when the resolution changes)
+        std::stringstream source;
+
+        source << "font:" << (const void *)font;
+
+        auto key = textKey(source.str(), TTF_FontHeight(font), style, fg, w - 2 * space, text);
+
+        auto surface = Widget::TextRows.Get(key, [&]() {
+            TTF_SetFontStyle(font, style);
+
+            return Textures::Native(Memory::Type::TEXT, Memory::Track(Memory::Type::TEXT, TTF_RenderText_Blended_Wrapped(font, text, fg, w - 2 * space)));
+        });
+
+        if (surface)
+        {
+            auto height = (surface->h + 2 * space) < h ? h : (surface->h + 2 * space);
+
+            fillRect(renderer, w, height, x, y, bg);
+
+            if (space > 0)
+            {
+                renderText(renderer, surface.get(), 0, x + space, y + space, height - 2 * space, 0);
+            }
+            else
+            {
+                renderText(renderer, surface.get(), 0, x + (w - surface->w) / 2, y + (h - surface->h) / 2, height - 2 * space, 0);
+            }
+        }
+    }
+}
+
+void fillWindow(SDL_Renderer *renderer, Uint32 color)
+{
+    Render::SetColor(renderer, color);
+    SDL_RenderClear(renderer);
+}
+
+// Outline the rows of a list page that are in the selection (drawn with the buttons)
+void markSelection(const std::vector<Button> &controls, const std::vector<int> &selection, int start, int last, int space)
+{
+    for (auto i = 0; i < last - start && i < controls.size(); i++)
+    {
+        if (Item::FIND(selection, start + i) >= 0)
+        {
+            Render::Queue.Draw(controls[i].W + 2 * space, controls[i].H + 2 * space, controls[i].X - space, controls[i].Y - space, intBK);
+        }
+    }
+}
+
+void renderTextButtons(SDL_Renderer *renderer, const std::vector<TextButton> &controls, const char *ttf, int selected, SDL_Color fg, Uint32 bg, Uint32 bgSelected, int fontsize, int style)
+{
+    if (controls.size() > 0)
+    {
+        for (auto i = 0; i < controls.size(); i++)
+        {
+            auto key = textKey(std::string("ttf:") + ttf, fontsize, style, fg, controls[i].W, controls[i].Text);
+
+            auto text = Widget::TextRows.Get(key, [&]() { return createText(controls[i].Text, ttf, fontsize, fg, controls[i].W, style); });
+
+            if (!text)
+            {
+                continue;
+            }
+
+            int x = controls[i].X + (controls[i].W - text->w) / 2;
+            int y = controls[i].Y + (controls[i].H - text->h) / 2;
+
+            SDL_Rect rect;
+
+            rect.w = controls[i].W;
+            rect.h = controls[i].H;
+            rect.x = controls[i].X;
+            rect.y = controls[i].Y;
+
+            if (i == selected)
+            {
+                Render::SetColor(renderer, bgSelected);
+            }
+            else
+            {
+                Render::SetColor(renderer, bg);
+            }
+
+            SDL_RenderFillRect(renderer, &rect);
+
+            renderText(renderer, text.get(), bg, x, y, 2 * fontsize, 0);
+        }
+    }
+}
+
+// Button images are drawn in order, the scroll backgrounds and the highlight are batched (and also flush anything queued by the caller)
+void renderButtons(SDL_Renderer *renderer, const std::vector<Button> &controls, int current, int fg, int space, int pts)
+{
+    for (auto i = 0; i < controls.size(); i++)
+    {
+        renderImage(renderer, controls[i].Surface.get(), controls[i].X, controls[i].Y);
+
+        if (i == current)
+        {
+            Render::Queue.Border(controls[i], fg, space, pts);
+        }
+    }
+
+    // also submits whatever the screen queued before the buttons
+    Render::Queue.Flush(renderer);
+}
+
+void renderButtons(SDL_Renderer *renderer, const std::vector<Button> &controls, int current, int fg, int space, int pts, bool scroll_up, bool scroll_dn)
+{
+    // scroll button backgrounds go underneath the images
+    for (auto i = 0; i < controls.size(); i++)
+    {
+        if ((controls[i].Type == Control::Type::SCROLL_UP && scroll_up) || (controls[i].Type == Control::Type::SCROLL_DOWN && scroll_dn))
+        {
+            Render::Queue.Fill(controls[i].W + 2 * border_space, controls[i].H + 2 * border_space, controls[i].X - border_space, controls[i].Y - border_space, intWH);
+        }
+    }
+
+    Render::Queue.Flush(renderer);
+
+    for (auto i = 0; i < controls.size(); i++)
+    {
+        if ((controls[i].Type == Control::Type::SCROLL_UP && scroll_up) || (controls[i].Type == Control::Type::SCROLL_DOWN && scroll_dn) || (controls[i].Type != Control::Type::SCROLL_UP && controls[i].Type != Control::Type::SCROLL_DOWN))
+        {
+            renderImage(renderer, controls[i].Surface.get(), controls[i].X, controls[i].Y);
+
+            if (i == current)
+            {
+                Render::Queue.Border(controls[i], fg, space, pts);
+            }
+        }
+    }
+
+    Render::Queue.Flush(renderer);
+}
+
+std::vector<TextButton> createHTextButtons(const char **choices, int num, int text_buttonh, int text_x, int text_y)
+{
+    auto controls = std::vector<TextButton>();
+
+    if (num > 0)
+    {
+        auto margin2 = (2.0 * Margin);
+        auto marginleft = (1.0 - margin2);
+
+        auto pixels = (int)(SCREEN_WIDTH * Margin) / 2;
+        auto width = (int)(SCREEN_WIDTH * marginleft);
+
+        auto text_spacew = width / num;
+        auto text_buttonw = text_spacew - pixels;
+        auto text_space = pixels / 2;
+
+        for (auto i = 0; i < num; i++)
+        {
+            int left = i > 0 ? i - 1 : i;
+            int right = i < num - 1 ? i + 1 : i;
+            int up = i;
+            int down = i;
+
+            auto x = text_x + i * (text_buttonw + text_space * 2) + text_space;
+
+            auto button = TextButton(i, choices[i], left, right, up, down, x, text_y, text_buttonw, text_buttonh);
+
+            controls.push_back(button);
+        }
+    }
+
+    return controls;
+}
+
+SDL_Surface *createHeaderButton(SDL_Window *window, const char *text, SDL_Color color, Uint32 bg, int w, int h, int x)
+{
+    auto button = Memory::Track(Memory::Type::BUTTONS, SDL_CreateRGBSurface(0, w, h, 32, 0, 0, 0, 0));
+    auto text_surface = Handle::Surface(createText(text, FONT_FILE, Video.Scaled(18), color, w, TTF_STYLE_NORMAL));
+
+    if (button && text_surface)
+    {
+        SDL_Rect src;
+
+        src.w = text_surface->w;
+        src.h = text_surface->h;
+        src.x = 0;
+        src.y = 0;
+
+        SDL_Rect dst;
+
+        dst.w = button->w;
+        dst.h = button->h;
+        dst.x = 0;
+        dst.y = 0;
+
+        SDL_FillRect(button, &dst, bg);
+
+        dst.x = x < 0 ? (button->w - text_surface->w) / 2 : x;
+        dst.y = (button->h - text_surface->h) / 2;
+
+        SDL_BlitSurface(text_surface.get(), &src, button, &dst);
+    }
+
+    return button;
+}
+
+// Rasterized row of a list (black text), shared with the row pool and recycled when it has been rendered before
+Handle::SharedSurface listRow(std::string text, int font_size, int wrap)
+{
+    auto key = "text:" + std::to_string(font_size) + ":" + std::to_string(wrap) + ":" + text;
+
+    return Widget::ListRows.Get(key, [&]() { return createText(text.c_str(), FONT_FILE, font_size, clrBK, wrap, TTF_STYLE_NORMAL); });
+}
+
+std::vector<Button> createItemList(SDL_Window *window, SDL_Renderer *renderer, std::vector<Item::Base> list, int start, int last, int limit, bool confirm_button, bool back_button)
+{
+    auto font_size = Video.Scaled(20);
+    auto text_space = Video.Scaled(8);
+    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+
+    auto controls = std::vector<Button>();
+
+    if (list.size() > 0)
+    {
+        for (int i = 0; i < last - start; i++)
+        {
+            auto index = start + i;
+
+            std::string item_string = list[index].Name;
+
+            if (list[index].Charge > 0)
+            {
+                item_string += " (";
+
+                if (list[index].Charge > 0)
+                {
+                    item_string += std::to_string(list[index].Charge);
+                }
+
+                item_string += ")";
+            }
+
+            auto text = listRow(item_string, font_size, textwidth - 4 * text_space);
+
+            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
+
+            controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < (last - start) ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
+
+            controls[i].W = textwidth - 4 * text_space;
+
+            controls[i].H = text->h;
+        }
+    }
+
+    auto idx = controls.size();
+
+    if (list.size() > limit)
+    {
+        if (start > 0)
+        {
+            controls.push_back(Button(idx, "icons/up-arrow.png", idx, idx, idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+
+            idx++;
+        }
+
+        if (list.size() - last > 0)
+        {
+            controls.push_back(Button(idx, "icons/down-arrow.png", idx, idx, start > 0 ? idx - 1 : idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx++;
+        }
+    }
+
+    if (confirm_button)
+    {
+        idx = controls.size();
+
+        controls.push_back(Button(idx, "icons/yes.png", idx - 1, back_button ? idx + 1 : idx, idx - 1, idx, startx, buttony, Control::Type::CONFIRM));
+    }
+
+    if (back_button)
+    {
+        idx = controls.size();
+
+        controls.push_back(Button(idx, "icons/back-button.png", idx - 1, idx, list.size() > 0 ? (last - start) : idx, idx, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+    }
+
+    return controls;
+}
+
+// Control bars of the story screen (declared in story.hpp)
+namespace Story
+{
+    std::vector<Button> StandardControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/exit.png", idx + 4, idx + 5, compact ? idx + 5 : 1, idx + 5, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> ShopControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SHOP));
+        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> SellControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/selling.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SELL));
+        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> BuyAndSellControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SHOP));
+        controls.push_back(Button(idx + 6, "icons/selling.png", idx + 5, idx + 7, compact ? idx + 6 : 1, idx + 6, startx + 6 * gridsize, buttony, Control::Type::SELL));
+        controls.push_back(Button(idx + 7, "icons/exit.png", idx + 6, idx + 7, compact ? idx + 7 : 1, idx + 7, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> TradeControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::TRADE));
+        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> BarterControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/exhange.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::BARTER));
+        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> BarterAndShopControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
+        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
+        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
+        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
+        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SHOP));
+        controls.push_back(Button(idx + 6, "icons/exchange.png", idx + 5, idx + 7, compact ? idx + 6 : 1, idx + 6, startx + 6 * gridsize, buttony, Control::Type::BARTER));
+        controls.push_back(Button(idx + 7, "icons/exit.png", idx + 6, idx + 7, compact ? idx + 7 : 1, idx + 7, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+
+    std::vector<Button> ExitControls(bool compact)
+    {
+        auto idx = 0;
+
+        auto controls = std::vector<Button>();
+
+        if (!compact)
+        {
+            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx = 2;
+        }
+
+        controls.push_back(Button(idx, "icons/exit.png", compact ? idx : idx - 1, idx, compact ? idx : idx - 1, idx, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        return controls;
+    }
+} // namespace Story
+
+// SDL resources created and freed through the memory accounting (declared in memory.hpp)
+namespace Memory
+{
+    // Font file sizes
+    std::mutex FontsLock;
+
+    std::map<std::string, long long> Fonts = std::map<std::string, long long>();
+
+    // Overlay, rendered again only when its lines or its size change
+    Handle::Texture OverlayTexture = Handle::Texture();
+
+    std::vector<std::string> OverlayLines = std::vector<std::string>();
+
+    int OverlaySize = 0;
+
+    SDL_Rect OverlayBounds = {0, 0, 0, 0};
+
+    SDL_Surface *Track(Memory::Type type, SDL_Surface *surface)
+    {
+        if (surface)
+        {
+            Memory::Track(surface, type, (long long)surface->pitch * surface->h + sizeof(SDL_Surface));
+        }
+
+        return surface;
+    }
+
+    SDL_Texture *CreateTexture(SDL_Renderer *renderer, SDL_Surface *surface)
+    {
+        auto texture = SDL_CreateTextureFromSurface(renderer, surface);
+
+        if (texture)
+        {
+            Uint32 format = 0;
+
+            auto w = 0;
+            auto h = 0;
+
+            SDL_QueryTexture(texture, &format, NULL, &w, &h);
+
+            auto bytes = SDL_BYTESPERPIXEL(format) > 0 ? SDL_BYTESPERPIXEL(format) : 4;
+
+            Memory::Track(texture, Memory::Type::TEXTURES, (long long)w * h * bytes);
+        }
+
+        return texture;
+    }
+
+    TTF_Font *OpenFont(const char *file, int size)
+    {
+        auto font = TTF_OpenFont(file, size);
+
+        if (font && file)
+        {
+            long long bytes = 0;
+
+            {
+                std::lock_guard<std::mutex> guard(FontsLock);
+
+                if (Fonts.count(file) == 0)
+                {
+                    std::error_code error;
+
+                    auto length = std::filesystem::file_size(file, error);
+
+                    Fonts[file] = error ? 0 : (long long)length;
+                }
+
+                bytes = Fonts[file];
+            }
+
+            Memory::Track(font, Memory::Type::FONTS, bytes);
+        }
+
+        return font;
+    }
+
+    void FreeSurface(SDL_Surface *surface)
+    {
+        if (surface)
+        {
+            Memory::Release(surface);
+
+            Textures::Forget(surface);
+
+            SDL_FreeSurface(surface);
+        }
+    }
+
+    void DestroyTexture(SDL_Texture *texture)
+    {
+        if (texture)
+        {
+            Memory::Release(texture);
+
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    void CloseFont(TTF_Font *font)
+    {
+        if (font)
+        {
+            Memory::Release(font);
+
+            TTF_CloseFont(font);
+        }
+    }
+
+    // One surface holding every line of the report, each on its own backdrop
+    SDL_Surface *Compose(std::vector<std::string> &lines, int size, int space)
+    {
+        // a scope of its own: screens initialize and shut down SDL_ttf as they come and go
+        Handle::TTF library;
+
+        auto font = Handle::Font(Memory::OpenFont(FONT_FILE, size));
+
+        if (!font)
+        {
+            return NULL;
+        }
+
+        auto rendered = std::vector<Handle::Surface>();
+
+        auto w = 0;
+
+        auto h = 0;
+
+        for (auto &line : lines)
+        {
+            auto surface = Handle::Surface(Memory::Track(Memory::Type::TEXT, TTF_RenderText_Blended(font.get(), line.c_str(), clrWH)));
+
+            if (surface)
+            {
+                w = std::max(w, surface->w + 2 * space);
+
+                h += surface->h;
+
+                rendered.push_back(std::move(surface));
+            }
+        }
+
+        if (w <= 0 || h <= 0)
+        {
+            return NULL;
+        }
+
+        auto overlay = Memory::Track(Memory::Type::TEXT, SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888));
+
+        if (overlay)
+        {
+            SDL_FillRect(overlay, NULL, SDL_MapRGBA(overlay->format, 0, 0, 0, 0));
+
+            auto y = 0;
+
+            for (auto &surface : rendered)
+            {
+                SDL_Rect box = {0, y, surface->w + 2 * space, surface->h};
+
+                SDL_Rect dst = {space, y, surface->w, surface->h};
+
+                SDL_FillRect(overlay, &box, SDL_MapRGBA(overlay->format, 0, 0, 0, 0xC0));
+
+                SDL_SetSurfaceBlendMode(surface.get(), SDL_BLENDMODE_BLEND);
+
+                SDL_BlitSurface(surface.get(), NULL, overlay, &dst);
+
+                y += surface->h;
+            }
+        }
+
+        return overlay;
+    }
+
+    void Draw(SDL_Renderer *renderer)
+    {
+        if (!Overlay || renderer == NULL)
+        {
+            return;
+        }
+
+        auto lines = Memory::Lines();
+
+        auto size = Video.Scaled(14);
+
+        auto space = Video.Scaled(4);
+
+        if (!OverlayTexture || lines != OverlayLines || size != OverlaySize)
+        {
+            OverlayTexture.reset();
+
+            OverlayLines = lines;
+
+            OverlaySize = size;
+
+            auto surface = Handle::Surface(Memory::Compose(lines, size, space));
+
+            if (surface)
+            {
+                OverlayTexture = Handle::Texture(Memory::CreateTexture(renderer, surface.get()));
+
+                OverlayBounds = {space, space, surface->w, surface->h};
+
+                if (OverlayTexture)
+                {
+                    SDL_SetTextureBlendMode(OverlayTexture.get(), SDL_BLENDMODE_BLEND);
+                }
+            }
+        }
+
+        if (OverlayTexture)
+        {
+            SDL_RenderCopy(renderer, OverlayTexture.get(), NULL, &OverlayBounds);
+        }
+    }
+
+    void Discard()
+    {
+        OverlayTexture.reset();
+
+        OverlayLines.clear();
+    }
+} // namespace Memory
@@ -0,0 +1,37 @@
+#ifndef __GRAPHICS__HPP__
+#define __GRAPHICS__HPP__
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "controls.hpp"
+#include "items.hpp"
+
+// Drawing helpers shared by all the screens (graphics.cpp)
+SDL_Surface *createImage(const char *image);
+SDL_Surface *createText(const char *text, const char *ttf, int font_size, SDL_Color textColor, int wrap, int style = TTF_STYLE_NORMAL);
+SDL_Surface *createHeaderButton(SDL_Window *window, const char *text, SDL_Color color, Uint32 bg, int w, int h, int x);
+Handle::SharedSurface listRow(std::string text, int font_size, int wrap);
+
+std::vector<Button> createItemList(SDL_Window *window, SDL_Renderer *renderer, std::vector<Item::Base> list, int start, int last, int limit, bool confirm_button, bool back_button);
+std::vector<TextButton> createHTextButtons(const char **choices, int num, int text_buttonh, int text_x, int text_y);
+
+int fitImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int w, int h);
+
+void createWindow(Uint32 flags, SDL_Window **window, SDL_Renderer **renderer, const char *title, const char *icon);
+void drawRect(SDL_Renderer *renderer, int w, int h, int x, int y, int color);
+void fillRect(SDL_Renderer *renderer, int w, int h, int x, int y, int color);
+void fillWindow(SDL_Renderer *renderer, Uint32 color);
+void markSelection(const std::vector<Button> &controls, const std::vector<int> &selection, int start, int last, int space);
+void putText(SDL_Renderer *renderer, const char *text, TTF_Font *font, int space, SDL_Color fg, Uint32 bg, int style, int w, int h, int x, int y);
+void renderButtons(SDL_Renderer *renderer, const std::vector<Button> &controls, int current, int fg, int space, int pts);
+void renderButtons(SDL_Renderer *renderer, const std::vector<Button> &controls, int current, int fg, int space, int pts, bool scroll_up, bool scroll_dn);
+void renderImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y);
+void renderText(SDL_Renderer *renderer, SDL_Surface *text, Uint32 bg, int x, int y, int bounds, int offset);
+void renderTextButtons(SDL_Renderer *renderer, const std::vector<TextButton> &controls, const char *ttf, int selected, SDL_Color fg, Uint32 bg, Uint32 bgSelected, int fontsize, int style = TTF_STYLE_NORMAL);
+void stretchImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int w, int h);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef __HANDLES__HPP__
+#define __HANDLES__HPP__
+
+#include <memory>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "memory.hpp"
+
+// Move-only owners of SDL resources: the resource is released (and its memory accounting updated) when the handle goes
+// out of scope, including on early returns
+namespace Handle
+{
+    class FreeSurface
+    {
+    public:
+        void operator()(SDL_Surface *surface) const
+        {
+            Memory::FreeSurface(surface);
+        }
+    };
+
+    class DestroyTexture
+    {
+    public:
+        void operator()(SDL_Texture *texture) const
+        {
+            Memory::DestroyTexture(texture);
+        }
+    };
+
+    class CloseFont
+    {
+    public:
+        void operator()(TTF_Font *font) const
+        {
+            Memory::CloseFont(font);
+        }
+    };
+
+    typedef std::unique_ptr<SDL_Surface, Handle::FreeSurface> Surface;
+
+    typedef std::unique_ptr<SDL_Texture, Handle::DestroyTexture> Texture;
+
+    typedef std::unique_ptr<TTF_Font, Handle::CloseFont> Font;
+
+    // A surface with several owners (buttons and the pools they draw from), freed with the last one. Shared surfaces
+    // are never changed after they were created.
+    typedef std::shared_ptr<SDL_Surface> SharedSurface;
+
+    inline Handle::SharedSurface Share(SDL_Surface *surface)
+    {
+        return Handle::SharedSurface(surface, Handle::FreeSurface());
+    }
+
+    // Keeps SDL_ttf initialized for the lifetime of a screen. Declare it before the fonts so that they are closed first.
+    class TTF
+    {
+    public:
+        TTF()
+        {
+            TTF_Init();
+        }
+
+        TTF(const TTF &) = delete;
+
+        TTF &operator=(const TTF &) = delete;
+
+        ~TTF()
+        {
+            TTF_Quit();
+        }
+    };
+} // namespace Handle
+
+#endif
@@ -0,0 +1,394 @@
+// Telemetry heatmap
+//
+// Combines the telemetry logs written with --telemetry (savedgames/telemetry/*.tlm) by any number of machines into
+// per-section figures: how often each section was entered, how long players stayed (until the next section of the
+// same session), the choices they took from it, how many adventures ended there, and the trades made in it. Sections
+// are ranked by total time spent, and the heat column is that time relative to the hottest section.
+//
+// Usage: TelemetryHeatmap.exe [FILE.tlm | DIRECTORY ...] [--csv heatmap.csv] [--json heatmap.json] [--top N]
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "telemetry.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Heatmap
+{
+    class Section
+    {
+    public:
+        int ID = -1;
+
+        long long Visits = 0;
+
+        // milliseconds
+        long long Dwell = 0;
+
+        long long Deaths = 0;
+
+        long long Dooms = 0;
+
+        long long Buys = 0;
+
+        long long Sells = 0;
+
+        long long Barters = 0;
+
+        long long Trades = 0;
+
+        // destination -> times taken
+        std::map<int, long long> Choices = std::map<int, long long>();
+    };
+
+    class Totals
+    {
+    public:
+        int Sessions = 0;
+
+        long long Events = 0;
+
+        // files that are not telemetry logs or were cut short
+        int Rejected = 0;
+
+        std::map<int, Heatmap::Section> Sections = std::map<int, Heatmap::Section>();
+
+        Heatmap::Section &Get(int id)
+        {
+            auto &section = Sections[id];
+
+            section.ID = id;
+
+            return section;
+        }
+    };
+
+    bool Read(const std::string &file, Heatmap::Totals &totals)
+    {
+        std::ifstream in(file, std::ios::binary);
+
+        Telemetry::Header header;
+
+        if (!in.read((char *)&header, sizeof(header)) || std::string(header.Magic, 4) != std::string(Telemetry::MAGIC, 4) || header.Version != Telemetry::VERSION || header.Size != sizeof(Telemetry::Event))
+        {
+            totals.Rejected++;
+
+            return false;
+        }
+
+        totals.Sessions++;
+
+        // the section being read and when it was entered
+        auto current = -1;
+
+        uint32_t entered = 0;
+
+        Telemetry::Event event;
+
+        // a record torn by a crash ends the log
+        while (in.read((char *)&event, sizeof(event)))
+        {
+            totals.Events++;
+
+            auto &section = totals.Get(event.Section);
+
+            switch (event.Kind)
+            {
+            case Telemetry::Kind::SECTION:
+
+                if (current >= 0)
+                {
+                    totals.Get(current).Dwell += event.Time - entered;
+                }
+
+                section.Visits++;
+
+                current = event.Section;
+
+                entered = event.Time;
+
+                break;
+
+            case Telemetry::Kind::CHOICE:
+
+                section.Choices[event.Value]++;
+
+                break;
+
+            case Telemetry::Kind::DOOM:
+
+                section.Dooms++;
+
+                break;
+
+            case Telemetry::Kind::DEATH:
+
+                section.Deaths++;
+
+                break;
+
+            case Telemetry::Kind::BUY:
+
+                section.Buys++;
+
+                break;
+
+            case Telemetry::Kind::SELL:
+
+                section.Sells++;
+
+                break;
+
+            case Telemetry::Kind::BARTER:
+
+                section.Barters++;
+
+                break;
+
+            case Telemetry::Kind::TRADE:
+
+                section.Trades++;
+
+                break;
+
+            default:
+
+                break;
+            }
+
+            // time in the last section lasts until the last event of the session
+            if (current >= 0 && event.Kind != Telemetry::Kind::SECTION)
+            {
+                totals.Get(current).Dwell += event.Time - entered;
+
+                entered = event.Time;
+            }
+        }
+
+        return true;
+    }
+
+    // Sections by total time spent, then by visits
+    std::vector<Heatmap::Section> Ranked(Heatmap::Totals &totals)
+    {
+        auto ranked = std::vector<Heatmap::Section>();
+
+        for (auto &section : totals.Sections)
+        {
+            ranked.push_back(section.second);
+        }
+
+        std::stable_sort(ranked.begin(), ranked.end(), [](const Heatmap::Section &a, const Heatmap::Section &b) { return a.Dwell != b.Dwell ? a.Dwell > b.Dwell : a.Visits > b.Visits; });
+
+        return ranked;
+    }
+
+    double Heat(const Heatmap::Section &section, long long hottest)
+    {
+        return hottest > 0 ? (double)section.Dwell / hottest : 0.0;
+    }
+
+    double Mean(const Heatmap::Section &section)
+    {
+        return section.Visits > 0 ? (double)section.Dwell / section.Visits / 1000.0 : 0.0;
+    }
+
+    // Most taken choice as "destination (times)"
+    std::string Favourite(const Heatmap::Section &section)
+    {
+        auto best = section.Choices.end();
+
+        for (auto choice = section.Choices.begin(); choice != section.Choices.end(); choice++)
+        {
+            if (best == section.Choices.end() || choice->second > best->second)
+            {
+                best = choice;
+            }
+        }
+
+        return best == section.Choices.end() ? std::string("-") : std::to_string(best->first) + " (" + std::to_string(best->second) + ")";
+    }
+
+    void Print(Heatmap::Totals &totals, std::vector<Heatmap::Section> &ranked, int top, std::ostream &out)
+    {
+        out << "Sessions: " << totals.Sessions << ", events: " << totals.Events << ", sections: " << totals.Sections.size();
+
+        if (totals.Rejected > 0)
+        {
+            out << ", rejected files: " << totals.Rejected;
+        }
+
+        out << std::endl
+            << std::endl;
+
+        auto hottest = ranked.empty() ? 0 : ranked.front().Dwell;
+
+        out << std::setw(8) << "Section" << std::setw(8) << "Visits" << std::setw(12) << "Mean (s)" << std::setw(12) << "Total (s)" << std::setw(7) << "Heat" << std::setw(8) << "Deaths" << std::setw(7) << "Dooms" << "  Top choice" << std::endl;
+
+        out << std::fixed << std::setprecision(1);
+
+        for (auto i = 0; i < ranked.size() && (top <= 0 || i < top); i++)
+        {
+            auto &section = ranked[i];
+
+            out << std::setw(8) << section.ID << std::setw(8) << section.Visits << std::setw(12) << Heatmap::Mean(section) << std::setw(12) << section.Dwell / 1000.0 << std::setw(7) << std::setprecision(2) << Heatmap::Heat(section, hottest) << std::setprecision(1) << std::setw(8) << section.Deaths << std::setw(7) << section.Dooms << "  " << Heatmap::Favourite(section) << std::endl;
+        }
+
+        out << std::defaultfloat;
+    }
+
+    void WriteCSV(std::vector<Heatmap::Section> &ranked, std::ostream &out)
+    {
+        auto hottest = ranked.empty() ? 0 : ranked.front().Dwell;
+
+        out << "section,visits,dwell_ms,mean_s,heat,deaths,dooms,buys,sells,barters,trades" << std::endl;
+
+        for (auto &section : ranked)
+        {
+            out << section.ID << "," << section.Visits << "," << section.Dwell << "," << Heatmap::Mean(section) << "," << Heatmap::Heat(section, hottest) << "," << section.Deaths << "," << section.Dooms << "," << section.Buys << "," << section.Sells << "," << section.Barters << "," << section.Trades << std::endl;
+        }
+    }
+
+    nlohmann::json ToJSON(Heatmap::Totals &totals, std::vector<Heatmap::Section> &ranked)
+    {
+        nlohmann::json data;
+
+        auto hottest = ranked.empty() ? 0 : ranked.front().Dwell;
+
+        data["sessions"] = totals.Sessions;
+        data["events"] = totals.Events;
+        data["sections"] = nlohmann::json::array();
+
+        for (auto &section : ranked)
+        {
+            nlohmann::json entry;
+
+            entry["id"] = section.ID;
+            entry["visits"] = section.Visits;
+            entry["dwell_ms"] = section.Dwell;
+            entry["heat"] = Heatmap::Heat(section, hottest);
+            entry["deaths"] = section.Deaths;
+            entry["dooms"] = section.Dooms;
+            entry["buys"] = section.Buys;
+            entry["sells"] = section.Sells;
+            entry["barters"] = section.Barters;
+            entry["trades"] = section.Trades;
+
+            auto choices = nlohmann::json::object();
+
+            for (auto &choice : section.Choices)
+            {
+                choices[std::to_string(choice.first)] = choice.second;
+            }
+
+            entry["choices"] = choices;
+
+            data["sections"].push_back(entry);
+        }
+
+        return data;
+    }
+} // namespace Heatmap
+
+int main(int argc, char **argv)
+{
+    auto inputs = std::vector<std::string>();
+    auto csv = std::string();
+    auto json = std::string();
+
+    auto top = 20;
+
+    for (auto i = 1; i < argc; i++)
+    {
+        auto arg = std::string(argv[i]);
+
+        if (arg == "--csv" && i + 1 < argc)
+        {
+            csv = argv[++i];
+        }
+        else if (arg == "--json" && i + 1 < argc)
+        {
+            json = argv[++i];
+        }
+        else if (arg == "--top" && i + 1 < argc)
+        {
+            top = std::atoi(argv[++i]);
+        }
+        else
+        {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty())
+    {
+        std::cerr << "Usage: TelemetryHeatmap.exe [FILE.tlm | DIRECTORY ...] [--csv FILE] [--json FILE] [--top N]" << std::endl;
+
+        return 2;
+    }
+
+    // logs named after their start time, read in order
+    auto files = std::vector<std::string>();
+
+    for (auto &input : inputs)
+    {
+        std::error_code error;
+
+        if (fs::is_directory(input, error))
+        {
+            for (auto &entry : fs::recursive_directory_iterator(input, error))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == Telemetry::EXTENSION)
+                {
+                    files.push_back(entry.path().string());
+                }
+            }
+        }
+        else
+        {
+            files.push_back(input);
+        }
+    }
+
+    std::sort(files.begin(), files.end());
+
+    Heatmap::Totals totals;
+
+    for (auto &file : files)
+    {
+        if (!Heatmap::Read(file, totals))
+        {
+            std::cerr << "Not a telemetry log: " << file << std::endl;
+        }
+    }
+
+    auto ranked = Heatmap::Ranked(totals);
+
+    Heatmap::Print(totals, ranked, top, std::cout);
+
+    if (csv.length() > 0)
+    {
+        std::ofstream out(csv);
+
+        Heatmap::WriteCSV(ranked, out);
+    }
+
+    if (json.length() > 0)
+    {
+        std::ofstream out(json);
+
+        out << Heatmap::ToJSON(totals, ranked).dump(4) << std::endl;
+    }
+
+    return totals.Sessions > 0 ? 0 : 1;
+}
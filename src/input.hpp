@@ -4,11 +4,16 @@
 #include <vector>
 #include <SDL.h>
 
+#include "audio.hpp"
 #include "controls.hpp"
+#include "frame.hpp"
+#include "memory.hpp"
+#include "replay.hpp"
+#include "soak.hpp"
 
 namespace Input
 {
-    int InitializeGamePads()
+    inline int InitializeGamePads()
     {
         if (SDL_WasInit(SDL_INIT_GAMECONTROLLER) != 1)
         {
@@ -51,10 +56,26 @@ namespace Input
     }
 
     template <typename T>
-    bool GetInput(SDL_Renderer *renderer, std::vector<T> choices, int &current, bool &selected, bool &scrollUp, bool &scrollDown, bool &hold)
+    bool GetInput(SDL_Renderer *renderer, const std::vector<T> &choices, int &current, bool &selected, bool &scrollUp, bool &scrollDown, bool &hold)
     {
+        Memory::Draw(renderer);
+
         // Update the renderer
-        SDL_RenderPresent(renderer);
+        Frame::Present(renderer);
+
+        if (Replay::Session.Replaying())
+        {
+            return Replay::Session.Play(current, selected, scrollUp, scrollDown, hold);
+        }
+
+        if (Soak::Active)
+        {
+            auto quit = Soak::Play(choices, current, selected, scrollUp, scrollDown, hold);
+
+            Replay::Session.Record(current, selected, scrollUp, scrollDown, hold, quit);
+
+            return quit;
+        }
 
         SDL_Event result;
 
@@ -70,7 +91,13 @@ namespace Input
 
         while (1)
         {
-            SDL_WaitEvent(&result);
+            // a held scroll button repeats, timed messages expire, otherwise sleep until the next event
+            auto repeat = hold && current >= 0 && current < choices.size() && (choices[current].Type == Control::Type::SCROLL_UP || choices[current].Type == Control::Type::SCROLL_DOWN);
+
+            if (!Frame::Wait(&result, repeat, Frame::REPEAT))
+            {
+                break;
+            }
 
             if (result.type == SDL_QUIT)
             {
@@ -93,7 +120,14 @@ namespace Input
             }
             else if (result.type == SDL_KEYDOWN)
             {
-                if (result.key.keysym.sym == SDLK_PAGEUP)
+                if (result.key.keysym.sym == SDLK_F3)
+                {
+                    // toggle the memory overlay, the screen is drawn again
+                    Memory::Overlay = !Memory::Overlay;
+
+                    break;
+                }
+                else if (result.key.keysym.sym == SDLK_PAGEUP)
                 {
                     scrollUp = true;
                     scrollDown = false;
@@ -257,9 +291,15 @@ namespace Input
 
                 auto previous = current;
 
+                // controls are laid out in framebuffer pixels
+                auto x = result.motion.x;
+                auto y = result.motion.y;
+
+                Video.Pixels(x, y);
+
                 for (auto i = 0; i < choices.size(); i++)
                 {
-                    if (result.motion.x >= choices[i].X && result.motion.x <= choices[i].X + choices[i].W - 1 && result.motion.y >= choices[i].Y && result.motion.y <= choices[i].Y + choices[i].H - 1)
+                    if (x >= choices[i].X && x <= choices[i].X + choices[i].W - 1 && y >= choices[i].Y && y <= choices[i].Y + choices[i].H - 1)
                     {
                         current = choices[i].ID;
 
@@ -316,15 +356,6 @@ namespace Input
 
                 break;
             }
-            else if (hold)
-            {
-                if (current >= 0 && current < choices.size() && (choices[current].Type == Control::Type::SCROLL_UP || choices[current].Type == Control::Type::SCROLL_DOWN))
-                {
-                    SDL_Delay(50);
-
-                    break;
-                }
-            }
 
             if (SDL_GetTicks() - start_ticks > 1000)
             {
@@ -332,11 +363,33 @@ namespace Input
             }
         }
 
+        Replay::Session.Record(current, selected, scrollUp, scrollDown, hold, quit);
+
+        // scroll buttons repeat while held, only the other controls click
+        if (selected && current >= 0 && current < choices.size() && choices[current].Type != Control::Type::SCROLL_UP && choices[current].Type != Control::Type::SCROLL_DOWN)
+        {
+            Audio::Play(Audio::Effect::BUTTON);
+        }
+
         return quit;
     }
 
-    void WaitForNext(SDL_Renderer *renderer)
+    inline void WaitForNext(SDL_Renderer *renderer)
     {
+        if (Replay::Session.Replaying())
+        {
+            Replay::Session.Play();
+
+            return;
+        }
+
+        if (Soak::Active)
+        {
+            Replay::Session.Record();
+
+            return;
+        }
+
         SDL_Event result;
 
         while (1)
@@ -377,6 +430,8 @@ namespace Input
                 break;
             }
         }
+
+        Replay::Session.Record();
     }
 } // namespace Input
 #endif
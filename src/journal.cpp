@@ -0,0 +1,416 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "nlohmann/json.hpp"
+
+#include "character.hpp"
+#include "journal.hpp"
+#include "memory.hpp"
+
+// save.cpp
+nlohmann::json characterData(Character::Base &player);
+
+namespace Journal
+{
+    long long Now()
+    {
+        return std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
+    }
+
+    // Push buffered writes to the disk
+    void Sync(FILE *file)
+    {
+        fflush(file);
+
+#if defined(_WIN32)
+        _commit(_fileno(file));
+#else
+        fsync(fileno(file));
+#endif
+    }
+
+    // Write the snapshot to a temporary file first so that a crash never leaves a partial snapshot
+    bool Write(std::string file, nlohmann::json &data)
+    {
+        auto temporary = file + ".tmp";
+
+        auto output = fopen(temporary.c_str(), "wb");
+
+        if (output == NULL)
+        {
+            std::cerr << "Unable to write " << temporary << "!" << std::endl;
+
+            return false;
+        }
+
+        auto text = data.dump();
+
+        fwrite(text.data(), 1, text.length(), output);
+
+        Sync(output);
+
+        fclose(output);
+
+        std::error_code error;
+
+        std::filesystem::rename(temporary, file, error);
+
+        if (error)
+        {
+            std::cerr << "Unable to replace " << file << "! " << error.message() << std::endl;
+
+            return false;
+        }
+
+        return true;
+    }
+
+    // Snapshot a record was written after, 0 if there is none
+    long long Generation(nlohmann::json &data)
+    {
+        return (data.is_object() && data.count("generation") > 0 && data["generation"].is_number()) ? (long long)data["generation"] : 0;
+    }
+
+    // Apply the complete records of the journal that follow this snapshot. Returns the number of records applied.
+    int Merge(nlohmann::json &snapshot, std::string file)
+    {
+        std::ifstream ifs(file);
+
+        auto applied = 0;
+
+        auto generation = Journal::Generation(snapshot);
+
+        auto line = std::string();
+
+        while (ifs.good() && std::getline(ifs, line))
+        {
+            // a torn record (crash during a write) ends the journal
+            auto record = nlohmann::json::parse(line, nullptr, false);
+
+            if (record.is_discarded() || !record.is_object() || record.count("delta") == 0)
+            {
+                break;
+            }
+
+            // left over from an older snapshot (crash between writing a snapshot and emptying the journal)
+            if (Journal::Generation(record) != generation)
+            {
+                continue;
+            }
+
+            if (!snapshot.is_object())
+            {
+                snapshot = nlohmann::json::object();
+            }
+
+            for (auto &field : record["delta"].items())
+            {
+                snapshot[field.key()] = field.value();
+            }
+
+            applied++;
+        }
+
+        return applied;
+    }
+
+    bool Recover(std::string directory)
+    {
+        auto journal = directory + "/" + Journal::JOURNAL;
+        auto snapshot = directory + "/" + Journal::SNAPSHOT;
+
+        std::error_code error;
+
+        if (!std::filesystem::exists(journal, error) || std::filesystem::file_size(journal, error) == 0)
+        {
+            return false;
+        }
+
+        nlohmann::json data;
+
+        std::ifstream ifs(snapshot);
+
+        if (ifs.good())
+        {
+            data = nlohmann::json::parse(ifs, nullptr, false);
+
+            ifs.close();
+        }
+
+        if (data.is_discarded())
+        {
+            data = nlohmann::json();
+        }
+
+        auto applied = Journal::Merge(data, journal);
+
+        auto recovered = false;
+
+        // only a complete character (i.e. one that started from a snapshot) can be loaded
+        if (applied > 0 && data.is_object() && data.count("name") > 0 && data.count("storyID") > 0)
+        {
+            data["epoch"] = Journal::Now();
+
+            recovered = Journal::Write(snapshot, data);
+        }
+
+        if (recovered || applied == 0)
+        {
+            std::filesystem::remove(journal, error);
+        }
+
+        return recovered;
+    }
+
+    class Writer
+    {
+    private:
+        std::thread worker;
+
+        std::mutex lock;
+
+        std::condition_variable signal;
+
+        bool running = false;
+
+        // Only the latest state is kept if the writer falls behind, each record is relative to the last one written
+        bool pending = false;
+
+        Character::Base player;
+
+        // The next record starts a new game
+        bool restart = true;
+
+        // Last state written
+        nlohmann::json state;
+
+        int records = 0;
+
+        // Of the last snapshot written, the records that follow it carry the same number
+        long long generation = 0;
+
+        std::string snapshot_file = "";
+
+        std::string journal_file = "";
+
+        void compact(nlohmann::json &data)
+        {
+            data["epoch"] = Journal::Now();
+
+            // unique across runs, so records of an older snapshot never match a newer one
+            auto next = std::max(generation + 1, Journal::Now());
+
+            data["generation"] = next;
+
+            if (Journal::Write(snapshot_file, data))
+            {
+                generation = next;
+
+                // start an empty journal
+                auto output = fopen(journal_file.c_str(), "wb");
+
+                if (output)
+                {
+                    fclose(output);
+                }
+
+                records = 0;
+            }
+        }
+
+        void append(std::string &line)
+        {
+            auto output = fopen(journal_file.c_str(), "ab");
+
+            if (output)
+            {
+                line += "\n";
+
+                fwrite(line.data(), 1, line.length(), output);
+
+                Sync(output);
+
+                fclose(output);
+
+                records++;
+            }
+        }
+
+        void process(Character::Base &character, bool start)
+        {
+            auto data = characterData(character);
+
+            if (start || !state.is_object() || records >= Journal::COMPACT_EVERY)
+            {
+                compact(data);
+            }
+            else
+            {
+                nlohmann::json record;
+
+                auto delta = nlohmann::json::object();
+
+                for (auto &field : data.items())
+                {
+                    if (field.key() != "epoch" && (state.count(field.key()) == 0 || state[field.key()] != field.value()))
+                    {
+                        delta[field.key()] = field.value();
+                    }
+                }
+
+                record["story"] = character.StoryID;
+                record["generation"] = generation;
+                record["delta"] = delta;
+
+                auto line = record.dump();
+
+                if (line.length() > Journal::MAX_RECORD)
+                {
+                    compact(data);
+                }
+                else
+                {
+                    append(line);
+                }
+            }
+
+            state = data;
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> guard(lock);
+
+            while (running || pending)
+            {
+                signal.wait(guard, [this] { return pending || !running; });
+
+                if (pending)
+                {
+                    auto character = player;
+
+                    auto start = restart;
+
+                    pending = false;
+
+                    restart = false;
+
+                    guard.unlock();
+
+                    process(character, start);
+
+                    guard.lock();
+                }
+            }
+
+            // leave a complete snapshot behind on a clean exit
+            if (state.is_object() && records > 0)
+            {
+                compact(state);
+            }
+        }
+
+    public:
+        void Start(std::string directory)
+        {
+            if (!running)
+            {
+                snapshot_file = directory + "/" + Journal::SNAPSHOT;
+
+                journal_file = directory + "/" + Journal::JOURNAL;
+
+                running = true;
+
+                worker = std::thread(&Journal::Writer::run, this);
+            }
+        }
+
+        // A new game was started or loaded, the next record is a snapshot
+        void Begin()
+        {
+            std::lock_guard<std::mutex> guard(lock);
+
+            restart = true;
+        }
+
+        // Called once per section on the render thread, only copies the character
+        void Push(Character::Base &character)
+        {
+            if (running)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    player = character;
+
+                    pending = true;
+                }
+
+                Memory::Set(Memory::Type::SNAPSHOTS, Character::Footprint(character));
+
+                signal.notify_one();
+            }
+        }
+
+        // Write what is pending and wait for the writer to finish
+        void Stop()
+        {
+            if (running)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    running = false;
+                }
+
+                signal.notify_one();
+
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        ~Writer()
+        {
+            Stop();
+        }
+    };
+
+    Journal::Writer Autosave = Journal::Writer();
+
+    void Start(std::string directory)
+    {
+        Autosave.Start(directory);
+    }
+
+    void Begin()
+    {
+        Autosave.Begin();
+    }
+
+    void Push(Character::Base &character)
+    {
+        Autosave.Push(character);
+    }
+
+    void Stop()
+    {
+        Autosave.Stop();
+    }
+} // namespace Journal
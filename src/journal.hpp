@@ -0,0 +1,42 @@
+#ifndef __JOURNAL__HPP__
+#define __JOURNAL__HPP__
+
+#include <string>
+
+#include "character.hpp"
+
+// Append-only autosave. Every section entered adds one line to the journal: the story ID and the character fields
+// that changed since the previous line. The journal is compacted into a full snapshot (a regular saved game) every
+// COMPACT_EVERY records, when a record would be too large, and on exit. After a crash the tail of the journal is
+// replayed onto the snapshot at startup. Records carry the generation of the snapshot they follow, so records left over
+// from an older snapshot (a crash before the journal was emptied) are skipped. All file writes happen on a background
+// thread.
+namespace Journal
+{
+    // Records larger than this (in bytes) are replaced by a snapshot
+    const int MAX_RECORD = 512;
+
+    // Records between snapshots
+    const int COMPACT_EVERY = 64;
+
+    inline const char *SNAPSHOT = "autosave.save";
+
+    inline const char *JOURNAL = "autosave.journal";
+
+    // Replay the tail of an unfinished journal onto the snapshot. Returns true if a game was recovered.
+    bool Recover(std::string directory);
+
+    // Start the background writer
+    void Start(std::string directory);
+
+    // A new game was started or loaded, the next record is a snapshot
+    void Begin();
+
+    // Called once per section on the render thread, only copies the character
+    void Push(Character::Base &character);
+
+    // Write what is pending and wait for the writer to finish
+    void Stop();
+} // namespace Journal
+
+#endif
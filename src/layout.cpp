@@ -0,0 +1,351 @@
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "handles.hpp"
+#include "memory.hpp"
+#include "textures.hpp"
+#include "story.hpp"
+#include "layout.hpp"
+
+namespace Layout
+{
+    const char *HEADER = "LAYOUT 2";
+
+    class Entry
+    {
+    public:
+        // FNV-1a of the text that was broken
+        unsigned int Hash = 0;
+
+        Layout::Lines Lines = Layout::Lines();
+    };
+
+    // (font size, width) -> section ID -> lines
+    std::map<std::pair<int, int>, std::unordered_map<int, Layout::Entry>> Baked = std::map<std::pair<int, int>, std::unordered_map<int, Layout::Entry>>();
+
+    unsigned int Hash(const char *text)
+    {
+        unsigned int hash = 2166136261U;
+
+        for (auto c = text; *c; c++)
+        {
+            hash = (hash ^ (unsigned char)*c) * 16777619U;
+        }
+
+        return hash;
+    }
+
+    int Width(TTF_Font *font, const std::string &text)
+    {
+        auto w = 0;
+
+        auto h = 0;
+
+        if (text.length() > 0)
+        {
+            TTF_SizeText(font, text.c_str(), &w, &h);
+        }
+
+        return w;
+    }
+
+    Layout::Line Measure(TTF_Font *font, const std::string &source, int start, int length)
+    {
+        auto line = Layout::Line();
+
+        line.Start = start;
+
+        line.Length = length;
+
+        line.Width = Layout::Width(font, source.substr(start, length));
+
+        return line;
+    }
+
+    Layout::Lines Break(TTF_Font *font, const char *text, int wrap)
+    {
+        auto lines = Layout::Lines();
+
+        auto source = std::string(text ? text : "");
+
+        auto start = 0;
+
+        while (start <= (int)source.length())
+        {
+            auto end = (int)source.find('\n', start);
+
+            if (end == (int)std::string::npos)
+            {
+                end = (int)source.length();
+            }
+
+            // one paragraph, broken at the last space that fits
+            auto line = start;
+
+            auto last = start;
+
+            while (true)
+            {
+                auto space = (int)source.find(' ', last);
+
+                auto next = (space == (int)std::string::npos || space > end) ? end : space;
+
+                if (next > line && last > line && Layout::Width(font, source.substr(line, next - line)) > wrap)
+                {
+                    lines.push_back(Layout::Measure(font, source, line, last - 1 - line));
+
+                    line = last;
+                }
+
+                if (next >= end)
+                {
+                    break;
+                }
+
+                last = next + 1;
+            }
+
+            lines.push_back(Layout::Measure(font, source, line, end - line));
+
+            start = end + 1;
+        }
+
+        return lines;
+    }
+
+    void Bake(const char *ttf, int font_size, int wrap)
+    {
+        auto font = Handle::Font(Memory::OpenFont(ttf, font_size));
+
+        if (!font)
+        {
+            std::cerr << "Unable to open font " << ttf << "! TTF Error: " << TTF_GetError() << std::endl;
+
+            return;
+        }
+
+        auto &baked = Baked[std::make_pair(font_size, wrap)];
+
+        for (auto story : Stories)
+        {
+            if (story->Text)
+            {
+                auto entry = Layout::Entry();
+
+                entry.Hash = Layout::Hash(story->Text);
+
+                entry.Lines = Layout::Break(font.get(), story->Text, wrap);
+
+                baked[story->ID] = entry;
+            }
+        }
+    }
+
+    bool Save(const char *file)
+    {
+        std::ofstream out(file);
+
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        out << HEADER << std::endl;
+
+        for (auto &size : Baked)
+        {
+            out << "SIZE " << size.first.first << " " << size.first.second << " " << size.second.size() << std::endl;
+
+            for (auto &section : size.second)
+            {
+                out << section.first << " " << section.second.Hash << " " << section.second.Lines.size();
+
+                // gap since the end of the previous line, length and width, so that most numbers are short
+                auto end = 0;
+
+                for (auto &line : section.second.Lines)
+                {
+                    out << " " << (line.Start - end) << " " << line.Length << " " << line.Width;
+
+                    end = line.Start + line.Length;
+                }
+
+                out << std::endl;
+            }
+        }
+
+        return out.good();
+    }
+
+    bool Load(const char *file, int font_size, int wrap)
+    {
+        std::ifstream in(file);
+
+        auto header = std::string();
+
+        if (!in.is_open() || !std::getline(in, header) || header != HEADER)
+        {
+            return false;
+        }
+
+        auto key = std::make_pair(font_size, wrap);
+
+        auto &baked = Baked[key];
+
+        baked.clear();
+
+        long long bytes = 0;
+
+        auto line = std::string();
+
+        auto current = false;
+
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+
+            if (line.compare(0, 5, "SIZE ") == 0)
+            {
+                auto tag = std::string();
+
+                auto size = 0;
+
+                auto width = 0;
+
+                fields >> tag >> size >> width;
+
+                current = (size == font_size && width == wrap);
+
+                if (!current && baked.size() > 0)
+                {
+                    // all the entries of a size are together
+                    break;
+                }
+            }
+            else if (current)
+            {
+                auto id = 0;
+
+                auto count = 0;
+
+                auto entry = Layout::Entry();
+
+                fields >> id >> entry.Hash >> count;
+
+                auto end = 0;
+
+                for (auto i = 0; i < count && fields; i++)
+                {
+                    auto gap = 0;
+
+                    auto line = Layout::Line();
+
+                    fields >> gap >> line.Length >> line.Width;
+
+                    line.Start = end + gap;
+
+                    entry.Lines.push_back(line);
+
+                    end = line.Start + line.Length;
+                }
+
+                if (fields && entry.Lines.size() == count)
+                {
+                    bytes += sizeof(Layout::Entry) + entry.Lines.size() * sizeof(Layout::Line);
+
+                    baked[id] = entry;
+                }
+            }
+        }
+
+        if (baked.empty())
+        {
+            Baked.erase(key);
+        }
+
+        Memory::Set(Memory::Type::LAYOUTS, bytes);
+
+        return bytes > 0;
+    }
+
+    const Layout::Lines *Find(int id, int font_size, int wrap, const char *text)
+    {
+        auto size = Baked.find(std::make_pair(font_size, wrap));
+
+        if (text == NULL || size == Baked.end())
+        {
+            return NULL;
+        }
+
+        auto section = size->second.find(id);
+
+        if (section == size->second.end() || section->second.Hash != Layout::Hash(text))
+        {
+            return NULL;
+        }
+
+        return &section->second.Lines;
+    }
+
+    SDL_Surface *Render(TTF_Font *font, const char *text, const Layout::Lines &lines, SDL_Color color)
+    {
+        if (font == NULL || text == NULL || lines.empty())
+        {
+            return NULL;
+        }
+
+        auto source = std::string(text);
+
+        auto skip = TTF_FontLineSkip(font);
+
+        auto width = 0;
+
+        for (auto &line : lines)
+        {
+            width = line.Width > width ? line.Width : width;
+        }
+
+        if (width <= 0)
+        {
+            return NULL;
+        }
+
+        auto surface = Memory::Track(Memory::Type::TEXT, SDL_CreateRGBSurfaceWithFormat(0, width, skip * (int)lines.size(), 32, Textures::Format()));
+
+        if (surface == NULL)
+        {
+            return NULL;
+        }
+
+        SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, color.r, color.g, color.b, 0));
+
+        for (auto i = 0; i < lines.size(); i++)
+        {
+            if (lines[i].Length > 0)
+            {
+                auto rendered = Handle::Surface(Memory::Track(Memory::Type::TEXT, TTF_RenderText_Blended(font, source.substr(lines[i].Start, lines[i].Length).c_str(), color)));
+
+                if (rendered)
+                {
+                    SDL_Rect position = {0, i * skip, rendered->w, rendered->h};
+
+                    // copy the glyph alpha as is
+                    SDL_SetSurfaceBlendMode(rendered.get(), SDL_BLENDMODE_NONE);
+
+                    SDL_BlitSurface(rendered.get(), NULL, surface, &position);
+                }
+            }
+        }
+
+        return surface;
+    }
+} // namespace Layout
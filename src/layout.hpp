@@ -0,0 +1,55 @@
+#ifndef __LAYOUT__HPP__
+#define __LAYOUT__HPP__
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+// Line breaks of the section texts computed ahead of time (layout.cpp). "make layouts" bakes the breaks of every
+// section at each of the RESOLUTIONS into FILE. At runtime the entries for the current font size and text width are
+// loaded, and a section whose text matches its baked hash is drawn line by line without measuring. Texts that are
+// built at runtime (e.g. PreText) do not match and go through createText.
+namespace Layout
+{
+    inline const char *FILE = "layouts.dat";
+
+    // Framebuffer sizes that are baked (width, height)
+    inline const std::vector<std::pair<int, int>> RESOLUTIONS = {{980, 700}, {1280, 720}, {1366, 768}, {1600, 900}, {1920, 1080}, {1960, 1400}, {2560, 1440}, {3840, 2160}};
+
+    class Line
+    {
+    public:
+        // Byte offset and length in the text
+        int Start = 0;
+
+        int Length = 0;
+
+        // Pixels, measured when the line was baked
+        int Width = 0;
+    };
+
+    typedef std::vector<Layout::Line> Lines;
+
+    // Greedy breaking at spaces and newlines, like TTF_RenderText_Blended_Wrapped
+    Layout::Lines Break(TTF_Font *font, const char *text, int wrap);
+
+    // Break every section text with this font size and width
+    void Bake(const char *ttf, int font_size, int wrap);
+
+    // Write everything baked so far
+    bool Save(const char *file);
+
+    // Load the entries for this font size and width only. Returns false if there are none.
+    bool Load(const char *file, int font_size, int wrap);
+
+    // Baked lines of the section, NULL if the size was not baked or the text is not the one that was baked
+    const Layout::Lines *Find(int id, int font_size, int wrap, const char *text);
+
+    // Draw the lines onto one surface (the same size TTF_RenderText_Blended_Wrapped would make) without measuring them
+    SDL_Surface *Render(TTF_Font *font, const char *text, const Layout::Lines &lines, SDL_Color color);
+} // namespace Layout
+
+#endif
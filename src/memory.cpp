@@ -0,0 +1,230 @@
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "memory.hpp"
+
+namespace Memory
+{
+    const int TYPES = (int)Memory::Type::COUNT;
+
+    const char *Names[TYPES] = {"images", "text", "icons", "buttons", "rows", "textures", "fonts", "story", "player", "snapshots", "audio", "layouts"};
+
+    std::atomic<long long> Current[TYPES];
+
+    std::atomic<long long> Peaks[TYPES];
+
+    // budgets for the 1 GB armhf units, leaving most of the memory to the system, SDL and the GPU driver
+#if defined(__arm__)
+    long long Budgets[TYPES] = {96LL << 20, 32LL << 20, 16LL << 20, 32LL << 20, 16LL << 20, 128LL << 20, 16LL << 20, 8LL << 20, 1LL << 20, 1LL << 20, 4LL << 20, 2LL << 20};
+#else
+    long long Budgets[TYPES] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+#endif
+
+    std::atomic<bool> Warned[TYPES];
+
+    // Live surfaces, textures and fonts: size and subsystem
+    std::mutex Lock;
+
+    std::map<const void *, std::pair<Memory::Type, long long>> Live = std::map<const void *, std::pair<Memory::Type, long long>>();
+
+    const char *Name(Memory::Type type)
+    {
+        return (type >= Memory::Type::IMAGES && type < Memory::Type::COUNT) ? Names[(int)type] : "unknown";
+    }
+
+    void Check(Memory::Type type)
+    {
+        if (Memory::Over(type) && !Warned[(int)type].exchange(true))
+        {
+            std::cerr << "Memory budget exceeded: " << Memory::Name(type) << " uses " << (Memory::Used(type) >> 10) << " KB of " << (Memory::Budget(type) >> 10) << " KB" << std::endl;
+        }
+    }
+
+    void Add(Memory::Type type, long long bytes)
+    {
+        auto used = (Current[(int)type] += bytes);
+
+        auto peak = Peaks[(int)type].load();
+
+        while (used > peak && !Peaks[(int)type].compare_exchange_weak(peak, used))
+        {
+        }
+
+        Check(type);
+    }
+
+    void Remove(Memory::Type type, long long bytes)
+    {
+        Current[(int)type] -= bytes;
+    }
+
+    void Set(Memory::Type type, long long bytes)
+    {
+        Memory::Add(type, bytes - Current[(int)type].load());
+    }
+
+    long long Used(Memory::Type type)
+    {
+        return Current[(int)type].load();
+    }
+
+    long long Peak(Memory::Type type)
+    {
+        return Peaks[(int)type].load();
+    }
+
+    long long Total()
+    {
+        long long total = 0;
+
+        for (auto i = 0; i < TYPES; i++)
+        {
+            total += Current[i].load();
+        }
+
+        return total;
+    }
+
+    long long Budget(Memory::Type type)
+    {
+        return Budgets[(int)type];
+    }
+
+    void Budget(Memory::Type type, long long bytes)
+    {
+        Budgets[(int)type] = bytes;
+
+        Warned[(int)type] = false;
+    }
+
+    bool Budget(std::string option)
+    {
+        auto separator = option.find('=');
+
+        if (separator != std::string::npos)
+        {
+            auto name = option.substr(0, separator);
+
+            for (auto i = 0; i < TYPES; i++)
+            {
+                if (name == Names[i])
+                {
+                    Memory::Budget((Memory::Type)i, std::atoll(option.substr(separator + 1).c_str()) << 20);
+
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    bool Over(Memory::Type type)
+    {
+        auto budget = Budgets[(int)type];
+
+        return budget > 0 && Current[(int)type].load() > budget;
+    }
+
+    bool Exceeded()
+    {
+        for (auto i = 0; i < TYPES; i++)
+        {
+            if (Warned[i].load())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Track(const void *resource, Memory::Type type, long long bytes)
+    {
+        if (resource)
+        {
+            {
+                std::lock_guard<std::mutex> guard(Lock);
+
+                auto live = Live.find(resource);
+
+                if (live != Live.end())
+                {
+                    Memory::Remove(live->second.first, live->second.second);
+                }
+
+                Live[resource] = std::make_pair(type, bytes);
+            }
+
+            Memory::Add(type, bytes);
+        }
+    }
+
+    void Release(const void *resource)
+    {
+        if (resource)
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            auto live = Live.find(resource);
+
+            if (live != Live.end())
+            {
+                Memory::Remove(live->second.first, live->second.second);
+
+                Live.erase(live);
+            }
+        }
+    }
+
+    std::string Size(long long bytes)
+    {
+        std::ostringstream text;
+
+        text << std::fixed << std::setprecision(1) << (double)bytes / (1 << 20) << " MB";
+
+        return text.str();
+    }
+
+    std::vector<std::string> Lines()
+    {
+        auto lines = std::vector<std::string>();
+
+        for (auto i = 0; i < TYPES; i++)
+        {
+            auto type = (Memory::Type)i;
+
+            std::ostringstream line;
+
+            line << std::left << std::setw(10) << Names[i] << " " << Memory::Size(Memory::Used(type)) << " (peak " << Memory::Size(Memory::Peak(type)) << ")";
+
+            if (Memory::Budget(type) > 0)
+            {
+                line << " of " << Memory::Size(Memory::Budget(type)) << (Memory::Over(type) ? " OVER" : "");
+            }
+
+            lines.push_back(line.str());
+        }
+
+        lines.push_back("total      " + Memory::Size(Memory::Total()));
+
+        return lines;
+    }
+
+    void Report(std::ostream &out)
+    {
+        out << "Memory:" << std::endl;
+
+        for (auto &line : Memory::Lines())
+        {
+            out << "    " << line << std::endl;
+        }
+    }
+} // namespace Memory
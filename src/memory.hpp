@@ -0,0 +1,105 @@
+#ifndef __MEMORY__HPP__
+#define __MEMORY__HPP__
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+// Memory used by each subsystem (memory.cpp, the SDL wrappers are in graphics.cpp so that the accounting itself does not
+// need SDL). Surfaces, textures and fonts are attributed when they are created through the wrappers (or passed to Track)
+// and released when they are freed through the wrappers. Story and character sizes
+// are measured. Sizes of textures and fonts are estimates: pixels times bytes per pixel and the size of the font file.
+namespace Memory
+{
+    enum class Type
+    {
+        IMAGES = 0, // decoded images (createImage)
+        TEXT,       // rendered text (createText, putText)
+        ICONS,      // scaled icon cache (Asset::Icon)
+        BUTTONS,    // surfaces owned by buttons
+        ROWS,       // rasterized list rows (Widget::Rows)
+        TEXTURES,   // GPU textures
+        FONTS,      // open fonts
+        STORY,      // story sections
+        PLAYER,     // the player
+        SNAPSHOTS,  // copies of the player kept by the autosave
+        AUDIO,      // decoded sound effects
+        LAYOUTS,    // baked line breaks of the section texts (Layout::Load)
+        COUNT
+    };
+
+    // Show the budget report on top of every screen (toggled with F3)
+    inline bool Overlay = false;
+
+    const char *Name(Memory::Type type);
+
+    void Add(Memory::Type type, long long bytes);
+
+    void Remove(Memory::Type type, long long bytes);
+
+    void Set(Memory::Type type, long long bytes);
+
+    long long Used(Memory::Type type);
+
+    long long Peak(Memory::Type type);
+
+    long long Total();
+
+    // Limit in bytes, 0 for none
+    long long Budget(Memory::Type type);
+
+    void Budget(Memory::Type type, long long bytes);
+
+    // Parse NAME=MB (e.g. textures=64), returns false if the subsystem is unknown
+    bool Budget(std::string option);
+
+    bool Over(Memory::Type type);
+
+    // True if any subsystem went over its budget
+    bool Exceeded();
+
+    // Attribute a live resource to a subsystem, a resource that is already tracked moves to the new subsystem
+    void Track(const void *resource, Memory::Type type, long long bytes);
+
+    // Stop tracking a resource that is about to be freed
+    void Release(const void *resource);
+
+    // Attribute a surface to a subsystem, a surface that is already tracked moves to the new subsystem
+    SDL_Surface *Track(Memory::Type type, SDL_Surface *surface);
+
+    SDL_Texture *CreateTexture(SDL_Renderer *renderer, SDL_Surface *surface);
+
+    TTF_Font *OpenFont(const char *file, int size);
+
+    void FreeSurface(SDL_Surface *surface);
+
+    void DestroyTexture(SDL_Texture *texture);
+
+    void CloseFont(TTF_Font *font);
+
+    // Heap bytes of a string (none when the text fits in the string itself)
+    inline long long Bytes(const std::string &text)
+    {
+        auto data = (const char *)text.data();
+
+        auto self = (const char *)&text;
+
+        return (data >= self && data < self + sizeof(text)) ? 0 : (long long)text.capacity() + 1;
+    }
+
+    // Lines of the budget report
+    std::vector<std::string> Lines();
+
+    void Report(std::ostream &out);
+
+    // Draw the report over the current frame when the overlay is on
+    void Draw(SDL_Renderer *renderer);
+
+    // Destroy the overlay's texture (before the renderer is destroyed)
+    void Discard();
+} // namespace Memory
+
+#endif
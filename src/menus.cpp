@@ -0,0 +1,365 @@
+// Standard IO
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+// Using SDL
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "config.hpp"
+#include "controls.hpp"
+#include "handles.hpp"
+#include "render.hpp"
+#include "widgets.hpp"
+#include "runner.hpp"
+#include "input.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "story.hpp"
+#include "graphics.hpp"
+#include "screens.hpp"
+#include "save.hpp"
+
+bool aboutScreen(SDL_Window *window, SDL_Renderer *renderer)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    auto *about = "Critical IF are gamebooks with a difference. The outcomes are not random. Whether you live or die is a matter not of luck, but of judgement.\n\nTo start your adventure simply choose your character. Each character has a unique selection of four skills; these will decide which options are available to you. Also note your Life Points and your possessions.\n\nLife Points are lost each time you are wounded. If you are ever reduced to zero Life Points, you have been killed and the adventure ends. Sometimes you can recover Life Points during your adventure, but you can never have more Life Points than you started with.\n\nYou can carry up to eight possessions at a time. If you are at this limit and find something else you want, drop one of your other possessions to make room for the new item.\n\nConsider your selection of skills. They establish your special strengths, and will help you to role-play your choices during the adventrue. If you arrive at an entry which lists options for more than one of your skills, you can choose which skill to use in that situation.\n\nThat's all you need to know. Now choose your character.";
+
+    auto splash = Handle::Surface(createImage("images/skulls-vr.png"));
+
+    auto text_space = Video.Scaled(8);
+
+    auto text = Handle::Surface(createText(about, FONT_FILE, Video.Scaled(18), clrWH, SCREEN_WIDTH * (1.0 - 3 * Margin) - splashw - 2 * text_space));
+
+    // Render the image
+    if (window && renderer && splash && text)
+    {
+        auto about_buttonw = Video.Scaled(150);
+        auto about_buttonh = Video.Scaled(48);
+        auto about_buttony = (int)(SCREEN_HEIGHT * (1 - Margin) - buttonh);
+
+        auto runner = Widget::Runner<TextButton>(window, renderer, "About the game");
+
+        runner.Controls.push_back(TextButton(0, "Back", 0, 0, 0, 0, startx, about_buttony, about_buttonw, about_buttonh, Control::Type::BACK));
+
+        runner.Background = intDB;
+
+        runner.FontSize = Video.Scaled(20);
+
+        runner.Widgets.Add<Widget::Scroll>(text.get(), intDB, text_space, 0, text->w + 2 * text_space, std::min(text->h + 2 * text_space, (int)(SCREEN_HEIGHT * (1.0 - 2 * Margin))), startx * 2 + splashw, starty);
+
+        runner.Update = [&]() {
+            fitImage(renderer, splash.get(), startx, starty, splashw, text_bounds);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            return type == Control::Type::BACK;
+        };
+
+        done = runner.Run();
+    }
+
+    return done;
+}
+
+std::vector<Button> createFilesList(SDL_Window *window, SDL_Renderer *renderer, std::vector<std::string> list, int start, int last, int limit, bool save_button)
+{
+    auto controls = std::vector<Button>();
+
+    auto text_space = Video.Scaled(8);
+
+    if (list.size() > 0)
+    {
+        for (int i = 0; i < last - start; i++)
+        {
+            std::string game_string = "";
+
+            auto index = start + i;
+
+            auto character = summaryGame(list[index]);
+
+#if defined(_WIN32) || defined(__arm__)
+            long long epoch_long;
+#else
+            long epoch_long;
+#endif
+
+            if (character.Epoch == 0)
+            {
+                auto epoch = list[index].substr(list[index].find_last_of("/") + 1, list[index].find_last_of(".") - list[index].find_last_of("/") - 1);
+
+#if defined(_WIN32) || defined(__arm__)
+                epoch_long = std::stoull(epoch);
+#else
+                epoch_long = std::stol(epoch);
+#endif
+            }
+            else
+            {
+                epoch_long = character.Epoch;
+            }
+
+            if (character.StoryID != -1)
+            {
+                auto storyID = std::to_string(std::abs(character.StoryID));
+
+                game_string += std::string(4 - std::to_string(index + 1).length(), '0') + std::to_string(index + 1) + ". " + character.Name + "\n";
+                game_string += "Date: " + time_string(epoch_long) + "\n";
+                game_string += "Section " + std::string(4 - storyID.length(), '0') + storyID + ": ";
+                game_string += "Life: " + std::to_string(character.Life);
+                game_string += ", Money: " + std::to_string(character.Money);
+                game_string += ", Items: " + std::to_string(character.Items.size());
+                game_string += ", Codewords: " + std::to_string(character.Codewords.size());
+            }
+
+            auto button_w = textwidth - 3 * button_space / 2;
+            auto button_h = 0.125 * SCREEN_HEIGHT;
+
+            auto key = "game:" + std::to_string(button_w) + ":" + std::to_string(button_h) + ":" + game_string;
+
+            auto button = Widget::ListRows.Get(key, [&]() { return createHeaderButton(window, game_string.c_str(), clrWH, intDB, button_w, button_h, text_space); });
+
+            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
+
+            controls.push_back(Button(i, button, i, i, (i > 0 ? i - 1 : i), (i < (last - start) ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
+
+            controls[i].W = button->w;
+
+            controls[i].H = button->h;
+        }
+    }
+
+    auto idx = controls.size();
+
+    if (list.size() > limit)
+    {
+        if (start > 0)
+        {
+            controls.push_back(Button(idx, "icons/up-arrow.png", idx, idx, idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+
+            idx++;
+        }
+
+        if (list.size() - last > 0)
+        {
+            controls.push_back(Button(idx, "icons/down-arrow.png", idx, idx, start > 0 ? idx - 1 : idx, idx + 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+
+            idx++;
+        }
+    }
+
+    controls.push_back(Button(idx, "icons/open.png", idx, idx + 1, idx > 0 ? idx - 1 : idx, idx, startx, buttony, Control::Type::LOAD));
+
+    if (save_button)
+    {
+        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, idx > 0 ? idx - 1 : idx + 1, idx + 1, startx + gridsize, buttony, Control::Type::SAVE));
+    }
+
+    idx = controls.size();
+
+    controls.push_back(Button(idx, "icons/back-button.png", idx - 1, idx, list.size() > 0 ? (last - start) : idx, idx, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+    return controls;
+}
+
+Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, bool save_botton)
+{
+    auto screen = Frame::Screen();
+
+    auto result = Control::Type::BACK;
+
+    if (window && renderer)
+    {
+        std::string save = savePath();
+        std::string path = save + "/";
+
+        fs::create_directories(save);
+
+        std::vector<std::string> entries;
+
+        auto splash = Handle::Surface(createImage("images/filler1.png"));
+
+        auto saved_games = std::multimap<std::filesystem::file_time_type, std::string, std::greater<std::filesystem::file_time_type>>();
+
+        try
+        {
+            for (const auto &entry : fs::directory_iterator(path))
+            {
+                auto time_stamp = entry.last_write_time();
+
+#if defined(_WIN32) || defined(__arm__)
+                std::string file_name = entry.path().string();
+#else
+                std::string file_name = entry.path();
+#endif
+
+                if (file_name.substr(file_name.find_last_of(".") + 1) == "save")
+                {
+                    saved_games.insert(std::make_pair(time_stamp, file_name));
+                }
+            }
+        }
+        catch (std::exception &ex)
+        {
+            std::cerr << "Unable to read save directory!" << std::endl;
+        }
+
+        for (auto const &entry : saved_games)
+        {
+            entries.push_back(entry.second);
+        }
+
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        auto runner = Widget::Runner<>(window, renderer, "Necklace of Skulls: LOAD/SAVE game");
+
+        runner.Limit = (text_bounds - text_space) / (boxh + 3 * text_space);
+
+        runner.Count = [&]() {
+            return (int)entries.size();
+        };
+
+        runner.List = [&]() {
+            return createFilesList(window, renderer, entries, runner.Offset, runner.Last(), runner.Limit, save_botton);
+        };
+
+        runner.Refresh();
+
+        runner.Space = border_space;
+        runner.Points = border_pts;
+
+        auto selected_file = -1;
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto shown_file = -1;
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth, text_bounds, textx, texty);
+        runner.Widgets.Add<Widget::Label>("SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * boxh + infoh - 1));
+        runner.Widgets.Add<Widget::Panel>(intBE, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh);
+        auto game_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh);
+
+        runner.Update = [&]() {
+            fitImage(renderer, splash.get(), startx, starty, splashw, text_bounds);
+
+            // the summary is only read again when another file is selected
+            if (selected_file != shown_file)
+            {
+                shown_file = selected_file;
+
+                std::string game_string = "";
+
+                if (selected_file >= 0 && selected_file < entries.size())
+                {
+                    auto character = loadGame(entries[selected_file]);
+
+#if defined(_WIN32) || defined(__arm__)
+                    long long epoch_long;
+#else
+                    long epoch_long;
+#endif
+
+                    if (character.Epoch > 0)
+                    {
+                        epoch_long = character.Epoch;
+                    }
+                    else
+                    {
+                        auto epoch = entries[selected_file].substr(entries[selected_file].find_last_of("/") + 1, entries[selected_file].find_last_of(".") - entries[selected_file].find_last_of("/") - 1);
+
+#if defined(_WIN32) || defined(__arm__)
+                        epoch_long = std::stoull(epoch);
+#else
+                        epoch_long = std::stol(epoch);
+#endif
+                    }
+
+                    if (character.StoryID != -1)
+                    {
+                        auto storyID = std::to_string(std::abs(character.StoryID));
+
+                        game_string = "Date: " + time_string(epoch_long) + "\n";
+                        game_string += std::string(4 - storyID.length(), '0') + storyID + ": " + character.Name;
+                        game_string += "\nLife: " + std::to_string(character.Life);
+                        game_string += " Money: " + std::to_string(character.Money);
+                    }
+                }
+
+                game_box->Set(game_string);
+            }
+        };
+
+        runner.Draw = [&]() {
+            for (auto i = 0; i < runner.Last() - runner.Offset; i++)
+            {
+                if (runner.Offset + i == selected_file)
+                {
+                    Render::Queue.Border(runner.Controls[i], intBK, text_space, 4);
+                }
+            }
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION)
+            {
+                auto file = runner.Offset + runner.Current;
+
+                selected_file = (file == selected_file) ? -1 : file;
+            }
+            else if (type == Control::Type::LOAD)
+            {
+                if (selected_file >= 0 && selected_file < entries.size())
+                {
+                    player = loadGame(entries[selected_file]);
+
+                    result = Control::Type::LOAD;
+
+                    return true;
+                }
+            }
+            else if (type == Control::Type::SAVE)
+            {
+                saveGame(player, selected_file != -1 ? entries[selected_file].c_str() : NULL);
+
+                result = Control::Type::SAVE;
+
+                return true;
+            }
+            else if (type == Control::Type::BACK)
+            {
+                result = Control::Type::BACK;
+
+                return true;
+            }
+
+            return false;
+        };
+
+        runner.Run();
+    }
+
+    return result;
+}
@@ -0,0 +1,109 @@
+#ifndef __RENDER__HPP__
+#define __RENDER__HPP__
+
+#include <map>
+#include <vector>
+
+#include <SDL.h>
+
+#include "constants.hpp"
+#include "controls.hpp"
+
+namespace Render
+{
+    inline SDL_Renderer *LastRenderer = NULL;
+
+    inline Uint32 LastColor = 0;
+
+    // Set the draw color only when it differs from the one last submitted to the renderer
+    inline void SetColor(SDL_Renderer *renderer, Uint32 color)
+    {
+        if (renderer != LastRenderer || color != LastColor)
+        {
+            SDL_SetRenderDrawColor(renderer, R(color), G(color), B(color), A(color));
+
+            LastRenderer = renderer;
+
+            LastColor = color;
+        }
+    }
+
+    // Collects rectangles by color and submits each color group with a single draw call
+    class Batch
+    {
+    private:
+        std::map<Uint32, std::vector<SDL_Rect>> Fills = std::map<Uint32, std::vector<SDL_Rect>>();
+
+        std::map<Uint32, std::vector<SDL_Rect>> Outlines = std::map<Uint32, std::vector<SDL_Rect>>();
+
+        void add(std::map<Uint32, std::vector<SDL_Rect>> &groups, int w, int h, int x, int y, Uint32 color)
+        {
+            SDL_Rect rect;
+
+            rect.w = w;
+            rect.h = h;
+            rect.x = x;
+            rect.y = y;
+
+            groups[color].push_back(rect);
+        }
+
+        void submit(SDL_Renderer *renderer, std::map<Uint32, std::vector<SDL_Rect>> &groups, bool fill)
+        {
+            for (auto &group : groups)
+            {
+                if (group.second.size() > 0)
+                {
+                    SetColor(renderer, group.first);
+
+                    if (fill)
+                    {
+                        SDL_RenderFillRects(renderer, group.second.data(), group.second.size());
+                    }
+                    else
+                    {
+                        SDL_RenderDrawRects(renderer, group.second.data(), group.second.size());
+                    }
+
+                    // keep the capacity around for the next frame
+                    group.second.clear();
+                }
+            }
+        }
+
+    public:
+        void Fill(int w, int h, int x, int y, Uint32 color)
+        {
+            add(Fills, w, h, x, y, color);
+        }
+
+        void Draw(int w, int h, int x, int y, Uint32 color)
+        {
+            add(Outlines, w, h, x, y, color);
+        }
+
+        // Queue the highlight around a control, (pts + 1) concentric outlines spaced one pixel apart
+        void Border(const Control::Base &control, Uint32 color, int space, int pts)
+        {
+            for (auto size = pts; size >= 0; size--)
+            {
+                Draw(control.W + 2 * (space - size), control.H + 2 * (space - size), control.X - space + size, control.Y - space + size, color);
+            }
+        }
+
+        // Submit the queued filled rectangles (which go underneath) then the outlines
+        void Flush(SDL_Renderer *renderer)
+        {
+            if (renderer)
+            {
+                submit(renderer, Fills, true);
+                submit(renderer, Outlines, false);
+            }
+        }
+    };
+
+    // Shared by all screens
+    inline Render::Batch Queue = Render::Batch();
+} // namespace Render
+
+#endif
@@ -0,0 +1,493 @@
+#ifndef __REPLAY__HPP__
+#define __REPLAY__HPP__
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "constants.hpp"
+
+// Deterministic input recorder and replay. The game has no randomness, so the resolved inputs (the control selected,
+// scroll and hold state) from program start are enough to reproduce a session. Section and character checkpoints are
+// written along with the inputs so that a replay can detect when it no longer follows the recording.
+//
+// Log format (one record per line):
+//
+//  skulls-replay <version> <framebuffer width> <framebuffer height> <story>
+//  i <delay> <control> <flags>   input (flags: 1 selected, 2 scroll up, 4 scroll down, 8 hold, 16 quit)
+//  n <delay>                     press to continue (Input::WaitForNext)
+//  c <json>                      character at the start of a game
+//  s <section> [<state>]         section entered, with the hash of the character's state (State::Hash) in hex
+//
+// <delay> is the number of milliseconds since the previous input
+namespace Replay
+{
+    const int VERSION = 1;
+
+    enum class Mode
+    {
+        NONE = 0,
+        RECORD,
+        REPLAY
+    };
+
+    enum class Kind
+    {
+        INPUT = 0,
+        NEXT,
+        CHARACTER,
+        SECTION
+    };
+
+    class Record
+    {
+    public:
+        Replay::Kind Kind = Replay::Kind::INPUT;
+
+        Uint32 Delay = 0;
+
+        int Current = -1;
+
+        int Flags = 0;
+
+        // section ID or character data
+        int Section = -1;
+
+        // State::Hash of the character on entering the section, 0 in older logs
+        uint64_t State = 0;
+
+        std::string Data = "";
+    };
+
+    class Log
+    {
+    private:
+        std::ofstream stream;
+
+        std::vector<Replay::Record> records = std::vector<Replay::Record>();
+
+        size_t next = 0;
+
+        Uint32 last_ticks = 0;
+
+        Uint32 start_ticks = 0;
+
+        bool diverged = false;
+
+        // window closed during the replay
+        bool stopped = false;
+
+        // section transition timing
+        Uint32 section_ticks = 0;
+
+        int section = -1;
+
+        int sections = 0;
+
+        Uint32 slowest = 0;
+
+        int slowest_from = -1;
+        int slowest_to = -1;
+
+        Uint32 elapsed()
+        {
+            auto ticks = SDL_GetTicks();
+
+            auto delay = ticks - last_ticks;
+
+            last_ticks = ticks;
+
+            return delay;
+        }
+
+        void write(std::string line)
+        {
+            if (stream.is_open())
+            {
+                stream << line << std::endl;
+            }
+        }
+
+        void diverge(std::string reason)
+        {
+            if (!diverged)
+            {
+                std::cerr << "Replay diverged at record " << next + 1 << ": " << reason << std::endl;
+
+                diverged = true;
+            }
+        }
+
+        // Wait until the recorded delay has passed (realtime) and keep the window responsive
+        bool pace(Uint32 delay)
+        {
+            auto target = last_ticks + delay;
+
+            auto quit = false;
+
+            do
+            {
+                SDL_Event event;
+
+                while (SDL_PollEvent(&event))
+                {
+                    if (event.type == SDL_QUIT)
+                    {
+                        quit = true;
+                    }
+                }
+
+                auto now = SDL_GetTicks();
+
+                // sleep until the delay has passed or an event arrives
+                if (!quit && Realtime && now < target && SDL_WaitEventTimeout(&event, (int)(target - now)) && event.type == SDL_QUIT)
+                {
+                    quit = true;
+                }
+
+            } while (!quit && Realtime && SDL_GetTicks() < target);
+
+            last_ticks = SDL_GetTicks();
+
+            stopped = stopped || quit;
+
+            return quit;
+        }
+
+        // Next input record, false when the log is exhausted or no longer matches the game
+        bool fetch(Replay::Kind kind, Replay::Record &record)
+        {
+            if (diverged || stopped || next >= records.size())
+            {
+                return false;
+            }
+
+            if (records[next].Kind != kind)
+            {
+                diverge(kind == Replay::Kind::NEXT ? "expected an input but the game is waiting to continue" : "expected to continue but the game is waiting for input");
+
+                return false;
+            }
+
+            record = records[next];
+
+            next++;
+
+            return true;
+        }
+
+    public:
+        Replay::Mode Mode = Replay::Mode::NONE;
+
+        std::string File = "";
+
+        // Replay with the original delays between inputs instead of as fast as possible
+        bool Realtime = false;
+
+        // From the log header
+        int Width = 0;
+        int Height = 0;
+
+        int Story = 0;
+
+        bool Recording()
+        {
+            return Mode == Replay::Mode::RECORD;
+        }
+
+        bool Replaying()
+        {
+            return Mode == Replay::Mode::REPLAY;
+        }
+
+        bool Load(std::string file)
+        {
+            std::ifstream ifs(file);
+
+            if (!ifs.good())
+            {
+                std::cerr << "Unable to open replay log " << file << "!" << std::endl;
+
+                return false;
+            }
+
+            auto header = std::string();
+            auto version = 0;
+
+            ifs >> header >> version >> Width >> Height >> Story;
+
+            if (header != "skulls-replay" || version != Replay::VERSION)
+            {
+                std::cerr << file << " is not a replay log!" << std::endl;
+
+                return false;
+            }
+
+            auto line = std::string();
+
+            while (std::getline(ifs, line))
+            {
+                if (line.length() < 2)
+                {
+                    continue;
+                }
+
+                Replay::Record record;
+
+                std::istringstream fields(line.substr(2));
+
+                if (line[0] == 'i')
+                {
+                    record.Kind = Replay::Kind::INPUT;
+
+                    fields >> record.Delay >> record.Current >> record.Flags;
+                }
+                else if (line[0] == 'n')
+                {
+                    record.Kind = Replay::Kind::NEXT;
+
+                    fields >> record.Delay;
+                }
+                else if (line[0] == 's')
+                {
+                    record.Kind = Replay::Kind::SECTION;
+
+                    fields >> record.Section;
+
+                    if (!(fields >> std::hex >> record.State))
+                    {
+                        record.State = 0;
+                    }
+                }
+                else if (line[0] == 'c')
+                {
+                    record.Kind = Replay::Kind::CHARACTER;
+
+                    record.Data = line.substr(2);
+                }
+                else
+                {
+                    continue;
+                }
+
+                records.push_back(record);
+            }
+
+            ifs.close();
+
+            File = file;
+
+            Mode = Replay::Mode::REPLAY;
+
+            return true;
+        }
+
+        bool Create(std::string file)
+        {
+            stream.open(file, std::ios::out | std::ios::trunc);
+
+            if (!stream.good())
+            {
+                std::cerr << "Unable to create replay log " << file << "!" << std::endl;
+
+                return false;
+            }
+
+            File = file;
+
+            Mode = Replay::Mode::RECORD;
+
+            return true;
+        }
+
+        // Call once the window has been created
+        void Start(int story)
+        {
+            if (Recording())
+            {
+                std::ostringstream header;
+
+                header << "skulls-replay " << Replay::VERSION << " " << Video.SCREEN_WIDTH << " " << Video.SCREEN_HEIGHT << " " << story;
+
+                write(header.str());
+            }
+            else if (Replaying() && (Width != Video.SCREEN_WIDTH || Height != Video.SCREEN_HEIGHT))
+            {
+                std::cerr << "Replay was recorded at " << Width << "x" << Height << " but is running at " << Video.SCREEN_WIDTH << "x" << Video.SCREEN_HEIGHT << ", lists may page differently" << std::endl;
+            }
+
+            start_ticks = last_ticks = SDL_GetTicks();
+        }
+
+        // Input::GetInput
+        void Record(int current, bool selected, bool scrollUp, bool scrollDown, bool hold, bool quit)
+        {
+            if (Recording() && (selected || scrollUp || scrollDown || hold || quit))
+            {
+                auto flags = (selected ? 1 : 0) | (scrollUp ? 2 : 0) | (scrollDown ? 4 : 0) | (hold ? 8 : 0) | (quit ? 16 : 0);
+
+                write("i " + std::to_string(elapsed()) + " " + std::to_string(current) + " " + std::to_string(flags));
+            }
+        }
+
+        // Input::WaitForNext
+        void Record()
+        {
+            if (Recording())
+            {
+                write("n " + std::to_string(elapsed()));
+            }
+        }
+
+        // Returns true (quit) when the log is exhausted
+        bool Play(int &current, bool &selected, bool &scrollUp, bool &scrollDown, bool &hold)
+        {
+            Replay::Record record;
+
+            if (!fetch(Replay::Kind::INPUT, record) || pace(record.Delay))
+            {
+                selected = false;
+                scrollUp = false;
+                scrollDown = false;
+                hold = false;
+
+                return true;
+            }
+
+            current = record.Current;
+
+            selected = (record.Flags & 1) != 0;
+            scrollUp = (record.Flags & 2) != 0;
+            scrollDown = (record.Flags & 4) != 0;
+            hold = (record.Flags & 8) != 0;
+
+            return (record.Flags & 16) != 0;
+        }
+
+        void Play()
+        {
+            Replay::Record record;
+
+            if (fetch(Replay::Kind::NEXT, record))
+            {
+                pace(record.Delay);
+            }
+        }
+
+        // Checkpoint: character (serialized) at the start of a game
+        void Character(std::string data)
+        {
+            if (Recording())
+            {
+                write("c " + data);
+            }
+            else if (Replaying() && !diverged && !stopped)
+            {
+                if (next < records.size() && records[next].Kind == Replay::Kind::CHARACTER)
+                {
+                    if (records[next].Data != data)
+                    {
+                        diverge("character differs from the recording");
+                    }
+                    else
+                    {
+                        next++;
+                    }
+                }
+                else
+                {
+                    diverge("unexpected start of a game");
+                }
+            }
+        }
+
+        // Checkpoint: section entered (and the state of the character), also used to time section transitions
+        void Section(int id, uint64_t state = 0)
+        {
+            auto ticks = SDL_GetTicks();
+
+            if (section_ticks > 0 && ticks - section_ticks > slowest)
+            {
+                slowest = ticks - section_ticks;
+
+                slowest_from = section;
+                slowest_to = id;
+            }
+
+            section_ticks = ticks;
+
+            section = id;
+
+            sections++;
+
+            if (Recording())
+            {
+                std::ostringstream record;
+
+                record << "s " << id << " " << std::hex << state;
+
+                write(record.str());
+            }
+            else if (Replaying() && !diverged && !stopped)
+            {
+                if (next < records.size() && records[next].Kind == Replay::Kind::SECTION)
+                {
+                    if (records[next].Section != id)
+                    {
+                        diverge("expected section " + std::to_string(records[next].Section) + " but entered " + std::to_string(id));
+                    }
+                    else if (records[next].State != 0 && state != 0 && records[next].State != state)
+                    {
+                        diverge("character differs from the recording on entering section " + std::to_string(id));
+                    }
+                    else
+                    {
+                        next++;
+                    }
+                }
+                else
+                {
+                    diverge("unexpected transition to section " + std::to_string(id));
+                }
+            }
+        }
+
+        void Close()
+        {
+            if (stream.is_open())
+            {
+                stream.close();
+            }
+
+            if (Replaying())
+            {
+                auto total = SDL_GetTicks() - start_ticks;
+
+                std::cerr << "Replayed " << next << " of " << records.size() << " records from " << File << " in " << total << " ms" << (diverged ? " (diverged)" : (stopped ? " (stopped)" : "")) << std::endl;
+
+                if (sections > 0)
+                {
+                    std::cerr << "Sections: " << sections << ", average " << (total / sections) << " ms";
+
+                    if (slowest_from >= 0)
+                    {
+                        std::cerr << ", slowest " << slowest_from << " -> " << slowest_to << " (" << slowest << " ms)";
+                    }
+
+                    std::cerr << std::endl;
+                }
+            }
+
+            Mode = Replay::Mode::NONE;
+        }
+    };
+
+    inline Replay::Log Session = Replay::Log();
+} // namespace Replay
+
+#endif
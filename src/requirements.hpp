@@ -0,0 +1,179 @@
+#ifndef __REQUIREMENTS__HPP__
+#define __REQUIREMENTS__HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include "codewords.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+
+// Choice requirements compiled into an opcode and bit masks, evaluated against a snapshot of the player
+namespace Requirement
+{
+    enum class Type
+    {
+        NONE = 0,      // Always available
+        ALL_ITEMS,     // Every item in Items (usable, i.e. with charges)
+        ANY_ITEM,      // At least one item in Items (usable)
+        ALL_CODEWORDS, // Every codeword in Codewords
+        SKILL,         // Skill and the item that the skill requires
+        SKILL_ANY,     // Skill and at least one item in Items (usable)
+        SKILL_ALL,     // Skill and every item in Items (usable)
+        MONEY,         // Money >= Value
+        POSSESSIONS,   // At least one possession
+        COUNT          // At least Value items of type Item (regardless of charges)
+    };
+
+    class Base
+    {
+    public:
+        Requirement::Type Type = Requirement::Type::NONE;
+
+        uint64_t Items = 0;
+
+        uint64_t Codewords = 0;
+
+        uint64_t Skills = 0;
+
+        Item::Type Item = Item::Type::NONE;
+
+        int Value = 0;
+    };
+
+    // one bit per item, skill and codeword in a 64-bit mask
+    static_assert((int)Item::Type::Last < 64, "Item::Type does not fit in a requirement mask");
+
+    static_assert((int)Skill::Type::Last < 64, "Skill::Type does not fit in a requirement mask");
+
+    static_assert(Codeword::COUNT <= 64, "Codeword::Type does not fit in a requirement mask");
+
+    inline uint64_t Bit(Item::Type item)
+    {
+        return item != Item::Type::NONE ? ((uint64_t)1 << (int)item) : 0;
+    }
+
+    inline uint64_t Bit(Skill::Type skill)
+    {
+        return skill != Skill::Type::NONE ? ((uint64_t)1 << (int)skill) : 0;
+    }
+
+    inline uint64_t Bit(Codeword::Type codeword)
+    {
+        return codeword != Codeword::Type::NONE ? ((uint64_t)1 << (int)codeword) : 0;
+    }
+
+    inline uint64_t Mask(std::vector<Item::Base> &items)
+    {
+        uint64_t mask = 0;
+
+        for (auto i = 0; i < items.size(); i++)
+        {
+            mask |= Requirement::Bit(items[i].Type);
+        }
+
+        return mask;
+    }
+
+    inline uint64_t Mask(std::vector<Codeword::Type> &codewords)
+    {
+        uint64_t mask = 0;
+
+        for (auto i = 0; i < codewords.size(); i++)
+        {
+            mask |= Requirement::Bit(codewords[i]);
+        }
+
+        return mask;
+    }
+
+    // Player state reduced to bit masks, taken once and shared by all the choices being evaluated
+    class State
+    {
+    public:
+        // Items that can be used (with charges left)
+        uint64_t Usable = 0;
+
+        // Items carried, used up or not
+        uint64_t Carried = 0;
+
+        uint64_t Skills = 0;
+
+        // Skills whose required item (if any) is also usable
+        uint64_t Ready = 0;
+
+        uint64_t Codewords = 0;
+
+        int Money = 0;
+
+        int Possessions = 0;
+
+        std::vector<Item::Base> *Items = NULL;
+
+        State(Character::Base &player)
+        {
+            Money = player.Money;
+
+            Possessions = player.Items.size();
+
+            Items = &player.Items;
+
+            for (auto i = 0; i < player.Items.size(); i++)
+            {
+                Carried |= Requirement::Bit(player.Items[i].Type);
+
+                if (player.Items[i].Charge != 0)
+                {
+                    Usable |= Requirement::Bit(player.Items[i].Type);
+                }
+            }
+
+            for (auto i = 0; i < player.Codewords.size(); i++)
+            {
+                Codewords |= Requirement::Bit(player.Codewords[i]);
+            }
+
+            for (auto i = 0; i < player.Skills.size(); i++)
+            {
+                auto skill = Requirement::Bit(player.Skills[i].Type);
+
+                Skills |= skill;
+
+                if (player.Skills[i].Requirement == Item::Type::NONE || (Usable & Requirement::Bit(player.Skills[i].Requirement)) != 0)
+                {
+                    Ready |= skill;
+                }
+            }
+        }
+    };
+
+    inline bool Evaluate(Requirement::Base &requirement, Requirement::State &state)
+    {
+        switch (requirement.Type)
+        {
+        case Requirement::Type::ALL_ITEMS:
+            return (state.Usable & requirement.Items) == requirement.Items;
+        case Requirement::Type::ANY_ITEM:
+            return (state.Usable & requirement.Items) != 0;
+        case Requirement::Type::ALL_CODEWORDS:
+            return (state.Codewords & requirement.Codewords) == requirement.Codewords;
+        case Requirement::Type::SKILL:
+            return (state.Ready & requirement.Skills) != 0;
+        case Requirement::Type::SKILL_ANY:
+            return (state.Skills & requirement.Skills) != 0 && (state.Usable & requirement.Items) != 0;
+        case Requirement::Type::SKILL_ALL:
+            return (state.Skills & requirement.Skills) != 0 && (state.Usable & requirement.Items) == requirement.Items;
+        case Requirement::Type::MONEY:
+            return state.Money >= requirement.Value;
+        case Requirement::Type::POSSESSIONS:
+            return state.Possessions > 0;
+        case Requirement::Type::COUNT:
+            return state.Items != NULL && Item::COUNT_TYPES(*state.Items, requirement.Item) >= requirement.Value;
+        default:
+            return true;
+        }
+    }
+} // namespace Requirement
+
+#endif
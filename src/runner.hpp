@@ -0,0 +1,478 @@
+#ifndef __RUNNER__HPP__
+#define __RUNNER__HPP__
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "controls.hpp"
+#include "frame.hpp"
+#include "handles.hpp"
+#include "graphics.hpp"
+#include "input.hpp"
+#include "widgets.hpp"
+
+namespace Widget
+{
+    // Text taller than its box, moved by the scroll controls of a Runner
+    class Scroll : public Base
+    {
+    public:
+        SDL_Surface *Text = NULL;
+
+        // 0 leaves the box unfilled, translucent colors are blended
+        Uint32 Bg = intBE;
+
+        int Space = 0;
+
+        // Pixels scrolled from the top and per step
+        int Offset = 0;
+        int Speed = 0;
+
+        Scroll(SDL_Surface *text, Uint32 bg, int space, int speed, int w, int h, int x, int y)
+        {
+            Text = text;
+            Bg = bg;
+            Space = space;
+            Speed = speed;
+            W = w;
+            H = h;
+            X = x;
+            Y = y;
+        }
+
+        // Furthest the text can be scrolled
+        int Max()
+        {
+            return (Text && Text->h >= H - 2 * Space) ? Text->h - H + 2 * Space : 0;
+        }
+
+        void Render(SDL_Renderer *renderer)
+        {
+            auto translucent = Bg != 0 && A(Bg) < 0xFF;
+
+            if (translucent)
+            {
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            }
+
+            if (Bg != 0)
+            {
+                fillRect(renderer, W, H, X, Y, Bg);
+            }
+
+            renderText(renderer, Text, translucent ? 0 : Bg, X + Space, Y + Space, H - 2 * Space, Offset);
+
+            if (translucent)
+            {
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            }
+        }
+    };
+
+    // Yes/no question in a box over a screen (Runner::Ask)
+    class Question
+    {
+    public:
+        Handle::Surface Text;
+
+        std::vector<Button> Controls = std::vector<Button>();
+
+        int W = 0;
+        int H = 0;
+        int X = 0;
+        int Y = 0;
+
+        int Space = 0;
+
+        Question(const char *text, int font_size, int space, int w)
+        {
+            W = w;
+            H = 0.25 * SCREEN_HEIGHT;
+            X = (SCREEN_WIDTH - W) / 2;
+            Y = (SCREEN_HEIGHT - H) / 2;
+
+            Space = space;
+
+            Text.reset(createText(text, FONT_FILE, font_size, clrWH, W - 2 * space, TTF_STYLE_NORMAL));
+
+            Controls.push_back(Button(0, "icons/yes.png", 0, 1, 0, 0, X + button_space, Y + H - buttonh - button_space, Control::Type::YES));
+            Controls.push_back(Button(1, "icons/no.png", 0, 1, 1, 1, X + W - button_space - buttonw, Y + H - buttonh - button_space, Control::Type::NO));
+        }
+
+        void Render(SDL_Renderer *renderer, int current)
+        {
+            fillRect(renderer, W, H, X, Y, intLB);
+
+            if (Text)
+            {
+                renderImage(renderer, Text.get(), (SCREEN_WIDTH - Text->w) / 2, Y + Space);
+            }
+
+            renderButtons(renderer, Controls, current, intWH, border_space, border_pts);
+        }
+    };
+
+    // Two headed boxes at the bottom of the left column, the first one lowest. Returns the boxes for the values.
+    inline std::pair<Widget::Label *, Widget::Label *> Sidebar(Widget::Tree &widgets, TTF_Font *font, const char *first, const char *second, int boxh, int space, int box_space, Uint32 bg = intBE)
+    {
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+
+        widgets.Add<Widget::Label>(first, font, space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
+        auto first_box = widgets.Add<Widget::Label>("", font, space, clrBK, bg, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
+
+        widgets.Add<Widget::Label>(second, font, space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (2 * (boxh + infoh) + box_space - 1));
+        auto second_box = widgets.Add<Widget::Label>("", font, space, clrBK, bg, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
+
+        return std::make_pair(first_box, second_box);
+    }
+
+    // Event, scroll and render loop of a screen. Each frame draws the widget tree, what the screen draws over it and
+    // the controls, then waits for input. Scrolling (a page of list rows, or the text of a Scroll) and timed messages
+    // are handled here, every other control that is chosen goes to the screen's Act handler.
+    template <typename T = Button>
+    class Runner
+    {
+    private:
+        bool flashing = false;
+
+        Uint32 flash_start = 0;
+
+        // status shown again when a message that replaced it expires
+        std::string status_text = "";
+
+        Uint32 status_bg = intDB;
+
+        void expire()
+        {
+            if (flashing && (SDL_GetTicks() - flash_start) >= Duration)
+            {
+                flashing = false;
+
+                if (!Message && Status)
+                {
+                    Status->Set(status_text, status_bg);
+                }
+            }
+
+            if (flashing)
+            {
+                // wake up to clear the message
+                Frame::Until(flash_start + Duration);
+            }
+
+            if (Message)
+            {
+                Message->Visible = flashing;
+
+                if (Status)
+                {
+                    Status->Visible = !flashing;
+                }
+            }
+        }
+
+        void buttons(int current)
+        {
+            if constexpr (std::is_same<T, TextButton>::value)
+            {
+                renderTextButtons(Renderer, Controls, FONT_FILE, current, clrWH, intBK, intRD, FontSize, TTF_STYLE_NORMAL);
+
+                Render::Queue.Flush(Renderer);
+            }
+            else if (Text)
+            {
+                renderButtons(Renderer, Controls, current, Highlight, Space, Points, Text->Offset > 0, Text->Offset < Text->Max());
+            }
+            else
+            {
+                renderButtons(Renderer, Controls, current, Highlight, Space, Points);
+            }
+        }
+
+        void frame(int current)
+        {
+            SDL_SetWindowTitle(Window, Title.c_str());
+
+            fillWindow(Renderer, Background);
+
+            expire();
+
+            if (Update)
+            {
+                Update();
+            }
+
+            Widgets.Render(Renderer);
+
+            if (Draw)
+            {
+                Draw();
+            }
+
+            buttons(current);
+        }
+
+        void scroll(bool up)
+        {
+            if (Text)
+            {
+                Text->Offset = up ? Text->Offset - Text->Speed : Text->Offset + Text->Speed;
+
+                clip(Text->Offset, 0, Text->Max());
+            }
+            else if (List && Count)
+            {
+                auto count = Count();
+
+                if (up)
+                {
+                    if (Offset > 0)
+                    {
+                        Offset--;
+
+                        Refresh();
+                    }
+
+                    if (Offset <= 0)
+                    {
+                        Current = -1;
+
+                        Selected = false;
+                    }
+                }
+                else
+                {
+                    if (count - Last() > 0)
+                    {
+                        Offset++;
+
+                        clip(Offset, 0, count - Limit);
+
+                        Refresh();
+
+                        // the highlight follows the row
+                        if (Offset > 0 && Current >= 0 && Current < Controls.size() && Controls[Current].Type != Control::Type::SCROLL_DOWN)
+                        {
+                            Current++;
+                        }
+                    }
+
+                    if (count - Last() <= 0)
+                    {
+                        Current = -1;
+
+                        Selected = false;
+                    }
+                }
+            }
+        }
+
+        static void clip(int &value, int min, int max)
+        {
+            if (value > max)
+            {
+                value = max;
+            }
+
+            if (value < min)
+            {
+                value = min;
+            }
+        }
+
+    public:
+        SDL_Window *Window = NULL;
+
+        SDL_Renderer *Renderer = NULL;
+
+        std::string Title = "Necklace of Skulls";
+
+        Uint32 Background = intWH;
+
+        Widget::Tree Widgets = Widget::Tree();
+
+        std::vector<T> Controls = std::vector<T>();
+
+        int Current = -1;
+
+        bool Selected = false;
+        bool ScrollUp = false;
+        bool ScrollDown = false;
+        bool Hold = false;
+
+        // The window was closed
+        bool Quit = false;
+
+        // Highlight around the current button
+        Uint32 Highlight = intDB;
+
+        int Space = 8;
+        int Points = 4;
+
+        // Text buttons
+        int FontSize = 20;
+
+        // Timed messages go on Message (Status is hidden meanwhile) or, without one, replace the text of Status
+        Widget::Label *Message = NULL;
+        Widget::Label *Status = NULL;
+
+        Uint32 Duration = 3000;
+
+        // Text scrolled by the scroll controls
+        Widget::Scroll *Text = NULL;
+
+        // Or a page of Limit rows out of Count(), starting at Offset, whose controls List() builds
+        int Offset = 0;
+        int Limit = 0;
+
+        std::function<int()> Count = NULL;
+
+        std::function<std::vector<T>()> List = NULL;
+
+        // Every frame, before the widgets are drawn (e.g. to update their contents)
+        std::function<void()> Update = NULL;
+
+        // Over the widgets and under the controls
+        std::function<void()> Draw = NULL;
+
+        // A control was chosen, true leaves the screen
+        std::function<bool(Control::Type)> Act = NULL;
+
+        Runner(SDL_Window *window, SDL_Renderer *renderer, std::string title)
+        {
+            Window = window;
+            Renderer = renderer;
+            Title = title;
+        }
+
+        // End of the page
+        int Last()
+        {
+            auto last = Offset + Limit;
+
+            auto count = Count ? Count() : 0;
+
+            return last > count ? count : last;
+        }
+
+        // Build the controls of the page again, after rows were added or removed
+        void Refresh()
+        {
+            if (List)
+            {
+                Controls = List();
+            }
+        }
+
+        // A row of the page was removed
+        void Removed()
+        {
+            if (Offset > 0)
+            {
+                Offset--;
+            }
+
+            Refresh();
+        }
+
+        void Flash(std::string text, Uint32 bg = intRD)
+        {
+            if (!Message && Status && !flashing)
+            {
+                status_text = Status->Text;
+
+                status_bg = Status->Bg;
+            }
+
+            if (Message)
+            {
+                Message->Set(text, bg);
+            }
+            else if (Status)
+            {
+                Status->Set(text, bg);
+            }
+
+            flash_start = SDL_GetTicks();
+
+            flashing = true;
+        }
+
+        bool Flashing()
+        {
+            return flashing;
+        }
+
+        // Asks the question over the screen until it is answered, true if the answer is yes
+        bool Ask(Widget::Question &question)
+        {
+            auto current = -1;
+            auto selected = false;
+            auto up = false;
+            auto down = false;
+            auto hold = false;
+
+            while (!Quit)
+            {
+                frame(-1);
+
+                question.Render(Renderer, current);
+
+                Quit = Input::GetInput(Renderer, question.Controls, current, selected, up, down, hold);
+
+                if (selected && !hold && current >= 0 && current < question.Controls.size())
+                {
+                    Current = -1;
+
+                    return question.Controls[current].Type == Control::Type::YES;
+                }
+            }
+
+            return false;
+        }
+
+        // Until Act returns true or the window is closed, true if it was closed
+        bool Run()
+        {
+            auto done = false;
+
+            while (!Quit && !done)
+            {
+                frame(Current);
+
+                Quit = Input::GetInput(Renderer, Controls, Current, Selected, ScrollUp, ScrollDown, Hold);
+
+                if (Quit)
+                {
+                    break;
+                }
+
+                auto chosen = (Selected || Hold) && Current >= 0 && Current < Controls.size();
+
+                if (ScrollUp || (chosen && Controls[Current].Type == Control::Type::SCROLL_UP))
+                {
+                    scroll(true);
+                }
+                else if (ScrollDown || (chosen && Controls[Current].Type == Control::Type::SCROLL_DOWN))
+                {
+                    scroll(false);
+                }
+                else if (chosen && Selected && !Hold && Act)
+                {
+                    done = Act(Controls[Current].Type);
+                }
+            }
+
+            return Quit;
+        }
+    };
+} // namespace Widget
+
+#endif
@@ -0,0 +1,385 @@
+// Standard IO
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+#if defined(_WIN32)
+
+#include <windows.h>
+#include <shlobj.h>
+
+#else
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <pwd.h>
+
+#endif
+
+// JSON library
+#include "nlohmann/json.hpp"
+
+#include "codewords.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "save.hpp"
+
+// forward declarations (also used by the journal)
+Character::Base characterFromData(nlohmann::json &data);
+nlohmann::json characterData(Character::Base &player);
+
+#if defined(_WIN32) || defined(__arm__) || defined(__APPLE__)
+std::string time_string(long long deserialised)
+{
+    auto epoch = std::chrono::time_point<std::chrono::system_clock>();
+    auto since_epoch = std::chrono::milliseconds(deserialised);
+    std::chrono::system_clock::time_point timestamp = epoch + since_epoch;
+
+    auto in_time_t = std::chrono::system_clock::to_time_t(timestamp);
+
+    std::stringstream ss;
+
+    if (in_time_t >= 0)
+    {
+        ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d %X");
+    }
+
+    return ss.str();
+}
+#else
+std::string time_string(long deserialised)
+{
+    auto epoch = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    auto since_epoch = std::chrono::milliseconds(deserialised);
+    auto timestamp = epoch + since_epoch;
+
+    auto in_time_t = std::chrono::system_clock::to_time_t(timestamp);
+
+    std::stringstream ss;
+
+    ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d %X");
+
+    return ss.str();
+}
+#endif
+
+// Directory where games are saved
+std::string savePath()
+{
+#if defined(_WIN32)
+
+    PWSTR path_str;
+
+    SHGetKnownFolderPath(FOLDERID_Documents, KF_FLAG_DEFAULT, NULL, &path_str);
+
+    std::wstring wpath(path_str);
+
+    CoTaskMemFree(path_str);
+
+    std::string save(wpath.length(), ' ');
+
+    std::copy(wpath.begin(), wpath.end(), save.begin());
+
+    save += "/Saved Games/Necklace of Skulls";
+
+#else
+
+    const char *homedir;
+
+    if ((homedir = getenv("HOME")) == NULL)
+    {
+        homedir = getpwuid(getuid())->pw_dir;
+    }
+
+    std::string save = std::string(homedir) + "/Documents/Saved Games/Necklace of Skulls";
+
+#endif
+
+    return save;
+}
+
+bool saveGame(Character::Base &player, const char *overwrite)
+{
+    auto seed = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
+
+    std::ostringstream buffer;
+
+    std::string save = savePath();
+    std::string path = save + "/";
+
+    fs::create_directories(save);
+
+    if (overwrite != NULL)
+    {
+        buffer << std::string(overwrite);
+    }
+    else
+    {
+        buffer << path << std::to_string(seed) << ".save";
+    }
+
+    player.Epoch = seed;
+
+    auto data = characterData(player);
+
+    std::string filename = buffer.str();
+
+    std::ofstream file(filename);
+
+    file << data.dump();
+
+    file.close();
+
+    return true;
+}
+
+nlohmann::json characterData(Character::Base &player)
+{
+    nlohmann::json data;
+
+    data["name"] = player.Name;
+    data["description"] = player.Description;
+    data["type"] = player.Type;
+    data["gender"] = player.Gender;
+    data["life"] = player.Life;
+    data["money"] = player.Money;
+    data["itemLimit"] = player.ITEM_LIMIT;
+    data["lifeLimit"] = player.MAX_LIFE_LIMIT;
+    data["skillsLimit"] = player.SKILLS_LIMIT;
+    data["codewords"] = player.Codewords;
+    data["donation"] = player.DONATION;
+    data["isBlessed"] = player.IsBlessed;
+    data["isImmortal"] = player.IsImmortal;
+    data["ritualBallStarted"] = player.RitualBallStarted;
+    data["ticks"] = player.Ticks;
+    data["cross"] = player.Cross;
+    data["epoch"] = player.Epoch;
+
+    auto skills = std::vector<Skill::Type>();
+    auto lostSkills = std::vector<Skill::Type>();
+    auto temporarySkills = std::vector<Skill::Type>();
+
+    for (auto i = 0; i < player.Skills.size(); i++)
+    {
+        skills.push_back(player.Skills[i].Type);
+    }
+
+    for (auto i = 0; i < player.LostSkills.size(); i++)
+    {
+        lostSkills.push_back(player.LostSkills[i].Type);
+    }
+
+    data["skills"] = skills;
+    data["lostSkills"] = lostSkills;
+    data["lostMoney"] = player.LostMoney;
+    data["storyID"] = player.StoryID;
+
+    auto items = std::vector<nlohmann::json>();
+    auto lostItems = std::vector<nlohmann::json>();
+
+    for (auto i = 0; i < player.Items.size(); i++)
+    {
+        nlohmann::json item;
+
+        item.emplace("name", player.Items[i].Name);
+        item.emplace("description", player.Items[i].Description);
+        item.emplace("type", player.Items[i].Type);
+        item.emplace("charge", player.Items[i].Charge);
+
+        items.push_back(item);
+    }
+
+    for (auto i = 0; i < player.LostItems.size(); i++)
+    {
+        nlohmann::json item;
+
+        item.emplace("name", player.LostItems[i].Name);
+        item.emplace("description", player.LostItems[i].Description);
+        item.emplace("type", player.LostItems[i].Type);
+        item.emplace("charge", player.LostItems[i].Charge);
+
+        lostItems.push_back(item);
+    }
+
+    data["lostItems"] = lostItems;
+    data["items"] = items;
+
+    return data;
+}
+
+std::string characterString(Character::Base &player)
+{
+    return characterData(player).dump();
+}
+
+Character::Base characterFromData(nlohmann::json &data)
+{
+    auto character = Character::Base();
+
+    std::string name = std::string(data["name"]);
+
+    std::string description = data["description"];
+
+    auto type = static_cast<Character::Type>((int)data["type"]);
+
+    auto gender = Character::Gender::NONE;
+
+    if (!data["gender"].is_null())
+    {
+        gender = static_cast<Character::Gender>((int)data["gender"]);
+    }
+
+    auto skills = std::vector<Skill::Base>();
+    auto items = std::vector<Item::Base>();
+    auto codewords = std::vector<Codeword::Type>();
+
+    auto lostSkills = std::vector<Skill::Base>();
+    auto lostItems = std::vector<Item::Base>();
+
+    for (auto i = 0; i < (int)data["skills"].size(); i++)
+    {
+        auto skill = static_cast<Skill::Type>((int)data["skills"][i]);
+        auto found = Skill::INDEX(skill);
+
+        if (found >= 0)
+        {
+            skills.push_back(Skill::ALL[found]);
+        }
+    }
+
+    for (auto i = 0; i < (int)data["lostSkills"].size(); i++)
+    {
+        auto skill = static_cast<Skill::Type>((int)data["lostSkills"][i]);
+        auto found = Skill::INDEX(skill);
+
+        if (found >= 0)
+        {
+            lostSkills.push_back(Skill::ALL[found]);
+        }
+    }
+
+    for (auto i = 0; i < (int)data["items"].size(); i++)
+    {
+        auto item_name = std::string(data["items"][i]["name"]);
+        auto item_description = std::string(data["items"][i]["description"]);
+        auto item_type = static_cast<Item::Type>((int)data["items"][i]["type"]);
+        auto item_charge = (int)data["items"][i]["charge"];
+
+        items.push_back(Item::Base(item_name.c_str(), item_description.c_str(), item_type, item_charge));
+    }
+
+    for (auto i = 0; i < (int)data["lostItems"].size(); i++)
+    {
+        auto item_name = std::string(data["lostItems"][i]["name"]);
+        auto item_description = std::string(data["lostItems"][i]["description"]);
+        auto item_type = static_cast<Item::Type>((int)data["lostItems"][i]["type"]);
+        auto item_charge = (int)data["lostItems"][i]["charge"];
+
+        lostItems.push_back(Item::Base(item_name.c_str(), item_description.c_str(), item_type, item_charge));
+    }
+
+    for (auto i = 0; i < (int)data["codewords"].size(); i++)
+    {
+        auto codeword = static_cast<Codeword::Type>((int)data["codewords"][i]);
+
+        codewords.push_back(codeword);
+    }
+
+    auto money = (int)data["money"];
+    auto life = (int)data["life"];
+
+    character = Character::Base(name.c_str(), type, description.c_str(), skills, items, codewords, life, money);
+
+    character.LostSkills = lostSkills;
+    character.LostItems = lostItems;
+    character.LostMoney = (int)data["lostMoney"];
+
+    character.ITEM_LIMIT = (int)data["itemLimit"];
+    character.MAX_LIFE_LIMIT = (int)data["lifeLimit"];
+    character.SKILLS_LIMIT = (int)data["skillsLimit"];
+    character.StoryID = (int)data["storyID"];
+
+    character.Ticks = (int)data["ticks"];
+    character.Cross = (int)data["cross"];
+
+    character.IsBlessed = (bool)data["isBlessed"];
+    character.IsImmortal = (bool)data["isImmortal"];
+    character.RitualBallStarted = (bool)data["ritualBallStarted"];
+
+    character.DONATION = (int)data["donation"];
+
+    character.Gender = gender;
+
+    try
+    {
+#if defined(_WIN32) || defined(__arm__)
+        character.Epoch = (long long)(data["epoch"]);
+#else
+        character.Epoch = (long)(data["epoch"]);
+#endif
+    }
+    catch (std::exception &ex)
+    {
+        character.Epoch = 0;
+    }
+
+    return character;
+}
+
+Character::Base loadGame(std::string file_name)
+{
+    std::ifstream ifs(file_name);
+
+    auto character = Character::Base();
+
+    if (ifs.good())
+    {
+        auto data = nlohmann::json::parse(ifs);
+
+        ifs.close();
+
+        character = characterFromData(data);
+    }
+    else
+    {
+        character.StoryID = -1;
+    }
+
+    return character;
+}
+
+// Saved games already listed once, re-read only when the file changes
+std::map<std::string, std::pair<fs::file_time_type, Character::Base>> savedGames = std::map<std::string, std::pair<fs::file_time_type, Character::Base>>();
+
+Character::Base summaryGame(std::string file_name)
+{
+    std::error_code error;
+
+    auto modified = fs::last_write_time(file_name, error);
+
+    auto cached = savedGames.find(file_name);
+
+    if (!error && cached != savedGames.end() && cached->second.first == modified)
+    {
+        return cached->second.second;
+    }
+
+    auto character = loadGame(file_name);
+
+    if (!error)
+    {
+        savedGames[file_name] = std::make_pair(modified, character);
+    }
+
+    return character;
+}
@@ -0,0 +1,28 @@
+#ifndef __SAVE__HPP__
+#define __SAVE__HPP__
+
+#include <string>
+
+#include "character.hpp"
+
+// Saved games (save.cpp). This is the only module that reads or writes JSON.
+#if defined(_WIN32) || defined(__arm__) || defined(__APPLE__)
+std::string time_string(long long deserialised);
+#else
+std::string time_string(long deserialised);
+#endif
+
+// Directory where games are saved
+std::string savePath();
+
+// Character serialized as a single line (replay checkpoints)
+std::string characterString(Character::Base &player);
+
+bool saveGame(Character::Base &player, const char *overwrite);
+
+Character::Base loadGame(std::string file_name);
+
+// Character in a saved game, cached until the file changes
+Character::Base summaryGame(std::string file_name);
+
+#endif
@@ -0,0 +1,1187 @@
+// Standard IO
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+// Using SDL
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "config.hpp"
+#include "controls.hpp"
+#include "handles.hpp"
+#include "render.hpp"
+#include "widgets.hpp"
+#include "runner.hpp"
+#include "input.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "story.hpp"
+#include "graphics.hpp"
+#include "tiles.hpp"
+#include "screens.hpp"
+
+bool greenMirror(SDL_Window *window, SDL_Renderer *renderer, Character::Base player, Story::Base *story)
+{
+    auto screen = Frame::Screen();
+
+    if (window && renderer)
+    {
+        auto text_space = Video.Scaled(8);
+        auto font_size = Video.Scaled(20);
+
+        const int future_width = SCREEN_WIDTH * (1.0 - 2.0 * Margin) - arrow_size - 2 * text_space;
+
+        std::string future_text = "You used the GREEN MIRROR to look into your future...\n\n";
+
+        if (story->Choices.size() > 0)
+        {
+            for (auto i = 0; i < story->Choices.size(); i++)
+            {
+                if (i > 0)
+                {
+                    future_text += "\n" + std::string(future_width / 10, '-') + "\n\n";
+                }
+
+                auto simPlayer = player;
+
+                future_text += "[" + std::string(story->Choices[i].Text) + "]\n\n";
+
+                // simulate going into the future
+                auto future_story = (Story::Base *)findStory(story->Choices[i].Destination);
+
+                auto background = 0;
+
+                while (background != -1)
+                {
+                    background = future_story->Background(simPlayer);
+
+                    if (background >= 0)
+                    {
+                        future_story = (Story::Base *)findStory(background);
+                    }
+                }
+
+                future_story->Event(simPlayer);
+
+                future_text += future_story->Text;
+            }
+        }
+        else
+        {
+            auto simPlayer = player;
+
+            // simulate going into the future
+            auto future_story = (Story::Base *)findStory(story->Continue(simPlayer));
+
+            auto background = 0;
+
+            while (background != -1)
+            {
+                background = future_story->Background(simPlayer);
+
+                if (background >= 0)
+                {
+                    future_story = (Story::Base *)findStory(background);
+                }
+            }
+
+            future_story->Event(simPlayer);
+
+            future_text += "... " + std::string(future_story->Text);
+        }
+
+        auto future = Handle::Surface(createText(future_text.c_str(), FONT_FILE, font_size, clrBK, future_width - 2 * text_space, TTF_STYLE_NORMAL));
+
+        textScreen(window, renderer, "Necklace of Skulls: GREEN MIRROR", future.get(), future_width, text_space);
+    }
+
+    return false;
+}
+
+bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
+{
+    auto screen = Frame::Screen();
+
+    // Render the image
+    if (window && renderer)
+    {
+        const int profilew = SCREEN_WIDTH * (1.0 - 2.0 * Margin);
+        const int profileh = 0.12 * SCREEN_HEIGHT;
+
+        auto marginh = Margin * SCREEN_HEIGHT / 2;
+
+        auto headerw = splashw;
+        auto headerh = 0.07 * SCREEN_HEIGHT;
+        auto space = Video.Scaled(8);
+        auto font_size = Video.Scaled(18);
+
+        auto boxh = headerh;
+
+        std::string codewords = "";
+
+        for (auto i = 0; i < player.Codewords.size(); i++)
+        {
+            if (!Codeword::IsInvisible(player.Codewords[i]))
+            {
+                if (i > 0 && codewords.length() > 0)
+                {
+                    codewords += ", ";
+                }
+
+                codewords += Codeword::Description(player.Codewords[i]);
+            }
+        }
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        if (font)
+        {
+            auto sheet = AdventureSheet(font);
+
+            auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls: Adventure Sheet");
+
+            runner.Controls.push_back(Button(0, createHeaderButton(window, "Skills", clrWH, intDB, headerw, headerh, space), 0, 1, 0, 1, startx, starty + profileh + headerh + marginh, Control::Type::GLOSSARY));
+            runner.Controls.push_back(Button(1, createHeaderButton(window, "Possessions", clrWH, intDB, headerw, headerh, space), 0, 2, 0, 2, startx, starty + profileh + 3 * headerh + 3 * marginh + 2 * boxh, Control::Type::ACTION));
+            runner.Controls.push_back(Button(2, "icons/back-button.png", 1, 2, 1, 2, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+            runner.Space = space;
+            runner.Points = space / 2;
+
+            auto codewords_header = runner.Widgets.Add<Widget::Label>("Codewords", font, space, clrWH, intDB, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + 2 * profileh + 4 * headerh + 4 * marginh + 2 * boxh);
+            auto codewords_box = runner.Widgets.Add<Widget::Label>(codewords.c_str(), font, space, clrBK, intBE, TTF_STYLE_ITALIC, profilew - buttonw - 2 * space, boxh, startx, starty + 2 * profileh + 5 * headerh + 4 * marginh + 2 * boxh);
+
+            codewords_header->Visible = player.Codewords.size() > 0 && codewords.length() > 0;
+
+            codewords_box->Visible = codewords_header->Visible;
+
+            runner.Update = [&]() {
+                sheet.Render(renderer, player, Character::Gender::NONE);
+            };
+
+            runner.Act = [&](Control::Type type) {
+                if (type == Control::Type::GLOSSARY)
+                {
+                    glossaryScreen(window, renderer, player.Skills);
+
+                    runner.Current = -1;
+                }
+                else if (type == Control::Type::ACTION)
+                {
+                    inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
+
+                    runner.Current = -1;
+                }
+
+                return type == Control::Type::BACK;
+            };
+
+            runner.Run();
+        }
+    }
+
+    return false;
+}
+
+bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skill::Base> Skills)
+{
+    auto screen = Frame::Screen();
+
+    if (window && renderer)
+    {
+        auto space = Video.Scaled(8);
+
+        auto font_size = Video.Scaled(20);
+
+        const int glossary_width = SCREEN_WIDTH * (1.0 - 2.0 * Margin) - arrow_size - 2 * space;
+
+        std::string text;
+
+        for (auto i = 0; i < Skills.size(); i++)
+        {
+            if (i > 0)
+            {
+                text += "\n" + std::string(glossary_width / 10, '-') + "\n";
+            }
+
+            text += std::string(Skills[i].Name) + "\n\n";
+            text += std::string(Skills[i].Description) + "\n";
+        }
+
+        auto glossary = Handle::Surface(createText(text.c_str(), FONT_FILE, font_size, clrBK, glossary_width - 2 * space, TTF_STYLE_NORMAL));
+
+        textScreen(window, renderer, "Necklace of Skulls: Skills Glossary", glossary.get(), glossary_width, space);
+    }
+
+    return false;
+}
+
+bool textScreen(SDL_Window *window, SDL_Renderer *renderer, const char *title, SDL_Surface *text, int width, int space)
+{
+    auto runner = Widget::Runner<Button>(window, renderer, title);
+
+    runner.Controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
+    runner.Controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
+    runner.Controls.push_back(Button(2, "icons/back-button.png", 1, 2, 1, 2, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+    runner.Space = border_space;
+    runner.Points = border_pts;
+
+    runner.Text = runner.Widgets.Add<Widget::Scroll>(text, intBE, space, Video.Scaled(20), width, text_bounds, startx, starty);
+
+    runner.Act = [&](Control::Type type) {
+        return type == Control::Type::BACK;
+    };
+
+    return runner.Run();
+}
+
+bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<Item::Base> &Items, Control::Type mode, int limit)
+{
+    auto screen = Frame::Screen();
+
+    if (Items.size() > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto boxh = 0.150 * SCREEN_HEIGHT;
+        auto box_space = Video.Scaled(10);
+
+        auto mirror = Widget::Question("The GREEN MIRROR disappears after one use. Do you wish to continue?", font_size, text_space, textwidth);
+
+        std::string status_message = "You are carrying these items";
+
+        if (mode == Control::Type::DROP)
+        {
+            status_message = "You are carrying too many items. Select item(s) to DROP.";
+        }
+        else if (mode == Control::Type::USE)
+        {
+            status_message = "Select an item to USE";
+        }
+        else if (mode == Control::Type::LOSE)
+        {
+            status_message = "DROP item(s) until only " + std::to_string(limit) + " item" + std::string(limit > 1 ? "s" : "") + " remains.";
+        }
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls: Possessions");
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Limit = (text_bounds - text_space) / (font_size + 7 * text_space / 2);
+
+        runner.Count = [&]() {
+            return (int)Items.size();
+        };
+
+        runner.List = [&]() {
+            return createItemList(window, renderer, Items, runner.Offset, runner.Last(), runner.Limit, false, true);
+        };
+
+        runner.Refresh();
+
+        runner.Message = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+        runner.Status = runner.Widgets.Add<Widget::Label>(status_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        auto wallet = Widget::Sidebar(runner.Widgets, font, "Life", "Money", boxh, text_space, box_space);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            wallet.first->Set(std::to_string(player.Life));
+
+            wallet.second->Set(std::to_string(player.Money) + std::string(" cacao"));
+        };
+
+        runner.Draw = [&]() {
+            for (auto i = 0; i < runner.Last() - runner.Offset; i++)
+            {
+                auto &row = runner.Controls[i];
+
+                Render::Queue.Draw(row.W + 2 * text_space, row.H + 2 * text_space, row.X - text_space, row.Y - text_space, intBK);
+            }
+        };
+
+        auto dropped = [&](Item::Base &item) {
+            std::string description = item.Name;
+
+            if (item.Charge == 0)
+            {
+                description += " (destroyed)";
+            }
+
+            runner.Flash(description + " DROPPED!", intRD);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            auto index = runner.Offset + runner.Current;
+
+            if (type == Control::Type::ACTION && index >= 0 && index < Items.size())
+            {
+                auto item = Items[index];
+
+                if (mode == Control::Type::DROP)
+                {
+                    Items.erase(Items.begin() + index);
+
+                    runner.Removed();
+
+                    dropped(item);
+                }
+                else if (mode == Control::Type::LOSE)
+                {
+                    if (Items.size() > limit)
+                    {
+                        Items.erase(Items.begin() + index);
+
+                        Character::LOSE_ITEMS(player, {item.Type});
+
+                        runner.Removed();
+
+                        dropped(item);
+                    }
+                }
+                else if (mode == Control::Type::USE)
+                {
+                    if (item.Type == Item::Type::GREEN_MIRROR)
+                    {
+                        if (runner.Ask(mirror))
+                        {
+                            greenMirror(window, renderer, player, story);
+
+                            Item::REMOVE(Items, Item::GREEN_MIRROR);
+
+                            runner.Removed();
+
+                            runner.Flash("The GREEN MIRROR vanishes without a trace!", intLB);
+                        }
+                    }
+                    else if (item.Type == Item::Type::MAGIC_DRINK || item.Type == Item::Type::PAPAYA || item.Type == Item::Type::MAIZE_CAKES)
+                    {
+                        auto life = item.Type == Item::Type::MAGIC_DRINK ? 5 : 1;
+
+                        if (player.Life >= player.MAX_LIFE_LIMIT)
+                        {
+                            runner.Flash("You are not INJURED!", intRD);
+                        }
+                        else
+                        {
+                            Character::GAIN_LIFE(player, life);
+
+                            Items.erase(Items.begin() + index);
+
+                            // used up once, also when the list is not the player's own
+                            if (&Items != &player.Items)
+                            {
+                                Character::LOSE_ITEMS(player, {item.Type});
+                            }
+
+                            runner.Removed();
+
+                            runner.Flash(life > 1 ? "You RECOVER 5 Life Points." : "You RECOVER 1 Life Point.", intLB);
+                        }
+                    }
+                }
+
+                runner.Current = -1;
+            }
+
+            return type == Control::Type::BACK;
+        };
+
+        runner.Run();
+    }
+
+    return false;
+}
+
+int giftScreen(SDL_Window *window, SDL_Renderer *renderer, Story::Base *story, Character::Base &player, std::vector<std::pair<Item::Type, int>> gifts, int default_destination)
+{
+    auto screen = Frame::Screen();
+
+    int storyID = default_destination;
+
+    if (player.Items.size() > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        auto selected_item = -1;
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls: Possessions");
+
+        runner.Controls = createItemList(window, renderer, player.Items, 0, player.Items.size(), player.Items.size(), true, true);
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Message = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
+        runner.Status = runner.Widgets.Add<Widget::Label>("Select an item to GIVE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        runner.Widgets.Add<Widget::Label>("Selected", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh));
+        runner.Widgets.Add<Widget::Panel>(intBE, splashw, boxh, startx, starty + text_bounds - boxh);
+        auto selected_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            selected_box->Set(selected_item >= 0 && selected_item < player.Items.size() ? player.Items[selected_item].Name : "");
+        };
+
+        runner.Draw = [&]() {
+            if (selected_item >= 0 && selected_item < player.Items.size())
+            {
+                auto &row = runner.Controls[selected_item];
+
+                Render::Queue.Draw(row.W + 2 * text_space, row.H + 2 * text_space, row.X - text_space, row.Y - text_space, intBK);
+            }
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION && runner.Current < player.Items.size())
+            {
+                selected_item = (selected_item == runner.Current) ? -1 : runner.Current;
+            }
+            else if (type == Control::Type::CONFIRM)
+            {
+                if (selected_item >= 0 && selected_item < player.Items.size())
+                {
+                    auto item = player.Items[selected_item];
+
+                    Character::LOSE_ITEMS(player, {item.Type});
+
+                    for (auto i = 0; i < gifts.size(); i++)
+                    {
+                        if (gifts[i].first == item.Type)
+                        {
+                            storyID = gifts[i].second;
+
+                            break;
+                        }
+                    }
+
+                    return true;
+                }
+
+                runner.Flash("You have not selected anything!");
+            }
+            else if (type == Control::Type::BACK)
+            {
+                storyID = story->ID;
+
+                return true;
+            }
+
+            return false;
+        };
+
+        runner.Run();
+    }
+
+    return storyID;
+}
+
+bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int TakeLimit, bool back_button)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    if (TakeLimit > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        auto selection = std::vector<int>();
+
+        std::string take_message = "";
+
+        if (items.size() > 1)
+        {
+            if (TakeLimit > 1)
+            {
+                if (TakeLimit == items.size())
+                {
+                    take_message = "You can TAKE any number of items.";
+                }
+                else
+                {
+                    take_message = "You can TAKE up to " + std::to_string(TakeLimit) + " items.";
+                }
+            }
+            else
+            {
+                take_message = "Choose an item to KEEP.";
+            }
+        }
+        else
+        {
+            take_message = "KEEP this item?";
+        }
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls");
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Limit = (text_bounds - text_space) / (font_size + 7 * text_space / 2);
+
+        runner.Count = [&]() {
+            return (int)items.size();
+        };
+
+        runner.List = [&]() {
+            return createItemList(window, renderer, items, runner.Offset, runner.Last(), runner.Limit, true, back_button);
+        };
+
+        runner.Refresh();
+
+        runner.Message = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
+        runner.Status = runner.Widgets.Add<Widget::Label>(take_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        runner.Widgets.Add<Widget::Label>("SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (3 * boxh + infoh - 1));
+        auto selected_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 3 * boxh, startx, starty + text_bounds - 3 * boxh);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            selected_box->Set(selection.size() > 0 ? Item::DESCRIBE(items, selection) : "(None)");
+        };
+
+        runner.Draw = [&]() {
+            markSelection(runner.Controls, selection, runner.Offset, runner.Last(), text_space);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION)
+            {
+                auto result = Item::FIND(selection, runner.Offset + runner.Current);
+
+                if (result >= 0)
+                {
+                    selection.erase(selection.begin() + result);
+                }
+                else if (selection.size() < TakeLimit)
+                {
+                    selection.push_back(runner.Offset + runner.Current);
+                }
+
+                runner.Current = -1;
+            }
+            else if (type == Control::Type::CONFIRM)
+            {
+                auto take = std::vector<Item::Base>();
+
+                for (auto i = 0; i < selection.size(); i++)
+                {
+                    take.push_back(items[selection[i]]);
+                }
+
+                Character::GET_ITEMS(player, take);
+
+                done = true;
+            }
+
+            return done || type == Control::Type::BACK;
+        };
+
+        done = runner.Run() || done;
+    }
+
+    return done;
+}
+
+bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> item_types, int Limit)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    if (Limit > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space);
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        auto selection = std::vector<int>();
+
+        std::string lose_message = "";
+
+        if (item_types.size() > 1)
+        {
+            if (Limit > 1)
+            {
+                lose_message = "You must GIVE UP " + std::to_string(Limit) + " items.";
+            }
+            else
+            {
+                lose_message = "Choose an item to GIVE UP.";
+            }
+        }
+        else
+        {
+            lose_message = "GIVE UP this item";
+        }
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls");
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Limit = (text_bounds - text_space) / (font_size + 7 * text_space / 2);
+
+        runner.Count = [&]() {
+            return (int)player.Items.size();
+        };
+
+        runner.List = [&]() {
+            return createItemList(window, renderer, player.Items, runner.Offset, runner.Last(), runner.Limit, true, false);
+        };
+
+        runner.Refresh();
+
+        runner.Message = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
+        runner.Status = runner.Widgets.Add<Widget::Label>(lose_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        runner.Widgets.Add<Widget::Label>("SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (3 * boxh + infoh - 1));
+        auto selected_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 3 * boxh, startx, starty + text_bounds - 3 * boxh);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            selected_box->Set(selection.size() > 0 ? Item::DESCRIBE(player.Items, selection) : "(None)");
+        };
+
+        runner.Draw = [&]() {
+            markSelection(runner.Controls, selection, runner.Offset, runner.Last(), text_space);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION)
+            {
+                auto index = runner.Offset + runner.Current;
+
+                auto result = Item::FIND(selection, index);
+
+                if (result >= 0)
+                {
+                    selection.erase(selection.begin() + result);
+                }
+                else if (selection.size() < Limit)
+                {
+                    if (std::find(item_types.begin(), item_types.end(), player.Items[index].Type) != item_types.end())
+                    {
+                        selection.push_back(index);
+                    }
+                    else
+                    {
+                        runner.Flash("This is unacceptable. Please choose another.");
+                    }
+                }
+
+                runner.Current = -1;
+            }
+            else if (type == Control::Type::CONFIRM)
+            {
+                if (selection.size() == Limit)
+                {
+                    auto items = std::vector<Item::Base>();
+
+                    for (auto i = 0; i < player.Items.size(); i++)
+                    {
+                        if (Item::FIND(selection, i) < 0)
+                        {
+                            items.push_back(player.Items[i]);
+                        }
+                    }
+
+                    player.Items = items;
+
+                    done = true;
+                }
+                else
+                {
+                    runner.Flash("Please select item(s) to GIVE UP");
+                }
+            }
+
+            return done;
+        };
+
+        done = runner.Run() || done;
+    }
+
+    return done;
+}
+
+bool mapScreen(SDL_Window *window, SDL_Renderer *renderer)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    auto background = Handle::Surface(createImage("images/background.png"));
+
+    Tiles::Viewer map;
+
+    // Render the image
+    if (window && renderer && background && map.Open("images/map-one-world.png"))
+    {
+        SDL_SetWindowTitle(window, "Map: One World");
+
+        auto selected = false;
+        auto current = -1;
+
+        auto marginw = (int)((1.0 - 2.0 * Margin) * SCREEN_WIDTH);
+
+        std::vector<Button> controls = {Button(0, "icons/back-button.png", 0, 0, 0, 0, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK)};
+
+        map.Fit(marginw, text_bounds);
+
+        // screen pixels per second when panning with the keys or a stick, zoom factor per wheel notch or button press
+        auto pan_speed = 0.6 * marginw;
+        auto zoom_step = 1.25;
+
+        auto dead_zone = 8000;
+
+        auto axis_x = 0;
+        auto axis_y = 0;
+        auto axis_zoom = 0;
+
+        auto dragging = false;
+        auto drag_x = 0;
+        auto drag_y = 0;
+
+        auto moving = false;
+
+        auto ticks = SDL_GetTicks();
+
+        while (!done)
+        {
+            // Fill the surface with background color
+            fillWindow(renderer, intWH);
+
+            stretchImage(renderer, background.get(), 0, 0, SCREEN_WIDTH, buttony - button_space);
+
+            auto loading = map.Render(renderer, startx, starty, marginw, text_bounds);
+
+            drawRect(renderer, marginw, text_bounds, startx, starty, intBK);
+
+            renderButtons(renderer, controls, current, intDB, 8, 4);
+
+            if (Replay::Session.Replaying() || Soak::Active)
+            {
+                // panning and zooming are not recorded, only leaving the map
+                auto scrollUp = false;
+                auto scrollDown = false;
+                auto hold = false;
+
+                done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+
+                if (selected && current >= 0 && current < controls.size() && controls[current].Type == Control::Type::BACK)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            Memory::Draw(renderer);
+
+            Frame::Present(renderer);
+
+            SDL_Event result;
+
+            // keep drawing while the view moves or tiles are loading, otherwise sleep until something happens
+            auto pending = Frame::Wait(&result, moving || loading);
+
+            auto back = false;
+
+            while (pending)
+            {
+                auto x = 0;
+                auto y = 0;
+
+                if (result.type == SDL_MOUSEMOTION || result.type == SDL_MOUSEBUTTONDOWN || result.type == SDL_MOUSEBUTTONUP)
+                {
+                    x = result.type == SDL_MOUSEMOTION ? result.motion.x : result.button.x;
+                    y = result.type == SDL_MOUSEMOTION ? result.motion.y : result.button.y;
+
+                    Video.Pixels(x, y);
+                }
+
+                auto on_back = (x >= controls[0].X && x < controls[0].X + controls[0].W && y >= controls[0].Y && y < controls[0].Y + controls[0].H);
+
+                if (result.type == SDL_QUIT)
+                {
+                    done = true;
+                }
+                else if (result.type == SDL_CONTROLLERDEVICEADDED)
+                {
+                    Input::InitializeGamePads();
+                }
+                else if (result.type == SDL_KEYDOWN)
+                {
+                    auto key = result.key.keysym.sym;
+
+                    if (key == SDLK_F3)
+                    {
+                        Memory::Overlay = !Memory::Overlay;
+                    }
+                    else if (key == SDLK_ESCAPE || key == SDLK_BACKSPACE)
+                    {
+                        back = true;
+                    }
+                    else if ((key == SDLK_RETURN || key == SDLK_KP_ENTER || key == SDLK_RETURN2) && current == 0)
+                    {
+                        back = true;
+                    }
+                    else if (key == SDLK_TAB)
+                    {
+                        current = current < 0 ? 0 : -1;
+                    }
+                    else if (key == SDLK_PAGEUP)
+                    {
+                        map.ZoomAt(zoom_step, marginw / 2.0, text_bounds / 2.0);
+                    }
+                    else if (key == SDLK_PAGEDOWN)
+                    {
+                        map.ZoomAt(1.0 / zoom_step, marginw / 2.0, text_bounds / 2.0);
+                    }
+                    else if (key == SDLK_HOME)
+                    {
+                        map.Fit(marginw, text_bounds);
+                    }
+                }
+                else if (result.type == SDL_MOUSEWHEEL)
+                {
+                    auto mouse_x = 0;
+                    auto mouse_y = 0;
+
+                    SDL_GetMouseState(&mouse_x, &mouse_y);
+
+                    Video.Pixels(mouse_x, mouse_y);
+
+                    map.ZoomAt(std::pow(zoom_step, result.wheel.y), mouse_x - startx, mouse_y - starty);
+                }
+                else if (result.type == SDL_MOUSEBUTTONDOWN && result.button.button == SDL_BUTTON_LEFT)
+                {
+                    if (!on_back && x >= startx && x < startx + marginw && y >= starty && y < starty + text_bounds)
+                    {
+                        dragging = true;
+
+                        drag_x = x;
+                        drag_y = y;
+                    }
+                }
+                else if (result.type == SDL_MOUSEBUTTONUP && result.button.button == SDL_BUTTON_LEFT)
+                {
+                    back = (on_back && !dragging);
+
+                    dragging = false;
+                }
+                else if (result.type == SDL_MOUSEMOTION)
+                {
+                    if (dragging)
+                    {
+                        map.Pan(drag_x - x, drag_y - y);
+
+                        drag_x = x;
+                        drag_y = y;
+                    }
+
+                    current = on_back ? 0 : -1;
+                }
+                else if (result.type == SDL_CONTROLLERAXISMOTION)
+                {
+                    if (result.caxis.axis == SDL_CONTROLLER_AXIS_LEFTX)
+                    {
+                        axis_x = result.caxis.value;
+                    }
+                    else if (result.caxis.axis == SDL_CONTROLLER_AXIS_LEFTY)
+                    {
+                        axis_y = result.caxis.value;
+                    }
+                    else if (result.caxis.axis == SDL_CONTROLLER_AXIS_RIGHTY)
+                    {
+                        axis_zoom = result.caxis.value;
+                    }
+                }
+                else if (result.type == SDL_CONTROLLERBUTTONUP)
+                {
+                    auto button = result.cbutton.button;
+
+                    if (button == SDL_CONTROLLER_BUTTON_B || (button == SDL_CONTROLLER_BUTTON_A && current == 0))
+                    {
+                        back = true;
+                    }
+                    else if (button == SDL_CONTROLLER_BUTTON_A)
+                    {
+                        current = 0;
+                    }
+                    else if (button == SDL_CONTROLLER_BUTTON_RIGHTSHOULDER)
+                    {
+                        map.ZoomAt(zoom_step, marginw / 2.0, text_bounds / 2.0);
+                    }
+                    else if (button == SDL_CONTROLLER_BUTTON_LEFTSHOULDER)
+                    {
+                        map.ZoomAt(1.0 / zoom_step, marginw / 2.0, text_bounds / 2.0);
+                    }
+                    else if (button == SDL_CONTROLLER_BUTTON_DPAD_LEFT || button == SDL_CONTROLLER_BUTTON_DPAD_RIGHT)
+                    {
+                        map.Pan((button == SDL_CONTROLLER_BUTTON_DPAD_LEFT ? -0.25 : 0.25) * marginw, 0);
+                    }
+                    else if (button == SDL_CONTROLLER_BUTTON_DPAD_UP || button == SDL_CONTROLLER_BUTTON_DPAD_DOWN)
+                    {
+                        map.Pan(0, (button == SDL_CONTROLLER_BUTTON_DPAD_UP ? -0.25 : 0.25) * text_bounds);
+                    }
+                }
+
+                pending = SDL_PollEvent(&result);
+            }
+
+            if (back || done)
+            {
+                Replay::Session.Record(0, back, false, false, false, done);
+
+                if (back)
+                {
+                    Audio::Play(Audio::Effect::BUTTON);
+                }
+
+                break;
+            }
+
+            // held keys and sticks move the view smoothly, a long wait between frames does not make it jump
+            auto now = SDL_GetTicks();
+
+            auto seconds = std::min(0.05, (now - ticks) / 1000.0);
+
+            ticks = now;
+
+            auto keys = SDL_GetKeyboardState(NULL);
+
+            auto stick = [&](int value) { return std::abs(value) > dead_zone ? value / 32767.0 : 0.0; };
+
+            auto dx = (keys[SDL_SCANCODE_RIGHT] ? 1.0 : 0.0) - (keys[SDL_SCANCODE_LEFT] ? 1.0 : 0.0) + stick(axis_x);
+
+            auto dy = (keys[SDL_SCANCODE_DOWN] ? 1.0 : 0.0) - (keys[SDL_SCANCODE_UP] ? 1.0 : 0.0) + stick(axis_y);
+
+            auto dz = ((keys[SDL_SCANCODE_EQUALS] || keys[SDL_SCANCODE_KP_PLUS]) ? 1.0 : 0.0) - ((keys[SDL_SCANCODE_MINUS] || keys[SDL_SCANCODE_KP_MINUS]) ? 1.0 : 0.0) - stick(axis_zoom);
+
+            moving = (dx != 0.0 || dy != 0.0 || dz != 0.0);
+
+            if (dx != 0.0 || dy != 0.0)
+            {
+                map.Pan(dx * pan_speed * seconds, dy * pan_speed * seconds);
+            }
+
+            if (dz != 0.0)
+            {
+                // doubles the zoom every second
+                map.ZoomAt(std::pow(2.0, dz * seconds), marginw / 2.0, text_bounds / 2.0);
+            }
+        }
+    }
+
+    return done;
+}
+
+std::vector<Button> createSkillControls(std::vector<Skill::Base> Skills)
+{
+    auto font_size = Video.Scaled(20);
+    auto text_space = Video.Scaled(8);
+    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+    auto controls = std::vector<Button>();
+
+    for (auto idx = 0; idx < Skills.size(); idx++)
+    {
+        auto text = createText(Skills[idx].Name, FONT_FILE, font_size, clrBK, textwidth + button_space, TTF_STYLE_NORMAL);
+
+        auto y = (idx > 0 ? controls[idx - 1].Y + controls[idx - 1].H + 3 * text_space : texty + 2 * text_space);
+
+        controls.push_back(Button(idx, text, idx, idx, (idx > 0 ? idx - 1 : idx), (idx < Skills.size() ? idx + 1 : idx), textx + 2 * text_space, y, Control::Type::ACTION));
+
+        controls[idx].W = textwidth + button_space;
+
+        controls[idx].H = text->h;
+    }
+
+    return controls;
+}
+
+bool loseSkills(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int limit)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    if (player.Skills.size() > limit)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        auto selection = std::vector<Skill::Base>();
+
+        auto to_lose = player.SKILLS_LIMIT - limit;
+
+        std::string lose_message = "Select " + std::string(to_lose > 1 ? std::string(std::to_string(to_lose) + " skills") : "a skill") + " to LOSE.";
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls");
+
+        runner.Controls = createSkillControls(player.Skills);
+
+        auto idx = player.Skills.size();
+
+        runner.Controls.push_back(Button(idx, "icons/yes.png", idx - 1, idx + 1, idx - 1, idx, startx, buttony, Control::Type::CONFIRM));
+        runner.Controls.push_back(Button(idx + 1, "icons/back-button.png", idx, idx + 1, idx - 1, idx + 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Message = runner.Widgets.Add<Widget::Label>("", font, text_space, clrWH, intRD, TTF_STYLE_NORMAL, splashw, boxh * 2, startx, starty);
+        runner.Status = runner.Widgets.Add<Widget::Label>(lose_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        runner.Widgets.Add<Widget::Label>("SKILLS", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
+        auto selected_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            std::string names = "";
+
+            for (auto i = 0; i < selection.size(); i++)
+            {
+                names += (i > 0 ? ", " : "") + std::string(selection[i].Name);
+            }
+
+            selected_box->Set(selection.size() > 0 ? names : "(None)");
+        };
+
+        runner.Draw = [&]() {
+            for (auto i = 0; i < player.Skills.size(); i++)
+            {
+                if (Skill::VERIFY(selection, player.Skills[i]))
+                {
+                    auto &row = runner.Controls[i];
+
+                    Render::Queue.Draw(row.W + 2 * text_space, row.H + 2 * text_space, row.X - text_space, row.Y - text_space, intBK);
+                }
+            }
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION && runner.Current < player.Skills.size())
+            {
+                if (Skill::VERIFY(selection, player.Skills[runner.Current]))
+                {
+                    Skill::REMOVE(selection, player.Skills[runner.Current]);
+                }
+                else if (selection.size() < to_lose)
+                {
+                    Skill::ADD(selection, player.Skills[runner.Current]);
+                }
+
+                runner.Current = -1;
+            }
+            else if (type == Control::Type::CONFIRM)
+            {
+                if (selection.size() > 0 && ((player.SKILLS_LIMIT - selection.size()) <= limit))
+                {
+                    auto skills = std::vector<Skill::Type>();
+
+                    for (auto i = 0; i < selection.size(); i++)
+                    {
+                        skills.push_back(selection[i].Type);
+                    }
+
+                    Character::LOSE_SKILLS(player, skills);
+
+                    done = true;
+                }
+                else
+                {
+                    runner.Flash("Please complete your selection");
+
+                    runner.Current = -1;
+                }
+            }
+
+            return done || type == Control::Type::BACK;
+        };
+
+        done = runner.Run() || done;
+    }
+
+    return done;
+}
@@ -0,0 +1,78 @@
+#ifndef __SCREENS__HPP__
+#define __SCREENS__HPP__
+
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "controls.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "story.hpp"
+#include "widgets.hpp"
+
+// Screens (screens.cpp, characters.cpp, menus.cpp, shops.cpp and NecklaceOfSkulls.cpp)
+bool aboutScreen(SDL_Window *window, SDL_Renderer *renderer);
+bool barterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<std::pair<Item::Base, std::vector<Item::Base>>> Barter);
+bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
+bool donateScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player);
+bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skill::Base> Skills);
+bool greenMirror(SDL_Window *window, SDL_Renderer *renderer, Character::Base player, Story::Base *story);
+bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<Item::Base> &Items, Control::Type mode, int limit);
+bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> item_types, int Limit);
+bool loseSkills(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int limit);
+bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID);
+bool mapScreen(SDL_Window *window, SDL_Renderer *renderer);
+bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
+bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Control::Type mode);
+bool storyScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int id);
+bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int limit, bool back_button);
+bool textScreen(SDL_Window *window, SDL_Renderer *renderer, const char *title, SDL_Surface *text, int width, int space);
+bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Item::Base mine, Item::Base theirs);
+
+int eatScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int limit);
+int giftScreen(SDL_Window *window, SDL_Renderer *renderer, Story::Base *story, Character::Base &player, std::vector<std::pair<Item::Type, int>> gifts, int default_destination);
+
+Character::Base customCharacter(SDL_Window *window, SDL_Renderer *renderer);
+Character::Base selectCharacter(SDL_Window *window, SDL_Renderer *renderer);
+Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, bool save_botton);
+
+Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
+Story::Base *renderChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
+
+std::vector<Button> createSkillControls(std::vector<Skill::Base> Skills);
+std::vector<Button> skillsList(SDL_Window *window, SDL_Renderer *renderer, int start, int last, int limit);
+
+void clipValue(int &val, int min, int max);
+
+// Adventure sheet of a character (characters.cpp), laid out once and updated as the character changes
+class AdventureSheet
+{
+private:
+    Widget::Tree widgets = Widget::Tree();
+
+    Widget::Label *name = NULL;
+    Widget::Label *status = NULL;
+    Widget::Label *description = NULL;
+    Widget::Label *skills = NULL;
+    Widget::Label *life = NULL;
+    Widget::Label *money = NULL;
+    Widget::Label *possessions = NULL;
+    Widget::Label *male = NULL;
+    Widget::Label *female = NULL;
+
+    int genderx = 0;
+    int genderw = 0;
+    int genderh = 0;
+    int genderspace = 0;
+
+public:
+    AdventureSheet(TTF_Font *font);
+
+    void Render(SDL_Renderer *renderer, Character::Base &player, Character::Gender gender);
+};
+
+#endif
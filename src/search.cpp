@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "character.hpp"
+#include "story.hpp"
+#include "search.hpp"
+
+namespace Search
+{
+    // word -> sorted section IDs
+    std::unordered_map<std::string, std::vector<int>> Index = std::unordered_map<std::string, std::vector<int>>();
+
+    bool Ready = false;
+
+    std::vector<std::string> Split(const std::string &text)
+    {
+        auto words = std::vector<std::string>();
+
+        auto word = std::string();
+
+        for (auto c : text)
+        {
+            if (std::isalnum((unsigned char)c))
+            {
+                word += (char)std::tolower((unsigned char)c);
+            }
+            else if (word.length() > 0)
+            {
+                words.push_back(word);
+
+                word.clear();
+            }
+        }
+
+        if (word.length() > 0)
+        {
+            words.push_back(word);
+        }
+
+        return words;
+    }
+
+    void Add(int id, const std::string &text)
+    {
+        for (auto &word : Search::Split(text))
+        {
+            auto &sections = Index[word];
+
+            // sections are indexed one at a time, so a repeated word can only repeat the last ID
+            if (sections.empty() || sections.back() != id)
+            {
+                sections.push_back(id);
+            }
+        }
+    }
+
+    void Add(int id, const char *text)
+    {
+        if (text)
+        {
+            Search::Add(id, std::string(text));
+        }
+    }
+
+    void Add(int id, std::vector<Item::Base> &items)
+    {
+        for (auto &item : items)
+        {
+            Search::Add(id, item.Name);
+        }
+    }
+
+    // Everything the player can read in the section as it is now
+    void Add(Story::Base *story)
+    {
+        auto id = story->ID;
+
+        Search::Add(id, story->Title);
+        Search::Add(id, story->Text);
+        Search::Add(id, story->Bye);
+
+        for (auto &choice : story->Choices)
+        {
+            Search::Add(id, choice.Text);
+            Search::Add(id, choice.Items);
+        }
+
+        for (auto &item : story->Shop)
+        {
+            Search::Add(id, item.first.Name);
+        }
+
+        for (auto &item : story->Sell)
+        {
+            Search::Add(id, item.first.Name);
+        }
+
+        for (auto &barter : story->Barter)
+        {
+            Search::Add(id, barter.first.Name);
+            Search::Add(id, barter.second);
+        }
+
+        Search::Add(id, story->Take);
+        Search::Add(id, story->ToLose);
+    }
+
+    void Build()
+    {
+        Index.clear();
+
+        // IDs must be added in ascending order
+        auto sections = std::vector<Story::Base *>(Stories.begin(), Stories.end());
+
+        std::stable_sort(sections.begin(), sections.end(), [](Story::Base *a, Story::Base *b) { return a->ID < b->ID; });
+
+        for (auto story : sections)
+        {
+            Search::Add(story);
+
+            // run the section's Event for each starting character, then put the section back the way it was
+            for (auto &character : Character::Classes)
+            {
+                auto saved = *story;
+
+                auto player = character;
+
+                story->Event(player);
+
+                Search::Add(story);
+
+                static_cast<Story::Base &>(*story) = saved;
+            }
+        }
+
+        for (auto &word : Index)
+        {
+            word.second.shrink_to_fit();
+        }
+
+        Ready = true;
+    }
+
+    bool Built()
+    {
+        return Ready;
+    }
+
+    int Words()
+    {
+        return (int)Index.size();
+    }
+
+    std::vector<int> Find(const std::string &query)
+    {
+        auto result = std::vector<int>();
+
+        auto words = Search::Split(query);
+
+        for (auto i = 0; i < words.size(); i++)
+        {
+            auto match = Index.find(words[i]);
+
+            if (match == Index.end())
+            {
+                return std::vector<int>();
+            }
+
+            if (i == 0)
+            {
+                result = match->second;
+            }
+            else
+            {
+                auto both = std::vector<int>();
+
+                std::set_intersection(result.begin(), result.end(), match->second.begin(), match->second.end(), std::back_inserter(both));
+
+                result = both;
+            }
+
+            if (result.empty())
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+} // namespace Search
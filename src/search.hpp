@@ -0,0 +1,27 @@
+#ifndef __SEARCH__HPP__
+#define __SEARCH__HPP__
+
+#include <string>
+#include <vector>
+
+// Inverted index over the section texts (search.cpp): words of the text, title, farewell, choices and the items
+// offered in each section. Text that sections build at runtime is collected by running each section's Event on a
+// copy of every starting character, so the index must be built before any section is played.
+namespace Search
+{
+    // Index all sections (after InitializeStories)
+    void Build();
+
+    bool Built();
+
+    // Number of distinct words
+    int Words();
+
+    // Lower case words (letters and digits) of the text
+    std::vector<std::string> Split(const std::string &text);
+
+    // IDs of the sections that contain every word of the query, in ascending order
+    std::vector<int> Find(const std::string &query);
+} // namespace Search
+
+#endif
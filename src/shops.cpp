@@ -0,0 +1,571 @@
+// Standard IO
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+// Using SDL
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "config.hpp"
+#include "controls.hpp"
+#include "handles.hpp"
+#include "render.hpp"
+#include "widgets.hpp"
+#include "runner.hpp"
+#include "input.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "story.hpp"
+#include "graphics.hpp"
+#include "screens.hpp"
+#include "telemetry.hpp"
+
+bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Item::Base mine, Item::Base theirs)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    if (Character::VERIFY_ITEMS(player, {mine.Type}))
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto box_space = Video.Scaled(10);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        std::string trade_text = "Trade " + std::string(mine.Name) + " for " + std::string(theirs.Name) + "?";
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Make a Donation");
+
+        runner.Controls.push_back(Button(0, "icons/yes.png", 0, 1, 0, 0, startx, buttony, Control::Type::ACTION));
+        runner.Controls.push_back(Button(1, "icons/back-button.png", 0, 1, 0, 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Widgets.Add<Widget::Label>("TRADE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        auto wallet = Widget::Sidebar(runner.Widgets, font, "Life", "Money", boxh, text_space, box_space);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+        runner.Widgets.Add<Widget::Label>(trade_text.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, textwidth, boxh, textx + text_space, texty + text_space);
+
+        runner.Update = [&]() {
+            wallet.first->Set(std::to_string(player.Life));
+
+            wallet.second->Set(std::to_string(player.Money) + std::string(" cacao"));
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION)
+            {
+                Character::LOSE_ITEMS(player, {mine.Type});
+                Character::GET_ITEMS(player, {theirs});
+
+                Telemetry::Push(Telemetry::Kind::TRADE, player.StoryID, (int)mine.Type);
+
+                done = true;
+            }
+
+            return done || type == Control::Type::BACK;
+        };
+
+        done = runner.Run() || done;
+    }
+
+    return done;
+}
+
+// Gives up one item of the type, the least charged one when there are several
+void loseOne(Character::Base &player, Item::Type type)
+{
+    if (Item::COUNT_TYPES(player.Items, type) > 1)
+    {
+        auto least = Item::FIND_LEAST(player.Items, type);
+
+        if (least >= 0)
+        {
+            player.Items.erase(player.Items.begin() + least);
+        }
+    }
+    else
+    {
+        Character::LOSE_ITEMS(player, {type});
+    }
+}
+
+// Rows of a shop or barter list, then the possessions and back buttons
+std::vector<Button> shopControls(std::vector<std::string> choices, int textwidth, int text_space)
+{
+    auto controls = std::vector<Button>();
+
+    auto idx = 0;
+
+    for (auto &choice : choices)
+    {
+        auto text = createText(choice.c_str(), FONT_FILE, Video.Scaled(16), clrBK, textwidth + button_space, TTF_STYLE_NORMAL);
+
+        auto y = (idx > 0 ? controls[idx - 1].Y + controls[idx - 1].H + 3 * text_space : texty + 2 * text_space);
+
+        controls.push_back(Button(idx, text, idx, idx, (idx > 0 ? idx - 1 : idx), (idx < choices.size() ? idx + 1 : idx), textx + 2 * text_space, y, Control::Type::ACTION));
+
+        controls[idx].W = textwidth + button_space;
+
+        controls[idx].H = text->h;
+
+        idx++;
+    }
+
+    controls.push_back(Button(idx, "icons/items.png", idx - 1, idx + 1, idx - 1, idx + 1, startx, buttony, Control::Type::USE));
+    controls.push_back(Button(idx + 1, "icons/back-button.png", idx, idx + 1, idx - 1, idx + 1, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+    return controls;
+}
+
+// Outlines the rows of a shop or barter list except the current one
+void markRows(std::vector<Button> &controls, int rows, int current, int text_space)
+{
+    for (auto i = 0; i < rows; i++)
+    {
+        if (i != current)
+        {
+            Render::Queue.Draw(controls[i].W + 2 * text_space, controls[i].H + 2 * text_space, controls[i].X - text_space, controls[i].Y - text_space, intBK);
+        }
+    }
+}
+
+bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Control::Type mode)
+{
+    auto screen = Frame::Screen();
+
+    auto shop = mode == Control::Type::BUY ? story->Shop : story->Sell;
+
+    if (shop.size() > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        auto choices = std::vector<std::string>();
+
+        for (auto &element : shop)
+        {
+            std::string choice = element.first.Name;
+
+            if (mode == Control::Type::BUY && element.first.Charge == 0)
+            {
+                choice += " (destroyed)";
+            }
+
+            choices.push_back(choice + " (" + std::to_string(element.second) + " cacao)");
+        }
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+        auto box_space = Video.Scaled(10);
+
+        auto shop_message = mode == Control::Type::BUY ? "Select an item to BUY" : "You may SELL your items at prices indicated here";
+
+        auto runner = Widget::Runner<Button>(window, renderer, story->Title ? story->Title : "Necklace of Skulls: Shop");
+
+        runner.Controls = shopControls(choices, textwidth, text_space);
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Status = runner.Widgets.Add<Widget::Label>(shop_message, font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        auto wallet = Widget::Sidebar(runner.Widgets, font, "Possessions", "Money", boxh, text_space, box_space);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            wallet.first->Set(std::to_string(player.Items.size()) + std::string(" item(s)"));
+
+            wallet.second->Set(std::to_string(player.Money) + std::string(" cacao"));
+        };
+
+        runner.Draw = [&]() {
+            markRows(runner.Controls, shop.size(), runner.Current, text_space);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION && runner.Current < shop.size())
+            {
+                auto item = shop[runner.Current].first;
+                auto price = shop[runner.Current].second;
+
+                if (mode == Control::Type::BUY)
+                {
+                    if (player.Money < price)
+                    {
+                        runner.Flash("You do not have enough cacao to buy that!", intRD);
+                    }
+                    else if (Item::IsUnique(item.Type) && Character::VERIFY_ITEMS(player, {item.Type}))
+                    {
+                        runner.Flash("You already have this item!", intRD);
+                    }
+                    else
+                    {
+                        Character::GET_ITEMS(player, {item});
+
+                        player.Money -= price;
+
+                        Telemetry::Push(Telemetry::Kind::BUY, player.StoryID, (int)item.Type);
+
+                        while (!Character::VERIFY_POSSESSIONS(player))
+                        {
+                            inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
+                        }
+
+                        std::string description = item.Name;
+
+                        if (item.Charge == 0)
+                        {
+                            description += " (destroyed)";
+                        }
+
+                        runner.Flash(description + " purchased.", intDB);
+                    }
+                }
+                else if (mode == Control::Type::SELL)
+                {
+                    if (Item::FIND_TYPE(player.Items, item.Type) >= 0)
+                    {
+                        Character::GAIN_MONEY(player, price);
+
+                        Telemetry::Push(Telemetry::Kind::SELL, player.StoryID, (int)item.Type);
+
+                        loseOne(player, item.Type);
+
+                        runner.Flash(std::string(item.Name) + " SOLD.", intDB);
+                    }
+                    else
+                    {
+                        runner.Flash("You do not have that item!", intRD);
+                    }
+                }
+            }
+            else if (type == Control::Type::USE)
+            {
+                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
+
+                runner.Current = -1;
+            }
+
+            return type == Control::Type::BACK;
+        };
+
+        runner.Run();
+    }
+
+    return false;
+}
+
+bool barterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<std::pair<Item::Base, std::vector<Item::Base>>> Barter)
+{
+    auto screen = Frame::Screen();
+
+    if (Barter.size() > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        auto choices = std::vector<std::string>();
+
+        for (auto &element : Barter)
+        {
+            choices.push_back(element.first.Name);
+        }
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto box_space = Video.Scaled(10);
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls: Barter");
+
+        runner.Controls = shopControls(choices, textwidth, text_space);
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Status = runner.Widgets.Add<Widget::Label>("Select an item to BARTER", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        // shown empty while no item is highlighted
+        runner.Widgets.Add<Widget::Panel>(intBE, splashw, boxh, startx, starty + text_bounds - (2 * boxh + infoh + box_space));
+
+        auto boxes = Widget::Sidebar(runner.Widgets, font, "Possessions", "Exchange for", boxh, text_space, box_space);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            boxes.first->Set(std::to_string(player.Items.size()) + std::string(" item(s)"));
+
+            std::string goods = "";
+
+            if (runner.Current >= 0 && runner.Current < Barter.size())
+            {
+                for (auto j = 0; j < Barter[runner.Current].second.size(); j++)
+                {
+                    goods += (j > 0 ? ", " : "") + std::string(Barter[runner.Current].second[j].Name);
+                }
+            }
+
+            boxes.second->Set(goods);
+        };
+
+        runner.Draw = [&]() {
+            markRows(runner.Controls, Barter.size(), runner.Current, text_space);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION && runner.Current < Barter.size())
+            {
+                auto item = Barter[runner.Current].first;
+                auto goods = Barter[runner.Current].second;
+
+                if (Item::FIND_TYPE(player.Items, item.Type) >= 0)
+                {
+                    loseOne(player, item.Type);
+
+                    Character::GET_ITEMS(player, goods);
+
+                    Telemetry::Push(Telemetry::Kind::BARTER, player.StoryID, (int)item.Type);
+
+                    runner.Flash(std::string(item.Name) + " BARTERED.", intDB);
+                }
+                else
+                {
+                    runner.Flash("You do not have that item!", intRD);
+                }
+            }
+            else if (type == Control::Type::USE)
+            {
+                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
+
+                runner.Current = -1;
+            }
+
+            return type == Control::Type::BACK;
+        };
+
+        runner.Run();
+    }
+
+    return false;
+}
+
+bool donateScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player)
+{
+    auto screen = Frame::Screen();
+
+    auto done = false;
+
+    if (player.Money > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto box_space = Video.Scaled(10);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        auto button_plus = createHeaderButton(window, "+", clrWH, intDB, arrow_size, arrow_size, -1);
+        auto button_minus = createHeaderButton(window, "-", clrWH, intDB, arrow_size, arrow_size, -1);
+        auto button_size = Video.Scaled(35);
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+        auto donation = 1;
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Make a Donation");
+
+        runner.Controls.push_back(Button(0, button_plus, 0, 1, 0, 2, textx + 2 * text_space, texty + button_size + 2 * box_space, Control::Type::PLUS));
+        runner.Controls.push_back(Button(1, button_minus, 0, 1, 0, 2, textx + 2 * text_space + button_space + arrow_size, texty + button_size + 2 * box_space, Control::Type::MINUS));
+        runner.Controls.push_back(Button(2, "icons/yes.png", 2, 2, 1, 2, startx, buttony, Control::Type::CONFIRM));
+        runner.Controls.push_back(Button(3, "icons/back-button.png", 3, 3, 0, 3, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Widgets.Add<Widget::Label>("Select amount to DONATE", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        auto wallet = Widget::Sidebar(runner.Widgets, font, "Money", "Life", boxh, text_space, box_space);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+        auto donation_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, textwidth, button_size, textx + text_space, texty + text_space);
+
+        runner.Update = [&]() {
+            wallet.first->Set(std::to_string(player.Money) + std::string(" cacao"));
+
+            wallet.second->Set(std::to_string(player.Life));
+
+            donation_box->Set("DONATE " + (std::to_string(donation)) + " cacao");
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::CONFIRM)
+            {
+                player.DONATION = donation;
+
+                player.Money -= donation;
+
+                done = true;
+            }
+            else if (type == Control::Type::PLUS || type == Control::Type::MINUS)
+            {
+                if (type == Control::Type::PLUS && donation < player.Money)
+                {
+                    donation++;
+                }
+                else if (type == Control::Type::MINUS && donation > 0)
+                {
+                    donation--;
+                }
+
+                runner.Current = -1;
+            }
+
+            return done || type == Control::Type::BACK;
+        };
+
+        done = runner.Run() || done;
+    }
+
+    return done;
+}
+
+int eatScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int limit)
+{
+    auto screen = Frame::Screen();
+
+    auto consumed = 0;
+
+    auto filtered_items = std::vector<Item::Base>();
+
+    for (auto i = 0; i < player.Items.size(); i++)
+    {
+        if (Item::VERIFY(items, player.Items[i]))
+        {
+            filtered_items.push_back(player.Items[i]);
+        }
+    }
+
+    if (player.Items.size() > 0 && filtered_items.size() > 0)
+    {
+        auto font_size = Video.Scaled(20);
+        auto text_space = Video.Scaled(8);
+        auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+        Handle::TTF library;
+
+        Handle::Font typeface(Memory::OpenFont(FONT_FILE, font_size));
+
+        auto font = typeface.get();
+
+        auto infoh = 0.07 * SCREEN_HEIGHT;
+        auto boxh = 0.125 * SCREEN_HEIGHT;
+
+        auto selection = std::vector<int>();
+
+        std::string eat_message = "Select " + std::string((limit > 1) ? "provisions" : "provision") + " to EAT." + (limit > 1 ? (" You can EAT up to " + std::to_string(limit) + " provisions.") : "");
+
+        auto runner = Widget::Runner<Button>(window, renderer, "Necklace of Skulls");
+
+        runner.Controls = createItemList(window, renderer, filtered_items, 0, filtered_items.size(), filtered_items.size(), true, true);
+
+        runner.Space = text_space;
+        runner.Points = text_space / 2;
+
+        runner.Widgets.Add<Widget::Label>(eat_message.c_str(), font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, boxh, startx, starty);
+
+        runner.Widgets.Add<Widget::Label>("SELECTED", font, text_space, clrWH, intDB, TTF_STYLE_NORMAL, splashw, infoh, startx, starty + text_bounds - (boxh + infoh - 1));
+        auto selected_box = runner.Widgets.Add<Widget::Label>("", font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, boxh, startx, starty + text_bounds - boxh);
+
+        runner.Widgets.Add<Widget::Panel>(intBE, textwidth + arrow_size + button_space, text_bounds, textx, texty);
+
+        runner.Update = [&]() {
+            selected_box->Set(selection.size() > 0 ? Item::DESCRIBE(filtered_items, selection) : "(None)");
+        };
+
+        runner.Draw = [&]() {
+            markSelection(runner.Controls, selection, 0, filtered_items.size(), text_space);
+        };
+
+        runner.Act = [&](Control::Type type) {
+            if (type == Control::Type::ACTION && runner.Current < filtered_items.size())
+            {
+                auto result = Item::FIND(selection, runner.Current);
+
+                if (result >= 0)
+                {
+                    selection.erase(selection.begin() + result);
+                }
+                else if (selection.size() < limit)
+                {
+                    selection.push_back(runner.Current);
+                }
+
+                runner.Current = -1;
+            }
+            else if (type == Control::Type::CONFIRM)
+            {
+                for (auto i = 0; i < selection.size(); i++)
+                {
+                    Character::LOSE_ITEMS(player, {filtered_items[selection[i]].Type});
+                }
+
+                consumed = selection.size();
+
+                return true;
+            }
+
+            return type == Control::Type::BACK;
+        };
+
+        runner.Run();
+    }
+
+    if (filtered_items.size() <= 0)
+    {
+        consumed = -1;
+    }
+
+    return consumed;
+}
@@ -1,8 +1,10 @@
 #ifndef __SKILLS__HPP__
 #define __SKILLS__HPP__
 
+#include <array>
 #include <vector>
 
+#include "catalogue.hpp"
 #include "items.hpp"
 
 namespace Skill
@@ -10,18 +12,9 @@ namespace Skill
     enum class Type
     {
         NONE = -1,
-        AGILITY,
-        CHARMS,
-        CUNNING,
-        ETIQUETTE,
-        FOLKLORE,
-        ROGUERY,
-        SEAFARING,
-        SPELLS,
-        SWORDPLAY,
-        TARGETING,
-        UNARMED_COMBAT,
-        WILDERNESS_LORE,
+#define SKILL_TYPE(type, name, description, item) type,
+        SKULLS_SKILLS(SKILL_TYPE)
+#undef SKILL_TYPE
         First = AGILITY,
         Last = WILDERNESS_LORE
     };
@@ -31,45 +24,48 @@ namespace Skill
     public:
         const char *Name = NULL;
         const char *Description = NULL;
-        Skill::Type Type;
+        Skill::Type Type = Skill::Type::NONE;
         Item::Type Requirement = Item::Type::NONE;
 
-        Base(const char *name, const char *description, Skill::Type type, Item::Type item)
+        constexpr Base(const char *name, const char *description, Skill::Type type, Item::Type item) : Name(name), Description(description), Type(type), Requirement(item)
         {
-            Name = name;
-            Type = type;
-            Description = description;
-            Requirement = item;
         }
 
-        Base(const char *name, const char *description, Skill::Type type)
+        constexpr Base(const char *name, const char *description, Skill::Type type) : Base(name, description, type, Item::Type::NONE)
         {
-            Name = name;
-            Type = type;
-            Description = description;
-            Requirement = Item::Type::NONE;
         }
     };
 
-    const auto AGILITY = Base("AGILITY", "The ability to perform acrobatic feats, run, climb, balance and leap. A character with this skill is nimble and dexterous.", Type::AGILITY);
-    const auto CHARMS = Base("CHARMS", "The expert use of magical wards to protect you from danger. Also includes that most elusive of qualities: luck. You must possess a MAGIC AMULET to use this skill.", Type::CHARMS, Item::Type::MAGIC_AMULET);
-    const auto CUNNING = Base("CUNNING", "The ability to think on your feet and devise clever schemes for getting out of trouble. Useful in countless situations.", Type::CUNNING);
-    const auto ETIQUETTE = Base("ETIQUETTE", "Understanding of the courtly manners which are essential to proper conduct in the upper echelons of the nobility.", Type::ETIQUETTE);
-    const auto FOLKLORE = Base("FOLKLORE", "Knowledge of myth and legend, and how best to deal with supernatural menaces such as garlic against vampires, silver bullets against a werewolf, and so on.", Type::FOLKLORE);
-    const auto ROGUERY = Base("ROGUERY", "The traditional repertoire of a thief's tricks: picking pockets, opening locks, and skulking unseen in the shadows.", Type::ROGUERY);
-    const auto SEAFARING = Base("SEAFARING", "Knowing all about life at sea, including the ability to handle anything from a rowing boat right up to a large sailing ship.", Type::SEAFARING);
-    const auto SPELLS = Base("SPELLS", "A range of magical effects encompassing illusions, elemental effects, commands, and summonings. You must possess a MAGIC WAND to use this skill.", Type::SPELLS, Item::Type::MAGIC_WAND);
-    const auto SWORDPLAY = Base("SWORDPLAY", "The best fighting skill. You must possess a SWORD to use this skill.", Type::SWORDPLAY, Item::Type::SWORD);
-    const auto TARGETING = Base("TARGETING", "A long-range attack skill. You must possess a BLOWGUN to use this skill.", Type::TARGETING, Item::Type::BLOWGUN);
-    const auto UNARMED_COMBAT = Base("UNARMED COMBAT", "Fisticuffs, wrestling holds, jabs and kicks, and the tricks of infighting. Not as effective as SWORDPLAY, but you do not need weapons - your own body is the weapon!", Type::UNARMED_COMBAT);
-    const auto WILDERNESS_LORE = Base("WILDERNESS LORE", "A talent for survival in the wild - whether it be forest, desert, swamp or mountain peak.", Type::WILDERNESS_LORE);
-
-    std::vector<Skill::Base> ALL = {
-        AGILITY, CHARMS, CUNNING, ETIQUETTE,
-        FOLKLORE, ROGUERY, SEAFARING, SPELLS,
-        SWORDPLAY, TARGETING, UNARMED_COMBAT, WILDERNESS_LORE};
-
-    int FIND(std::vector<Skill::Base> &skills, Skill::Type skill)
+#define SKILL_CONSTANT(type, name, description, item) constexpr auto type = Base(name, description, Type::type, Item::Type::item);
+    SKULLS_SKILLS(SKILL_CONSTANT)
+#undef SKILL_CONSTANT
+
+#define SKILL_ALL(type, name, description, item) type,
+    inline constexpr std::array<Skill::Base, (int)Skill::Type::Last + 1> ALL = {SKULLS_SKILLS(SKILL_ALL)};
+#undef SKILL_ALL
+
+    // Index of the skill in ALL (its value), -1 for NONE or an unknown value
+    constexpr int INDEX(Skill::Type skill)
+    {
+        return (skill >= Skill::Type::First && skill <= Skill::Type::Last) ? (int)skill : -1;
+    }
+
+    constexpr bool Indexed()
+    {
+        for (auto i = 0; i < (int)Skill::ALL.size(); i++)
+        {
+            if ((int)Skill::ALL[i].Type != i)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(Skill::Indexed(), "Skill::ALL must follow the order of Skill::Type");
+
+    inline int FIND(std::vector<Skill::Base> &skills, Skill::Type skill)
     {
         auto found = -1;
 
@@ -89,7 +85,7 @@ namespace Skill
         return found;
     }
 
-    int FIND_LIST(std::vector<int> selection, int item)
+    inline int FIND_LIST(std::vector<int> selection, int item)
     {
         auto found = -1;
 
@@ -106,12 +102,12 @@ namespace Skill
         return found;
     }
 
-    bool VERIFY(std::vector<Skill::Base> &skills, Skill::Base skill)
+    inline bool VERIFY(std::vector<Skill::Base> &skills, Skill::Base skill)
     {
         return FIND(skills, skill.Type) >= 0;
     }
 
-    void ADD(std::vector<Skill::Base> &skills, Skill::Base skill)
+    inline void ADD(std::vector<Skill::Base> &skills, Skill::Base skill)
     {
         if (!VERIFY(skills, skill))
         {
@@ -119,7 +115,7 @@ namespace Skill
         }
     }
 
-    void REMOVE(std::vector<Skill::Base> &skills, Skill::Base skill)
+    inline void REMOVE(std::vector<Skill::Base> &skills, Skill::Base skill)
     {
         auto result = FIND(skills, skill.Type);
 
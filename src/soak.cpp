@@ -0,0 +1,449 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#elif !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include <SDL.h>
+
+#include "memory.hpp"
+#include "textures.hpp"
+#include "frame.hpp"
+#include "save.hpp"
+#include "soak.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Soak
+{
+    class Metric
+    {
+    public:
+        const char *Name;
+
+        // growth tolerated over the judged part of the run: absolute, and relative to the metric's mean
+        double Absolute;
+
+        double Relative;
+    };
+
+    const std::vector<Soak::Metric> METRICS = {
+        {"rss_mb", 8.0, 0.05},
+        {"open_files", 2.0, 0.0},
+        {"textures", 16.0, 0.0},
+        {"tracked_mb", 2.0, 0.05},
+        {"frame_ms", 2.0, 0.5}};
+
+    class Sample
+    {
+    public:
+        double Minutes = 0.0;
+
+        // in the order of METRICS, negative when not available on this platform
+        std::vector<double> Values = std::vector<double>();
+    };
+
+    std::vector<Soak::Sample> Samples = std::vector<Soak::Sample>();
+
+    std::mt19937 Random;
+
+    std::ofstream Output;
+
+    std::chrono::steady_clock::time_point Began;
+
+    std::chrono::steady_clock::time_point Sampled;
+
+    bool Started = false;
+
+    long long Steps = 0;
+
+    // steps since the last sample
+    long long Interval = 0;
+
+    // inputs requested after the time was up
+    long long Overtime = 0;
+
+    int Sections = 0;
+
+    int Saves = 0;
+
+    int Mismatches = 0;
+
+    double Elapsed(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+    {
+        return std::chrono::duration<double>(to - from).count();
+    }
+
+    // Bytes of resident memory (peak resident memory where the current value is not available), -1 if unknown
+    long long Resident()
+    {
+#if defined(__linux__)
+        std::ifstream statm("/proc/self/statm");
+
+        long long size = 0;
+
+        long long resident = 0;
+
+        if (statm >> size >> resident)
+        {
+            return resident * sysconf(_SC_PAGESIZE);
+        }
+
+        return -1;
+#elif defined(_WIN32)
+        return -1;
+#else
+        struct rusage usage;
+
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            return (long long)usage.ru_maxrss;
+        }
+
+        return -1;
+#endif
+    }
+
+    // Open file descriptors, -1 if unknown
+    int OpenFiles()
+    {
+#if defined(__linux__) || defined(__APPLE__)
+#if defined(__linux__)
+        auto directory = "/proc/self/fd";
+#else
+        auto directory = "/dev/fd";
+#endif
+        std::error_code error;
+
+        auto count = 0;
+
+        for (auto &entry : fs::directory_iterator(directory, error))
+        {
+            (void)entry;
+
+            count++;
+        }
+
+        // not counting the descriptor of the listing itself
+        return error ? -1 : std::max(0, count - 1);
+#else
+        return -1;
+#endif
+    }
+
+    void Write(Soak::Sample &sample)
+    {
+        if (Output.is_open())
+        {
+            Output << std::fixed << std::setprecision(3) << sample.Minutes;
+
+            for (auto value : sample.Values)
+            {
+                Output << "," << value;
+            }
+
+            Output << std::endl;
+        }
+    }
+
+    void Take(std::chrono::steady_clock::time_point now)
+    {
+        Soak::Sample sample;
+
+        sample.Minutes = Soak::Elapsed(Began, now) / 60.0;
+
+        auto resident = Soak::Resident();
+
+        sample.Values.push_back(resident >= 0 ? resident / (1024.0 * 1024.0) : -1.0);
+
+        sample.Values.push_back(Soak::OpenFiles());
+
+        sample.Values.push_back(Textures::Count());
+
+        sample.Values.push_back(Memory::Total() / (1024.0 * 1024.0));
+
+        sample.Values.push_back(Interval > 0 ? 1000.0 * Soak::Elapsed(Sampled, now) / Interval : -1.0);
+
+        Samples.push_back(sample);
+
+        Soak::Write(sample);
+
+        Sampled = now;
+
+        Interval = 0;
+    }
+
+    void Start()
+    {
+        Active = true;
+
+        // keep what the environment asks for, e.g. a real display to watch the run
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+
+        // as fast as the game can draw
+        Frame::Cap = 0;
+
+        Frame::VSync = false;
+
+        if (Seed == 0)
+        {
+            Seed = (unsigned int)std::chrono::system_clock::now().time_since_epoch().count();
+        }
+
+        Random.seed(Seed);
+
+        if (Log.length() > 0)
+        {
+            Output.open(Log, std::ios::out | std::ios::trunc);
+
+            if (!Output.is_open())
+            {
+                std::cerr << "Unable to create soak log " << Log << "!" << std::endl;
+            }
+            else
+            {
+                Output << "minutes";
+
+                for (auto &metric : METRICS)
+                {
+                    Output << "," << metric.Name;
+                }
+
+                Output << std::endl;
+            }
+        }
+
+        std::cerr << "Soak test for " << Minutes << " minutes, seed " << Seed << std::endl;
+    }
+
+    bool Step()
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        if (!Started)
+        {
+            Started = true;
+
+            Began = Sampled = now;
+
+            Soak::Take(now);
+        }
+
+        Steps++;
+
+        Interval++;
+
+        if (Soak::Elapsed(Sampled, now) >= Soak::SAMPLE_INTERVAL)
+        {
+            Soak::Take(now);
+        }
+
+        auto expired = Soak::Elapsed(Began, now) >= Minutes * 60.0;
+
+        if (expired)
+        {
+            Overtime++;
+
+            // a screen that never lets go
+            if (Overtime > 10000)
+            {
+                std::cerr << "Soak test could not leave the current screen" << std::endl;
+
+                auto code = Soak::Finish(std::cerr);
+
+                std::exit(code != 0 ? code : 4);
+            }
+        }
+
+        return expired;
+    }
+
+    int Pick(const std::vector<Control::Type> &types)
+    {
+        // weights: the walk should go deeper more often than it backs out
+        auto weights = std::vector<double>();
+
+        auto total = 0.0;
+
+        for (auto type : types)
+        {
+            auto weight = 6.0;
+
+            if (type == Control::Type::QUIT)
+            {
+                weight = 0.0;
+            }
+            else if (type == Control::Type::BACK)
+            {
+                weight = 1.0;
+            }
+
+            weights.push_back(weight);
+
+            total += weight;
+        }
+
+        if (total <= 0.0)
+        {
+            return -1;
+        }
+
+        std::discrete_distribution<int> pick(weights.begin(), weights.end());
+
+        return pick(Random);
+    }
+
+    int Back(const std::vector<Control::Type> &types)
+    {
+        auto quit = -1;
+
+        for (auto i = 0; i < types.size(); i++)
+        {
+            if (types[i] == Control::Type::BACK)
+            {
+                return i;
+            }
+            else if (types[i] == Control::Type::QUIT && quit < 0)
+            {
+                quit = i;
+            }
+        }
+
+        return quit;
+    }
+
+    void Section(Character::Base &player)
+    {
+        if (!Active)
+        {
+            return;
+        }
+
+        Sections++;
+
+        if (Sections % Soak::SAVE_EVERY != 0)
+        {
+            return;
+        }
+
+        std::error_code error;
+
+        auto file = (fs::temp_directory_path(error) / "skulls-soak.save").string();
+
+        saveGame(player, file.c_str());
+
+        auto loaded = loadGame(file);
+
+        Saves++;
+
+        if (loaded.StoryID != player.StoryID || loaded.Life != player.Life || loaded.Items.size() != player.Items.size())
+        {
+            Mismatches++;
+
+            std::cerr << "Soak test: the character loaded in section " << player.StoryID << " differs from the one saved" << std::endl;
+        }
+        else
+        {
+            player = loaded;
+        }
+    }
+
+    // Least squares slope (per minute) of the metric over the judged samples
+    double Slope(const std::vector<Soak::Sample> &samples, int metric, double &mean)
+    {
+        auto n = 0.0;
+        auto sx = 0.0;
+        auto sy = 0.0;
+        auto sxx = 0.0;
+        auto sxy = 0.0;
+
+        for (auto &sample : samples)
+        {
+            auto x = sample.Minutes;
+            auto y = sample.Values[metric];
+
+            n += 1.0;
+            sx += x;
+            sy += y;
+            sxx += x * x;
+            sxy += x * y;
+        }
+
+        mean = n > 0 ? sy / n : 0.0;
+
+        auto d = n * sxx - sx * sx;
+
+        return d != 0.0 ? (n * sxy - sx * sy) / d : 0.0;
+    }
+
+    int Finish(std::ostream &out)
+    {
+        if (Started && Interval > 0)
+        {
+            Soak::Take(std::chrono::steady_clock::now());
+        }
+
+        auto failed = Mismatches > 0;
+
+        out << "Soak test: " << Steps << " inputs, " << Sections << " sections, " << Saves << " saves, " << Samples.size() << " samples, seed " << Seed << std::endl;
+
+        // skip the warm-up (caches filling up)
+        auto judged = std::vector<Soak::Sample>(Samples.begin() + Samples.size() / 4, Samples.end());
+
+        if (judged.size() < Soak::MIN_SAMPLES)
+        {
+            out << "Too few samples to judge trends (at least " << Soak::MIN_SAMPLES << " after the warm-up, one every " << Soak::SAMPLE_INTERVAL << " s)" << std::endl;
+
+            return failed ? 3 : 0;
+        }
+
+        auto span = judged.back().Minutes - judged.front().Minutes;
+
+        out << std::fixed << std::setprecision(2);
+
+        for (auto i = 0; i < METRICS.size(); i++)
+        {
+            auto &metric = METRICS[i];
+
+            auto available = std::all_of(judged.begin(), judged.end(), [i](const Soak::Sample &sample) { return sample.Values[i] >= 0; });
+
+            if (!available)
+            {
+                out << std::setw(12) << metric.Name << ": not available" << std::endl;
+
+                continue;
+            }
+
+            auto mean = 0.0;
+
+            auto growth = Soak::Slope(judged, i, mean) * span;
+
+            auto tolerated = std::max(metric.Absolute, metric.Relative * mean);
+
+            auto trending = growth > tolerated;
+
+            failed = failed || trending;
+
+            out << std::setw(12) << metric.Name << ": " << judged.front().Values[i] << " -> " << judged.back().Values[i] << ", trend " << std::showpos << growth << std::noshowpos << " over " << span << " min (tolerated " << tolerated << ")" << (trending ? " GROWING" : "") << std::endl;
+        }
+
+        out << std::defaultfloat;
+
+        out << (failed ? "Soak test FAILED" : "Soak test passed") << std::endl;
+
+        return failed ? 3 : 0;
+    }
+} // namespace Soak
@@ -0,0 +1,88 @@
+#ifndef __SOAK__HPP__
+#define __SOAK__HPP__
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "character.hpp"
+#include "controls.hpp"
+
+// Soak test (soak.cpp, --soak MINUTES). Every screen is driven by random inputs instead of the player, so the game
+// walks through the story, the shops, barters, take and eat screens and the menus for as long as requested, saving and
+// loading the character every few sections. Resident memory, open files, live textures, tracked memory and the time
+// per frame are sampled throughout, and the run fails if any of them keeps growing after the warm-up.
+namespace Soak
+{
+    // Seconds between samples
+    const int SAMPLE_INTERVAL = 10;
+
+    // Sections between saving and loading the character
+    const int SAVE_EVERY = 25;
+
+    // Samples needed to judge a trend, the first quarter of the run is not judged
+    const int MIN_SAMPLES = 8;
+
+    inline bool Active = false;
+
+    // Run for this long (--soak MINUTES)
+    inline double Minutes = 0;
+
+    // Random seed (--seed), taken from the clock when 0
+    inline unsigned int Seed = 0;
+
+    // Samples as CSV (--soak-log FILE)
+    inline std::string Log = "";
+
+    // Select the dummy video and audio drivers, seed the random walk (before SDL_Init)
+    void Start();
+
+    // One input was requested, returns true once the time is up
+    bool Step();
+
+    // Random control (index), the ones that end the game are never chosen and BACK seldom
+    int Pick(const std::vector<Control::Type> &types);
+
+    // Index of the control that leaves the screen (BACK, otherwise QUIT), -1 if none
+    int Back(const std::vector<Control::Type> &types);
+
+    // A section was entered (render thread), saves and reloads the character every SAVE_EVERY sections
+    void Section(Character::Base &player);
+
+    // Print the samples' trends, returns the exit code (non-zero if any metric keeps growing)
+    int Finish(std::ostream &out);
+
+    // Input::GetInput
+    template <typename T>
+    bool Play(const std::vector<T> &choices, int &current, bool &selected, bool &scrollUp, bool &scrollDown, bool &hold)
+    {
+        auto types = std::vector<Control::Type>();
+
+        for (auto &choice : choices)
+        {
+            types.push_back(choice.Type);
+        }
+
+        scrollUp = false;
+        scrollDown = false;
+        hold = false;
+
+        if (Soak::Step())
+        {
+            // leave the screen, screens that ignore quit still go back
+            current = Soak::Back(types);
+
+            selected = current >= 0;
+
+            return true;
+        }
+
+        current = Soak::Pick(types);
+
+        selected = current >= 0;
+
+        return false;
+    }
+} // namespace Soak
+
+#endif
@@ -0,0 +1,211 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "startup.hpp"
+
+namespace Startup
+{
+    class Timing
+    {
+    public:
+        std::string Name = "";
+
+        double Start = 0.0;
+
+        double End = 0.0;
+
+        Timing(std::string name, double start, double end)
+        {
+            Name = name;
+
+            Start = start;
+
+            End = end;
+        }
+    };
+
+    auto Clock = std::chrono::steady_clock::now();
+
+    std::mutex Lock;
+
+    std::vector<Startup::Timing> Milestones = std::vector<Startup::Timing>();
+
+    std::vector<Startup::Timing> Tasks = std::vector<Startup::Timing>();
+
+    std::condition_variable Signal;
+
+    std::vector<std::thread> Workers = std::vector<std::thread>();
+
+    // tasks waiting for a worker
+    std::deque<std::pair<const char *, std::function<void()>>> Queue = std::deque<std::pair<const char *, std::function<void()>>>();
+
+    // the workers leave once the queue is empty
+    bool Closing = false;
+
+    std::atomic<int> Started(0);
+
+    std::atomic<int> Finished(0);
+
+    void Begin()
+    {
+        Clock = std::chrono::steady_clock::now();
+    }
+
+    double Elapsed()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Clock).count();
+    }
+
+    void Mark(const char *milestone)
+    {
+        auto now = Startup::Elapsed();
+
+        std::lock_guard<std::mutex> guard(Lock);
+
+        Milestones.push_back(Startup::Timing(milestone, now, now));
+    }
+
+    void Time(const char *name, std::function<void()> &task)
+    {
+        auto start = Startup::Elapsed();
+
+        task();
+
+        auto end = Startup::Elapsed();
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            Tasks.push_back(Startup::Timing(name, start, end));
+        }
+
+        Finished++;
+    }
+
+    void Work()
+    {
+        std::unique_lock<std::mutex> guard(Lock);
+
+        while (true)
+        {
+            Signal.wait(guard, [] { return Closing || !Queue.empty(); });
+
+            if (Queue.empty())
+            {
+                break;
+            }
+
+            auto task = Queue.front();
+
+            Queue.pop_front();
+
+            guard.unlock();
+
+            Startup::Time(task.first, task.second);
+
+            guard.lock();
+        }
+    }
+
+    void Run(const char *name, std::function<void()> task)
+    {
+        Started++;
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            Queue.push_back(std::make_pair(name, task));
+        }
+
+        // only the main thread starts and joins workers
+        if (Workers.size() < Startup::MAX_WORKERS)
+        {
+            Workers.push_back(std::thread(Startup::Work));
+        }
+
+        Signal.notify_one();
+    }
+
+    void Main(const char *name, std::function<void()> task)
+    {
+        Started++;
+
+        Startup::Time(name, task);
+    }
+
+    int Pending()
+    {
+        return Started - Finished;
+    }
+
+    double Progress()
+    {
+        return Started > 0 ? (double)Finished / Started : 1.0;
+    }
+
+    void Wait()
+    {
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            Closing = true;
+        }
+
+        Signal.notify_all();
+
+        for (auto &worker : Workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+
+        Workers.clear();
+
+        std::lock_guard<std::mutex> guard(Lock);
+
+        Closing = false;
+    }
+
+    void Print(std::ostream &out)
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        auto busy = 0.0;
+
+        auto last = 0.0;
+
+        out << "Startup (ms since start):" << std::endl;
+
+        out << std::fixed << std::setprecision(1);
+
+        for (auto &task : Tasks)
+        {
+            out << "  " << std::left << std::setw(20) << task.Name << std::right << std::setw(9) << task.Start << " - " << std::setw(9) << task.End << " (" << (task.End - task.Start) << ")" << std::endl;
+
+            busy += task.End - task.Start;
+
+            last = task.End > last ? task.End : last;
+        }
+
+        for (auto &milestone : Milestones)
+        {
+            out << "  " << std::left << std::setw(20) << milestone.Name << std::right << std::setw(9) << milestone.Start << std::endl;
+        }
+
+        // the tasks would have taken this long one after the other
+        out << "  " << std::left << std::setw(20) << "tasks (sequential)" << std::right << std::setw(9) << busy << std::endl;
+
+        out << "  " << std::left << std::setw(20) << "tasks (done)" << std::right << std::setw(9) << last << std::endl;
+
+        out << std::defaultfloat;
+    }
+} // namespace Startup
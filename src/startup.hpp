@@ -0,0 +1,45 @@
+#ifndef __STARTUP__HPP__
+#define __STARTUP__HPP__
+
+#include <functional>
+#include <iostream>
+
+// Startup pipeline (startup.cpp). The window is shown with a placeholder while the stories, the cover and the icons are
+// loaded on a few worker threads. Text is rasterized on the main thread, SDL_ttf is not thread-safe. Milestones and
+// task times are measured from Begin.
+namespace Startup
+{
+    // Print the timings once the main menu accepts input (--startup-report)
+    inline bool Report = false;
+
+    // Threads that run the loading tasks, the rest wait in line
+    const int MAX_WORKERS = 3;
+
+    // Start the clock (first thing in main)
+    void Begin();
+
+    // Milliseconds since Begin
+    double Elapsed();
+
+    // Record a milestone, e.g. "first frame"
+    void Mark(const char *milestone);
+
+    // Queue a loading task for the workers
+    void Run(const char *name, std::function<void()> task);
+
+    // Run a loading task on the calling (main) thread, timed like the others. For anything that uses SDL_ttf.
+    void Main(const char *name, std::function<void()> task);
+
+    // Number of tasks started and not yet finished
+    int Pending();
+
+    // Fraction of the tasks that have finished (1.0 if there are none)
+    double Progress();
+
+    // Wait for the tasks and join the workers
+    void Wait();
+
+    void Print(std::ostream &out);
+} // namespace Startup
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef __STATE__HPP__
+#define __STATE__HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "character.hpp"
+
+// Canonical encoding of the game state carried by a character, for telling states apart cheaply (replay checkpoints,
+// deduplication). Only what affects play is encoded: life, money, the limits, the flags, Ticks, Cross, the section,
+// and the skills, items (with charges), codewords, lost items and lost skills. The lists are sorted, so the order
+// in which things were gained does not matter. Names, descriptions and the save time are left out.
+//
+// Integers are written as LEB128 varints (zigzag for signed values), so the bytes do not depend on the compiler or
+// the platform. Enumerations are written as their values: new items, skills and codewords must be appended to their
+// enums (or VERSION raised) for old encodings and hashes to stay valid. Reference value for checking a build (checked
+// by make state-check): State::Hash(Character::WARRIOR) == 0x8fe1a26d70abe172.
+namespace State
+{
+    const uint8_t VERSION = 1;
+
+    typedef std::vector<uint8_t> Bytes;
+
+    class Encoder
+    {
+    private:
+        // reused between encodes, so encoding does not allocate once warmed up
+        std::vector<int> keys = std::vector<int>();
+
+        std::vector<std::pair<int, int>> pairs = std::vector<std::pair<int, int>>();
+
+        void put(uint32_t value)
+        {
+            while (value >= 0x80)
+            {
+                Data.push_back((uint8_t)(value | 0x80));
+
+                value >>= 7;
+            }
+
+            Data.push_back((uint8_t)value);
+        }
+
+        void put(int value)
+        {
+            put(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+        }
+
+        template <typename T>
+        void types(const std::vector<T> &list)
+        {
+            keys.clear();
+
+            for (auto &element : list)
+            {
+                keys.push_back((int)element.Type);
+            }
+
+            sorted();
+        }
+
+        void sorted()
+        {
+            std::sort(keys.begin(), keys.end());
+
+            put((uint32_t)keys.size());
+
+            for (auto key : keys)
+            {
+                put(key);
+            }
+        }
+
+        void items(const std::vector<Item::Base> &list)
+        {
+            pairs.clear();
+
+            for (auto &item : list)
+            {
+                pairs.push_back({(int)item.Type, item.Charge});
+            }
+
+            std::sort(pairs.begin(), pairs.end());
+
+            put((uint32_t)pairs.size());
+
+            for (auto &pair : pairs)
+            {
+                put(pair.first);
+
+                put(pair.second);
+            }
+        }
+
+    public:
+        State::Bytes Data = State::Bytes();
+
+        // The encoding stays in Data until the next call
+        const State::Bytes &Encode(const Character::Base &player)
+        {
+            Data.clear();
+
+            Data.push_back(State::VERSION);
+
+            put(player.StoryID);
+            put(player.Life);
+            put(player.Money);
+            put(player.ITEM_LIMIT);
+            put(player.MAX_LIFE_LIMIT);
+            put(player.SKILLS_LIMIT);
+            put(player.DONATION);
+            put(player.Ticks);
+            put(player.Cross);
+            put(player.LostMoney);
+
+            Data.push_back((uint8_t)((player.IsBlessed ? 1 : 0) | (player.IsImmortal ? 2 : 0) | (player.RitualBallStarted ? 4 : 0)));
+
+            types(player.Skills);
+
+            items(player.Items);
+
+            keys.clear();
+
+            for (auto codeword : player.Codewords)
+            {
+                keys.push_back((int)codeword);
+            }
+
+            sorted();
+
+            items(player.LostItems);
+
+            types(player.LostSkills);
+
+            return Data;
+        }
+    };
+
+    // FNV-1a (64-bit)
+    inline uint64_t Hash(const uint8_t *data, size_t size)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ data[i]) * 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    inline State::Bytes Encode(const Character::Base &player)
+    {
+        State::Encoder encoder;
+
+        return encoder.Encode(player);
+    }
+
+    inline uint64_t Hash(const Character::Base &player)
+    {
+        thread_local State::Encoder encoder;
+
+        auto &data = encoder.Encode(player);
+
+        return State::Hash(data.data(), data.size());
+    }
+
+    // Same state of play (names and save times may differ)
+    inline bool Same(const Character::Base &a, const Character::Base &b)
+    {
+        thread_local State::Encoder first;
+
+        thread_local State::Encoder second;
+
+        return first.Encode(a) == second.Encode(b);
+    }
+} // namespace State
+
+#endif
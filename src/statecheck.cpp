@@ -0,0 +1,177 @@
+// State encoding check
+//
+// Checks a build against the canonical state encoding (state.hpp): the reference hash of the Warrior, that the order in
+// which items, skills and codewords were gained does not change the encoding (State::Same and State::Hash) while a
+// change of play does, and times a batch of encodes.
+//
+// Usage: StateCheck.exe [--encodes N]
+//
+// Exits with a non-zero status when a check fails.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "character.hpp"
+#include "state.hpp"
+
+namespace StateCheck
+{
+    const uint64_t REFERENCE = 0x8fe1a26d70abe172ULL;
+
+    int Failures = 0;
+
+    void Check(bool passed, std::string what)
+    {
+        if (!passed)
+        {
+            std::cerr << "FAILED: " << what << std::endl;
+
+            Failures++;
+        }
+    }
+
+    // Gains a few more things (so that every list has something to reorder)
+    Character::Base Played(Character::Base player)
+    {
+        auto charged = Item::Base(Item::SWORD);
+
+        charged.Charge = 3;
+
+        player.Items.push_back(charged);
+
+        player.Items.push_back(Item::SWORD);
+
+        player.Codewords.push_back((Codeword::Type)0);
+
+        player.Codewords.push_back((Codeword::Type)(Codeword::COUNT - 1));
+
+        player.Codewords.push_back((Codeword::Type)(Codeword::COUNT / 2));
+
+        player.LostItems.push_back(Item::SWORD);
+
+        player.LostSkills.push_back(Skill::ALL[0]);
+
+        player.LostSkills.push_back(Skill::ALL[Skill::ALL.size() - 1]);
+
+        return player;
+    }
+
+    // Same state with every list in another order
+    Character::Base Reordered(Character::Base player)
+    {
+        std::reverse(player.Skills.begin(), player.Skills.end());
+
+        std::reverse(player.Items.begin(), player.Items.end());
+
+        std::reverse(player.Codewords.begin(), player.Codewords.end());
+
+        std::reverse(player.LostItems.begin(), player.LostItems.end());
+
+        std::reverse(player.LostSkills.begin(), player.LostSkills.end());
+
+        if (player.Skills.size() > 2)
+        {
+            std::rotate(player.Skills.begin(), player.Skills.begin() + 1, player.Skills.end());
+        }
+
+        // not part of the state of play
+        player.Name = "Reordered";
+
+        return player;
+    }
+
+    void Run(int encodes)
+    {
+        auto hash = State::Hash(Character::WARRIOR);
+
+        StateCheck::Check(hash == StateCheck::REFERENCE, "State::Hash(Character::WARRIOR) is not the reference value");
+
+        std::cout << "Reference: " << std::hex << std::setfill('0') << std::setw(16) << hash << std::dec << std::setfill(' ') << std::endl;
+
+        for (auto &character : Character::Classes)
+        {
+            auto player = StateCheck::Played(character);
+
+            auto reordered = StateCheck::Reordered(player);
+
+            StateCheck::Check(State::Same(player, reordered), character.Name + ": reordered lists are not the same state");
+
+            StateCheck::Check(State::Hash(player) == State::Hash(reordered), character.Name + ": reordered lists hash differently");
+
+            StateCheck::Check(State::Encode(player) == State::Encode(reordered), character.Name + ": reordered lists encode differently");
+
+            auto changed = reordered;
+
+            changed.Life--;
+
+            StateCheck::Check(!State::Same(player, changed), character.Name + ": a change of life is the same state");
+
+            changed = reordered;
+
+            changed.Codewords.pop_back();
+
+            StateCheck::Check(!State::Same(player, changed), character.Name + ": a lost codeword is the same state");
+        }
+
+        // every class, gained things included, in turn
+        auto players = std::vector<Character::Base>();
+
+        for (auto &character : Character::Classes)
+        {
+            players.push_back(StateCheck::Played(character));
+        }
+
+        uint64_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto i = 0; i < encodes; i++)
+        {
+            sum ^= State::Hash(players[i % players.size()]);
+        }
+
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Encodes: " << encodes << " in " << std::fixed << std::setprecision(1) << elapsed / 1e6 << " ms (" << (encodes > 0 ? elapsed / encodes : 0.0) << " ns each, checksum " << std::hex << sum << std::dec << ")" << std::endl;
+    }
+} // namespace StateCheck
+
+int main(int argc, char **argv)
+{
+    auto encodes = 1000000;
+
+    for (auto i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "--encodes" && i + 1 < argc)
+        {
+            encodes = std::max(0, std::atoi(argv[++i]));
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--encodes N]" << std::endl;
+
+            return 1;
+        }
+    }
+
+    StateCheck::Run(encodes);
+
+    if (StateCheck::Failures > 0)
+    {
+        std::cerr << StateCheck::Failures << " check(s) failed" << std::endl;
+
+        return 1;
+    }
+
+    std::cout << "All checks passed" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <cstring>
+#include <vector>
+
+#include "memory.hpp"
+#include "story.hpp"
+
+namespace Choice
+{
+    std::vector<bool> Available(std::vector<Choice::Base> &choices, Character::Base &player)
+    {
+        auto state = Requirement::State(player);
+
+        auto available = std::vector<bool>(choices.size());
+
+        for (auto i = 0; i < choices.size(); i++)
+        {
+            available[i] = Requirement::Evaluate(choices[i].Requires, state);
+        }
+
+        return available;
+    }
+} // namespace Choice
+
+namespace Story
+{
+    long long Footprint(Story::Base *story)
+    {
+        long long bytes = sizeof(Story::Base);
+
+        for (auto text : {story->Text, story->Title, story->Bye, story->Image})
+        {
+            bytes += text ? strlen(text) + 1 : 0;
+        }
+
+        bytes += story->Choices.capacity() * sizeof(Choice::Base);
+
+        for (auto &choice : story->Choices)
+        {
+            bytes += choice.Text ? strlen(choice.Text) + 1 : 0;
+
+            bytes += choice.Items.capacity() * sizeof(Item::Base) + choice.Gifts.capacity() * sizeof(std::pair<Item::Type, int>) + choice.Codewords.capacity() * sizeof(Codeword::Type);
+        }
+
+        bytes += (story->Shop.capacity() + story->Sell.capacity()) * sizeof(std::pair<Item::Base, int>);
+
+        bytes += story->Barter.capacity() * sizeof(std::pair<Item::Base, std::vector<Item::Base>>);
+
+        for (auto &barter : story->Barter)
+        {
+            bytes += barter.second.capacity() * sizeof(Item::Base);
+        }
+
+        bytes += (story->Take.capacity() + story->ToLose.capacity()) * sizeof(Item::Base);
+
+        return bytes;
+    }
+} // namespace Story
+
+NotImplemented notImplemented = NotImplemented();
+
+std::vector<Story::Base *> Stories = std::vector<Story::Base *>();
+
+void *findStory(int id)
+{
+    Story::Base *story = &notImplemented;
+
+    if (Stories.size() > 0)
+    {
+        for (auto i = 0; i < Stories.size(); i++)
+        {
+            if (((Story::Base *)Stories[i])->ID == id)
+            {
+                story = (Story::Base *)Stories[i];
+
+                break;
+            }
+        }
+    }
+
+    return story;
+}
+
+void InitializeStories()
+{
+    Stories.clear();
+
+    InitializeStories000();
+    InitializeStories100();
+    InitializeStories200();
+    InitializeStories300();
+    InitializeStories400();
+
+    long long bytes = Stories.capacity() * sizeof(Story::Base *);
+
+    for (auto story : Stories)
+    {
+        bytes += Story::Footprint(story);
+    }
+
+    Memory::Set(Memory::Type::STORY, bytes);
+}
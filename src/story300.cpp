@@ -0,0 +1,2682 @@
+#include <vector>
+
+#include "story.hpp"
+
+class Story300 : public Story::Base
+{
+public:
+    Story300()
+    {
+        ID = 300;
+
+        Text = "Two days' sailing brings you to Tahil, a busy trading settlement on the far coast. The others squint warily as they bring the vessel in to the harbour. You can see at once there is trouble here. Instead of the stacks of trade goods that would normally be piled up along the quayside at a port like this, there are milling crowds of refugees carrying everything they own on their backs.\n\nAs you tie up at the quay, a man whose elegant clothing marks him as a lord of the Great City comes striding towards you. \"I am commandeering your vessel,\" he says in a tone that brooks no disagreement.\n\nWithout waiting for a reply, he turns and beckons his wife and children to join him. A couple of servants scurry along behind them, struggling under the weight of the family's possessions.";
+
+        Image = "images/maya-noble.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Prevent his appropriation of the vessel using [ETIQUETTE] ", 159, Skill::Type::ETIQUETTE));
+        Choices.push_back(Choice::Base("Use [CUNNING]", 183, Skill::Type::CUNNING));
+        Choices.push_back(Choice::Base("[SWORDPLAY] Fight", 206, Choice::Type::SKILL_ANY, Skill::Type::SWORDPLAY, {Item::SWORD, Item::JADE_SWORD}));
+        Choices.push_back(Choice::Base("You are not bothered about him taking the vessel, you can just set out towards Shakalla", 85));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story301 : public Story::Base
+{
+public:
+    Story301()
+    {
+        ID = 301;
+
+        Choices.clear();
+    }
+
+    int Background(Character::Base &player)
+    {
+        if (player.DONATION > 4)
+        {
+            return 323;
+        }
+        else
+        {
+            return 346;
+        }
+    }
+};
+
+class Story302 : public Story::Base
+{
+public:
+    Story302()
+    {
+        ID = 302;
+
+        Text = "The effort of trying to regurgitate the firefly leaves your eyes watering, but to no avail. Before you can blink away the tears, you realize someone is trying to pull the SHAWL out of your grip. You have the impression of someone very tall and unbelievably thin, like a human stick insect. The face is as pale as sap, and the naked skin exudes a sweet smell like tree bark and honey.\n\nYou wipe your eyes and look again. At first you think the figure is gone, but then there is a flicker of movement at the edge of your vision. Whirling, you catch a brief glimpse of two or three thin creatures. They dart away like pale green fishes to hang just behind your line of sight. By standing still you get an uncertain and unfocused view of them out of the corner of your eye. It dawns on you that there are many of them clustered noiselessly around the clearing, transient as sunbeams. They are the stabai -- the creatures of the wooded dells, who ply their magic to the discomfort of lone travellers like yourself.\n\n\"You have our SHAWL,\" buzzes a soft forlorn voice in your ear. \"Won't you return it?\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[FOLKLORE]", 255, Skill::Type::FOLKLORE));
+        Choices.push_back(Choice::Base("Return the SHAWL", 347, {Item::SHAWL}));
+        Choices.push_back(Choice::Base("Keep the SHAWL", 369, {Item::SHAWL}));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story303 : public Story::Base
+{
+public:
+    Story303()
+    {
+        ID = 303;
+
+        Text = "The sun rises again, flooding the sands with red-gold light. You are contemplating the need for shelter when, cresting a dune, you catch sight of it at long last -- the wizard's palace. Double ramparts surround a central courtyard where a high black pyramid rises like a blotch of midnight. The palace lies just ahead across a stretch of brown-gold sand. The dawn light makes it seem to shimmer like a mirage in the deep blue shadows between the dunes, but you know it is real.\n\nDouble doors swing open in the wall as you approach. Confronting you is a horde of men in ragged animal skins. Their long thin faces and downcast smiles give them a canine appearance. All of them bear stone axes which they lift when you walk through the palace gate -- not a gesture of impending violence, but just to warn you where you stand.\n\n\"I have come,\" you say, \"to see Necklace of Skulls.\"\n\nOne of the men gives a bark of laughter. \"It's not as easy as that. Do you think our master sees every stray mongrel who wanders to his door? First you will have to pass five nights among us, his faithful courtiers. And before that you'll face another test: deciding which route to take to the inner courtyard.\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 315; }
+};
+
+class Story304 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story304()
+    {
+        ID = 304;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "From what your friend the old soothsayer told you, it is unwise to speak once you enter the underworld. You had better cast your spells now, while you still can.\n\n\"Allow me a moment to compose myself,\" you say to the high priest.\n\n\"It is irregular...\"\n\n\"I am about to meet a god,\" you point out.\n\nStepping away a few paces, you murmur the words of an incantation which renders your body as buoyant as wood. You gaze down into the depths of the well. At least now you can be sure of not drowning -- but if this is truly the entrance to the underworld, there will be other dangers which you cannot yet even guess at.\n\nYou turn to the assembled crowd and announce, \"I am ready.\"\n\nYou are led to a shrine at the western edge of the hole. From here, a steep flight of steps descends towards a platform covered with the hieratic glyphs of the afterlife. A vest of golden plaques is fastened across your chest and the high priest places a tall helmet of gold and copper on your head. The burden of so much metal makes you stoop. These artifacts are beyond price, since gold is not found in this part of the world. It is a lavish offering to the Rain God, but it also serves a secondary purpose: the great weight ensures you will be carried deep under the water.\n\nSeveral junior priests come forward with dishes of blue dye, which they use to paint spirals across your face and limbs. \"Thus you are consecrated to the Rain God,\" they explain. \"Go now into the other world, and carry our plea for rain to refresh the arid fields.\"";
+
+        if (Character::VERIFY_ITEMS(player, {Item::Type::JADE_BEAD}))
+        {
+            PreText += "\n\nYou slip the JADE BEAD under your tongue as advised.";
+        }
+
+        PreText += "\n\nThen you descend to the platform overlooking the well and prepare yourself for the most uncanny voyage anyone could every attempt: a leap into the underworld.";
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 411; }
+};
+
+class Story305 : public Story::Base
+{
+public:
+    Story305()
+    {
+        ID = 305;
+
+        Text = "Which of these items will you use?";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Use the MAN OF GOLD", 351, {Item::MAN_OF_GOLD}));
+        Choices.push_back(Choice::Base("... the PARCEL OF SALT", 372, {Item::PARCEL_OF_SALT}));
+        Choices.push_back(Choice::Base("... the FIREBRAND", 393, {Item::FIREBRAND}));
+        Choices.push_back(Choice::Base("Otherwise, you will have to fight", 328));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story306 : public Story::Base
+{
+public:
+    Story306()
+    {
+        ID = 306;
+
+        Text = "The MAN OF GOLD comes to life in the warmth of your hands. You set him down on the ledge and he surveys the sealed tomb with a smile on his tiny sculpted features. You have no need to tell him what you want him to do. Striding forward, he batters at the slab with thunderous blows. You are amazed to see chips of stone fly away as he gradually tunnels a hole large enough for you to squeeze through. Then, his task completed, he turns and dives off into the river below.\n\nA movement from inside the tomb makes you jump. Out of the hole slithers a cobra. It is no ordinary cobra: its hood is vastly extended to form translucent oval wings which beat slowly, carrying it through the air with a sinister gliding motion. With its iridescent scales it seems like a polished stone idol, but there is no mistaking the living menace in the glittering eyes and forked tongue.";
+
+        Image = "images/flying-snake.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Retreat back down to the canoe", 167));
+        Choices.push_back(Choice::Base("[SWORDPLAY] Close with the snake and fight it", 375, Choice::Type::SKILL_ANY, Skill::Type::SWORDPLAY, {Item::SWORD, Item::JADE_SWORD}));
+        Choices.push_back(Choice::Base("[UNARMED COMBAT]", 375, Skill::Type::UNARMED_COMBAT));
+        Choices.push_back(Choice::Base("[TARGETING] Shoot it", 352, Skill::Type::TARGETING));
+        Choices.push_back(Choice::Base("[CHARMS] Cast a protective enchantment", 394, Skill::Type::CHARMS));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::MAN_OF_GOLD});
+    }
+};
+
+class Story307 : public Story::Base
+{
+public:
+    Story307()
+    {
+        ID = 307;
+
+        Text = "A bundle lies across the path ahead. Quickening your pace, you are startled when the 'bundle' suddenly raises its head. It is a dwarf with withered legs but very broad shoulders wrapped in a long black mantle. His large ears and upturned nose give him a grotesque appearance, and you are on the point of hurrying past when he raises a long imploring arm.\n\n\"Please help me,\" he begs. \"I'm too weak to go on, and I'm terribly thirsty...\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Go back to the river to fetch him some water", 330));
+        Choices.push_back(Choice::Base("Gash your hand and let him drink some of your blood", 353));
+        Choices.push_back(Choice::Base("Step over him and continue along the path without stopping", 373));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story308 : public Story::Base
+{
+public:
+    Story308()
+    {
+        ID = 308;
+
+        Text = "You discover that King Cloud Jaguar is sitting with his courtiers in the steam bath at the rear of the palace. Leaving your clothes and belongings in a bundle behind a wall, you mingle in among the servants and pick up a jar of water. Clad in only loin-cloth, there is nothing to draw attention to you when you enter the bath-house with downcast eyes and pour water onto the sizzling stones of the hearth.\n\nThe King and the nobles of his court sit naked on the benches of the bath-house, sweltering in the wreathes of herb-scented steam. \"Will you be communing with your late father tonight, your Majesty?\" you hear one of the nobles asking.\n\n\"Of course!\" says the King gruffly. \"I must discover the import of recent events. The collapse of the Great City will have far-reaching consequences.\"\n\n\"The astrologers have read the signs,\" puts in the King's vizier. \"The most auspicious time is the hour just before dawn. We shall ascend the pyramid and speak our questions into the spirit tube which leads to King Sky Shield's tomb. Perhaps you would like to accompany us, Lord Smoke Shell?\"\n\nThe noble who spoke first looks up with sudden alarm. \"Ah... er, that's most gracious, but I need my sleep if I'm to cope with all the excitement tomorrow. I'm not as young as I once was.\"\n\n\"Nor as brave,\" says the King pointedly, provoking a gust of laughter at Smoke Shell's expense. You leave the bath-house and retrieve your belongings.\n\nYou gained the codeword PSYCHODUCT.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Seek lodging if you have some money", 101, Choice::Type::MONEY, 1));
+        Choices.push_back(Choice::Base("Continue on your journey westwards", 8));
+        Choices.push_back(Choice::Base("Continue north to the coast", 30));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_CODEWORDS(player, {Codeword::Type::PSYCHODUCT});
+    }
+};
+
+class Story309 : public Story::Base
+{
+public:
+    Story309()
+    {
+        ID = 309;
+
+        Text = "You walk along the side of the canyon in search of the dragon Kawak. The sky slowly acquires a sullen red glare like the inside of a kiln. Through the clouds of gritty yellow vapour rising out of the depths, you begin to discern a rock outcropping just ahead. Then you take a step or two closer and you realize it is not a pile of boulders that you see resting at the lip of the chasm. It is a gigantic head.\n\nKawak's snout reminds you of the temple pyramids of your homeland, with its size and bright patterning of carmine and bone-white. His mouth stands open like an ominous gateway, tongue leading up like a temple's stairway to where his eyes burn darkly under brows like shields of stone. You can see the immense curve of his body, as broad as a city plaza, arcing off into the distance towards the other side of the canyon. His claws resemble the prows of ocean-going canoes hanging over the edge of the precipice.\n\n\"You wish to cross. To enter my mouth and pass into the world beyond.\" His voice is the sound of birth and death, the dull titanic roar that is more felt than heard. \"You must pay for your passage with a JADE BEAD.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Let Kawak have the JADE BEAD", 33, Choice::Type::GIVE_ITEMS, {Item::JADE_BEAD}));
+        Choices.push_back(Choice::Base("Employ the MAN OF GOLD", 79, {Item::MAN_OF_GOLD}));
+        Choices.push_back(Choice::Base("Use a BLOWGUN", 170, {Item::BLOWGUN}));
+        Choices.push_back(Choice::Base("Try crossing via the line of stepping-stones formed by the tips of the rock spires", 147));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story310 : public Story::Base
+{
+public:
+    Story310()
+    {
+        ID = 310;
+
+        Text = "This situation reminds you unpleasantly of what the fenman told you about nightcrawlers. You find that you cannot even consider what might be hidden under the overturned pitcher without a shudder of horror. The fenman also said that salt will stop a nightcrawler from attaching itself to a victim.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::REMOVE_CODEWORD(player, Codeword::Type::CALABASH);
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::PARCEL_OF_SALT}))
+        {
+            return 34;
+        }
+        else
+        {
+            return 57;
+        }
+    }
+};
+
+class Story311 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story311()
+    {
+        ID = 311;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Type = Story::Type::NORMAL;
+
+        PreText = "You roll forward, carrying yourself and your hideous foe to the ground. It emits a gurgle of vaunting glee as it presses the stump of its neck against your shoulder, trying to drive its vampiric tendrils into your flesh and make you its willing host.";
+
+        if (!Character::VERIFY_SKILL(player, Skill::Type::CHARMS) && !Character::VERIFY_CODEWORDS(player, {Codeword::Type::SALVATION}))
+        {
+            PreText += "\n\nYou have no defence against the creature's malign magic and you are doomed to become its next victim.";
+
+            Type = Story::Type::DOOM;
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 357; }
+};
+
+class Story312 : public Story::Base
+{
+public:
+    Story312()
+    {
+        ID = 312;
+
+        Text = "You set your wand down on the ground in the middle of the crossroads and spin it, meanwhile uttering the words of a divining spell. It comes to rest pointing along the black path. That is the route you must take to reach the Deathlands.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 219; }
+};
+
+class Story313 : public Story::Base
+{
+public:
+    Story313()
+    {
+        ID = 313;
+
+        Text = "You approach the first of the sentinels. Seeing you, he leans forward on his granite throne and taps your shoulder with a sceptre carved from a human thighbone. \"Where are your manners?\" he thunders. His voice sounds like a shriek of an eagle in the instant of seizing its prey.\n\nWhat name will you greet him by?";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("'Lord Blood'", 401));
+        Choices.push_back(Choice::Base("'Thunderbolt Laughter'", 380));
+        Choices.push_back(Choice::Base("'Grandfather of Darkness'", 359));
+        Choices.push_back(Choice::Base("'Lord Skull'", 14));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story314 : public Story::Base
+{
+public:
+    Story314()
+    {
+        ID = 314;
+
+        Text = "Again you avoid the monster's bites by a hair's breadth. Spitting with fury at its failure to trap you, it slithers forward with all four necks extended.\n\nDecide your next move.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Continue to jump away from the hydra", 360));
+        Choices.push_back(Choice::Base("Rush in to strike a blow", 381));
+        Choices.push_back(Choice::Base("Try a feint", 419));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story315 : public Story::Base
+{
+public:
+    Story315()
+    {
+        ID = 315;
+
+        Text = "You are taken to the back wall of the courtyard, where colonnade gives respite from the intense sun. Beneath a frieze patterned like a rattlesnake's skin, four archways lead on from here to the next courtyard of the palace. The courtiers give you wide grins and invite you to make a choice.\n\nYou look into the first archway. A short flight of steps leads up to the edge of a pit about two metres across. The purpose of the steps is apparently to ensure that you cannot take a running jump. The bottom of the pit is filled with smoking coals.\n\nBeyond the next archway is a tunnel blocked by an artful tangle of wooden beams, some of which seem to be shoring up the walls. \"The trick there is to remove the right combination of beams in the right order,\" says the chief courtier, leaning over your shoulder. \"You want to clear enough space to get past without causing the tunnel to collapse.\"\n\nThe third route is a passage with no obstacles -- just a triangular vault leading through to the next courtyard. then you notice the sigils inscribed along the corbels of the vault: sigils indicating calamity and catastrophe. Is the vault designed to cave in when someone walks along it?\n\nThe passage beyond the last archway is guarded by a large pallid hound with narrow pink eyes. It greets you with a threatening growl as you poke your head around the corner, but makes no move to attack. \"My second cousin twice removed,\" says the chief courtier in your ear. \"Nasty temper. His bite's worse than his bark, of course.\"\n\nIt is time for you to decide.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Cross the pit", 338));
+        Choices.push_back(Choice::Base("Attempt to clear the blocked tunnel", 361));
+        Choices.push_back(Choice::Base("Walk along the unguarded tunnel", 382));
+        Choices.push_back(Choice::Base("Brave the albino hound", 420));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story316 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story316()
+    {
+        ID = 316;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "Your dart tears into the hound's flank, leaving a raw bloody gash. It whines and shrinks back, only to leap forward without warning when you move to get past it along the tunnel. You feel a stab of pain as its teeth tear a hunk of flesh out of your thigh, but you stagger on regardless.\n\nYou LOSE 1 Life Point.";
+
+        Character::GAIN_LIFE(player, -1);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nYou emerge into the inner courtyard to find the courtiers already there waiting for you. \"You're a blowgunner, eh?\" says the chief courtier. \"Well, I'm afraid you'll find the creatures who serve Necklace of Skulls are less easy to intimidate than your average deer.\"";
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 431; }
+};
+
+class Story317 : public Story::Base
+{
+public:
+    Story317()
+    {
+        ID = 317;
+
+        Text = "You squint in the shimmering glare of the sun, but your eyes cannot make out any shape within the black void of the shrine entrance. The soot-coloured pillars give its darkened interior the look of a fleshless mouth. Again Necklace of Skull's voice rolls along the avenue, each syllable driving like a grave-cool gust of wind through the blistering desert heat. \"Your brother came here before you.\"\n\nRed rage seethes in your heart. \"That's right, you --\"\n\nThe sorcerer's words continue, unperturbed by your outburst. \"He played the ritual ball contest and he lost. His life was forfeit. Now you will play for the same stakes. Behold your antagonists.\" Two long rivulets of shadow flow out of the shrine and down the pyramid steps, looking like spreading pools of black blood against the ebon stone. Reaching the bottom, they rise up in obscenely palpitating columns which gradually take solid form. Human form. Confronting you now are your opponents in the ball contest: two creatures of living shadow fashioned by the sorcerer's magic.\n\nThe ritual ball contest has started.";
+
+        Image = "images/ballgame-arena.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::BROTHERS_SKULL}))
+        {
+            return 340;
+        }
+        else if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::ANGEL}))
+        {
+            return 363;
+        }
+        else
+        {
+            return 384;
+        }
+    }
+};
+
+class Story318 : public Story::Base
+{
+public:
+    Story318()
+    {
+        ID = 318;
+
+        Text = "You bear down on the enemy defensive player. Glancing back you see that the far shadow man has reached the far end of the arena, where your partner has managed to intercept the ball and get possession. You shout for him to bounce it along the wall towards you.";
+
+        Image = "images/filler1.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::SHADE}))
+        {
+            return 385;
+        }
+        else
+        {
+            return 405;
+        }
+    }
+};
+
+class Story319 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story319()
+    {
+        ID = 319;
+
+        Image = "images/filler1.png";
+
+        Bye = "In the morning, you stumble gratefully out into the hot sunshine.";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You manage to get the firebrand alight. It gives a little warmth, but not much. You spend a miserable night shivering in the icy draughts blowing through the House of Cold.";
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL(player, Skill::Type::WILDERNESS_LORE))
+        {
+            PreText += "[WILDERNESS LORE] Your natural toughness sustains you.";
+        }
+        else
+        {
+            PreText += "You LOSE 1 Life Point.";
+
+            Character::GAIN_LIFE(player, -1);
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 202; }
+};
+
+class Story320 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story320()
+    {
+        ID = 320;
+
+        Image = "images/pirates.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "The pirates' vessel bumps against yours and they come swarming over the side like ants. You cannot understand their yammering war-cries, for they are not of your people but come from a land beyond the northern sea. Their white-rimmed eyes hold a look that means the same in any language, though. It is the look of fury and hate.\n\nYou fight with desperate strength knowing that you are fighting not just for your own life but also for the trader and his young sons.";
+
+        auto DAMAGE = -9;
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL_ANY_ITEMS(player, Skill::Type::SWORDPLAY, {Item::Type::SWORD, Item::Type::JADE_SWORD}))
+        {
+            DAMAGE = -3;
+
+            PreText += "[SWORDPLAY] ";
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::UNARMED_COMBAT))
+        {
+            PreText += "[UNARMED COMBAT] ";
+
+            DAMAGE = -5;
+        }
+
+        PreText += "You LOSE " + std::to_string(-DAMAGE) + " Life Points.";
+
+        Character::GAIN_LIFE(player, DAMAGE);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nYou finally force the pirates to retreat to their own vessel and sail off.";
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 343; }
+};
+
+class Story321 : public Story::Base
+{
+public:
+    Story321()
+    {
+        ID = 321;
+
+        Text = "Shakalla is a walled town whose hard sun-baked streets are the colour of hot ash. At this time of day, the place is deserted. Those who have not fled in fear have retreated to the cool interiors of their houses, seeking refuge from the midday sun. You see a few faces peering from the narrow doorways as you go past. A dog lies stretched in the shade of a shop's awning, panting with the heat.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Enter the shop", 344));
+        Choices.push_back(Choice::Base("Carry on to the west gate of the town", 325));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story322 : public Story::Base
+{
+public:
+    Story322()
+    {
+        ID = 322;
+
+        Text = "You become weaker and weaker. Finally you collapse and lie stretched out on the hard sun-blistered ground, too weak to rise. You feel like one who has been chosen for sacrifice to the gods, spread-eagled and helpless. Your eyes are stinging. You stare up at the sky, which first blackens until it is like ink, then explodes in a hazy burst of light. Now you are weightless, dropping down an endless tunnel that leads into the bowels of the earth...\n\nAnd so you die, far out in the cruel desert with only the vultures to witness your last agonized moments. Perhaps you will be reunited with your brother in the afterlife -- but only the gods can say.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story323 : public Story::Base
+{
+public:
+    Story323()
+    {
+        ID = 323;
+
+        Text = "\"A generous donation.\" The high priest puts the money into his belt-pouch. \"I shall see that a ritual of benediction is performed for you at the temple tomorrow morning. You will carry the blessing of the god.\"\n\nThe blessing of the War God means that you can ignore any one injury taken at any point of your choice during the adventure. Remember that it only works once.\n\n\"How about a spot of ball practice?\" suggests the high priest.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Join him for a practice bout in the arena", 368));
+        Choices.push_back(Choice::Base("You had better get on with the rest of your preparations for the journey", 93));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.IsBlessed = true;
+    }
+};
+
+class Story324 : public Story::Base
+{
+public:
+    Story324()
+    {
+        ID = 324;
+
+        Text = "You gaze around. All directions present you with the same vista: trees stand like stone sentinels draped in moss-coloured gloom. Great nets of creepers are strung between their heavy boughs. There are not even any sounds of wildlife to disturb the hoary solitude of the ancient woods. You are thoroughly lost.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Continue", 118));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        if (player.Life < player.MAX_LIFE_LIMIT)
+        {
+            if (Character::VERIFY_SKILL(player, Skill::Type::WILDERNESS_LORE))
+            {
+                Choices[0].Destination = 72;
+            }
+            else
+            {
+                Choices[0].Destination = 95;
+            }
+        }
+        else
+        {
+            Choices[0].Destination = 118;
+        }
+    }
+};
+
+class Story325 : public Story::Base
+{
+public:
+    Story325()
+    {
+        ID = 325;
+
+        Text = "A low tunnel in the wall around the town forms the west gate. Crouching as you make your way along the tunnel, you notice rough scrawlings in the stone. One shows a man with the tail and claws of a scorpion: another is a four-headed dragon.\n\nTwo guards armed with spear stand at the far end of the tunnel, staring nervously out across the desert. As they hear you come up, they glance at you and one says, \"Here's a traveller who isn't afraid to take the Gate of Exiles!\"\n\nBeyond, in the bright sunshine, lies the desert you must cross. The bleak stony landscape of crags and dusty gullies stretches off into a haze of heat along the horizon. A path leads from the gate, but it peters out beside a large boulder ten paces away.";
+
+        Image = "images/gate-of-exiles.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Question the guards about the markings on the tunnel walls", 367));
+        Choices.push_back(Choice::Base("... or the nearby boulder", 388));
+        Choices.push_back(Choice::Base("Set out in the desert", 407));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story326 : public Story::Base
+{
+public:
+    Story326()
+    {
+        ID = 326;
+
+        Text = "You follow a game trail that forks beside a high moss-caked boulder. Sunlight slants down through chinks in the foliage, teasing you with inadequate clues as to your bearing.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Go left", 412));
+        Choices.push_back(Choice::Base("Take the right-hand fork", 348));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story327 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story327()
+    {
+        ID = 327;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[SPELLS]", 411, Choice::Type::SKILL_ANY, Skill::Type::SPELLS, {Item::MAGIC_WAND, Item::JADE_SWORD}));
+        Choices.push_back(Choice::Base("[CHARMS]", 189, Skill::Type::CHARMS));
+        Choices.push_back(Choice::Base("[CUNNING]", 371, Skill::Type::CUNNING));
+        Choices.push_back(Choice::Base("[SEAFARING]", 392, Skill::Type::SEAFARING));
+        Choices.push_back(Choice::Base("Use a BLOWGUN", 5, {Item::BLOWGUN}));
+        Choices.push_back(Choice::Base("Otherwise", 28));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You are led to a shrine at the western edge of the hole. From here, a steep flight of steps descends towards a platform covered with the hieratic glyphs of the afterlife. You will soon walk down those steps and, after reaching the platform, plunge far down into the dark waters below.\n\nA vest of golden plaques is fastened across your chest and the high priest places a tall helmet of gold and copper on your head. The burden of so much metal makes you stoop. These artifacts are beyond price since gold is not found in this part of the world. It is a lavish offering to the Rain God, but it also serves a secondary purpose: the great weight ensures you will be carried deep under the water.\n\nSeveral junior priests come forward with dishes of blue dye, which they use to paint spirals across your face and limbs. \"Thus you are consecrated to the Rain God,\" they explain. \"Go now into the other world, and carry our plea for rain to refresh the arid fields!\"";
+
+        if (Character::VERIFY_ITEMS(player, {Item::Type::JADE_BEAD}))
+        {
+            PreText += "\n\nYou remember to slip the JADE BEAD under your tongue as advised.";
+        }
+
+        PreText += "\n\nThen you descend to the platform overlooking the well and prepare yourself for the most uncanny voyage anyone could ever attempt: a leap into the underworld.";
+
+        Text = PreText.c_str();
+    }
+};
+
+class Story328 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story328()
+    {
+        ID = 328;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Type = Story::Type::NORMAL;
+
+        PreText = "You cannot suppress a scream as their wet stubby fingers clutch at you. It is like a scene from your worst nightmares. Striking out blindly, you stumble along the tunnel. You feel their shells crack under your frantic blows, but then a slimy hand presses over your face and you reel under a hail of punches. Ichor spurts into your eyes as you drive a deep blow hard into your eyes as you drive a deep blow hard into one of the creatures, and its eerie keening wail evokes a feeling of unendurable horror.";
+
+        auto DAMAGE = 0;
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL_ANY_ITEMS(player, Skill::Type::SWORDPLAY, {Item::Type::SWORD, Item::Type::JADE_SWORD}))
+        {
+            DAMAGE = -3;
+
+            PreText += "[SWORDPLAY] ";
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::UNARMED_COMBAT))
+        {
+            PreText += "[UNARMED COMBAT] ";
+
+            DAMAGE = -4;
+        }
+        else
+        {
+            PreText += "There is nothing you can do to prevent yourself being overwhelmed and slain.";
+
+            Type = Story::Type::DOOM;
+        }
+
+        if (DAMAGE != 0)
+        {
+            PreText += "You LOSE " + std::to_string(-DAMAGE) + " Life Points.";
+        }
+
+        Character::GAIN_LIFE(player, DAMAGE);
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 258; }
+};
+
+class Story329 : public Story::Base
+{
+public:
+    Story329()
+    {
+        ID = 329;
+
+        Text = "You were optimistic. It takes you nearly two hours to smash a hole large enough to squeeze through. As you stand on the ledge, panting with exhaustion and with sweat pouring off your body, there is a movement from inside the tomb.\n\nOut of the hole slithers a flying cobra. Its hood is vastly extended to form translucent oval wings which beat slowly, carrying the snake forward through the air with venatic precision. Its iridescent scales and hood make it seem like a polished stone effigy, but there is no mistaking the living menace in its glittering golden eyes and flickering forked tongue.\n\nAfter the hours spent pounding away at the slab, your shoulders are aching and you can barely lift your arms. There is no way you could climb back down to the canoe right now. The cobra swoops higher, arching its head as it hovers just above you. You must think of something quickly, or you will fall prey to its lethal bite.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[CHARMS] Cast a protective enchantment", 394, Skill::Type::CHARMS));
+        Choices.push_back(Choice::Base("[UNARMED COMBAT]", 191, Skill::Type::UNARMED_COMBAT));
+        Choices.push_back(Choice::Base("Use the MAN OF GOLD", 413, {Item::MAN_OF_GOLD}));
+        Choices.push_back(Choice::Base("Otherwise", 145));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story330 : public Story::Base
+{
+public:
+    Story330()
+    {
+        ID = 330;
+
+        Text = "By the time you return with a little of the river water cupped in your hands, the strange dwarfish man has disappeared. Presumably he has crawled off into the reeds. You scan the bleak landscape, straining your ears for the sound of someone sloshing through the wet mud, but to no avail. He looked so weak that he could not get far, but you are not keen to go wading off the path in search of him. At least you know that you tried to help.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 373; }
+};
+
+class Story331 : public Story::Base
+{
+public:
+    Story331()
+    {
+        ID = 331;
+
+        Text = "You can go to speak with the dead king's spirit tonight or you can rest here and decide what to do the next morning.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Go and talk to the Dead King's Spirit tonight", 218));
+        Choices.push_back(Choice::Base("Go west towards Ashaka", 8, Choice::Type::LIFE, 1));
+        Choices.push_back(Choice::Base("Go north to the coast", 30, Choice::Type::LIFE, 1));
+        Choices.push_back(Choice::Base("Stay in Nachan for the festival", 416, Choice::Type::LIFE, 1));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story332 : public Story::Base
+{
+public:
+    Story332()
+    {
+        ID = 332;
+
+        Text = "\"I notice you suffer from a bad back,\" you say to the fenman. \"May I ask why you don't rig a sail on your boat to save yourself the effort of rowing?\"\n\n\"Do you know nothing about boats?\" he grumbles as he picks up another heavy pot. \"A vessel made of reeds is to flimsy to support the weight of a mast.\"\n\n\"Use a double mast, so that the sail straddles the boat,\" you suggest. \"This would distribute the load more evenly. Also, why not treat the reeds with oil, which would make the hull more watertight?\"\n\n\"With the price of oil today?\" he cries incredulously. \"Reeds cost next to nothing.\"\n\n\"Ah, but think of the time it takes you to make a new boat for each river trip. A hull treated with oil would soon repay the initial cost.\"\n\nHe stops what he is doing and looks at you with new interest. \"Anything else?\" he asks.\n\n\"Yes. I see you are loading empty pots aboard your boat, presumably for sale downriver. Mead is plentiful in Nachan but not in the fens, so why not fill the pots with mead? It would take up no more space, but your profits would be enlarged by at least one fifth.\"\n\n\"A fine idea,\" he admits, \"but the pots are heavy enough for my poor back already.\"\n\n\"Exactly why you need a passenger who's willing to chip in a help,\" you answer in a trice. Convinced you are worth having along, he agrees to take you downriver for free..";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 355; };
+};
+
+class Story333 : public Story::Base
+{
+public:
+    Story333()
+    {
+        ID = 333;
+
+        Text = "Lifting the pitcher, you are horrified to see a second head on the woman's shoulder. It has a long lank hair, white skin and ghastly black lips. As you stifle a gasp of horror, its eyes snap open and it gives a chilling screech. The woman's arms lash out like a sleepwalker's dashing you backwards with astonishing strength.\n\nYou LOSE 1 Life Point.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GAIN_LIFE(player, -1);
+    }
+
+    int Continue(Character::Base &player) { return 104; };
+};
+
+class Story334 : public Story::Base
+{
+public:
+    Story334()
+    {
+        ID = 334;
+
+        Text = "The monster is impervious to your blows. More strands of long black hair wrap themselves around you. It is like fighting an octopus. You can do nothing to prevent it dragging itself closer until finally its jaws close on your windpipe. You feel yourself weakening, and then there is a crunching of cartilage and a pink spray of blood. Your blood.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story335 : public Story::Base
+{
+public:
+    Story335()
+    {
+        ID = 335;
+
+        Text = "\"You seek to enter the underworld,\" says the spirit. \"The way will not be easy. But I perceive your cause to be honourable, so I shall aid you.\"\n\nYou do not dare to answer. He goes on: \"You must place a JADE BEAD under your tongue and keep it there until you reach the four paths, not speaking whatever the temptation. Once you are at the four paths, you may remove the bead from your mouth but you should retain it until you see a kapok tree. Before any of this you must cross Death Canyon, however. If you have no other option, seek the dragon Kawak who lies across the canyon with one of his two heads on either side. Others have passed through his jaws and emerged at the far end, and if you are dauntless you may be able to do this too.\"\n\nThere is deep silence after he finishes speaking. You wait with lowered gaze. It is not seemly to look upon even a living king unless invited to. Suddenly there is a flash and an immediate peal of thunder, followed by a deluge of heavy tropical rain.\n\nYou look up. King Sky Shield and the phantom snake have vanished, but the shrine is not as it was before. Now a pit has opened in the floor, revealing stairs down into the pyramid. It is your route to the underworld.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Venture down the steps", 9));
+        Choices.push_back(Choice::Base("Leave the shrine and wait until morning to resume your journey overland to Ashaka", 8));
+        Choices.push_back(Choice::Base("Go downriver to the coast", 30));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story336 : public Story::Base
+{
+public:
+    Story336()
+    {
+        ID = 336;
+
+        Text = "You reach the end of the tunnel and emerge into the open under a bright blue sky. The sun of the upper world blazes high in the heavens -- a welcome change from the grey glare permeating the Deathlands, although you know that too long an exposure to its blistering rays may eventually leave you weak with thirst. Waves of heat rise around you off the baking sands of the great desert. Dunes stretch like the tops of clouds as far as the eye can see.\n\nNear by, you see various items poking up out of the sand. They may be the grave goods of spirits who descended here to the Deathlands. A closer inspection uncovers a SWORD, a WATERSKIN, and a copper-tipped SPEAR.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Take = {Item::WATERSKIN, Item::SWORD, Item::SPEAR};
+
+        Limit = 3;
+    }
+
+    int Continue(Character::Base &player) { return 152; }
+};
+
+class Story337 : public Story::Base
+{
+public:
+    Story337()
+    {
+        ID = 337;
+
+        Choices.clear();
+    }
+
+    int Background(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::SPEAR}))
+        {
+            return 429;
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::AGILITY))
+        {
+            return 222;
+        }
+        else
+        {
+            return 402;
+        }
+    }
+};
+
+class Story338 : public Story::Base
+{
+public:
+    Story338()
+    {
+        ID = 338;
+
+        Text = "You step up to the edge of the pit. The smoke rising off the coals at the bottom is thick and choking. You can feel the waves of heat simmering up on the still air. The pit is not deep, but even so you would not relish falling in!";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[AGILITY]", 16, Skill::Type::AGILITY));
+        Choices.push_back(Choice::Base("Use a BLOWGUN", 39, Choice::Type::LOSE_ITEMS, {Item::BLOWGUN}));
+        Choices.push_back(Choice::Base("... or a SPEAR", 39, Choice::Type::LOSE_ITEMS, {Item::SPEAR}));
+        Choices.push_back(Choice::Base("Otherwise", 63));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story339 : public Story::Base
+{
+public:
+    Story339()
+    {
+        ID = 339;
+
+        Text = "You find yourself in a narrow chamber. The air of the tomb is thick with the smell of old incense. In the faint light shining in from outside, you see an upright sarcophagus set against the far wall. Stylized features moulded into the sarcophagus lid suggest a woman in the raiment of a priestess. Then you notice that in her arms she carries two newborn children.\n\nCuriosity gets the better of you. Dislodging the lid, you strain with all your strength and finally succeed in dragging it open. For an instant the face of a beautiful woman stares out at you, and you give a startled cry. She has two little children in her arms. All three seem only asleep, but then the air you have allowed into the sarcophagus unlocks the closed gates of time. The bodies cave in and crumble to dust in front of your eyes.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Loot the contents of the sarcophagus", 427));
+        Choices.push_back(Choice::Base("You had better climb back down to the canoe before the two demons get fed up with waiting", 167));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story340 : public Story::Base
+{
+public:
+    Story340()
+    {
+        ID = 340;
+
+        Text = "Decide what to do next";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Use the GOLD DIADEM", 404, {Item::GOLD_DIADEM}));
+        Choices.push_back(Choice::Base("... or the CHALICE OF LIFE", 422, {Item::CHALICE_OF_LIFE}));
+        Choices.push_back(Choice::Base("[SPELLS] ... or a WAND", 18, Choice::Type::SKILL_ANY, Skill::Type::SPELLS, {Item::MAGIC_WAND, Item::JADE_SWORD}));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Background(Character::Base &player)
+    {
+        if (!Character::VERIFY_ITEMS(player, {Item::Type::GOLD_DIADEM}) && !Character::VERIFY_ITEMS(player, {Item::Type::CHALICE_OF_LIFE}) && !Character::VERIFY_SKILL_ANY_ITEMS(player, Skill::Type::SPELLS, {Item::Type::SWORD, Item::Type::JADE_SWORD}))
+        {
+            if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::ANGEL}))
+            {
+                return 363;
+            }
+            else
+            {
+                return 384;
+            }
+        }
+        else
+        {
+            return -1;
+        }
+    }
+};
+
+class Story341 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story341()
+    {
+        ID = 341;
+
+        Image = "images/filler1.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+
+        PreText = "Without warning, the shadow creature suddenly stops dead and throws his leg out to trip you. You are taken by surprise, since no human opponent could act so fast.";
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL(player, Skill::Type::AGILITY))
+        {
+            PreText += "[AGILITY] You jump over his leg and whirl around, managing to block his attempt at scoring.";
+        }
+        else
+        {
+            PreText += "He deflects the ball into the low-score zone.";
+
+            Character::SCORE(player, player.Cross, 1);
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 66; }
+};
+
+class Story342 : public Story::Base
+{
+public:
+    Story342()
+    {
+        ID = 342;
+
+        Text = "You have defeated the sorcerer. His monstrous body topples onto the steps of his black pyramid and begins to seethe with putrid vapours. With the magic that sustained him unnaturally throughout the centuries now broken, Necklace of Skulls decomposes into dank grey dust.\n\nThe walls of the palace begin to stir. You can feel the ground trembling underfoot. You hurry back through the courtyard and out of the gates. After a dozen pace you cannot resist the urge to look back. The pyramid and surrounding buildings are sinking into the sand. In minutes they have vanished entirely, and there is no sign to show that this was the spot where Necklace of Skulls once dwelt among his bestial courtiers. You look around for the courtiers, but see only a pack of malnourished dogs slinking off amid the dunes.\n\nIt is over. You turn your face to the east. You have a long journey back to civilization. If only you had been able to save your brother...\n\nYou dismiss such thoughts with a shrug. It is too late for regrets. At least you avenged Morning Star's death and rid the world of an evil monster.\n\nOne of the dogs gives a howl. You look round, into the glowering darkness along the western horizon that marks the boundary of the Deathlands. That is where your brother is now.\n\nYou look east, then west again. Civilization -- or further adventure? Only you can decide which way your destiny beckons. This quest is ended, but perhaps further adventures still await you? The only limit is your own imagination.";
+
+        Music = "music/victory.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+
+        Type = Story::Type::GOOD;
+    }
+};
+
+class Story343 : public Story::Base
+{
+public:
+    Story343()
+    {
+        ID = 343;
+
+        Text = "You sail on until the sight of circling gulls tells you that land is near. You know that it cannot be mainland. As a green swathe of foliage appears in the distance you realize you have found the fabled Isle of the Iguana.\n\nGetting closer, you find a coast of high cliffs which the sea has pounded into fanciful shapes. You sail under an arch of white rock and around a headland that reminds you of a serpent's mouth, arriving at last at a stretch of pebble-strewn beach.\n\n\"We must be virtually due east of Tahil,\" you announce. \"Certainly by sailing with the rising sun at our back we'd soon reach the mainland.\" But even as you are saying this, your eyes are scanning the shore with avid curiosity.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Put in at the island", 366));
+        Choices.push_back(Choice::Base("Sail on to Tahil", 300));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story344 : public Story::Base
+{
+public:
+    Story344()
+    {
+        ID = 344;
+
+        Text = "Cool shade embraces you as you step into the shop's interior. Your eyes adjust to the darkness. You call for service. A man rouses himself from his siesta and comes forward, blinking sleepily at you where you stand in the sunlit doorway as though you were a spirit that had emerged from the afterlife.\n\n\"I am journeying into the desert,\" you announce, to his obvious amazement. \"I'll need supplies.\"\n\nHe shows you the few items he has for sale in this impoverished town.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Shop = {
+            {Item::WATERSKIN, 4},
+            {Item::MAGIC_WAND, 16},
+            {Item::FLINT_KNIFE, 1},
+            {Item::BLOWGUN, 3},
+            {Item::BLANKET, 2}};
+
+        Controls = Story::Controls::SHOP;
+    }
+
+    int Continue(Character::Base &player) { return 325; }
+};
+
+class Story345 : public Story::Base
+{
+public:
+    Story345()
+    {
+        ID = 345;
+
+        Text = "The invisible demons of the desert are known to harness whirlwinds, which they ride pell-mell across the sand. It is said that on nights of the full moon they can even be seen crouched atop their captive whirlwinds -- translucent unhuman figures with their faces raised shrieking to the sky.\n\nThe moon is not full tonight, and you are glad. You have no wish to see these monsters. Your only desire is to get rid of them, and to do that you must exploit their one weakness: once in full pursuit of a victim, they cannot veer quickly off a straight line.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 137; }
+};
+
+class Story346 : public Story::Base
+{
+public:
+    Story346()
+    {
+        ID = 346;
+
+        Text = "The high priest looks disappointed, but seems to understand when you explain that you have barely enough to purchase the supplies you will need for the journey.\n\n\"A coil of ROPE might not be a bad idea,\" he suggests. \"I've often found the ROPE to come in handy. Oh, and a decent SWORD of course -- assuming you know how to use one.\" He juggles the heavy rubber ball he's carrying from one hand to the other. \"What about a practice session in the arena before you head off?\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Practice the ball contest with him", 368));
+        Choices.push_back(Choice::Base("Get on with preparations for your journey", 93));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story347 : public Story::Base
+{
+public:
+    Story347()
+    {
+        ID = 347;
+
+        Text = "No sooner have you released your tight grip on the SHAWL than it is snatched away. There is a whispered cry of exultation from all around. You have your only clear view of the stabaie as they shoot off into the distance like flickers of silent lightning, to be swallowed up by the gloom of the forest within moments. Silence fills the glade, and you realize you are alone in the heart of the wood.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::SHAWL});
+    }
+
+    int Continue(Character::Base &player) { return 324; }
+};
+
+class Story348 : public Story::Base
+{
+public:
+    Story348()
+    {
+        ID = 348;
+
+        Text = "You come to a huge buttress which at first you mistake for a cliff. Only when you get closer do you see what it truly is, and the realization draws a gasp from your lips: \"A tree!\" A tree whose trunk is as thick and solid as a temple-pyramid. You look up. You cannot see the upper branches. It stretches right through the forest canopy, dwarfing even the biggest trees, seeming to reach right up through the clouds.\n\nYou know what it is. It can only be the World Tree, which according to fable supports the heavens. Awestruck, you reach out and touch it, discovering that the bark is tingling. It is alive with the rhythms of life throughout the world.\n\nYou rest under the World Tree for a while. It fills you with a sense of joy to be so close to the roots of all existence, stronger and more confident than before. Now there is no peril that seems too daunting for you to face.\n\nYour Life Points are restored.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.Life = player.MAX_LIFE_LIMIT;
+    }
+
+    int Continue(Character::Base &player) { return 412; }
+};
+
+class Story349 : public Story::Base
+{
+public:
+    Story349()
+    {
+        ID = 349;
+
+        Text = "Lord Skull rocks his bulbous head and gives a groan of distress at being greeted incorrectly. Etiquette is obviously very important to these demons, because he also clouts you hard across the eyes as punishment. You reel back stunned, waiting for your vision to clear. It does so only partially: you can still sea, but not so clearly as before.\n\nYou retreat sullenly out of the sentinel's presence. The curse he has laid on you makes no difference. You have sworn to avenge your brother, and nothing short of death will stop you.\n\nYou can no longer use the [TARGETING] skill.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_SKILLS(player, {Skill::Type::TARGETING});
+
+        Character::REMOVE_CODEWORD(player, Codeword::Type::POKTAPOK);
+    }
+
+    int Continue(Character::Base &player) { return 336; }
+};
+
+class Story350 : public Story::Base
+{
+public:
+    Story350()
+    {
+        ID = 350;
+
+        Text = "You get your first glimpse of Yashuna on the afternoon of the following day. Like Koba, the tall temple pyramids of the city are visible for miles across the rolling countryside. As you approach the poorer dwellings at the outskirts of the city, you notice a large number of people milling towards the raised central complex which houses the temples and the palaces of the rich.\n\nIt seems to be market day.";
+
+        Image = "images/yashuna.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Pay a visit to the market", 142));
+        Choices.push_back(Choice::Base("Head north out of the city", 120));
+        Choices.push_back(Choice::Base("Take the southern road towards the forest", 165));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story351 : public Story::Base
+{
+public:
+    Story351()
+    {
+        ID = 351;
+
+        Text = "The MAN OF GOLD comes to life in your hands and jumps down to the ground. You have no need to explain your needs -- after one glance at the small-creatures, the little golden manikin leaps to the attack. His sharp blows crack their shells with ease and soon a path is cleared along the tunnel for you to dash back to the waiting canoe.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::MAN_OF_GOLD});
+    }
+
+    int Continue(Character::Base &player) { return 258; }
+};
+
+class Story352 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story352()
+    {
+        ID = 352;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You drop low as the cobra comes sailing through the air. It passes over your head, jaw snapping just inches from your flesh. Instinct warns you that the slightest scratch from those long curved fangs would spell your death. You pivot on your heel as the cobra swings gracefully to hover out off the ledge, readying itself for another attack.\n\nA single short puff sends a lethal dart deep into the cobra's head. You watch it drop into the river below. The demons in the canoe, seeing it fall, nod up at you with witless grins of encouragement.";
+
+        if (Character::VERIFY_ITEMS(player, {Item::Type::JADE_BEAD}))
+        {
+            PreText += "\n\nYou realize that you have lost the JADE BEAD. You check the BLOWGUN but it is not there. You must have blown it out along with the dart!";
+
+            Character::LOSE_ITEMS(player, {Item::Type::JADE_BEAD});
+        }
+
+        PreText += "\n\nThe tomb yawns open beside you. Having so nearly died at the fangs of its guardian, you decide you might as well take a look inside. Perhaps there will be some treasures worth taking.";
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 339; }
+};
+
+class Story353 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story353()
+    {
+        ID = 353;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "He opens a vein in the back of your hand using his long sharp fingernails, then laps eagerly at the blood. His tongue is rough and rasping at first, but soon the discomfort and the stinging of the wound begin to fade. You guess that there is something in his saliva that has a numbing effect.\n\nYou LOSE 1 Life Point.";
+
+        Character::GAIN_LIFE(player, -1);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nThe dwarf wipes his mouth fastidiously and gets to his feet. Once he is standing up he looks even more peculiar. Because of his stunted legs, his arms trail right down to the ground. \"You are most charitable,\" he says, grinning to reveal a snagged array of sharp little teeth. \"Rest assured that I'm not one to forget my obligations. Until we meet again, farewell!\"\n\nSo saying, he spreads his arms wide and executes a remarkable leap that carries him right over your head. His cloak flutters like a sail in the wind. Whirling around, you seen no sign of him in any direction. When you gaze up, there is just a distant black shape flying off into the grey sky.\n\nYou gained the codeword ZOTZ.";
+
+            Character::GET_CODEWORDS(player, {Codeword::Type::ZOTZ});
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 373; }
+};
+
+class Story354 : public Story::Base
+{
+public:
+    Story354()
+    {
+        ID = 354;
+
+        Text = "The wall around the royal precinct is constructed of closely fitted blocks of smooth limestone. The builders even bowed it out slightly to make it more difficult to climb. You loiter casually at a corner until there is no one in sight, then brace yourself around the bend in the wall and pull yourself up.\n\nThe top of the wall tapers to a wedge which is rimmed with spikes of sharp obsidian, provoking a grin of admiration from you for the ingenuity of the royal architects. But none of these measures is enough to deter you. Swinging into a cartwheel, you vault over the top of the wall without touching the razor-edge of obsidian, dropping lightly to your feet on the other side.\n\nA glance towards the gate confirms that the guards heard nothing: they are still gazing stolidly into the street outside. You slink away in the twilight and climb the steps of the pyramid.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 415; }
+};
+
+class Story355 : public Story::Base
+{
+public:
+    Story355()
+    {
+        ID = 355;
+
+        Text = "You spend a couple of pleasant days on the river, with nothing to do but watch the green banks slide past while you trail your fingers in the water and swap stories with the fenman. Like most people who travel widely, he has a fund of folktales with which to regale you.\n\n\"I have enjoyed having you along,\" he says as he ties up his boat at a village, \"but now we have arrived at my home. The coast is only a few days' walk -- just follow the road which leads along the riverbank, and may the God of the Pole Star guide you safely on your quest.\"\n\n\"Thank you,\" you reply, \"and may the God of the River see that you find good fortune in your business.\"\n\nYou have gone only a short distance when he calls out after you. \"Incidentally I should warn you that the fens are infested with nightcrawlers. I take it you know how to deal with such creatures?\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[FOLKLORE] Assure him that you are wise to such magical menaces", 264, Skill::Type::FOLKLORE));
+        Choices.push_back(Choice::Base("Perhaps you had better ask him to explain further", 172));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story356 : public Story::Base
+{
+public:
+    Story356()
+    {
+        ID = 356;
+
+        Text = "You walk on until overtaken by nightfall and exhaustion. Sitting down under the spreading foliage of a calabash tree, you consider looking for a more comfortable place to spend the night. You have passed a few peasant huts among the canals lining your route, but at the moment you cannot see any glimmers of lamplight to indicate habitation. Since it is a warm and sultry night, you decide to sleep out in the open.\n\nYou are woken by something heavy falling on your shoulder. It is pitch dark. Your heart is thudding, your nerves taught with unreasoning fear. You hear a slurping sound and turn your head. A horrible inhuman face is pressed up close to yours. Its lips are slick with your blood, but that is not the worst of it. You see that the monstrous head is sprouting from your own shoulder, and then you start to scream.\n\nYour adventure has come to a grisly end.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story357 : public Story::Base
+{
+public:
+    Story357()
+    {
+        ID = 357;
+
+        Text = "The head is unable to take control of you. Repulsed, it falls back with a snarl of icy rage. The enmeshing strands of hair go slack, but at best you have only a moment's respite before it resumes its attack.";
+
+        Image = "images/flying-head.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Strike it with your fist", 334));
+        Choices.push_back(Choice::Base("Dash it against the trunk of the nearest tree", 378));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story358 : public Story::Base
+{
+public:
+    Story358()
+    {
+        ID = 358;
+
+        Text = "A knot unties itself and one of the gates swing open. No sooner have you gone through than it closes behind you. You proceed along a short tunnel to a chamber which is open on the far side, giving onto a ledge overlooking a river of foaming blood. You step out onto the ledge and look downriver. There is another ledge corresponding to the other doorway, and there you see the feather-robed noble who got here before you.\n\nHe points to two obsidian beams spanning the river to the far bank. At first you think they are bridges, but then you notice the shape. They are wedge-shaped, coming to a sharp edge on the upper surface. \"It would be difficult to keep one's balance on that,\" you call out to him.\n\n\"That isn't the intention,\" says the noble. He holds up a POLE with a hook on the end. \"I found this here on the ledge. Notice that there is a similar POLE next to you.\"\n\nYou glance down. A POLE like the one the noble is holding rests against the wall, and you pick it up.\n\n\"You have a plan?\" you ask him.\n\nHe nods. \"If we extend our arms, we'll be able to hook the poles together. Then, leaning away from each other with our feet on the sloping outer surfaces of the obsidian beams, we'll be able to cross together.\"\n\nThe plan is ingenious. You agree to put it to the test, and by this means you are both able to get across the river of the blood to the far bank.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Take = {Item::POLE};
+
+        Limit = 1;
+    }
+
+    int Continue(Character::Base &player) { return 399; }
+};
+
+class Story359 : public Story::Base
+{
+public:
+    Story359()
+    {
+        ID = 359;
+
+        Text = "He listens to your greeting and gives a curt regal nod before waving you on towards the next sentinel. This one rubs his jaw as he looks at you. Then you notice with a shudder that his lower jaw is a bare of skin -- just a raw glistening mass of sinew and tendon. His eyes are like the gulf of stars on a cloudless night. How will you address him?";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Address him as 'Thunderbolt Laughter'", 37));
+        Choices.push_back(Choice::Base("... as 'Lord Blood'", 61));
+        Choices.push_back(Choice::Base("... as 'Lord Skull'", 107));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story360 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story360()
+    {
+        ID = 360;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You reach the slope of the dune and stumble as you try to retreat up it. The hydra's nearest head gives a triumphant hiss and lances down towards you as you lie helpless.";
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL(player, Skill::Type::CHARMS))
+        {
+            PreText += "You are lucky enough to have got a handful of sand which you throw in its face buying you the time to scrabble away unscathed.";
+        }
+        else
+        {
+            PreText += "Its bite inflicts some damage. You LOSE 2 Life Points.";
+
+            Character::GAIN_LIFE(player, -2);
+        }
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nYou have no recourse but to attack now.";
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (!Character::VERIFY_SKILL_ANY_ITEMS(player, Skill::Type::SWORDPLAY, {Item::Type::SWORD, Item::Type::JADE_SWORD}) && !Character::VERIFY_ITEMS(player, {Item::Type::FLINT_KNIFE}) && !Character::VERIFY_ITEMS(player, {Item::Type::SPEAR}))
+        {
+            return 402;
+        }
+        else
+        {
+            return 429;
+        }
+    }
+};
+
+class Story361 : public Story::Base
+{
+public:
+    Story361()
+    {
+        ID = 361;
+
+        Text = "You advance into the passage and start to examine the perplexing structure of wooden beams. The trick is to clear enough of them out of the way so as to be able to get past, but without bringing the whole passage down on top of you. It is like a child's puzzle, only this is a puzzle with a deadly twist.\n\nYou select one of the beams and dislodge it. As you haul it out of position, there is a crack and a thin trickle of plaster dust sifts down from the roof of the passage. You look up in alarm, heart skipping a beat, but the roof holds.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[ROGUERY]", 86, Skill::Type::ROGUERY));
+        Choices.push_back(Choice::Base("[SPELLS] Use a wand", 109, Choice::Type::SKILL_ALL, Skill::Type::SPELLS, {Item::MAGIC_WAND, Item::JADE_SWORD}));
+        Choices.push_back(Choice::Base("Try using the MAN OF GOLD", 131, {Item::MAN_OF_GOLD}));
+        Choices.push_back(Choice::Base("Otherwise", 154));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story362 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story362()
+    {
+        ID = 362;
+
+        Image = "images/filler7.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "The albino hound is so intent on reaching you and closing its jaws on your windpipe that it does not realize you are luring it back into the open. The moment it rushes out under the colonnade, the sunshine forces it to screw up its weak eyes. When you see it is dazzled, you feel more confident about closing in to do battle.";
+
+        auto DAMAGE = -3;
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL_ANY_ITEMS(player, Skill::Type::SWORDPLAY, {Item::Type::SWORD, Item::Type::JADE_SWORD}))
+        {
+            PreText += "[SWORDPLAY] ";
+
+            DAMAGE = -1;
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::UNARMED_COMBAT))
+        {
+            PreText += "[UNARMED COMBAT] ";
+
+            DAMAGE = -2;
+        }
+
+        PreText += "You LOSE " + std::to_string(-DAMAGE) + " Life Point(s).";
+
+        Character::GAIN_LIFE(player, DAMAGE);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nYou finally manage to force the hound down with your foot on its throat and administer the death-blow. Then you make your way along the passage it was guarding to the inner courtyard, where you find the courtiers already waiting for you. The chief courtier looks at you with a surprise, as though he did not expect you to win through.\n\n\"About your cousin --\"\n\n\"Yes?\" he says, peering back along the tunnel with a puzzled frown.\n\n\"He's dog meat.\"";
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 431; }
+};
+
+class Story363 : public Story::Base
+{
+public:
+    Story363()
+    {
+        ID = 363;
+
+        Text = "The ball contest requires two participants on each side. \"Am I to face this challenge alone?\" you cry out angrily.\n\nNecklace of Skulls' voice rustles from the depths of his shrine. It sounds like a whisper, but is loud enough to carry right along the arena. \"The man you befriended on the journey here. He shall fight beside you.\"\n\nHearing a footstep behind you, you glance back to see Stooping Eagle approaching through the skeletal gate. \"Evening Star!\" he says, glad to see that you too have survived the ordeals set by the courtiers. He touches his sword. \"Where is the wizard? I am eager to see if his blood is red and clean like other men's, or flows like foul sewage!\"\n\nYou gesture to the pyramid at the far end of the arena. \"He awaits us there. But first we must prove ourselves in the contest.\"\n\nHe nods and leans closer to whisper in your ear. \"I know something of the strategy of the ball contest. Begin boldly so as to unsettle your opponents, then allow their leading player past you and drive deep towards the enemy defence.\"\n\n\"Well,\" you say with a shrug, \"it's as good a plan as any.\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 42; }
+};
+
+class Story364 : public Story::Base
+{
+public:
+    Story364()
+    {
+        ID = 364;
+
+        Text = "Your partner darts forward and succeeds in intercepting the ball. You see that he cannot keep possession for long with the enemy attacking player dogging his every move. \"Send it over here!\" you yell at him.";
+
+        Image = "images/filler1.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::SHADE}))
+        {
+            return 385;
+        }
+        else if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::ANGEL}))
+        {
+            return 405;
+        }
+        else
+        {
+            return 423;
+        }
+    }
+};
+
+class Story365 : public Story::Base
+{
+public:
+    Story365()
+    {
+        ID = 365;
+
+        Text = "Leaving the battle behind, you hurry on until the stars begin to drown in the limpid haze heralding a new day. As the sun's heat grows stifling, you find shelter beneath a sand-blasted spar of rock where you rest until night comes again. Then you gather your belongings and set out again by moonlight. Your mouth feels as dry as the endless wastes surrounding you.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::WATERSKIN}))
+        {
+            return 303;
+        }
+        else
+        {
+            return 438;
+        }
+    }
+};
+
+class Story366 : public Story::Base
+{
+public:
+    Story366()
+    {
+        ID = 366;
+
+        Text = "Cowering under the trees at the back of the beach you find a very old man. His clothing is ragged, but the few scraps of adornment that he retains indicate a person of wealth and prestige. This impression is confirmed when he opens his mouth, saying, \"If you have come to kill me, I pray that you do so quickly, at least.\"\n\n\"We haven't come to kill you,\" you reply, extending your hand in friendship.\n\nHe returns a hopeful smile. \"I am Jade Thunder, once a great wizard. A contest with my arch-rival brought me to this desolate spot, and here we fought our last battle. I slew him, but with his dying breath he sealed my wand within a barrier of fire and now I cannot use my magic to return home.\"\n\nYou go with him to a spot further up the beach. Great magic has obviously been at work here, impossibly warping the trees and leaving the coconuts with silent staring faces. The sand underfoot has a dozen colours. In the centre of the clearing, a circle of crackling green flame surrounds a wand.\n\nYou try helping Jade recover his wand.";
+
+        Image = "images/filler3.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[CUNNING]", 21, Skill::Type::CUNNING));
+        Choices.push_back(Choice::Base("[SPELLS] Cast spells with your own wand", 435, Choice::Type::SKILL_ANY, Skill::Type::SPELLS, {Item::MAGIC_WAND, Item::JADE_SWORD}));
+        Choices.push_back(Choice::Base("Use the MAN OF GOLD", 45, {Item::MAN_OF_GOLD}));
+        Choices.push_back(Choice::Base("Walk boldly into the flames", 68));
+        Choices.push_back(Choice::Base("Decide against helping him", 437));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story367 : public Story::Base
+{
+public:
+    Story367()
+    {
+        ID = 367;
+
+        Text = "\"In times gone by, heretics and madmen were cast out from the town by this gate,\" says one of the guards. \"As they went, some would scratch pictures of what they expected to find in the far west.\"\n\n\"That's why it's called the Gate of Exiles,\" says the other man. \"I reckon you must be one of the few people who've taken this route by choice.\"\n\n\"I didn't have a choice,\" you say.\n\nTaking up your pack, you walk out into the waiting desert.";
+
+        Image = "images/gate-of-exiles.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 407; };
+};
+
+class Story368 : public Story::Base
+{
+public:
+    Story368()
+    {
+        ID = 368;
+
+        Text = "He flings the the ball against the slanting wall of the arena and it bounces towards you.. Leaping up with all your strength, you manage to strike it a glancing blow with your arm. A moment of stinging pain is followed by numbness, and the ball thuds to the court at your feet.\n\n\"No, no!\" says the priest, stepping forward to retrieve the ball. \"You have to judge the angle of impact perfectly, otherwise you end up bruised and the ball goes nowhere.\"\n\nHe demonstrates, swinging his hips for momentum a she slams his muscular forearm against the ball. It goes careering across the arena to ricochet off the side wall. This time you manage to intercept it, sending it skidding back along the slant of the wall towards the priest.\n\n\"You've got the hang of it now,\" he says some time later, leaning on his knees to get his breath back. \"The object is to keep the ball from touching the ground. It represents the sun, you see, so it has to stay aloft or else it's 'eclipse', meaning you lose a point.\"\n\nYou toss the ball up and catch it, enjoying the contest now you know more about it. \"And what about the stone rings at the top of the wall?\"\n\n\"Ah!\" says the priest. \"If you can get the ball through the ring then you've scored a 'sunrise' and you win outright. But it's not easy as it looks, believe me.\"\n\nYou stare up at the ring. It is tree man-heights off the ground and barely wider than the ball itself. \"But it doesn't look at all easy!\"\n\nThe priest grins. \"Precisely.\"\n\nIt is now getting late. Thanking the priest, you make your way back home. Tomorrow you will set out in search of your brother.\n\nYou gained the codeword POKTAPOK.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_CODEWORDS(player, {Codeword::Type::POKTAPOK});
+    }
+
+    int Continue(Character::Base &player) { return 389; }
+};
+
+class Story369 : public Story::Base
+{
+public:
+    Story369()
+    {
+        ID = 369;
+
+        Text = "You make a great show of folding the SHAWL and tucking it tightly under your arm. \"You've lured me far off the beaten track and caused me to inhale an insect!\" you say aloud, feeling somewhat foolish since you cannot see the creatures you are addressing.\n\n\"Merely a prank,\" says the eerie voice at your shoulder. \"Give us back our SHAWL, and we'll lead you back to the path without delay.\"\n\n\"Better yet,\" offers another of the stabai, \"we know of a great treasure hidden near by. If we take you to it, will you return the SHAWL?\"\n\nYou know better than to hand the SHAWL back before they have completed their part of any bargain. Even then, it might be wise to retain it in case they try to cause you further trouble. You decide to make no firm promises for now.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Ask them to show you the treasure", 409));
+        Choices.push_back(Choice::Base("Insist on being led back to the trail you were following before", 390));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story370 : public Story::Base
+{
+public:
+    Story370()
+    {
+        ID = 370;
+
+        Text = "Midnight Bloom proves to be a briskly efficient young woman with a vivacious smile. A jade necklace inlaid with flecks of gold sets off her deep coppery tan to good effect. She reads the letter given to you by the Matriarch and nods, saying, \"Many traders are reluctant to go as far as Tahil now, because the collapse of the Great City has left bands of brigands roaming unchecked in the region. But luckily I shall be sailing there in a week's time, to tie up some loose ends in the clan's business.\"\n\nYou spend a restful week in Balak at the house of your relatives here. Your Life Points are fully restored. At last Midnight Bloom comes to tell you that preparations are complete. Tomorrow you set sail for Tahil.\n\nYou gained the codeword SAKBE.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.Life = player.MAX_LIFE_LIMIT;
+
+        Character::GET_CODEWORDS(player, {Codeword::Type::SAKBE});
+    }
+
+    int Continue(Character::Base &player) { return 182; }
+};
+
+class Story371 : public Story::Base
+{
+public:
+    Story371()
+    {
+        ID = 371;
+
+        Text = "There is a gasp form the crowd as they watch you jump over the edge. You know you must act quickly. Pulling off the helmet as you tumble down, you hug it against you an instant before the lake surface comes rushing up, driving the air out of your lungs with its chilling embrace. You are surrounded by silence and watery gloom. The weight of gold drags you down, but you have managed to trap a pocket of air inside the helmet and you use this to breathe while unfastening the straps of the regalia. All the air is used up by the time you struggle free, and a red haze swims in front of your vision as you kick up towards the surface.\n\nYou reach fresh air to discover you are no longer at the bottom of the well. Instead of open sky, a cavern roof stretches overhead. A ghostly grey light emanates out of nowhere. Trudging up onto a a rocky ledge, you hear the sound of oars. A canoe is approaching. As it takes shape out of the shadows, you get a good look at the two occupants. They are like nothing you have ever seen outside your night-mares. Now you know you truly have plunged into the fabled river that leads between the world of the living and the world of the dead.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 97; }
+};
+
+class Story372 : public Story::Base
+{
+public:
+    Story372()
+    {
+        ID = 372;
+
+        Text = "Ripping open the packet, you scatter a handful of salt into the face of the closes snail-creature. It emits a ghastly whining cry and pulls back into its shell as the salt stings its sensitive flesh like acid.\n\nYou advance, casting more salt at any of the creatures that are bold enough to try to stop you. It is hard going, for they are clustered thickly in the tunnel and you are shuddering with terror by now, but at last you reach the canoe. Scattering the last of the salt back to deter pursuers, you jump into the canoe and gesture for the demonic oarsmen to cast off.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::PARCEL_OF_SALT});
+    }
+
+    int Continue(Character::Base &player) { return 258; }
+};
+
+class Story373 : public Story::Base
+{
+public:
+    Story373()
+    {
+        ID = 373;
+
+        Text = "You continue westwards, trudging beneath the living world on a journey that will carry you to the lower reaches of the Deathlands. Any attempt to contemplate your bizarre situation threatens to bring on an attack of claustrophobic panic, so you try to think only of your quest for Morning Star. You swear you'll give that wizard cause to rue the day he chose to work his wiles on your brother.\n\nAll the light drains out of the sky, leaving a hot sulphurous darkness. A flicker of red light shows as a haze on the horizon, like glowing coals against the blackness. You head towards it.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 80; }
+};
+
+class Story374 : public Story::Base
+{
+public:
+    Story374()
+    {
+        ID = 374;
+
+        Text = "Not far away, down a backstreet close to the palace wall, you find a house with a plump young pig tethered outside. Listening at the window, you hear the occupants of the house rowdily enjoying a few cups of mead. You tiptoe back to the pig and, stifling its squeals, tuck it under your arms before returning to the palace gate. There, crouched out of sight around the corner of a building, you release the pig and give it a shove which carries it towards the guards.\n\nThe pig takes a few steps, gives a baffled grunt upon confronting the guards, then bolts past them. \"Grab it, lads!\" cries the guard in high spirits. \"What fine succulent feast it'll make tomorrow, eh?\"\n\nTwo or three of the guards go chasing off after the pig, and the others look on laughing at their comrades' antics. You sneak past while their backs are turned and make your way over to the pyramid of the dead king.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 415; }
+};
+
+class Story375 : public Story::Base
+{
+public:
+    Story375()
+    {
+        ID = 375;
+
+        Text = "The cobra hovers in the air, head swaying from side to side with the beat of its strange wings. The wings are lit up by the luminous veins of glassy rock shining from behind it, displaying dark spots which on a normal cobra would be the patterning of its hood. They look like huge black eyes hanging in the gloom.";
+
+        Image = "images/flying-snake.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Lunge forward and strike it at once", 122));
+        Choices.push_back(Choice::Base("Wait until the cobra swoops in and then attempt a counterattack", 145));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story376 : public Story::Base
+{
+public:
+    Story376()
+    {
+        ID = 376;
+
+        Text = "He receives your answer with a languid smile. You suddenly have a nasty feeling you have been tricked.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::JADE_BEAD}))
+        {
+            return 56;
+        }
+        else
+        {
+            return 60;
+        }
+    }
+};
+
+class Story377 : public Story::Base
+{
+public:
+    Story377()
+    {
+        ID = 377;
+
+        Text = "You hide behind some bushes and wait for the sun to set. As dusk descends, the pitcher tips over to reveal a second head perched on the sleeping woman's shoulder. It has long coiled hair, stark white flesh and a black slit of a mouth. Rolling its eyes, it gives vent to a thin shriek of annoyance at seeing no sign of you. Then its hair flicks out, twisting to form thin legs like a pond-skater's which it braces against the ground before pulling itself off its host's neck with a sucking noise.\n\nYou wait until it has gone loping off into the night in search of prey, then look along the river bank until you find what you need: a smooth rock about the size and shape of a head. Using mud to daub some facial features on this, you prop it on the sleeping woman's shoulder and drape it with reeds to resemble hair. Then you go back and hide in the bushes.\n\nHours pas before the monster returns, prancing out of the darkness on its thin stilt-like legs. On catching sight of another of its kind perched on its own host body, it gives a shriek like an enraged bird and hurls itself forward -- only to fall stunned when it bites hard on the 'interloper' and breaks its teeth. You rush out of cover, snatch up the creature, and stuff pebbles into its bloodied mouth. All it can do is writhe weakly and emit choking noises. You take it to the edge of the river and throw it in, where it sinks without a trace.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 398; }
+};
+
+class Story378 : public Story::Base
+{
+public:
+    Story378()
+    {
+        ID = 378;
+
+        Text = "Grabbing a long hunk of hair, you bunch your muscles and swing the gibbering head around in a swift arc. It strikes the tree with a noise like a melon splitting, and a loathsome torrent of ichor spills out of its broken skull as it drops heavily to the ground. You watch in disgust as its eyes roll up and it gives a last fetid gasp. The twitching tresses shrivel before your eyes, and the head withers rapidly to a desiccated lifeless shell.";
+
+        Image = "images/flying-head.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::REMOVE_CODEWORD(player, Codeword::Type::SALVATION);
+    }
+
+    int Continue(Character::Base &player) { return 398; }
+};
+
+class Story379 : public Story::Base
+{
+public:
+    Story379()
+    {
+        ID = 379;
+
+        Text = "Legend states that a rich man can only enter the afterlife if led there by a poor man. Judging by his regalia, the figure you saw walking ahead of you was rich, and he evidently did not get rid of his money when he passed the idol or the bowl would not be empty. The sensible thing to do would therefore be to get rid of all your money at this point.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.LostMoney = player.Money;
+
+        player.Money = 0;
+    }
+
+    int Continue(Character::Base &player) { return 259; }
+};
+
+class Story380 : public Story::Base
+{
+public:
+    Story380()
+    {
+        ID = 380;
+
+        Text = "No expression shows on the hard mask-like face as you make your genuflection. There is no roar of rage to show he is affronted, nor flash of sullen anger in his eye. He only raises his sceptre slowly, as though to emphasize a point he is about to make .Then, before you have a chance to move, he brings the sceptre swishing down to split your skull open like a melon. Your adventure ends suddenly and horribly for you.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story381 : public Story::Base
+{
+public:
+    Story381()
+    {
+        ID = 381;
+
+        Choices.clear();
+    }
+
+    int Background(Character::Base &player)
+    {
+        if (!Character::VERIFY_ITEMS(player, {Item::Type::SWORD}) && !Character::VERIFY_ITEMS(player, {Item::Type::JADE_SWORD}) && !Character::VERIFY_ITEMS(player, {Item::Type::FLINT_KNIFE}) && !Character::VERIFY_ITEMS(player, {Item::Type::HAMMER}))
+        {
+            return 402;
+        }
+        else
+        {
+            return 429;
+        }
+    }
+};
+
+class Story382 : public Story::Base
+{
+public:
+    Story382()
+    {
+        ID = 382;
+
+        Text = "You pause at the archway and look along the passage. It looks deceptively easy -- just half a dozen paces would take you to the far end, where you can see a dusty sun-bleached courtyard.\n\nYou take one cautious step. Another. Then there is an ominous creak from the lintel above, and a fine sift of rock dust falls from the passage roof...";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_SKILL(player, Skill::Type::CHARMS))
+        {
+            return 177;
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::AGILITY))
+        {
+            return 201;
+        }
+        else
+        {
+            return 224;
+        }
+    }
+};
+
+class Story383 : public Story::Base
+{
+public:
+    Story383()
+    {
+        ID = 383;
+
+        Text = "You toss the ball into the hound's open jaws. It immediately crouches down on the ground and starts gnawing at the ball wagging its tail contentedly, and you are able to slip past unchallenged.\n\nThe courtiers are waiting for you in the inner courtyard. \"Ah, you fool,\" says the chief with a yelp of crowing laughter. \"You just wasted your best weapon!\"\n\n\"Then I'll just have to try that much harder from now on, won't I?\" you reply.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::HYDRA_BLOOD_BALL});
+    }
+
+    int Continue(Character::Base &player) { return 431; }
+};
+
+class Story384 : public Story::Base
+{
+public:
+    Story384()
+    {
+        ID = 384;
+
+        Text = "The ball contest requires two participants on each side. \"Am I to face these shadow beings alone?\" you cry out angrily.\n\nNecklace of Skulls' voice rushes from the depths of his shrine. It is like a whisper that is somehow loud enough to carry right along the arena. \"You came here seeking your brother. He shall fight beside you.\"\n\nA chill settles in the hot air for an instant. A figure has appeared beside you. You turn, not recognizing him at first. It is Morning Star, but there is a ghastly pallor to his skin and his eyes have a hollow look. His arm is pressed to his forehead in the gesture of the denizens of the Deathlands, who must forever shield their eyes from the glare of the sun beneath the world.\n\n\"Evening Star,\" he says forlornly. \"I am so cold. The grave has scant comforts.\"\n\nYou must fight beside the ghost of your brother in a contest to the death.\n\nYou gained the codeword SHADE.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_CODEWORDS(player, {Codeword::Type::SHADE});
+    }
+
+    int Continue(Character::Base &player) { return 42; }
+};
+
+class Story385 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story385()
+    {
+        ID = 385;
+
+        Image = "images/filler1.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+
+        PreText = "Your brother makes the best shot he can, but he is off balance and the ball goes wide. The enemy defensive player sees a chance and comes rushing in, trying to beat you to the ball.";
+
+        if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::POKTAPOK}))
+        {
+            PreText = "\n\nYou wrest possession from him and score a point.";
+
+            Character::SCORE(player, player.Ticks, 1);
+        }
+        else
+        {
+            PreText = "\n\nHe beats you to the ball and scores.";
+
+            Character::SCORE(player, player.Cross, 1);
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 66; }
+};
+
+class Story386 : public Story::Base
+{
+public:
+    Story386()
+    {
+        ID = 386;
+
+        Text = "Morning Star lobs the ball directly towards you. Timing your move perfectly, you hug it to your chest while substituting the blood ball.";
+
+        Image = "images/filler1.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Go for a standard scoring shot", 405));
+        Choices.push_back(Choice::Base("Risk everything on putting the ball through the stone ring and winning an instant victory", 43));
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+    }
+};
+
+class Story387 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story387()
+    {
+        ID = 387;
+
+        Image = "images/filler1.png";
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Choices.clear();
+
+        if (Character::VERIFY_SKILL(player, Skill::Type::SEAFARING))
+        {
+            PreText = "You repair the boat and set sail.";
+
+            Character::REMOVE_CODEWORD(player, Codeword::Type::EB);
+        }
+        else
+        {
+            PreText = "You are stranded unless you risk helping Jade Thunder.";
+
+            Choices.push_back(Choice::Base("[SPELLS] Use a wand", 435, Choice::Type::SKILL_ANY, Skill::Type::SPELLS, {Item::MAGIC_WAND, Item::JADE_SWORD}));
+            Choices.push_back(Choice::Base("[CUNNING]", 21, Skill::Type::CUNNING));
+            Choices.push_back(Choice::Base("Use the MAN OF GOLD", 45, {Item::MAN_OF_GOLD}));
+            Choices.push_back(Choice::Base("Otherwise", 68));
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 300; }
+};
+
+class Story388 : public Story::Base
+{
+public:
+    Story388()
+    {
+        ID = 388;
+
+        Text = "\"It is protection against the dust demons,\" explains one of the guards. \"They are invisible sprites who whip up whirlwinds and drive them like ravaging beasts onto those who travel in the desert.\"\n\nYou cast a brief glance at the boulder. \"Not much protection, surely? The demons could just steer their whirlwinds around it.\"\n\n\"No,\" says the other man in a tone that suggests they tell this legend to every wayfarer, \"because dust demons can only travel in long straight paths. They can't turn easily.\"\n\n\"Or so the priest Spitting Viper told us,\" chimes in the first man.\n\nBidding them farewell, you take up your pack and walk out into the waiting desert.";
+
+        Image = "images/gate-of-exiles.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 407; };
+};
+
+class Story389 : public Story::Base
+{
+public:
+    Story389()
+    {
+        ID = 389;
+
+        Text = "You decide to set out early the next morning, before sunrise. This will spare your family from farewells. By lantern light in the chill grey predawn, you stand in the antechamber of your family's house and check your belongings for the journey. You are attended by only one servant, who silently fastens the straps of your pack. Your aunts have left out a parcel of MAIZE CAKES for you to eat on the road.\n\nThere is a knock on the outer door and the servant darts off to open it. Outside you see your friend the old soothsayer standing in the early twilight. You go out and greet him: \"Good morning. You came just in time to catch me. I'm about to set out.\"\n\n\"I know,\" he says. \"I came to wish you luck. And to give you this.\" He holds up a JADE BEAD.\n\nYou take it with a quizzical smile. \"What's this for?\"\n\n\"There are some who'll tell you that the quickest route to Necklace of Skulls lies through the underworld. It is true, but that way is also fraught with peril and you will need certain safeguards if you hope to pass through in safety. Now, beads such as this are placed under the tongue of deceased nobles for them to use as currency in the afterlife. If you should enter the underworld, be sure to place the bead under your tongue and to keep it there until you reach the crossroads. Got that?\"\n\n\"I suppose so,\" you say, not really following his drift at all. But you pocket the JADE BEAD. As you set out along the road, you pause and glance back, adding, \"You were wrong about the dream. It seems my brother was dead after all.\"\n\nHe shrugs. \"Right... wrong... The world isn't quite that simple, Evening Star.\"\n\nBidding him farewell, you set off towards the edge of the city. Even at this early hour, traders are already carrying their wares to market. Out in the fields, moving shadows in the smoky blue twilight show that the farmers are hard at work. It is strange to think that you might never again see this great city of Koba, which has been your home since childhood.\n\nYou turn your gaze to the west, putting such thoughts out of your head. From now on, you must think only of the success of your quest.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_ITEMS(player, {Item::JADE_BEAD, Item::MAIZE_CAKES});
+    }
+
+    int Continue(Character::Base &player) { return 25; }
+};
+
+class Story390 : public Story::Base
+{
+public:
+    Story390()
+    {
+        ID = 390;
+
+        Text = "The stabai flicker at the edges of your vision, thin elusive shards of paleness against the green-tinged shadows. They lead you on through silent glades surrounded by trees which stretch endlessly upwards as though supporting the sky. The moist heat of the jungle weighs upon you until you feel like a drowning man. Slogging on through the eerie silence, limbs aching with fatigue, you begin to suspect the stabai are not leading you to safety at all. What if their plan is to entice you deeper and deeper into the woods until you finally drop from hunger and exhaustion?";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Dismiss the stabai and try to find your own way back to the trail", 324));
+        Choices.push_back(Choice::Base("Return the SHAWL in the hope of gaining the stabai's goodwill", 347, {Item::SHAWL}));
+        Choices.push_back(Choice::Base("Continue to let them guide you", 168));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story391 : public Story::Base
+{
+public:
+    Story391()
+    {
+        ID = 391;
+
+        Text = "You strike up a conversation with a trader whose boat looks impressively large and seaworthy. He is putting together a cargo of richly dyed cotton and woven feather head-dresses which he hopes to sell in Tahil.\n\n\"Brigands and pirates abound since the fall of the Great City,\" he says. \"These are exciting times we live in. Many prefer to cower in safety close to home, but for a bold man there are fine profits to be made.\"\n\nA few judicious remarks about the weather and the tides convince him that you would be a worthwhile person to have along on the voyage. He tells you to return in a week, when it will be time to set out.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 205; }
+};
+
+class Story392 : public Story::Base
+{
+public:
+    Story392()
+    {
+        ID = 392;
+
+        Text = "You know that your first priority must be to get out of the encumbering golden regalia as soon as you hit the water, otherwise it will drag you down to your doom. Your fingers have already found the straps as you dive off the platform. You hear a moan of awe from the onlookers which is soon snatched away by the rush of wind as you fall. Then you hit the water, and suddenly you are sinking through silent darkness.\n\nAnother person might panic, losing precious seconds, but you have been in this kind of scrape before. You made sure to take a good breath of air before going under, and you make use of that now to sustain you while you struggle free of the regalia. Discarding it, you watch it go drifting down until the yellow glints of metal are lost in the murk. It is a priceless treasure, but the loss of it gladdens your heart as you strike up through the cold green water.\n\nYour head breaks the surface and you suck gratefully at the stale air of an underground cavern. There is no flicker of daylight. The sinkhole has vanished, and the only light is now an eldritch grey glow seeping from an unknown source. You guess that you have been carried to the outer fringes of the underworld. Stumbling up onto a pebble-strewn shore, you gaze out into the gloom and see a canoe coming towards you. Your guess is confirmed when you see the oarsmen. They are like no creatures of the mortal realm.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 97; }
+};
+
+class Story393 : public Story::Base
+{
+public:
+    Story393()
+    {
+        ID = 393;
+
+        Text = "You light the firebrand and thrust it straight into the face of the nearest of the creatures -- the one hanging on the rock directly above your head. It throws up its stubby arms with a sickening bleat of anguish and falls, dashing you to the ground and smothering the burning brand. Before you can struggle free and rise to your feet, the rest of the creatures have slithered forward and seized you in their slimy fingers. You try to fight, but there are too many of them. All you can do is scream in panic as they overwhelm you. Your adventure has come to a horrible end.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story394 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story394()
+    {
+        ID = 394;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You complete the charm an instant before the cobra strikes. It comes sailing in and closes its jaws on your neck, but you feel barely more than a pinprick as the fangs glance harmlessly off your skin. The charm will keep you safe from its bite while you explore the tomb.";
+
+        if (Character::VERIFY_ITEMS(player, {Item::Type::JADE_BEAD}))
+        {
+            PreText += "\n\nThe JADE BEAD fell out of your mouth when you spoke the charm. You are too late to stop it rolling off the ledge and being lost in the water below.";
+
+            Character::LOSE_ITEMS(player, {Item::Type::JADE_BEAD});
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 339; }
+};
+
+class Story395 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story395()
+    {
+        ID = 395;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "The little man bites your wrist and sucks at it as though savouring the juice of a plum.\n\nYou LOSE 1 Life Point.";
+
+        Character::GAIN_LIFE(player, -1);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nAfter a short while he looks up. Under the hook of his extraordinary nose, his mouth is curled into a tight smile. \"That's a rare act of kindness for a stranger to do,\" he says in his thin voice, leaping to his tiny feet with miraculous vigour. \"I won't soon forget it, I assure you. Oh, and let me give you a word of advice. Get rid of any money you've got once you reach the crossroads.\"\n\nWith that he darts off and is soon lost to view among the rushes. You are left to ponder the meaning of this strange encounter as you continue on your way.\n\nYou gained the codeword ZAZ.";
+
+            Character::GET_CODEWORDS(player, {Codeword::Type::ZAZ});
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 307; }
+};
+
+class Story396 : public Story::Base
+{
+public:
+    Story396()
+    {
+        ID = 396;
+
+        Text = "You crouch behind some sacks of grain and wait an hour or so until the streets are completely deserted. A few lights show from the palace windows. Beside the gate, a brazier flares in the night breeze. Other than that it is completely dark. When the moon shows as a misty patch of silver beyond the wooded hills to the east, you put your plan into action.\n\n\"Brr, it's cold suddenly,\" remarks one of the guards at the gate.\n\nOne of his companions nods. \"Did you hear something just then?\" He casts a nervous glance over his shoulder. The pyramid-tomb of the dead king looms darkly against the pale halo of moonlight.\n\n\"Now you come to mention it...\" says another, also looking back. Suddenly he gasps, eyes popping out of his head. \"By all the gods!\"\n\nA parade of ghosts descends the steps of the pyramid. Their dead faces are formed on mist and moonbeams, and they move without sound across the courtyard. The guards are brave enough to face any foe of flesh and blood, but the sight of this host of spectres sends icy terror through their veins. Dropping their weapons, they run off into the night.\n\nYou watch them go, then step out from your hiding-place. As you cancel your illusion spell, the 'ghosts' dissolve into the darkness. You hurry across to the pyramid before the guards recover enough nerve to come slinking back.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 415; }
+};
+
+class Story397 : public Story::Base
+{
+public:
+    Story397()
+    {
+        ID = 397;
+
+        Text = "Your answer is greeted with a sneer and a hiss of laughter. It occurs to you that you may have been tricked.";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::JADE_BEAD}))
+        {
+            return 56;
+        }
+        else
+        {
+            return 60;
+        }
+    }
+};
+
+class Story398 : public Story::Base
+{
+public:
+    Story398()
+    {
+        ID = 398;
+
+        Text = "The woman is in a deep trance, but you shake her until she comes out of it. She tells you that she is a sorceress who fell victim to the nightcrawler when she tried to exorcize it from the region. \"I can never repay my debt to you,\" she says, weeping with relief to be free of the noxious creature's control at last. \"When you get to the sea, follow the shore until you come to a giant stone idol which is buried up to its neck in the sand. This is the idol of an ancient god. Tell him the number of stars in the sky and he will speak to you.\"\n\n\"How many stars are there?\"\n\nShe smiles. \"Tell him a hundred thousand million and seven. He wouldn't believe the true answer.\"\n\nYou gained the codeword OLMEK.\n\nBidding the woman farewell, you continue on your way.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_CODEWORDS(player, {Codeword::Type::OLMEK});
+    }
+
+    int Continue(Character::Base &player) { return 417; }
+};
+
+class Story399 : public Story::Base
+{
+public:
+    Story399()
+    {
+        ID = 399;
+
+        Text = "The remorseless glare of the unearthly sun dazzles you both, forcing you to shield your eyes. Walking on, you come in sight of a kapok tree whose spreading branches poke up into the roof of water above the underworld. Several figures are resting in its shade.\n\nAs you press on towards the tree, you pass a well beside the road. Your companion pauses and fishes in his belt-pouch for a JADE BEAD, which he casts into the well. There is a glint of golden light from the water, and the noble pauses to take a drink.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Do the same (JADE BEAD)", 59, Choice::Type::LOSE_ITEMS, {Item::JADE_BEAD}));
+        Choices.push_back(Choice::Base("Otherwise", 83));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+auto story300 = Story300();
+auto story301 = Story301();
+auto story302 = Story302();
+auto story303 = Story303();
+auto story304 = Story304();
+auto story305 = Story305();
+auto story306 = Story306();
+auto story307 = Story307();
+auto story308 = Story308();
+auto story309 = Story309();
+auto story310 = Story310();
+auto story311 = Story311();
+auto story312 = Story312();
+auto story313 = Story313();
+auto story314 = Story314();
+auto story315 = Story315();
+auto story316 = Story316();
+auto story317 = Story317();
+auto story318 = Story318();
+auto story319 = Story319();
+auto story320 = Story320();
+auto story321 = Story321();
+auto story322 = Story322();
+auto story323 = Story323();
+auto story324 = Story324();
+auto story325 = Story325();
+auto story326 = Story326();
+auto story327 = Story327();
+auto story328 = Story328();
+auto story329 = Story329();
+auto story330 = Story330();
+auto story331 = Story331();
+auto story332 = Story332();
+auto story333 = Story333();
+auto story334 = Story334();
+auto story335 = Story335();
+auto story336 = Story336();
+auto story337 = Story337();
+auto story338 = Story338();
+auto story339 = Story339();
+auto story340 = Story340();
+auto story341 = Story341();
+auto story342 = Story342();
+auto story343 = Story343();
+auto story344 = Story344();
+auto story345 = Story345();
+auto story346 = Story346();
+auto story347 = Story347();
+auto story348 = Story348();
+auto story349 = Story349();
+auto story350 = Story350();
+auto story351 = Story351();
+auto story352 = Story352();
+auto story353 = Story353();
+auto story354 = Story354();
+auto story355 = Story355();
+auto story356 = Story356();
+auto story357 = Story357();
+auto story358 = Story358();
+auto story359 = Story359();
+auto story360 = Story360();
+auto story361 = Story361();
+auto story362 = Story362();
+auto story363 = Story363();
+auto story364 = Story364();
+auto story365 = Story365();
+auto story366 = Story366();
+auto story367 = Story367();
+auto story368 = Story368();
+auto story369 = Story369();
+auto story370 = Story370();
+auto story371 = Story371();
+auto story372 = Story372();
+auto story373 = Story373();
+auto story374 = Story374();
+auto story375 = Story375();
+auto story376 = Story376();
+auto story377 = Story377();
+auto story378 = Story378();
+auto story379 = Story379();
+auto story380 = Story380();
+auto story381 = Story381();
+auto story382 = Story382();
+auto story383 = Story383();
+auto story384 = Story384();
+auto story385 = Story385();
+auto story386 = Story386();
+auto story387 = Story387();
+auto story388 = Story388();
+auto story389 = Story389();
+auto story390 = Story390();
+auto story391 = Story391();
+auto story392 = Story392();
+auto story393 = Story393();
+auto story394 = Story394();
+auto story395 = Story395();
+auto story396 = Story396();
+auto story397 = Story397();
+auto story398 = Story398();
+auto story399 = Story399();
+
+void InitializeStories300()
+{
+    Stories.insert(Stories.end(), {
+        &story300, &story301, &story302, &story303, &story304, &story305, &story306, &story307, &story308, &story309,
+        &story310, &story311, &story312, &story313, &story314, &story315, &story316, &story317, &story318, &story319,
+        &story320, &story321, &story322, &story323, &story324, &story325, &story326, &story327, &story328, &story329,
+        &story330, &story331, &story332, &story333, &story334, &story335, &story336, &story337, &story338, &story339,
+        &story340, &story341, &story342, &story343, &story344, &story345, &story346, &story347, &story348, &story349,
+        &story350, &story351, &story352, &story353, &story354, &story355, &story356, &story357, &story358, &story359,
+        &story360, &story361, &story362, &story363, &story364, &story365, &story366, &story367, &story368, &story369,
+        &story370, &story371, &story372, &story373, &story374, &story375, &story376, &story377, &story378, &story379,
+        &story380, &story381, &story382, &story383, &story384, &story385, &story386, &story387, &story388, &story389,
+        &story390, &story391, &story392, &story393, &story394, &story395, &story396, &story397, &story398, &story399});
+}
@@ -0,0 +1,1135 @@
+#include <vector>
+
+#include "story.hpp"
+
+class Story400 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story400()
+    {
+        ID = 400;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You lose your grip on the crumbling bark and go crashing down through the branches.";
+
+        auto DAMAGE = -5;
+
+        PreText += "\n\n";
+
+        if (Character::VERIFY_SKILL(player, Skill::Type::AGILITY))
+        {
+            PreText += "[AGILITY] You manage to break your fall by catching a stout strangler root.";
+
+            DAMAGE = -1;
+        }
+        else
+        {
+            PreText += "The ground comes up to hit you with a crushing force.";
+        }
+
+        PreText += "\n\nYou LOSE " + std::to_string(-DAMAGE) + " Life Points.";
+
+        Character::GAIN_LIFE(player, DAMAGE);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nStruggling to your feet, you limp away before the creature can descend from its arboreal lair to pursue you. The stabai have flitted away, terrified of the creature's wrath. When you are safely away from the tree, you clean the muck off the diadem and hold it up in a shaft of sunlight. It is a gold circlet of the sort that sometimes adorn the heads of great nobles. Sacred symbols are stamped into the metal and there is a jade inlay in the fourfold shape of the World Tree, the source of life itself in the mythology of your people (GOLD DIADEM).";
+
+            Character::GET_ITEMS(player, {Item::GOLD_DIADEM});
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 324; }
+};
+
+class Story401 : public Story::Base
+{
+public:
+    Story401()
+    {
+        ID = 401;
+
+        Text = "You greet the sentinel by name. He receives your greeting with barely a change in expression. Only in a narrowing of those burning eyes and a drooping of the chiselled lips do you begin to sense your error.\n\nHis sceptre flashes out without warning, shattering your breast-bone and drinking through into your heart. Impaled, you give a last spasm before death congeals on your features. You have met your doom.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story402 : public Story::Base
+{
+public:
+    Story402()
+    {
+        ID = 402;
+
+        Text = "You have no weapon strong enough to penetrate the monster's scaly hide. Snarling at your impudence in attacking it, it envelops you in its four necks like a ma closing his fist on a gnat. Fangs sharper than flakes of obsidian sink deep into your flesh and it raises your bloody carcass aloft to the night sky with a great shriek of inhuman glee. You sold your life valiantly, but you failed.";
+
+        Type = Story::Type::DOOM;
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story403 : public Story::Base
+{
+public:
+    Story403()
+    {
+        ID = 403;
+
+        Text = "The intense fire has burned down to a sullen cindery glow by daybreak. You are dimly aware of the door being swung open, and you begin to crawl feebly across the floor towards the flow of cool morning air. In doing so, your hand brushes against a large lump of charcoal which must have fallen out of the fire during the night. You also notice that one of the round stones which formed the sides of the fire-trough has worked itself loose. It is still warm to the touch, but not unbearably so.\n\n\"Come along,\" snaps the chief courtier impatiently. He sends in a couple of his men, who drag you outside. Staring down at you as your strength returns, he says nastily: \"Did you have a pleasant night?\"\n\n\"Very comfortable,\" you mutter through parched lips. \"What's next?\"\n\n\"Next,\" he says, \"is the House of Bats.\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Take = {Item::LUMP_OF_CHARCOAL, Item::STONE};
+
+        Limit = 2;
+    }
+
+    int Continue(Character::Base &player) { return 225; }
+};
+
+class Story404 : public Story::Base
+{
+public:
+    Story404()
+    {
+        ID = 404;
+
+        Text = "The symbol on the diadem represents the World Tree, the source of all birth and regeneration. Now you can feel it throbbing in your hand, its magical energy sending tingling sparks through your fingers. You carefully set your brother's skull on the dusty ground in front of you and place the diadem over its brow.\n\nSunlight splashes on the rim of the diadem, growing into a blinding cusp of unbearable intensity. The courtiers look away with a moan of awe, and the two shadow men shrink back against the flanks of their creator's pyramid. Narrowing your eyes, you peer into the heart of the glow and there you witness -- a miracle.\n\nThe glow fades. Your brother is standing before you, fully restored, grinning like a demigod with the diadem on his brow. It takes you a moment before the wave of dizzying joy passes enough for you to speak: \"Morning Star!\"\n\n\"It is good to see you!\" says your brother, coming forward to hug you. As the two of you touch, there is a crackle of energy and you feel the injuries and fatigue of the last few weeks burned away by life-giving magic.\n\n\"I feared you were lost for ever.\" You point towards the brooding shrine overlooking the ball contest arena. \"Now, brother, let's show that sorcerer our true mettle!\"\"\n\nYou RECOVER 4 Life Points.\n\nYou gain the codeword VENUS.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GAIN_LIFE(player, 4);
+
+        Character::GET_CODEWORDS(player, {Codeword::Type::VENUS});
+
+        Character::REMOVE_CODEWORD(player, Codeword::Type::ANGEL);
+    }
+
+    int Continue(Character::Base &player) { return 42; }
+};
+
+class Story405 : public Story::Base
+{
+public:
+    Story405()
+    {
+        ID = 405;
+
+        Text = "You swing your elbow up in a perfectly judge blow that hits the ball high up against the scoring zone.";
+
+        Image = "images/filler1.png";
+
+        Music = "music/ball-game.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        player.RitualBallStarted = true;
+
+        auto score = 1;
+
+        if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::POKTAPOK}))
+        {
+            score = 2;
+        }
+
+        Character::SCORE(player, player.Ticks, score);
+    }
+
+    int Continue(Character::Base &player) { return 66; }
+};
+
+class Story406 : public Story::Base
+{
+public:
+    Story406()
+    {
+        ID = 406;
+
+        Text = "The storm blows itself out towards dawn, leaving you all shaking with exhaustion. You look around. Unbroken sea surrounds you. The only clue to your course is the sun boiling its way through a bank of low cloud across the horizon, but the sight of circling gulls tells you that land is near. You know that it cannot be the mainland. As a green swathe of foliage appears in the distance, you realize you have found the fabled Isle of the Iguana.\n\nGetting closer, you find a coast of high cliffs which the sea has pounded into fanciful shapes. You sail under an arch of white rock and around a headland that reminds you of a serpent's mouth, arriving at last at a stretch of pebble-strewn beach.\n\n\"The ship was badly damaged in the storm,\" says one of the sailors, pointing to the water collecting in the bottom of the hull. \"We must put in here for repairs.\"\n\nYou gained the codeword EB.";
+
+        Image = "images/filler3.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_CODEWORDS(player, {Codeword::Type::EB});
+    }
+
+    int Continue(Character::Base &player) { return 366; }
+};
+
+class Story407 : public Story::Base
+{
+public:
+    Story407()
+    {
+        ID = 407;
+
+        Text = "The sun looks like a funnel of flame in the shimmering oven of the sky. Through the soles of your sandals, the rock and sand feel as hot as cinders. The air seems thick with dust, but at nightfall the temperature plummets and you are chilled by a strong breeze.";
+
+        Image = "images/filler1.png";
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Choices.clear();
+
+        if (!Character::VERIFY_SKILL(player, Skill::Type::WILDERNESS_LORE))
+        {
+            Choices.push_back(Choice::Base("Travel by day", 22));
+            Choices.push_back(Choice::Base("Travel by night", 46));
+        }
+    }
+
+    int Continue(Character::Base &player) { return 434; }
+};
+
+class Story408 : public Story::Base
+{
+public:
+    Story408()
+    {
+        ID = 408;
+
+        Text = "The high priest winds a white cloth across your eyes and leads you through to the inner shrine. A deep chill abides here; the thick stone blocks of the Death God's temple walls are never warmed by the sun. The sweet tarry smell of incense hangs in the air. You feel a hand on your shoulder, guiding you to kneel.\n\nA long period of utter silence ensues. You did not hear the high priest withdraw from the chamber, but you gradually become sure that he has left you here alone. You dare not remove the blindfold; to gaze directly on the holy of holies would drive you instantly insane.\n\nA whispering slithers slowly out of the silence. At first you take it for a trick of your unsettle imagination, but by straining your ears you begin to make out words. \"The way to the west lies through the underworld,\" the whispering tells you. \"Go to the city of Yashuna. North of the city lies a sacred well which is the entrance to the underworld. Take this path, which is dangerous but swift, and you will emerge at the western rim of the world. From there it is but a short journey back through the desert to your goal.\"\n\nThe whispers fade, drowned out by the thudding of your heart. Frozen with terror at the words of the god, you crouch motionless on the cold flagstones. The cloying scent of incense grows almost unbearable.\n\nSuddenly a hand touches your shoulder. After the initial jolt of alarm, you allow yourself to be led out onto the portico of the temple, where the blindfold is removed. You blink in the dazzling sunlight. You feel as weak as a baby and the smell of incense clings to your clothes. After the cool of the shrine, the heat of the afternoon sun makes you feel slightly sick.\n\nThe podgy priest is looking up into your eyes. \"You head the voice of the god,\" he says simply.\n\nYou gained the codeword CENOTE.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GET_CODEWORDS(player, {Codeword::Type::CENOTE});
+    }
+
+    int Continue(Character::Base &player) { return 93; }
+};
+
+class Story409 : public Story::Base
+{
+public:
+    Story409()
+    {
+        ID = 409;
+
+        Text = "The stabai guide you through the forest to a tall tree which has had the vitality leeched out of it by a strangler fig. The roots of the strangler enclose the decomposing trunk like a crusty scab. A barely glimpsed arm directs your attention to a hole some way up the side of the tree. \"There,\" announces the fluting voice of the stabai. \"The treasure is inside the dying tree-trunk.\"\n\nThe strangler's roots make it an easy climb. The stabai effortlessly keep pace with you. From somewhere amid the branches you hear them urging you to return the SHAWL. \"Not yet,\" you reply. \"First I'll take a look at this treasure.\"\n\n\"But then you will return the SHAWL?\" they whine.\n\nYour foot slips but you steady yourself in the crook of a branch. It is a long way to the ground. No doubt the stabai are hoping you will break your neck, and their distractions are not helping. \"I'm making no promises,\" you tell them irritably.\n\nPulling yourself up level with the hold, you peer inside. It looks dank and rotten. There is a smell like mushrooms -- sickly sweet, a heady aroma. But as your eyes penetrate the darkness, you see that the stabai did not lie. Just within reach glitters a solid GOLD DIADEM.";
+
+        Image = "images/filler1.png";
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Choices.clear();
+
+        if (!Character::VERIFY_SKILL(player, Skill::Type::ROGUERY))
+        {
+            Choices.push_back(Choice::Base("Reach in and take the diadem", 49));
+            Choices.push_back(Choice::Base("Climb back down and get the stabai to lead you out of the woods", 390));
+        }
+    }
+
+    int Continue(Character::Base &player) { return 26; }
+};
+
+class Story410 : public Story::Base
+{
+public:
+    Story410()
+    {
+        ID = 410;
+
+        Text = "The lad is as good as his word, and takes you along an obscure track that leads towards the edge of the forest. As you walk, he tells you of his people, whose task is to guard the World Tree.\n\n\"Who appointed you to this sacred duty?\" you ask, hiding a smile because you do not believe such an outrageous claim.\n\n\"It was the God of Gods, who at the dawn of time created our ancestors from whom came all men,\" he says. His sing-song intonation suggests he is reciting the words of his tribal shaman. But what he says next makes you pause for thought: \"You're going to Nachan? My father went there once, in the time of the old king. I hear there is a passage into the underworld.\"\n\nInterested, you ply him with questions but he knows nothing more. At last he points along a lightly wooded lane. \"Follow this path and you will soon reach the outside world,\" he says.\n\nThanking him, you say good-bye and set out along the lane.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 160; }
+};
+
+class Story411 : public Story::Base
+{
+public:
+    Story411()
+    {
+        ID = 411;
+
+        Text = "The high priest watches the sun decline across the treetops to the west. \"The moment has arrived,\" he intones to the waiting crowd. \"This ambassador will bear our message to the Rain God.\"\n\nYou stare down. A gulf of dozen man-heights separates you from the grim watery gate of the afterlife. Even with your spell in force, you cannot suppress a qualm as you step out into space.\n\nThe gasp of the crowd is lost in the rush of wind as you go plummeting down. The white root-tangled walls of the sinkhole flicker past your vision. An instant later there is an icy impact and then darkness and eeriness surround you.\n\nIf not for your magic, the golden regalia you are wearing would bear you down to a watery grave. You struggle free of the fastenings and allow the vest of gold plaques to sink out of sight in the murk, but you keep the GOLDEN HELMET tucked under your arm as you go shooting up towards the surface.\n\nYou break the surface like a log bobbing up out of the depths. There is a weak glow here, but it is not daylight. You are no longer at the bottom of the sinkhole, but in a vast underground cavern. You stagger up onto a rocky shore before your spell can wear off.\n\nThe sound of oars reaches your ears. Approaching you across the lake comes a long canoe crewed by two weird figures that seem to have strayed out of a feverish dream.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Keep the GOLDEN HELMET", 97, Choice::Type::GET_ITEMS, {Item::GOLDEN_HELMET}));
+        Choices.push_back(Choice::Base("Leave it", 97));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story412 : public Story::Base
+{
+public:
+    Story412()
+    {
+        ID = 412;
+
+        Text = "The path reaches a shallow brook. Midges cloud the damp gloomy air. In the branches high above, a macaw dips its long yellow beak to peer at you.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Go straight across the brook", 29));
+        Choices.push_back(Choice::Base("Go left along the bank", 6));
+        Choices.push_back(Choice::Base("Go", 52));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story413 : public Story::Base
+{
+public:
+    Story413()
+    {
+        ID = 413;
+
+        Text = "The warmth of your grip awakens the spark of life in the golden manikin. Dropping from your hand to the ledge, it takes in the situation with a single haughty glance. You wonder how anything so small could help against the flying cobra, but the MAN OF GOLD was fashioned by a god and is far more powerful than you could imagine. As the cobra comes swooping to attack you, the Man of Gold leaps up and seizes its tail, dragging it down to the ledge. The struggle is brief. After casting the lifeless body into the river, the Man of Gold makes a gesture of farewell and then dives off the ledge itself. You hear it fall with a short heavy splash, and by the time you look over the edge it has sunk without a trace.\n\n\"That was handy, having that little figurine,\" calls up one of the demonic oarsmen.\n\nThe other chimes in with: \"Too bad you couldn't keep it.\"\n\nHe is right.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::MAN_OF_GOLD});
+    }
+
+    int Continue(Character::Base &player) { return 339; }
+};
+
+class Story414 : public Story::Base
+{
+public:
+    Story414()
+    {
+        ID = 414;
+
+        Text = "The knot on one of the gates unties itself. The gate swings open to let you enter, then closes behind you. At the end of a short tunnel you find a chamber which is open on the far side, giving onto a ledge overlooking a river of foaming blood. A man stands on the ledge, and you recognize him as the feather-robed noble you saw on the causeway outside.\n\nHe points to an obsidian beam spanning the river to the far bank. At first you think it is a bridge, but when you step out onto the ledge for a closer look you see that it is wedge-shaped, coming to a sharp edge on its upper surface. \"It would be difficult to keep one's balance on that,\" you remark drily.\n\n\"That isn't the intention,\" says the noble. He holds up a pole with a hook on the end. \"I found this here on the ledge. Notice that there is a similar pole on the other ledge yonder.\"\n\nYou look upriver. There is indeed another ledge with an identical beam a few metres away, presumably where you would have come out if you had gone through the other doorway. A pole like the one the noble is holding rests there.\n\n\"Eventually a poor man will arrive,\" he says. \"He will emerge on the other ledge, at which time he and I will reach out and hook our poles together. Then, leaning out and walking on the sloping surface of the obsidian beams, we will be able to cross together.\"\n\n\"Ingenious!\" you say. But you are thinking about how you will get across.";
+
+        Image = "images/pyramid.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[AGILITY]", 418, Skill::Type::AGILITY));
+        Choices.push_back(Choice::Base("[ROGUERY]", 430, Skill::Type::ROGUERY));
+        Choices.push_back(Choice::Base("[SEAFARING]", 221, Skill::Type::SEAFARING));
+        Choices.push_back(Choice::Base("Otherwise", 13));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story415 : public Story::Base
+{
+public:
+    Story415()
+    {
+        ID = 415;
+
+        Text = "The shrine at the top of the pyramid is a small dark chamber fronted by a portico supported by strong square pillars. You can see the mouth of the spirit tube, fashioned in the shape of a slim snake. You know that the hollow tube extends all the way down through the interior of the pyramid to the tomb chamber deep in its heart. It is an eerie feeling to think that when you speak into the tube your words echo down into the ear of the dead king.\n\nYou keep a lone vigil long into the night. As the moon reaches its zenith, there is a soft soughing of wind up the spirit tube. Suddenly you realize you are unable to move. You will not admit to fear, but you are struck with awe to see a long curl of glowing green mist ooze out of the mouth of the tube. It hangs there in the shadows of the shrine, slowly curling in the air, gradually coming into focus in the form of a translucent snake. As you watch, the snake opens its jaws and the head of a man pushes into view, extruding from inside the snake's body until he has entirely emerged except for his left leg, which remains within its throat. He is a glistening red colour, as though covered in fresh blood, and as nude as a newborn baby.\n\nYou bow your head humbly to the cold flagstones, knowing that this is the spirit of King Sky Shield.";
+
+        Image = "images/filler7.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 335; }
+};
+
+class Story416 : public Story::Base
+{
+public:
+    Story416()
+    {
+        ID = 416;
+
+        Text = "The festivities include ritual dance-dramas in which the participants mask themselves as beasts, gods and heroes from folklore. Accompanied by flutes and the throbbing beat of immense wooden drums, they swirl across the plaza in front of the temples, enacting the deeds of such mythic figures as the hero-twins Forethought and Afterthought.\n\nAt one point the twins take part in a ball contest and Afterthought succeeds in hurling the ball through the stone hoop on the side of the court. This provokes shouts of praise from spectators at the back of the crowd, but you are close to the front and can see that the apparently difficult shot was made with the help of string tied to the ball.\n\n\"Huh!\" snorts a woman standing next to you. \"He'd never have made the shot otherwise. I've never seen it done for real in all the contests I've watched.\"\n\nThe woman's son tugs at her skirt. He wants to know why the act of scoring in the ball contest has given him victory over his foes, the Lords of Death. \"That's because it's more than a game,\" you hear her saying. \"It's also a sacred ritual. You'll understand when you're older.\"\n\nThe afternoon wears on with much feasting and jollity. By evening you are happy to lie down in the plaza and drift off to sleep as the sultry night unfolds its canopy of stars. Tomorrow you must decide.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Continue overland to Ashaka", 8));
+        Choices.push_back(Choice::Base("Go downriver to the coast", 30));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story417 : public Story::Base
+{
+public:
+    Story417()
+    {
+        ID = 417;
+
+        Text = "You leave the fenlands and continue north. Arriving at last at the coast, you go to the edge of the sea and watch the setting sun gouge streaks of blood across a jade-grey sky.";
+
+        Image = "images/filler1.png";
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Choices.clear();
+
+        if (!Character::VERIFY_CODEWORDS(player, {Codeword::Type::OLMEK}))
+        {
+            Choices.push_back(Choice::Base("Set off walking along the coast towards Tahil", 228));
+            Choices.push_back(Choice::Base("Try to get a passage on a ship", 251));
+        }
+    }
+
+    int Continue(Character::Base &player) { return 260; }
+};
+
+class Story418 : public Story::Base
+{
+public:
+    Story418()
+    {
+        ID = 418;
+
+        Text = "\"You can wait for a poor man to show up if you like,\" you say to the noble, \"but I don't have the patience for that.\"\n\n\"Wait!\" he cries as you step out onto the beam. \"You'll fall into the river and be drowned!\"\n\nBut he has reckoned without your extraordinary sense of balance. You run along the thin edge of the beam like a tightrope walker and leap off safely on the far bank. Glancing back, you wave to him, saying flippantly, \"I'm an expert. Don't try it yourself.\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 36; }
+};
+
+class Story419 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story419()
+    {
+        ID = 419;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "One of the heads flinches back as you fake a lunge towards it, but then you are caught a glancing blow by one of the others which sends you reeling off across the sand. Your blood drenches the ground underfoot.";
+
+        PreText += "\n\n";
+
+        auto DAMAGE = -2;
+
+        if (Character::VERIFY_SKILL_ANY_ITEMS(player, Skill::Type::SWORDPLAY, {Item::Type::SWORD, Item::Type::JADE_SWORD}))
+        {
+            PreText += "[SWORDPLAY] ";
+
+            DAMAGE = -1;
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::TARGETING))
+        {
+            PreText += "[TARGETING] ";
+
+            DAMAGE = -1;
+        }
+        else if (Character::VERIFY_SKILL(player, Skill::Type::UNARMED_COMBAT))
+        {
+            PreText += "[UNARMED COMBAT] ";
+
+            DAMAGE = -1;
+        }
+
+        PreText += "You LOSE " + std::to_string(-DAMAGE) + " Life Point(s).";
+
+        Character::GAIN_LIFE(player, DAMAGE);
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 222; }
+};
+
+class Story420 : public Story::Base
+{
+public:
+    Story420()
+    {
+        ID = 420;
+
+        Text = "The hound's hot glowering gaze burns in the brutal white wedge of its face. It looks as strong as a jaguar, but with the jaguar's easygoing disposition. As it sees you take a step into the passage, its jaws begin to slaver and it gives a rasping snarl.";
+
+        Image = "images/pyramid.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("[FOLKLORE]", 247, Skill::Type::FOLKLORE));
+        Choices.push_back(Choice::Base("[TARGETING] Use a BLOWGUN", 316, Skill::Type::TARGETING));
+        Choices.push_back(Choice::Base("Rely on [CUNNING]", 270, Skill::Type::CUNNING));
+        Choices.push_back(Choice::Base("Use the HYDRA BLOOD BALL", 383, {Item::HYDRA_BLOOD_BALL}));
+        Choices.push_back(Choice::Base("Fight the beast", 293));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story421 : public Story::Base
+{
+public:
+    Story421()
+    {
+        ID = 421;
+
+        Text = "The OWL is a natural predator of the bats. It perches on your shoulder and scans the dim vaults of the hall, its luminous eyes drinking up even the faintest glimmer of light. You feel reassured that, even through your own senses are helpless in the darkness, the OWL remains alert and watchful. Any bat who dared to descend from its roost would meet a sticky end. They seem to know this, and despite the rank stench of the place you are able to get a restful night's sleep.\n\nYou RECOVER 1 Life Point.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GAIN_LIFE(player, 1);
+    }
+
+    int Continue(Character::Base &player) { return 41; }
+};
+
+class Story422 : public Story::Base
+{
+public:
+    Story422()
+    {
+        ID = 422;
+
+        Text = "You take out the chalice and hold it reverentially in your hands. If it is indeed Chalice of Life, it is the same bowl in which the Supreme God gave birth to mankind. Praying that it still has some power to work miracles, you set the chalice on the ground and place your brother's skull within.\n\nThe sun's golden rays blaze down, catching in an incandescent cusp on the rim of the chalice. A stream of heavy vapour rapidly boils up, and within seconds you can no longer make out the skull within its pool of gold mist. The mist rises up into a swirling column about two metres high and hangs there above the chalice, shining with an inner core of light.\n\nA brief gust of wind stirs and dissipates the mist. The last strands are blown away and you stare incredulously for a long moment before giving a great shout of joy. Your brother is standing there in front of you -- alive again!\n\n\"Morning Star!\" As two of you embrace, there is a crackle of energy and you feel the injuries and fatigue of the last few weeks burned away by life-giving magic.\n\n\"It is good to see you, Evening Star,\" says your brother, smiling as he hugs you to him.\n\n\"And you.\" You point towards the brooding shrine overlooking the ball contest arena. \"Now, brother, let's show that sorcerer our true mettle!\"\n\nYou RECOVER 4 Life Points.\n\nYou gained the codeword VENUS.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GAIN_LIFE(player, 4);
+
+        Character::GET_CODEWORDS(player, {Codeword::Type::VENUS});
+
+        Character::REMOVE_CODEWORD(player, Codeword::Type::ANGEL);
+    }
+
+    int Continue(Character::Base &player) { return 42; }
+};
+
+class Story423 : public Story::Base
+{
+public:
+    Story423()
+    {
+        ID = 423;
+
+        Choices.clear();
+    }
+
+    int Background(Character::Base &player)
+    {
+        if (Character::VERIFY_ITEMS(player, {Item::Type::HYDRA_BLOOD_BALL}))
+        {
+            return 386;
+        }
+        else
+        {
+            return 405;
+        }
+    }
+};
+
+class Story424 : public Story::Base
+{
+public:
+    Story424()
+    {
+        ID = 424;
+
+        Text = "\"The goddess oversees the tides,\" says the priest, accepting your gift with a heavy-lidded smile. \"Betake yourself to the town of Balak. Do not put to sea at once; wait a week before you set sail. Stay close to shore if you wish to avoid a hazardous adventure.\"\n\nYou wait for more, but he seems to have finished speaking. \"You haven't even mentioned the western desert,\" you say in a tone verging on indignation.\n\n\"I have given my advice on that. There is just one think I might add: seek the blood that is like sap.\"\n\nYou suck your teeth. \"Enigmatic,\" you comment drily.\n\n\"If it's clarity you're after, consult a merchant.\"\n\nSomewhat disgruntled, you retreat down the temple steps. You would have preferred to proudly turn your back on the smug priest, but custom forbids you to avert your face from any shrine as you leave it for fear of offending the deity within. Also, these temple steps are alarmingly steep; descending backwards is less nerve-wracking.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 93; };
+};
+
+class Story425 : public Story::Base
+{
+public:
+    Story425()
+    {
+        ID = 425;
+
+        Text = "You hold out the SHAWL, allowing the scaly talons to catch hold of it. The arm withdraws into the hole and there is a pause while the unseen creature examines what it has got. \"This is a stabai SHAWL!\" cries a voice full of insensate rage. \"A curse be upon you, you crafty stabai! May fungus infect your limbs and sickness burrow into your bodies. You'll not escape lightly for this outrage.\"\n\nThe stabai utter moans of dismay and melt away into the distance, alarmed by the monster's threats. For your part, you descend swiftly and quietly to examine your prize. Cleaning away the coating of muck, you discover it to be a circlet such as a nobleman or high priest might wear upon his brow. It is patterned with sacred glyphs and bears the cruciform symbol of the World Tree in inlaid plaques of jade. It is literally worth a king's ransom (GOLD DIADEM).";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::LOSE_ITEMS(player, {Item::Type::SHAWL});
+        Character::GET_ITEMS(player, {Item::GOLD_DIADEM});
+    }
+
+    int Continue(Character::Base &player) { return 324; };
+};
+
+class Story426 : public Story::Base
+{
+public:
+    Story426()
+    {
+        ID = 426;
+
+        Text = "Not far off, a young priestess is overseeing the work of a group of artisans. Out of curiosity you stroll over and see that they are decorating a temple wall with an overlay of stucco. Apprentices trowel the plaster into place and then senior artisans work with the speed and assurance of past masters, sculpting images of heroes, princes and gods as the priestess directs. Then, while the stucco is still damp, a second team steps in with pots of dye and applies bright colours. You can only marvel at the skill of the men's work.\n\nThe figures depicted in the frieze looks so startlingly vivid that you could almost imagine them coming to life and stepping out of the stucco.";
+
+        Image = "images/street-scene.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Go over and talk to the priestess", 54));
+        Choices.push_back(Choice::Base("Find a place to stay", 101, Choice::Type::MONEY, 1));
+        Choices.push_back(Choice::Base("Seek an audience with the King of Nachan", 77));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story427 : public Story::Base
+{
+public:
+    Story427()
+    {
+        ID = 427;
+
+        Text = "Covering your mouth and nose, you sift through the mouldered remains. You find a SHELL NECKLACKE and an IVORY RING adorning the corpse as jewellery. Inside the shattered remnants of the mouth rests a JADE BEAD intended for the dead woman's soul to purchase its passage into the afterlife. Her babies have no such beads -- conventional lore says that they are too young to have souls. You feel sad for them, seeing the tiny skeletons clutched so hopelessly to the mother's dead breast. Even across the gulf of centuries, it is a scene poignant with deep tragedy.\n\nIn front of the sarcophagus you now notice a funerary lamp. It still has little INCENSE inside it.\n\nThe two demons utter a stream of coarse remarks as you climb back down, annoyed at having been kept waiting. You ignore them. Your experience in the tomb has left you feeling melancholy and haunted.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Take = {{Item::SHELL_NECKLACE, Item::IVORY_RING, Item::INCENSE, Item::JADE_BEAD}};
+
+        Limit = 4;
+    }
+
+    int Continue(Character::Base &player) { return 167; }
+};
+
+class Story428 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story428()
+    {
+        ID = 428;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "You glance up. In the gloomy vault of the dragon's throat, giant tonsils hang like a pair of gongs. You can just reach one of the tonsils by standing on tiptoe. You start to tickle it, and soon the dragon gives a gagging cough and spits you out -- along with a torrent of bilious vomit which burns your skin.\n\nYou LOSE 1 Life Point.";
+
+        Character::GAIN_LIFE(player, -1);
+
+        if (player.Life > 0)
+        {
+            PreText += "\n\nYou slowly get to your feet. Kawak's face at this end is blunter, with bulbous white eyes and long tusks. He sees you grimace at the stink of the vomit and remarks in a rumbling voice: \"Be thankful I didn't eat you alive.\"\n\nNodding, you press on deeper towards the Deathlands.";
+        }
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 263; }
+};
+
+class Story429 : public Story::Base
+{
+public:
+    Story429()
+    {
+        ID = 429;
+
+        Text = "Your thrust skewers the hydra at the junction of its four necks. A ghastly multiple shriek splits the air. You are jerked off its feet by its death-throes and its blood gushes out into your face. It snaps feebly at you, but you cling on and sink the weapon deeper until finally it gives a last spasm and fall lifeless.\n\nAs you withdraw the weapon, a large drop of its green life-fluid oozes out of the wound and falls to the ground, congealing to form a rubbery ball such as one might use in the ritual ball contest of your people.";
+
+        Image = "images/filler3.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Take = {Item::HYDRA_BLOOD_BALL};
+
+        Limit = 1;
+    }
+
+    int Continue(Character::Base &player)
+    {
+        if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::ANGEL}))
+        {
+            return 15;
+        }
+        else
+        {
+            return 38;
+        }
+    }
+};
+
+class Story430 : public Story::Base
+{
+public:
+    Story430()
+    {
+        ID = 430;
+
+        Text = "\"We might wait for ever for a poor man to show up,\" you say. \"My quest demands rather more urgency than that.\"\n\nSo saying, you retrace your steps to the wooden gate. It is now sealed again by the convoluted knot, but with your dexterity it is the work of a moment to untie it. Returning outside, you untie the knot on the other gate and hurry through the other ledge, where you pick up the hooked POLE lying there. Putting the nobleman's plan into operation, the two of you slowly cross the twin beams, putting your weight onto the hooked poles to counterbalance one another.\n\nThe torrent of blood churns beneath you. One slip and you would both be borne away to your doom. But at last you reach the far bank and step onto firm dry land. With a sigh of relief, the noble casts his pole into the river. You might wish to keep yours.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Keep the POLE", 399, Choice::Type::GET_ITEMS, {Item::POLE}));
+        Choices.push_back(Choice::Base("Leave it", 399));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story431 : public Story::Base
+{
+public:
+    Story431()
+    {
+        ID = 431;
+
+        Text = "This courtyard is surrounded by low grey walls that lie like borders of soot around a plaza ablaze in the blistering sunshine. In the far wall is a massive of intertwined human bones and skulls. \"They are the previous victims of our master,\" says the chief courtier with a leer when he sees you blanch. \"Soon your own bones will be added to that gate.\"\n\nIgnoring him , you turn your attention to five windowless buildings standing in the wide plaza. \"And those?\" you ask.\n\nThey are the Five Houses of Destiny,\" he says. \"If you can pass one night in each, the gate will open. Then you will gaze on the countenance of Necklace of Skulls.\"\n\nYou wait through a long afternoon until the sun dips into a red hot shimmer along the western horizon. The heat of the day has left you giddy, but you do your best not to show it as the courtiers come to lead you to the first of the buildings. As they open the door, you are confronted by a wave of fiery heat as though from an open kiln. The interior of the building is a single stone hall with a blazing channel of smouldering charcoal set along it. Large stones warmed to red heat surround it. Sweat erupts from your pores as you are ushered inside.\n\n\"This is the House of Fire,\" says the chief courtier. \"Have a good night. I'll come for you in the morning -- should you survive.\"\n\nThe door closes and you are left sealed within the House of Fire. Its smoky confines are swelteringly airless, and your only rest is not true sleep, but a listless swoon brought on by heat exhaustion.\n\nYou LOSE 2 Life Points.";
+
+        Image = "images/filler7.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GAIN_LIFE(player, -2);
+    }
+
+    int Continue(Character::Base &player) { return 403; }
+};
+
+class Story432 : public Story::Base
+{
+public:
+    Story432()
+    {
+        ID = 432;
+
+        Text = "Your eyes can make out nothing in the inky darkness that enfolds you. As you squat down on the guano-spattered floor, there is a flap of leather wings and the first of the bats comes fluttering down towards you. You put an arm up to fend it away. Then suddenly you feel a tingle of cold alarm as you realize someone is standing beside you.\n\n\"This mortal is under my protection,\" says a familiar voice. \"Return to your roosts. There will be no drinking of blood for any of you tonight.\"\n\nThe rustle of wings recedes into the rafters. You turn, straining to make out the stranger in the absolute dark. \"Who are you?\" you ask him.\n\n\"A friend.\" He touches your arm reassuringly. \"You helped me once, now I am returning the favour. Go to sleep now. These bats are my subjects, and they will not dare harm you.\"\n\nYou enjoy a restful night.\n\nYou RECOVER 1 Life Point.";
+
+        Image = "images/filler4.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Character::GAIN_LIFE(player, 1);
+
+        Character::REMOVE_CODEWORD(player, Codeword::Type::ZOTZ);
+    }
+
+    int Continue(Character::Base &player) { return 41; }
+};
+
+class Story433 : public Story::Base
+{
+public:
+    Story433()
+    {
+        ID = 433;
+
+        Text = "Your opponents have had enough. They abandon their home and go running off yelling, \"Flee! The lunatic will kill us all!\" You watch them splash through the verges of the pond and vanish into the curtain of undergrowth. You nod in satisfaction. It is only when you examine the roasting carcass on the fire that you discover you made a mistake. It is not a human baby they were cooking, but a monkey. So they were not cannibals after all. They must have been the jungle people that the hunter told you about.\n\nA swift examination of the hut reveals a well-stocked larder containing a HAUNCH OF VENISON, three PAPAYA, a bag of CHILLI PEPPERs and a WATERSKIN.\n\nYou decide against taking the roast monkey. You do not think you could bring yourself to eat anything that looks so much like a person. Now you had better leave before the jungle people return.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        Take = {{Item::HAUNCH_OF_VENISON, Item::PAPAYA, Item::PAPAYA, Item::PAPAYA, Item::CHILLI_PEPPERS, Item::WATERSKIN}};
+
+        Limit = 6;
+    }
+
+    int Continue(Character::Base &player) { return 118; }
+};
+
+class Story434 : public Story::Base
+{
+public:
+    Story434()
+    {
+        ID = 434;
+
+        Text = "Exposed to the full heat of the sun, you know you would not last three days. You must rest in the shade in the daytime, travelling on at sunset. By keeping on the move, you can keep warm despite the night-time chill.\n\nYou slip a pebble in your mouth. Sucking it will stave of thirst. You must conserve your water if you are to survive.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 46; }
+};
+
+class Story435 : public Story::Base
+{
+public:
+    Story435()
+    {
+        ID = 435;
+
+        Text = "You cast a negation spell, causing the flames to peter out. Jade Thunder scrabbles forward across the sand and snatches up his wand with a great shout of joy. \"At last!\" he cries. \"Now let me show you what can be achieved by a Grand Adept of our most potent art.\"";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 91; }
+};
+
+class Story436 : public Story::Base
+{
+public:
+    Story436()
+    {
+        ID = 436;
+
+        Text = "\"Easy to repay us,\" says one fellow, flashing his teeth in a broad white grin. He holds up the SHAWL you acquired earlier. \"The stabai cause us a lot of mischief. If we had their SHAWL, they wouldn't bother us.\"\n\nAfter some haggling, the jungle people agree to offer you a HAUNCH OF VENISON in exchange for the SHAWL.\n\nYou are ready to set out. As you gather up your belongings, a youth who has been watching you keenly without joining the conversation sidles up to you. \"I could guide you out of the woods if you think you might get lost,\" he suggests. You are unsure how to take this offer. The jungle dwellers do not observe the same rules of hospitality as civilized people, and for all you know he might lead you into a trap.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Let him guide you", 410));
+        Choices.push_back(Choice::Base("Set out alone", 118));
+
+        Trade = std::make_pair(Item::SHAWL, Item::HAUNCH_OF_VENISON);
+
+        Controls = Story::Controls::TRADE;
+    }
+};
+
+class Story437 : public Story::Base
+{
+public:
+    Story437()
+    {
+        ID = 437;
+
+        Text = "You set sail and continue your voyage west.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Background(Character::Base &player)
+    {
+        if (Character::VERIFY_CODEWORDS(player, {Codeword::Type::EB}))
+        {
+            return 387;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+
+    int Continue(Character::Base &player) { return 300; }
+};
+
+class Story438 : public Story::Base
+{
+public:
+    std::string PreText = "";
+
+    Story438()
+    {
+        ID = 438;
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    void Event(Character::Base &player)
+    {
+        PreText = "The blistering heat is sapping your last reserves of strength. Your lips are dry cracked husks and your skin is covered in blackened blisters. You cannot endure for long.";
+
+        PreText += "\n\n";
+
+        auto DAMAGE = -2;
+
+        if (Character::VERIFY_SKILL(player, Skill::Type::WILDERNESS_LORE))
+        {
+            PreText += "[WILDERNESS LORE] Your hardiness inures you to the extreme heat. ";
+
+            DAMAGE = -1;
+        }
+
+        PreText += "You LOSE " + std::to_string(-DAMAGE) + " Life Point(s).";
+
+        Character::GAIN_LIFE(player, DAMAGE);
+
+        Text = PreText.c_str();
+    }
+
+    int Continue(Character::Base &player) { return 303; }
+};
+
+class Story439 : public Story::Base
+{
+public:
+    Story439()
+    {
+        ID = 439;
+
+        Text = "You conjure a swarm of little green ants which follow the motion of your wand. Pointing to the dragon's tonsils, which dangle above you in the cavern of his mouth like a pair of giant gongs, you direct the ants to crawl up across them. The ticklish effect of thousands of tiny scuttling legs soon has the desired effect, and the dragon spits you out into the open with a gagging cough.\n\nYou get to your feet and wring the dragon's saliva out of your robes. It could have been worse: he might have thrown up. Kawak hangs at the lip of the canyon, glowering as he spits out ants like a man spitting papaya pips. You hurry off before he turns nasty.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 263; }
+};
+
+class Story440 : public Story::Base
+{
+public:
+    Story440()
+    {
+        ID = 440;
+
+        Text = "You smear yourself with the grease of the meat.\n\nSteeling yourself, you walk down into the lake. The bitter cold bites at your flesh, but the insulating layer of deer fat protects you from the worst of it. Half stumbling, half floating, you descend the staircase towards a blaze of pulsating green light.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+        Choices.push_back(Choice::Base("Keep the HAUNCH OF VENISON", 173));
+        Choices.push_back(Choice::Base("Leave it", 173, Choice::Type::LOSE_ITEMS, {Item::HAUNCH_OF_VENISON}));
+
+        Controls = Story::Controls::STANDARD;
+    }
+};
+
+class Story441 : public Story::Base
+{
+public:
+    Story441()
+    {
+        ID = 441;
+
+        Text = "You know that the terrain of the forest generally rises towards the south and west. On the basis of this, the direction of the woodland streams gives you at least a hint about which way to go to reach Nachan. You need to bear steadily left until you begin to see signs of human habitation.";
+
+        Image = "images/filler1.png";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+    }
+
+    int Continue(Character::Base &player) { return 326; }
+};
+
+class Story442 : public Story::Base
+{
+public:
+    Story442()
+    {
+        ID = 442;
+
+        Text = "As you and your brother cross the courtyard and pass through the palace gates, you can feel the ground shaking under your feet. You reach a dune and turn to look back. The pyramid and surrounding buildings are sinking into the sand. In minutes they have vanished entirely, and there is no sign to show that this was ever the spot where Necklace of Skulls dwelt among his bestial courtiers. You look around for the courtiers, but see only a pack of malnourished dogs slinking off amid the dunes.\n\n\"It's a long way home,\" says Morning Star. \"Fraught with danger every step of the way, I shouldn't wonder. Heat, thirst, sandstorms, poisonous snakes ...\" He says all this with a smile.\n\nYou smile too. \"After all we've been through, it'll seem like a picnic! Well brother, what are we waiting for?\"\n\nAnd, turning your faces to the east, you set out across the drifting sands.";
+
+        Music = "music/victory.ogg";
+
+        Choices.clear();
+
+        Controls = Story::Controls::STANDARD;
+
+        Type = Story::Type::GOOD;
+    }
+};
+
+auto story400 = Story400();
+auto story401 = Story401();
+auto story402 = Story402();
+auto story403 = Story403();
+auto story404 = Story404();
+auto story405 = Story405();
+auto story406 = Story406();
+auto story407 = Story407();
+auto story408 = Story408();
+auto story409 = Story409();
+auto story410 = Story410();
+auto story411 = Story411();
+auto story412 = Story412();
+auto story413 = Story413();
+auto story414 = Story414();
+auto story415 = Story415();
+auto story416 = Story416();
+auto story417 = Story417();
+auto story418 = Story418();
+auto story419 = Story419();
+auto story420 = Story420();
+auto story421 = Story421();
+auto story422 = Story422();
+auto story423 = Story423();
+auto story424 = Story424();
+auto story425 = Story425();
+auto story426 = Story426();
+auto story427 = Story427();
+auto story428 = Story428();
+auto story429 = Story429();
+auto story430 = Story430();
+auto story431 = Story431();
+auto story432 = Story432();
+auto story433 = Story433();
+auto story434 = Story434();
+auto story435 = Story435();
+auto story436 = Story436();
+auto story437 = Story437();
+auto story438 = Story438();
+auto story439 = Story439();
+auto story440 = Story440();
+auto story441 = Story441();
+auto story442 = Story442();
+
+void InitializeStories400()
+{
+    Stories.insert(Stories.end(), {
+        &story400, &story401, &story402, &story403, &story404, &story405, &story406, &story407, &story408, &story409,
+        &story410, &story411, &story412, &story413, &story414, &story415, &story416, &story417, &story418, &story419,
+        &story420, &story421, &story422, &story423, &story424, &story425, &story426, &story427, &story428, &story429,
+        &story430, &story431, &story432, &story433, &story434, &story435, &story436, &story437, &story438, &story439,
+        &story440, &story441, &story442});
+}
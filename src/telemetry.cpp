@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "telemetry.hpp"
+
+namespace Telemetry
+{
+    // Single producer (the render thread), single consumer (the writer)
+    class Ring
+    {
+    private:
+        Telemetry::Event events[Telemetry::CAPACITY];
+
+        // next slot written by the producer
+        std::atomic<uint32_t> head = {0};
+
+        // next slot read by the consumer
+        std::atomic<uint32_t> tail = {0};
+
+        std::atomic<uint32_t> dropped = {0};
+
+    public:
+        bool Push(const Telemetry::Event &event)
+        {
+            auto h = head.load(std::memory_order_relaxed);
+
+            if (h - tail.load(std::memory_order_acquire) >= Telemetry::CAPACITY)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+
+                return false;
+            }
+
+            events[h & (Telemetry::CAPACITY - 1)] = event;
+
+            head.store(h + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        // Pass the pending events (at most two runs, the second after the wrap) to the consumer and free their slots
+        template <typename F>
+        uint32_t Drain(F consume)
+        {
+            auto t = tail.load(std::memory_order_relaxed);
+
+            auto h = head.load(std::memory_order_acquire);
+
+            auto count = h - t;
+
+            if (count > 0)
+            {
+                auto first = t & (Telemetry::CAPACITY - 1);
+
+                auto run = std::min(count, Telemetry::CAPACITY - first);
+
+                consume(&events[first], run);
+
+                if (run < count)
+                {
+                    consume(&events[0], count - run);
+                }
+
+                tail.store(h, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        uint32_t Dropped()
+        {
+            return dropped.load(std::memory_order_relaxed);
+        }
+    };
+
+    class Writer
+    {
+    private:
+        std::thread worker;
+
+        std::mutex lock;
+
+        std::condition_variable signal;
+
+        bool running = false;
+
+        FILE *output = NULL;
+
+        void write(const Telemetry::Event *events, uint32_t count)
+        {
+            fwrite(events, sizeof(Telemetry::Event), count, output);
+        }
+
+        void flush()
+        {
+            if (Events.Drain([this](const Telemetry::Event *events, uint32_t count) { write(events, count); }) > 0)
+            {
+                fflush(output);
+            }
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> guard(lock);
+
+            while (running)
+            {
+                // the producer never signals, the ring is emptied at a steady pace
+                signal.wait_for(guard, std::chrono::milliseconds(Telemetry::FLUSH_INTERVAL), [this] { return !running; });
+
+                guard.unlock();
+
+                flush();
+
+                guard.lock();
+            }
+
+            flush();
+        }
+
+    public:
+        Telemetry::Ring Events;
+
+        std::chrono::steady_clock::time_point Started = std::chrono::steady_clock::now();
+
+        bool Running()
+        {
+            return running;
+        }
+
+        void Start(std::string directory)
+        {
+            if (running)
+            {
+                return;
+            }
+
+            std::error_code error;
+
+            std::filesystem::create_directories(directory, error);
+
+            auto now = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
+
+            auto file = directory + "/" + std::to_string(now) + Telemetry::EXTENSION;
+
+            output = fopen(file.c_str(), "wb");
+
+            if (output == NULL)
+            {
+                std::cerr << "Unable to write telemetry to " << file << "!" << std::endl;
+
+                return;
+            }
+
+            Telemetry::Header header;
+
+            std::memcpy(header.Magic, Telemetry::MAGIC, sizeof(header.Magic));
+
+            header.Version = Telemetry::VERSION;
+
+            header.Size = sizeof(Telemetry::Event);
+
+            header.Reserved = 0;
+
+            header.Start = (int64_t)now;
+
+            fwrite(&header, sizeof(header), 1, output);
+
+            Started = std::chrono::steady_clock::now();
+
+            running = true;
+
+            worker = std::thread(&Telemetry::Writer::run, this);
+        }
+
+        void Stop()
+        {
+            if (running)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    running = false;
+                }
+
+                signal.notify_one();
+
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+
+                fclose(output);
+
+                output = NULL;
+            }
+        }
+
+        ~Writer()
+        {
+            Stop();
+        }
+    };
+
+    Telemetry::Writer Log = Telemetry::Writer();
+
+    void Start(std::string directory)
+    {
+        Log.Start(directory);
+    }
+
+    void Push(Telemetry::Kind kind, int section, int value)
+    {
+        if (!Log.Running())
+        {
+            return;
+        }
+
+        Telemetry::Event event;
+
+        event.Time = (uint32_t)((std::chrono::steady_clock::now() - Log.Started) / std::chrono::milliseconds(1));
+
+        event.Kind = kind;
+
+        event.Reserved = 0;
+
+        event.Section = section;
+
+        event.Value = value;
+
+        Log.Events.Push(event);
+    }
+
+    uint32_t Dropped()
+    {
+        return Log.Events.Dropped();
+    }
+
+    void Stop()
+    {
+        Log.Stop();
+
+        if (Telemetry::Dropped() > 0)
+        {
+            std::cerr << "Telemetry: " << Telemetry::Dropped() << " events dropped (ring full)" << std::endl;
+        }
+    }
+} // namespace Telemetry
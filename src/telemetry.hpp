@@ -0,0 +1,83 @@
+#ifndef __TELEMETRY__HPP__
+#define __TELEMETRY__HPP__
+
+#include <cstdint>
+#include <string>
+
+// Gameplay telemetry (telemetry.cpp, --telemetry). Sections entered, choices taken, deaths and trades are pushed into a
+// fixed-size ring without locks or allocations, and a background thread appends them to a binary log in the saved
+// games folder. Events pushed while the ring is full are dropped and counted. The logs of many machines are combined
+// into per-section heatmaps by TelemetryHeatmap.exe (heatmap.cpp), which only needs this header.
+namespace Telemetry
+{
+    enum class Kind : uint16_t
+    {
+        SECTION = 0, // Value: life points after the section's Event
+        CHOICE,      // Value: destination
+        DOOM,        // the adventure failed
+        DEATH,       // life points reached 0
+        BUY,         // Value: item type
+        SELL,        // Value: item type
+        BARTER,      // Value: item type given
+        TRADE        // Value: item type given
+    };
+
+    // One log record
+    struct Event
+    {
+        // Milliseconds since the session started
+        uint32_t Time;
+
+        Telemetry::Kind Kind;
+
+        uint16_t Reserved;
+
+        int32_t Section;
+
+        int32_t Value;
+    };
+
+    // At the start of each log, followed by the events
+    struct Header
+    {
+        char Magic[4];
+
+        uint32_t Version;
+
+        uint32_t Size;
+
+        uint32_t Reserved;
+
+        // Milliseconds since the epoch when the session started
+        int64_t Start;
+    };
+
+    const char MAGIC[4] = {'S', 'K', 'T', 'L'};
+
+    const uint32_t VERSION = 1;
+
+    // Events held by the ring (a power of two)
+    const uint32_t CAPACITY = 4096;
+
+    // Milliseconds between writes
+    const int FLUSH_INTERVAL = 2000;
+
+    // Folder under the saved games folder, one log per session
+    const char *const DIRECTORY = "telemetry";
+
+    const char *const EXTENSION = ".tlm";
+
+    // Start the writer and the session log
+    void Start(std::string directory);
+
+    // Render thread only. Never blocks.
+    void Push(Telemetry::Kind kind, int section, int value = 0);
+
+    // Events lost because the ring was full
+    uint32_t Dropped();
+
+    // Write what is pending and join the writer
+    void Stop();
+} // namespace Telemetry
+
+#endif
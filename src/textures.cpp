@@ -0,0 +1,210 @@
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+
+#include "memory.hpp"
+#include "textures.hpp"
+
+namespace Textures
+{
+    class Entry
+    {
+    public:
+        SDL_Texture *Texture = NULL;
+
+        // written into the surface's userdata, a surface allocated at the same address will not carry it
+        uintptr_t Stamp = 0;
+
+        std::list<SDL_Surface *>::iterator Recent;
+    };
+
+    Uint32 Preferred = SDL_PIXELFORMAT_ARGB8888;
+
+    std::mutex Lock;
+
+    std::unordered_map<SDL_Surface *, Textures::Entry> Cache = std::unordered_map<SDL_Surface *, Textures::Entry>();
+
+    // most recently drawn first
+    std::list<SDL_Surface *> Recent = std::list<SDL_Surface *>();
+
+    // textures of surfaces freed on other threads, destroyed on the next Get
+    std::vector<SDL_Texture *> Released = std::vector<SDL_Texture *>();
+
+    uintptr_t Stamps = 0;
+
+    void Initialize(SDL_Renderer *renderer)
+    {
+        SDL_RendererInfo info;
+
+        if (renderer && SDL_GetRendererInfo(renderer, &info) == 0)
+        {
+            // the first format with an alpha channel, in the renderer's order of preference
+            for (auto i = 0; i < info.num_texture_formats; i++)
+            {
+                auto format = info.texture_formats[i];
+
+                if (!SDL_ISPIXELFORMAT_FOURCC(format) && SDL_ISPIXELFORMAT_ALPHA(format))
+                {
+                    Preferred = format;
+
+                    break;
+                }
+            }
+        }
+    }
+
+    Uint32 Format()
+    {
+        return Preferred;
+    }
+
+    SDL_Surface *Native(Memory::Type type, SDL_Surface *surface)
+    {
+        if (surface == NULL || surface->format->format == Preferred)
+        {
+            return surface;
+        }
+
+        auto converted = SDL_ConvertSurfaceFormat(surface, Preferred, 0);
+
+        if (converted == NULL)
+        {
+            return surface;
+        }
+
+        // an opaque image stays opaque (not blended) after gaining an alpha channel
+        SDL_BlendMode blending = SDL_BLENDMODE_NONE;
+
+        SDL_GetSurfaceBlendMode(surface, &blending);
+
+        SDL_SetSurfaceBlendMode(converted, blending);
+
+        Memory::FreeSurface(surface);
+
+        return Memory::Track(type, converted);
+    }
+
+    // with the lock held
+    void Drop(std::unordered_map<SDL_Surface *, Textures::Entry>::iterator entry)
+    {
+        Released.push_back(entry->second.Texture);
+
+        Recent.erase(entry->second.Recent);
+
+        Cache.erase(entry);
+    }
+
+    SDL_Texture *Get(SDL_Renderer *renderer, SDL_Surface *surface)
+    {
+        if (renderer == NULL || surface == NULL)
+        {
+            return NULL;
+        }
+
+        auto released = std::vector<SDL_Texture *>();
+
+        SDL_Texture *texture = NULL;
+
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            auto entry = Cache.find(surface);
+
+            if (entry != Cache.end() && (uintptr_t)surface->userdata == entry->second.Stamp)
+            {
+                Recent.splice(Recent.begin(), Recent, entry->second.Recent);
+
+                texture = entry->second.Texture;
+            }
+            else if (entry != Cache.end())
+            {
+                // a new surface at the address of one that was freed without Memory::FreeSurface
+                Textures::Drop(entry);
+            }
+
+            released.swap(Released);
+        }
+
+        for (auto old : released)
+        {
+            Memory::DestroyTexture(old);
+        }
+
+        if (texture)
+        {
+            return texture;
+        }
+
+        texture = Memory::CreateTexture(renderer, surface);
+
+        if (texture)
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+
+            auto entry = Textures::Entry();
+
+            entry.Texture = texture;
+
+            entry.Stamp = ++Stamps;
+
+            surface->userdata = (void *)entry.Stamp;
+
+            Recent.push_front(surface);
+
+            entry.Recent = Recent.begin();
+
+            Cache[surface] = entry;
+
+            while (Cache.size() > Textures::MAX_TEXTURES)
+            {
+                Textures::Drop(Cache.find(Recent.back()));
+            }
+        }
+
+        return texture;
+    }
+
+    void Forget(SDL_Surface *surface)
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        auto entry = Cache.find(surface);
+
+        if (entry != Cache.end())
+        {
+            Textures::Drop(entry);
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        for (auto &entry : Cache)
+        {
+            Released.push_back(entry.second.Texture);
+        }
+
+        Cache.clear();
+
+        Recent.clear();
+
+        for (auto texture : Released)
+        {
+            Memory::DestroyTexture(texture);
+        }
+
+        Released.clear();
+    }
+
+    int Count()
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        return (int)Cache.size();
+    }
+} // namespace Textures
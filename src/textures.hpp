@@ -0,0 +1,38 @@
+#ifndef __TEXTURES__HPP__
+#define __TEXTURES__HPP__
+
+#include <SDL.h>
+
+#include "memory.hpp"
+
+// Textures uploaded once per surface (textures.cpp). Surfaces are converted to the renderer's preferred texture format
+// when they are loaded, so an upload is a plain copy, and the texture is kept until the surface is freed (through
+// Memory::FreeSurface) or pushed out by newer ones. Surfaces must not be changed after they were first drawn.
+namespace Textures
+{
+    // Textures kept at most, the least recently drawn are destroyed first
+    const int MAX_TEXTURES = 96;
+
+    // Query the preferred format of the renderer (once, before any surface is loaded)
+    void Initialize(SDL_Renderer *renderer);
+
+    // Preferred texture format (ARGB8888 until Initialize)
+    Uint32 Format();
+
+    // Convert the surface to the preferred format, freeing the original. The copy is attributed to the subsystem.
+    SDL_Surface *Native(Memory::Type type, SDL_Surface *surface);
+
+    // Texture of the surface, uploaded the first time it is drawn. Owned by the cache. Render thread only.
+    SDL_Texture *Get(SDL_Renderer *renderer, SDL_Surface *surface);
+
+    // The surface is about to be freed. Safe on any thread, the texture is destroyed later on the render thread.
+    void Forget(SDL_Surface *surface);
+
+    // Destroy all textures (before the renderer is destroyed)
+    void Clear();
+
+    // Number of textures held
+    int Count();
+} // namespace Textures
+
+#endif
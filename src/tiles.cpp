@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include "handles.hpp"
+#include "memory.hpp"
+#include "save.hpp"
+#include "decode.hpp"
+#include "tiles.hpp"
+
+namespace fs = std::filesystem;
+
+namespace Tiles
+{
+    long long FileSize(const char *file)
+    {
+        std::error_code error;
+
+        auto size = fs::file_size(file, error);
+
+        return error ? 0 : (long long)size;
+    }
+
+    bool Pyramid::Load(std::string directory, const char *image)
+    {
+        std::ifstream in(directory + "/" + Tiles::INDEX);
+
+        auto tag = std::string();
+
+        auto version = 0;
+
+        auto size = 0;
+
+        if (!in.is_open() || !(in >> tag >> version) || tag != "TILES" || version != 1)
+        {
+            return false;
+        }
+
+        if (!(in >> tag >> size >> tag >> Source) || size != Tiles::SIZE || Source != Tiles::FileSize(image))
+        {
+            return false;
+        }
+
+        Levels.clear();
+
+        auto level = Tiles::Level();
+
+        while (in >> tag >> level.Width >> level.Height && tag == "LEVEL")
+        {
+            Levels.push_back(level);
+        }
+
+        Directory = directory;
+
+        return Levels.size() > 0 && Levels[0].Width > 0 && Levels[0].Height > 0;
+    }
+
+    std::string Pyramid::File(int level, int column, int row)
+    {
+        return Directory + "/" + std::to_string(level) + "-" + std::to_string(column) + "-" + std::to_string(row) + ".png";
+    }
+
+    bool Bake(const char *image, std::string directory)
+    {
+        auto source = Handle::Surface(Memory::Track(Memory::Type::IMAGES, IMG_Load(image)));
+
+        if (!source)
+        {
+            std::cerr << "Unable to load image " << image << "! SDL Error: " << SDL_GetError() << std::endl;
+
+            return false;
+        }
+
+        // the levels only live while the bake runs, they are counted with the decoded images meanwhile
+        auto level = Handle::Surface(Memory::Track(Memory::Type::IMAGES, SDL_ConvertSurfaceFormat(source.get(), SDL_PIXELFORMAT_ARGB8888, 0)));
+
+        source.reset();
+
+        std::error_code error;
+
+        fs::create_directories(directory, error);
+
+        auto pyramid = Tiles::Pyramid();
+
+        pyramid.Directory = directory;
+
+        auto ok = (level && !error);
+
+        while (ok)
+        {
+            auto dimensions = Tiles::Level();
+
+            dimensions.Width = level->w;
+
+            dimensions.Height = level->h;
+
+            pyramid.Levels.push_back(dimensions);
+
+            SDL_SetSurfaceBlendMode(level.get(), SDL_BLENDMODE_NONE);
+
+            for (auto row = 0; ok && row < dimensions.Rows(); row++)
+            {
+                for (auto column = 0; ok && column < dimensions.Columns(); column++)
+                {
+                    SDL_Rect area = {column * Tiles::SIZE, row * Tiles::SIZE, std::min(Tiles::SIZE, level->w - column * Tiles::SIZE), std::min(Tiles::SIZE, level->h - row * Tiles::SIZE)};
+
+                    auto tile = Handle::Surface(Memory::Track(Memory::Type::IMAGES, SDL_CreateRGBSurfaceWithFormat(0, area.w, area.h, 32, SDL_PIXELFORMAT_ARGB8888)));
+
+                    ok = (tile && SDL_BlitSurface(level.get(), &area, tile.get(), NULL) == 0 && IMG_SavePNG(tile.get(), pyramid.File((int)pyramid.Levels.size() - 1, column, row).c_str()) == 0);
+                }
+            }
+
+            if (!ok || (level->w <= Tiles::SIZE && level->h <= Tiles::SIZE))
+            {
+                break;
+            }
+
+            auto next = Handle::Surface(Memory::Track(Memory::Type::IMAGES, SDL_CreateRGBSurfaceWithFormat(0, std::max(1, (level->w + 1) / 2), std::max(1, (level->h + 1) / 2), 32, SDL_PIXELFORMAT_ARGB8888)));
+
+            ok = (next && SDL_SoftStretchLinear(level.get(), NULL, next.get(), NULL) == 0);
+
+            level = std::move(next);
+        }
+
+        if (!ok)
+        {
+            std::cerr << "Unable to cut " << image << " into tiles in " << directory << "! SDL Error: " << SDL_GetError() << std::endl;
+
+            return false;
+        }
+
+        // the index is written last, so an interrupted bake is not used
+        std::ofstream out(directory + "/" + Tiles::INDEX);
+
+        out << "TILES 1" << std::endl;
+
+        out << "SIZE " << Tiles::SIZE << " SOURCE " << Tiles::FileSize(image) << std::endl;
+
+        for (auto &dimensions : pyramid.Levels)
+        {
+            out << "LEVEL " << dimensions.Width << " " << dimensions.Height << std::endl;
+        }
+
+        return out.good();
+    }
+
+    bool Viewer::Open(const char *image)
+    {
+        auto name = fs::path(image).stem().string();
+
+        auto baked = std::string(Tiles::DIRECTORY) + "/" + name;
+
+        auto cached = savePath() + "/" + Tiles::DIRECTORY + "/" + name;
+
+        if (pyramid.Load(baked, image) || pyramid.Load(cached, image))
+        {
+            return true;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        if (!Tiles::Bake(image, cached) || !pyramid.Load(cached, image))
+        {
+            return false;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        std::cerr << "Cut " << image << " into " << pyramid.Levels.size() << " tile levels in " << elapsed << " ms" << std::endl;
+
+        return true;
+    }
+
+    int Viewer::Width()
+    {
+        return pyramid.Levels.size() > 0 ? pyramid.Levels[0].Width : 0;
+    }
+
+    int Viewer::Height()
+    {
+        return pyramid.Levels.size() > 0 ? pyramid.Levels[0].Height : 0;
+    }
+
+    double Viewer::MinZoom()
+    {
+        if (Width() <= 0 || Height() <= 0 || viewW <= 0 || viewH <= 0)
+        {
+            return 1.0;
+        }
+
+        return std::min((double)viewW / Width(), (double)viewH / Height());
+    }
+
+    double Viewer::MaxZoom()
+    {
+        // four screen pixels per image pixel, or the whole image if it is tiny
+        return std::max(4.0, MinZoom());
+    }
+
+    void Viewer::clamp()
+    {
+        Zoom = std::min(std::max(Zoom, MinZoom()), MaxZoom());
+
+        auto halfw = viewW / 2.0 / Zoom;
+
+        auto halfh = viewH / 2.0 / Zoom;
+
+        // keep the image in view, centred along a side that is smaller than the view
+        CenterX = (2.0 * halfw >= Width()) ? Width() / 2.0 : std::min(std::max(CenterX, halfw), Width() - halfw);
+
+        CenterY = (2.0 * halfh >= Height()) ? Height() / 2.0 : std::min(std::max(CenterY, halfh), Height() - halfh);
+    }
+
+    void Viewer::Fit(int w, int h)
+    {
+        viewW = w;
+
+        viewH = h;
+
+        Zoom = MinZoom();
+
+        CenterX = Width() / 2.0;
+
+        CenterY = Height() / 2.0;
+
+        clamp();
+    }
+
+    void Viewer::Pan(double dx, double dy)
+    {
+        CenterX += dx / Zoom;
+
+        CenterY += dy / Zoom;
+
+        clamp();
+    }
+
+    void Viewer::ZoomAt(double factor, double x, double y)
+    {
+        // image point under (x, y)
+        auto px = CenterX + (x - viewW / 2.0) / Zoom;
+
+        auto py = CenterY + (y - viewH / 2.0) / Zoom;
+
+        Zoom = std::min(std::max(Zoom * factor, MinZoom()), MaxZoom());
+
+        CenterX = px - (x - viewW / 2.0) / Zoom;
+
+        CenterY = py - (y - viewH / 2.0) / Zoom;
+
+        clamp();
+    }
+
+    SDL_Texture *Viewer::tile(SDL_Renderer *renderer, Key key, bool &pending)
+    {
+        auto found = cache.find(key);
+
+        if (found != cache.end())
+        {
+            recent.splice(recent.begin(), recent, found->second.Order);
+
+            found->second.Frame = frame;
+
+            return found->second.Texture.get();
+        }
+
+        auto file = pyramid.File(std::get<0>(key), std::get<1>(key), std::get<2>(key));
+
+        auto decoded = Decode::Request(file.c_str(), Decode::Priority::NOW);
+
+        // without the pool the future is ready (and empty) at once, then the tile is decoded here
+        if (decoded.valid() && decoded.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            pending = true;
+
+            return NULL;
+        }
+
+        auto surface = Handle::Surface(Decode::Take(file.c_str()));
+
+        if (!surface)
+        {
+            return NULL;
+        }
+
+        auto texture = Memory::CreateTexture(renderer, surface.get());
+
+        if (texture)
+        {
+            auto &entry = cache[key];
+
+            entry.Texture.reset(texture);
+
+            entry.Order = recent.insert(recent.begin(), key);
+
+            entry.Frame = frame;
+
+            // the least recently drawn go first, but never a tile of this frame (the rest are newer still)
+            while (recent.size() > capacity)
+            {
+                auto oldest = cache.find(recent.back());
+
+                if (oldest != cache.end() && oldest->second.Frame == frame)
+                {
+                    break;
+                }
+
+                if (oldest != cache.end())
+                {
+                    cache.erase(oldest);
+                }
+
+                recent.pop_back();
+            }
+        }
+
+        return texture;
+    }
+
+    void Viewer::span(int level, double left, double top, int w, int h, int &column0, int &column1, int &row0, int &row1)
+    {
+        auto &dimensions = pyramid.Levels[level];
+
+        auto fx = (double)Width() / dimensions.Width;
+
+        auto fy = (double)Height() / dimensions.Height;
+
+        column0 = std::max(0, (int)(left / fx / Tiles::SIZE));
+
+        column1 = std::min(dimensions.Columns() - 1, (int)((left + w / Zoom) / fx / Tiles::SIZE));
+
+        row0 = std::max(0, (int)(top / fy / Tiles::SIZE));
+
+        row1 = std::min(dimensions.Rows() - 1, (int)((top + h / Zoom) / fy / Tiles::SIZE));
+    }
+
+    bool Viewer::Render(SDL_Renderer *renderer, int x, int y, int w, int h)
+    {
+        if (pyramid.Levels.empty() || renderer == NULL)
+        {
+            return false;
+        }
+
+        if (w != viewW || h != viewH)
+        {
+            viewW = w;
+
+            viewH = h;
+
+            clamp();
+        }
+
+        auto pending = false;
+
+        auto left = CenterX - w / 2.0 / Zoom;
+
+        auto top = CenterY - h / 2.0 / Zoom;
+
+        SDL_Rect view = {x, y, w, h};
+
+        SDL_RenderSetClipRect(renderer, &view);
+
+        auto coarsest = (int)pyramid.Levels.size() - 1;
+
+        // the finest level that is not larger on screen than the image at this zoom
+        auto detail = std::min(std::max(0, (int)std::floor(std::log2(1.0 / Zoom))), coarsest);
+
+        auto levels = (detail == coarsest) ? std::vector<int>({coarsest}) : std::vector<int>({coarsest, detail});
+
+        frame++;
+
+        // room for every tile in view at this zoom, and a margin for panning back
+        capacity = Tiles::SPARE;
+
+        for (auto level : levels)
+        {
+            auto column0 = 0;
+            auto column1 = 0;
+            auto row0 = 0;
+            auto row1 = 0;
+
+            span(level, left, top, w, h, column0, column1, row0, row1);
+
+            capacity += std::max(0, column1 - column0 + 1) * std::max(0, row1 - row0 + 1);
+        }
+
+        for (auto level : levels)
+        {
+            auto &dimensions = pyramid.Levels[level];
+
+            auto fx = (double)Width() / dimensions.Width;
+
+            auto fy = (double)Height() / dimensions.Height;
+
+            // tiles of this level in view
+            auto column0 = 0;
+            auto column1 = 0;
+            auto row0 = 0;
+            auto row1 = 0;
+
+            span(level, left, top, w, h, column0, column1, row0, row1);
+
+            for (auto row = row0; row <= row1; row++)
+            {
+                for (auto column = column0; column <= column1; column++)
+                {
+                    auto texture = tile(renderer, std::make_tuple(level, column, row), pending);
+
+                    if (texture == NULL)
+                    {
+                        continue;
+                    }
+
+                    auto tw = std::min(Tiles::SIZE, dimensions.Width - column * Tiles::SIZE);
+
+                    auto th = std::min(Tiles::SIZE, dimensions.Height - row * Tiles::SIZE);
+
+                    // both edges are rounded so that neighbouring tiles meet without gaps
+                    auto x0 = (int)std::lround(x + (column * Tiles::SIZE * fx - left) * Zoom);
+
+                    auto y0 = (int)std::lround(y + (row * Tiles::SIZE * fy - top) * Zoom);
+
+                    auto x1 = (int)std::lround(x + ((column * Tiles::SIZE + tw) * fx - left) * Zoom);
+
+                    auto y1 = (int)std::lround(y + ((row * Tiles::SIZE + th) * fy - top) * Zoom);
+
+                    SDL_Rect dst = {x0, y0, x1 - x0, y1 - y0};
+
+                    SDL_RenderCopy(renderer, texture, NULL, &dst);
+                }
+            }
+        }
+
+        SDL_RenderSetClipRect(renderer, NULL);
+
+        return pending;
+    }
+
+    int Viewer::Cached()
+    {
+        return (int)cache.size();
+    }
+} // namespace Tiles
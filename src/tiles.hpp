@@ -0,0 +1,148 @@
+#ifndef __TILES__HPP__
+#define __TILES__HPP__
+
+#include <list>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <SDL.h>
+
+#include "handles.hpp"
+
+// Tiled mip pyramid for large images such as the world map (tiles.cpp). Level 0 is the image cut into SIZE x SIZE
+// tiles, and every further level is half the size of the previous one, down to a single tile. "make tiles" bakes the
+// pyramid into tiles/<name>. Otherwise it is baked into the saved games folder the first time the image is shown.
+namespace Tiles
+{
+    const int SIZE = 256;
+
+    // Tile textures a viewer keeps beyond the ones in view, the least recently drawn are destroyed first
+    const int SPARE = 16;
+
+    inline const char *DIRECTORY = "tiles";
+
+    inline const char *INDEX = "tiles.txt";
+
+    class Level
+    {
+    public:
+        int Width = 0;
+
+        int Height = 0;
+
+        int Columns()
+        {
+            return (Width + Tiles::SIZE - 1) / Tiles::SIZE;
+        }
+
+        int Rows()
+        {
+            return (Height + Tiles::SIZE - 1) / Tiles::SIZE;
+        }
+    };
+
+    class Pyramid
+    {
+    public:
+        std::string Directory = "";
+
+        // size in bytes of the image the tiles were cut from, a different size means the tiles are stale
+        long long Source = 0;
+
+        std::vector<Tiles::Level> Levels = std::vector<Tiles::Level>();
+
+        // Read the index, returns false if there is none or it is not for this image
+        bool Load(std::string directory, const char *image);
+
+        std::string File(int level, int column, int row);
+    };
+
+    // Cut the image into the tiles of every level and write the index
+    bool Bake(const char *image, std::string directory);
+
+    // Pan and zoom view of a pyramid. Only the tiles in view at the current zoom are decoded (on the decode pool) and
+    // uploaded; the single tile of the coarsest level is drawn underneath while they load.
+    class Viewer
+    {
+    private:
+        Tiles::Pyramid pyramid;
+
+        // (level, column, row)
+        typedef std::tuple<int, int, int> Key;
+
+        class Entry
+        {
+        public:
+            Handle::Texture Texture;
+
+            // position in the recency order
+            std::list<Key>::iterator Order;
+
+            // last frame the tile was drawn in
+            int Frame = 0;
+        };
+
+        std::map<Key, Entry> cache;
+
+        // most recently drawn first
+        std::list<Key> recent;
+
+        // frames rendered, tiles drawn in the current one are never destroyed
+        int frame = 0;
+
+        // tiles in view plus SPARE
+        int capacity = Tiles::SPARE;
+
+        int viewW = 0;
+
+        int viewH = 0;
+
+        SDL_Texture *tile(SDL_Renderer *renderer, Key key, bool &pending);
+
+        // Columns and rows of the level in view
+        void span(int level, double left, double top, int w, int h, int &column0, int &column1, int &row0, int &row1);
+
+        void clamp();
+
+    public:
+        // Screen pixels per image pixel
+        double Zoom = 1.0;
+
+        // Centre of the view in image pixels
+        double CenterX = 0.0;
+
+        double CenterY = 0.0;
+
+        // Find (or bake) the pyramid of the image
+        bool Open(const char *image);
+
+        // Size of the whole image in pixels
+        int Width();
+
+        int Height();
+
+        // Smallest zoom: the whole image fits the view
+        double MinZoom();
+
+        double MaxZoom();
+
+        // Show the whole image in a view of this size
+        void Fit(int w, int h);
+
+        // Move the view by screen pixels
+        void Pan(double dx, double dy);
+
+        // Zoom by the factor keeping the image point under (x, y) (relative to the view) in place
+        void ZoomAt(double factor, double x, double y);
+
+        // Draw into the rectangle, returns true while visible tiles are still loading
+        bool Render(SDL_Renderer *renderer, int x, int y, int w, int h);
+
+        // Number of tile textures held
+        int Cached();
+    };
+} // namespace Tiles
+
+#endif
@@ -0,0 +1,1827 @@
+// Text-mode frontend for machines without a display (serial consoles, SSH). It plays the same sections through the
+// same rules as the SDL screens and reads and writes the same saved games, but does not link against SDL.
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+#include "codewords.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "character.hpp"
+#include "story.hpp"
+#include "save.hpp"
+#include "search.hpp"
+
+namespace Terminal
+{
+    // Width of the wrapped text and lines per page
+    int Columns = 80;
+
+    int Rows = 24;
+
+    // Pause when a page is full (only when the output is a terminal)
+    bool Paging = true;
+
+    // Enables the find and go to commands
+    bool Debug = false;
+
+    // Lines written since the last input
+    int Printed = 0;
+
+    std::string Trim(const std::string &text)
+    {
+        auto start = text.find_first_not_of(" \t\r\n");
+
+        if (start == std::string::npos)
+        {
+            return "";
+        }
+
+        auto end = text.find_last_not_of(" \t\r\n");
+
+        return text.substr(start, end - start + 1);
+    }
+
+    // End of input ends the session
+    std::string Input(std::string prompt = "> ")
+    {
+        std::cout << prompt << std::flush;
+
+        std::string line;
+
+        if (!std::getline(std::cin, line))
+        {
+            std::cout << std::endl;
+
+            std::exit(0);
+        }
+
+        Printed = 0;
+
+        return Terminal::Trim(line);
+    }
+
+    // Positive number, or -1
+    int Number(const std::string &answer)
+    {
+        if (answer.empty() || answer.length() > 6 || answer.find_first_not_of("0123456789") != std::string::npos)
+        {
+            return -1;
+        }
+
+        return std::atoi(answer.c_str());
+    }
+
+    std::vector<std::string> Wrap(const std::string &text, int width)
+    {
+        auto lines = std::vector<std::string>();
+
+        size_t start = 0;
+
+        while (start <= text.length())
+        {
+            auto end = text.find('\n', start);
+
+            if (end == std::string::npos)
+            {
+                end = text.length();
+            }
+
+            auto paragraph = text.substr(start, end - start);
+
+            auto line = std::string();
+
+            size_t position = 0;
+
+            while (position < paragraph.length())
+            {
+                auto next = paragraph.find(' ', position);
+
+                if (next == std::string::npos)
+                {
+                    next = paragraph.length();
+                }
+
+                auto word = paragraph.substr(position, next - position);
+
+                if (line.length() > 0 && line.length() + 1 + word.length() > width)
+                {
+                    lines.push_back(line);
+
+                    line.clear();
+                }
+
+                if (word.length() > 0)
+                {
+                    line += (line.length() > 0 ? " " : "") + word;
+                }
+
+                position = next + 1;
+            }
+
+            lines.push_back(line);
+
+            start = end + 1;
+        }
+
+        return lines;
+    }
+
+    // One line that is already wrapped
+    void Line(const std::string &line)
+    {
+        if (Terminal::Paging && Terminal::Printed >= Terminal::Rows - 1)
+        {
+            Terminal::Input("-- more --");
+        }
+
+        std::cout << line << std::endl;
+
+        Terminal::Printed++;
+    }
+
+    void Print(const std::string &text)
+    {
+        for (auto &line : Terminal::Wrap(text, Terminal::Columns))
+        {
+            Terminal::Line(line);
+        }
+    }
+
+    void Print(const char *text)
+    {
+        if (text)
+        {
+            Terminal::Print(std::string(text));
+        }
+    }
+
+    void Heading(const std::string &title)
+    {
+        Terminal::Print("");
+        Terminal::Print("== " + title + " ==");
+        Terminal::Print("");
+    }
+
+    // Numbered entry with its text indented under the number (0 continues the previous entry)
+    void Option(int number, const std::string &text)
+    {
+        auto label = number > 0 ? std::to_string(number) + ". " : std::string("   ");
+
+        auto lines = Terminal::Wrap(text, Terminal::Columns - (int)label.length() - 2);
+
+        for (auto i = 0; i < lines.size(); i++)
+        {
+            Terminal::Line("  " + (i == 0 ? label : std::string(label.length(), ' ')) + lines[i]);
+        }
+    }
+
+    void Continue()
+    {
+        Terminal::Input("(press Enter to continue) ");
+    }
+
+    bool Confirm(const std::string &question)
+    {
+        while (true)
+        {
+            auto answer = Terminal::Input(question + " (y/n) ");
+
+            if (answer == "y" || answer == "Y")
+            {
+                return true;
+            }
+            else if (answer == "n" || answer == "N")
+            {
+                return false;
+            }
+        }
+    }
+
+    std::string Describe(Item::Base &item)
+    {
+        std::string description = item.Name;
+
+        if (item.Charge == 0)
+        {
+            description += " (destroyed)";
+        }
+
+        return description;
+    }
+
+    std::string List(std::vector<Item::Base> &items)
+    {
+        auto list = std::string();
+
+        for (auto i = 0; i < items.size(); i++)
+        {
+            list += (i > 0 ? ", " : "") + Terminal::Describe(items[i]);
+        }
+
+        return list.length() > 0 ? list : "(None)";
+    }
+
+    std::string List(std::vector<Skill::Base> &skills)
+    {
+        auto list = std::string();
+
+        for (auto i = 0; i < skills.size(); i++)
+        {
+            list += (i > 0 ? ", " : "") + std::string(skills[i].Name);
+        }
+
+        return list.length() > 0 ? list : "(None)";
+    }
+
+    void Status(Character::Base &player)
+    {
+        auto status = "Life: " + std::to_string(player.Life) + "  Money: " + std::to_string(player.Money) + " cacao";
+
+        if (player.RitualBallStarted)
+        {
+            status += "  Ticks: " + std::to_string(player.Ticks) + "  Cross: " + std::to_string(player.Cross);
+        }
+
+        Terminal::Print(status);
+    }
+
+    void Sheet(Character::Base &player)
+    {
+        auto name = player.Name;
+
+        if (player.IsImmortal)
+        {
+            name += " (Immortal)";
+        }
+
+        if (player.IsBlessed)
+        {
+            name += " (Blessed)";
+        }
+
+        Terminal::Heading(name);
+
+        Terminal::Status(player);
+
+        Terminal::Print("Skills: " + Terminal::List(player.Skills));
+
+        Terminal::Print("Possessions: " + Terminal::List(player.Items));
+
+        auto codewords = std::string();
+
+        for (auto i = 0; i < player.Codewords.size(); i++)
+        {
+            if (!Codeword::IsInvisible(player.Codewords[i]))
+            {
+                codewords += (codewords.length() > 0 ? ", " : "") + std::string(Codeword::Description(player.Codewords[i]));
+            }
+        }
+
+        Terminal::Print("Codewords: " + (codewords.length() > 0 ? codewords : std::string("(None)")));
+
+        Terminal::Continue();
+    }
+
+    // Text of the section after the current one, for each choice
+    void Mirror(Character::Base player, Story::Base *story)
+    {
+        auto future = [&](Story::Base *future_story, Character::Base simPlayer) {
+            auto background = 0;
+
+            while (background != -1)
+            {
+                background = future_story->Background(simPlayer);
+
+                if (background >= 0)
+                {
+                    future_story = (Story::Base *)findStory(background);
+                }
+            }
+
+            future_story->Event(simPlayer);
+
+            return std::string(future_story->Text ? future_story->Text : "");
+        };
+
+        Terminal::Heading("GREEN MIRROR");
+
+        Terminal::Print("You used the GREEN MIRROR to look into your future...");
+
+        if (story->Choices.size() > 0)
+        {
+            for (auto i = 0; i < story->Choices.size(); i++)
+            {
+                Terminal::Print("");
+                Terminal::Print("[" + std::string(story->Choices[i].Text) + "]");
+                Terminal::Print("");
+                Terminal::Print(future((Story::Base *)findStory(story->Choices[i].Destination), player));
+            }
+        }
+        else
+        {
+            auto simPlayer = player;
+
+            Terminal::Print("");
+            Terminal::Print("... " + future((Story::Base *)findStory(story->Continue(simPlayer)), simPlayer));
+        }
+
+        Terminal::Continue();
+    }
+
+    // DROP: drop items until the player carries no more than the limit, LOSE: give up items until only limit remain,
+    // USE: use items
+    void Inventory(Character::Base &player, Story::Base *story, std::vector<Item::Base> &items, Control::Type mode, int limit)
+    {
+        while (items.size() > 0)
+        {
+            if (mode == Control::Type::DROP)
+            {
+                Terminal::Heading("You are carrying too many items! DROP an item.");
+            }
+            else if (mode == Control::Type::LOSE)
+            {
+                Terminal::Heading("DROP item(s) until only " + std::to_string(limit) + " item" + std::string(limit > 1 ? "s" : "") + " remains.");
+            }
+            else
+            {
+                Terminal::Heading("Possessions");
+            }
+
+            for (auto i = 0; i < items.size(); i++)
+            {
+                Terminal::Option(i + 1, Terminal::Describe(items[i]));
+            }
+
+            Terminal::Print(mode == Control::Type::USE ? "Choose an item to USE, or b to go back." : "Choose an item to DROP, or b to go back.");
+
+            auto answer = Terminal::Input();
+
+            if (answer == "b")
+            {
+                return;
+            }
+
+            auto choice = Terminal::Number(answer) - 1;
+
+            if (choice < 0 || choice >= items.size())
+            {
+                continue;
+            }
+
+            auto item = items[choice];
+
+            if (mode == Control::Type::DROP)
+            {
+                items.erase(items.begin() + choice);
+
+                Terminal::Print(Terminal::Describe(item) + " DROPPED!");
+
+                if (Character::VERIFY_POSSESSIONS(player))
+                {
+                    return;
+                }
+            }
+            else if (mode == Control::Type::LOSE)
+            {
+                if (items.size() > limit)
+                {
+                    items.erase(items.begin() + choice);
+
+                    Character::LOSE_ITEMS(player, {item.Type});
+
+                    Terminal::Print(Terminal::Describe(item) + " DROPPED!");
+                }
+
+                if (items.size() <= limit)
+                {
+                    return;
+                }
+            }
+            else if (item.Type == Item::Type::PAPAYA || item.Type == Item::Type::MAIZE_CAKES || item.Type == Item::Type::MAGIC_DRINK)
+            {
+                auto life = item.Type == Item::Type::MAGIC_DRINK ? 5 : 1;
+
+                if (player.Life >= player.MAX_LIFE_LIMIT)
+                {
+                    Terminal::Print("You are not INJURED!");
+                }
+                else
+                {
+                    Character::GAIN_LIFE(player, life);
+
+                    items.erase(items.begin() + choice);
+
+                    Terminal::Print(life > 1 ? "You RECOVER " + std::to_string(life) + " Life Points." : std::string("You RECOVER 1 Life Point."));
+                }
+            }
+            else if (item.Type == Item::Type::GREEN_MIRROR)
+            {
+                if (Terminal::Confirm("The GREEN MIRROR disappears after one use. Do you wish to continue?"))
+                {
+                    Terminal::Mirror(player, story);
+
+                    Item::REMOVE(items, Item::GREEN_MIRROR);
+
+                    Terminal::Print("The GREEN MIRROR vanishes without a trace!");
+                }
+            }
+            else
+            {
+                Terminal::Print(item.Description.length() > 0 ? item.Description : "Nothing happens.");
+            }
+        }
+    }
+
+    void Drop(Character::Base &player, Story::Base *story)
+    {
+        while (!Character::VERIFY_POSSESSIONS(player))
+        {
+            Terminal::Inventory(player, story, player.Items, Control::Type::DROP, 0);
+        }
+    }
+
+    // Toggle entries of a list until the selection is confirmed (true) or abandoned (false)
+    bool Select(std::string message, std::vector<std::string> entries, std::vector<int> &selection, int limit, bool back, std::function<bool(int)> acceptable = nullptr)
+    {
+        while (true)
+        {
+            Terminal::Heading(message);
+
+            for (auto i = 0; i < entries.size(); i++)
+            {
+                auto chosen = std::find(selection.begin(), selection.end(), i) != selection.end();
+
+                Terminal::Option(i + 1, std::string(chosen ? "[x] " : "[ ] ") + entries[i]);
+            }
+
+            Terminal::Print(std::string("Choose a number to select or deselect, d when done") + (back ? ", b to go back." : "."));
+
+            auto answer = Terminal::Input();
+
+            if (answer == "d")
+            {
+                return true;
+            }
+            else if (answer == "b" && back)
+            {
+                return false;
+            }
+
+            auto choice = Terminal::Number(answer) - 1;
+
+            if (choice < 0 || choice >= entries.size())
+            {
+                continue;
+            }
+
+            auto result = std::find(selection.begin(), selection.end(), choice);
+
+            if (result != selection.end())
+            {
+                selection.erase(result);
+            }
+            else if (acceptable && !acceptable(choice))
+            {
+                Terminal::Print("This is unacceptable. Please choose another.");
+            }
+            else if (selection.size() < limit)
+            {
+                selection.push_back(choice);
+            }
+            else
+            {
+                Terminal::Print("You cannot select any more.");
+            }
+        }
+    }
+
+    bool Take(Character::Base &player, std::vector<Item::Base> items, int limit, bool back)
+    {
+        if (limit <= 0)
+        {
+            return false;
+        }
+
+        auto message = std::string();
+
+        if (items.size() > 1)
+        {
+            if (limit > 1)
+            {
+                message = limit == items.size() ? "You can TAKE any number of items." : "You can TAKE up to " + std::to_string(limit) + " items.";
+            }
+            else
+            {
+                message = "Choose an item to KEEP.";
+            }
+        }
+        else
+        {
+            message = "KEEP this item?";
+        }
+
+        auto entries = std::vector<std::string>();
+
+        for (auto &item : items)
+        {
+            entries.push_back(Terminal::Describe(item));
+        }
+
+        auto selection = std::vector<int>();
+
+        if (!Terminal::Select(message, entries, selection, limit, back))
+        {
+            return false;
+        }
+
+        auto take = std::vector<Item::Base>();
+
+        for (auto i : selection)
+        {
+            take.push_back(items[i]);
+        }
+
+        Character::GET_ITEMS(player, take);
+
+        return true;
+    }
+
+    bool LoseItems(Character::Base &player, std::vector<Item::Type> types, int limit)
+    {
+        if (limit <= 0)
+        {
+            return false;
+        }
+
+        auto message = types.size() > 1 ? (limit > 1 ? "You must GIVE UP " + std::to_string(limit) + " items." : std::string("Choose an item to GIVE UP.")) : std::string("GIVE UP this item");
+
+        auto entries = std::vector<std::string>();
+
+        for (auto &item : player.Items)
+        {
+            entries.push_back(Terminal::Describe(item));
+        }
+
+        auto selection = std::vector<int>();
+
+        auto acceptable = [&](int i) { return std::find(types.begin(), types.end(), player.Items[i].Type) != types.end(); };
+
+        while (Terminal::Select(message, entries, selection, limit, true, acceptable))
+        {
+            if (selection.size() == limit)
+            {
+                auto items = std::vector<Item::Base>();
+
+                for (auto i = 0; i < player.Items.size(); i++)
+                {
+                    if (std::find(selection.begin(), selection.end(), i) == selection.end())
+                    {
+                        items.push_back(player.Items[i]);
+                    }
+                }
+
+                player.Items = items;
+
+                return true;
+            }
+
+            Terminal::Print("Please select item(s) to GIVE UP");
+        }
+
+        return false;
+    }
+
+    bool LoseSkills(Character::Base &player, int limit)
+    {
+        if (player.Skills.size() <= limit)
+        {
+            return false;
+        }
+
+        auto count = player.SKILLS_LIMIT - limit;
+
+        auto entries = std::vector<std::string>();
+
+        for (auto &skill : player.Skills)
+        {
+            entries.push_back(skill.Name);
+        }
+
+        auto selection = std::vector<int>();
+
+        auto message = "Select " + std::string(count > 1 ? std::to_string(count) + " skills" : "a skill") + " to LOSE.";
+
+        while (Terminal::Select(message, entries, selection, count, true))
+        {
+            if (selection.size() > 0 && (player.SKILLS_LIMIT - selection.size()) <= limit)
+            {
+                auto skills = std::vector<Skill::Type>();
+
+                for (auto i : selection)
+                {
+                    skills.push_back(player.Skills[i].Type);
+                }
+
+                Character::LOSE_SKILLS(player, skills);
+
+                return true;
+            }
+
+            Terminal::Print("Please complete your selection");
+        }
+
+        return false;
+    }
+
+    // Number of provisions eaten, -1 if the player has nothing to eat
+    int Eat(Character::Base &player, std::vector<Item::Base> items, int limit)
+    {
+        auto provisions = std::vector<Item::Base>();
+
+        for (auto &item : player.Items)
+        {
+            if (Item::VERIFY(items, item))
+            {
+                provisions.push_back(item);
+            }
+        }
+
+        if (provisions.empty())
+        {
+            return -1;
+        }
+
+        auto entries = std::vector<std::string>();
+
+        for (auto &item : provisions)
+        {
+            entries.push_back(item.Name);
+        }
+
+        auto selection = std::vector<int>();
+
+        auto message = "Select " + std::string((limit > 1) ? "provisions" : "provision") + " to EAT." + (limit > 1 ? (" You can EAT up to " + std::to_string(limit) + " provisions.") : "");
+
+        if (!Terminal::Select(message, entries, selection, limit, true))
+        {
+            return 0;
+        }
+
+        for (auto i : selection)
+        {
+            Character::LOSE_ITEMS(player, {provisions[i].Type});
+        }
+
+        return selection.size();
+    }
+
+    int Gift(Story::Base *story, Character::Base &player, std::vector<std::pair<Item::Type, int>> gifts, int destination)
+    {
+        while (player.Items.size() > 0)
+        {
+            Terminal::Heading("Select an item to GIVE");
+
+            for (auto i = 0; i < player.Items.size(); i++)
+            {
+                Terminal::Option(i + 1, Terminal::Describe(player.Items[i]));
+            }
+
+            Terminal::Print("Choose an item, or b to go back.");
+
+            auto answer = Terminal::Input();
+
+            if (answer == "b")
+            {
+                return story->ID;
+            }
+
+            auto choice = Terminal::Number(answer) - 1;
+
+            if (choice >= 0 && choice < player.Items.size())
+            {
+                auto item = player.Items[choice];
+
+                Character::LOSE_ITEMS(player, {item.Type});
+
+                for (auto &gift : gifts)
+                {
+                    if (gift.first == item.Type)
+                    {
+                        return gift.second;
+                    }
+                }
+
+                return destination;
+            }
+        }
+
+        return destination;
+    }
+
+    bool Donate(Character::Base &player)
+    {
+        while (player.Money > 0)
+        {
+            auto answer = Terminal::Input("How much will you DONATE (1-" + std::to_string(player.Money) + ", b to go back)? ");
+
+            if (answer == "b")
+            {
+                return false;
+            }
+
+            auto donation = Terminal::Number(answer);
+
+            if (donation > 0 && donation <= player.Money)
+            {
+                player.DONATION = donation;
+
+                player.Money -= donation;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool Trade(Character::Base &player, Item::Base mine, Item::Base theirs)
+    {
+        if ((Requirement::State(player).Carried & Requirement::Bit(mine.Type)) == 0)
+        {
+            Terminal::Print("You do not have anything to trade.");
+
+            return false;
+        }
+
+        if (Terminal::Confirm("Trade " + std::string(mine.Name) + " for " + std::string(theirs.Name) + "?"))
+        {
+            Character::LOSE_ITEMS(player, {mine.Type});
+
+            Character::GET_ITEMS(player, {theirs});
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Remove one item of this type, the one with the fewest charges if there are several
+    void Part(Character::Base &player, Item::Type type)
+    {
+        if (Item::COUNT_TYPES(player.Items, type) > 1)
+        {
+            auto least = Item::FIND_LEAST(player.Items, type);
+
+            if (least >= 0)
+            {
+                player.Items.erase(player.Items.begin() + least);
+            }
+        }
+        else
+        {
+            Character::LOSE_ITEMS(player, {type});
+        }
+    }
+
+    void Shop(Character::Base &player, Story::Base *story, Control::Type mode)
+    {
+        auto shop = mode == Control::Type::BUY ? story->Shop : story->Sell;
+
+        while (shop.size() > 0)
+        {
+            Terminal::Heading(mode == Control::Type::BUY ? "Select an item to BUY" : "You may SELL your items at prices indicated here");
+
+            for (auto i = 0; i < shop.size(); i++)
+            {
+                auto item = shop[i].first;
+
+                auto choice = mode == Control::Type::BUY ? Terminal::Describe(item) : item.Name;
+
+                Terminal::Option(i + 1, choice + " (" + std::to_string(shop[i].second) + " cacao)");
+            }
+
+            Terminal::Status(player);
+
+            Terminal::Print("Possessions: " + Terminal::List(player.Items));
+
+            Terminal::Print("Choose an item, i for your items, or b to go back.");
+
+            auto answer = Terminal::Input();
+
+            if (answer == "b")
+            {
+                return;
+            }
+            else if (answer == "i")
+            {
+                Terminal::Inventory(player, story, player.Items, Control::Type::USE, 0);
+
+                continue;
+            }
+
+            auto choice = Terminal::Number(answer) - 1;
+
+            if (choice < 0 || choice >= shop.size())
+            {
+                continue;
+            }
+
+            auto item = shop[choice].first;
+
+            auto price = shop[choice].second;
+
+            if (mode == Control::Type::BUY)
+            {
+                if (player.Money < price)
+                {
+                    Terminal::Print("You do not have enough cacao to buy that!");
+                }
+                else if (Item::IsUnique(item.Type) && (Requirement::State(player).Carried & Requirement::Bit(item.Type)) != 0)
+                {
+                    Terminal::Print("You already have this item!");
+                }
+                else
+                {
+                    Character::GET_ITEMS(player, {item});
+
+                    player.Money -= price;
+
+                    Terminal::Drop(player, story);
+
+                    Terminal::Print(Terminal::Describe(item) + " purchased.");
+                }
+            }
+            else if (Item::FIND_TYPE(player.Items, item.Type) >= 0)
+            {
+                Character::GAIN_MONEY(player, price);
+
+                Terminal::Part(player, item.Type);
+
+                Terminal::Print(std::string(item.Name) + " SOLD.");
+            }
+            else
+            {
+                Terminal::Print("You do not have that item!");
+            }
+        }
+    }
+
+    void Barter(Character::Base &player, Story::Base *story, std::vector<std::pair<Item::Base, std::vector<Item::Base>>> barter)
+    {
+        while (barter.size() > 0)
+        {
+            Terminal::Heading("Select an item to BARTER");
+
+            for (auto i = 0; i < barter.size(); i++)
+            {
+                Terminal::Option(i + 1, std::string(barter[i].first.Name) + " for " + Terminal::List(barter[i].second));
+            }
+
+            Terminal::Print("Possessions: " + Terminal::List(player.Items));
+
+            Terminal::Print("Choose an item, i for your items, or b to go back.");
+
+            auto answer = Terminal::Input();
+
+            if (answer == "b")
+            {
+                return;
+            }
+            else if (answer == "i")
+            {
+                Terminal::Inventory(player, story, player.Items, Control::Type::USE, 0);
+
+                continue;
+            }
+
+            auto choice = Terminal::Number(answer) - 1;
+
+            if (choice < 0 || choice >= barter.size())
+            {
+                continue;
+            }
+
+            auto item = barter[choice].first;
+
+            if (Item::FIND_TYPE(player.Items, item.Type) >= 0)
+            {
+                Terminal::Part(player, item.Type);
+
+                Character::GET_ITEMS(player, barter[choice].second);
+
+                Terminal::Print(std::string(item.Name) + " BARTERED.");
+            }
+            else
+            {
+                Terminal::Print("You do not have that item!");
+            }
+        }
+    }
+
+    // Saved games, most recent first
+    std::vector<std::string> Games()
+    {
+        auto saved_games = std::multimap<fs::file_time_type, std::string, std::greater<fs::file_time_type>>();
+
+        try
+        {
+            for (const auto &entry : fs::directory_iterator(savePath()))
+            {
+                auto file_name = entry.path().string();
+
+                if (file_name.substr(file_name.find_last_of(".") + 1) == "save")
+                {
+                    saved_games.insert(std::make_pair(entry.last_write_time(), file_name));
+                }
+            }
+        }
+        catch (std::exception &ex)
+        {
+        }
+
+        auto entries = std::vector<std::string>();
+
+        for (auto const &entry : saved_games)
+        {
+            entries.push_back(entry.second);
+        }
+
+        return entries;
+    }
+
+    // Returns LOAD (player is replaced by the saved game), SAVE or BACK
+    Control::Type Game(Character::Base &player, bool save)
+    {
+        while (true)
+        {
+            auto entries = Terminal::Games();
+
+            Terminal::Heading(save ? "Save game" : "Load game");
+
+            for (auto i = 0; i < entries.size(); i++)
+            {
+                auto game = summaryGame(entries[i]);
+
+                auto name = fs::path(entries[i]).filename().string();
+
+                Terminal::Option(i + 1, name + ": " + game.Name + ", section " + std::to_string(game.StoryID) + ", Life " + std::to_string(game.Life) + ", " + std::to_string(game.Money) + " cacao");
+            }
+
+            if (entries.empty())
+            {
+                Terminal::Print("There are no saved games.");
+            }
+
+            Terminal::Print(save ? "Choose a game to overwrite, n for a new save, or b to go back." : "Choose a game to load, or b to go back.");
+
+            auto answer = Terminal::Input();
+
+            if (answer == "b")
+            {
+                return Control::Type::BACK;
+            }
+            else if (answer == "n" && save)
+            {
+                saveGame(player, NULL);
+
+                return Control::Type::SAVE;
+            }
+
+            auto choice = Terminal::Number(answer) - 1;
+
+            if (choice >= 0 && choice < entries.size())
+            {
+                if (save)
+                {
+                    saveGame(player, entries[choice].c_str());
+
+                    return Control::Type::SAVE;
+                }
+                else
+                {
+                    player = loadGame(entries[choice]);
+
+                    return Control::Type::LOAD;
+                }
+            }
+        }
+    }
+
+    // Resolve a choice: the next section, or NULL (with a message) if the player stays in this section
+    Story::Base *Choose(Character::Base &player, Story::Base *story, int current, std::string &message)
+    {
+        auto &choice = story->Choices[current];
+
+        auto available = Choice::Available(story->Choices, player);
+
+        // why a choice is not available
+        auto state = Requirement::State(player);
+
+        auto destination = [&]() { return (Story::Base *)findStory(choice.Destination); };
+
+        auto items = std::vector<Item::Type>();
+
+        for (auto &item : choice.Items)
+        {
+            items.push_back(item.Type);
+        }
+
+        switch (choice.Type)
+        {
+        case Choice::Type::NORMAL:
+
+            return destination();
+
+        case Choice::Type::ITEMS:
+
+            if (available[current])
+            {
+                return destination();
+            }
+            else
+            {
+                auto weapons = 0;
+
+                for (auto &item : choice.Items)
+                {
+                    // items that are carried but not loaded
+                    if ((state.Carried & Requirement::Bit(item.Type)) != 0)
+                    {
+                        weapons++;
+                    }
+                }
+
+                if (weapons > 0)
+                {
+                    message = weapons > 1 ? "The weapons you are carrying are not loaded!" : "The weapon you are carrying is not loaded!";
+                }
+                else
+                {
+                    message = choice.Items.size() > 1 ? "You do not have the required items!" : "You do not have the required item!";
+                }
+            }
+
+            break;
+
+        case Choice::Type::ANY_ITEM:
+
+            if (available[current])
+            {
+                return destination();
+            }
+
+            message = "You do not have any of the required items that can be used.";
+
+            break;
+
+        case Choice::Type::CODEWORD:
+
+            if (available[current])
+            {
+                return destination();
+            }
+
+            message = "You do not have the required codeword(s)!";
+
+            break;
+
+        case Choice::Type::GET_ITEMS:
+
+            Character::GET_ITEMS(player, {choice.Items});
+
+            Terminal::Drop(player, story);
+
+            return destination();
+
+        case Choice::Type::TAKE:
+
+            Character::LOSE_ITEMS(player, items);
+
+            while (!Terminal::Take(player, choice.Items, choice.Value, false))
+            {
+            }
+
+            Terminal::Drop(player, story);
+
+            return destination();
+
+        case Choice::Type::PAY_WITH:
+
+            if (choice.Items.size() > 0)
+            {
+                if (available[current])
+                {
+                    for (auto i = 0; i < choice.Value; i++)
+                    {
+                        Character::LOSE_ITEMS(player, {choice.Items[0].Type});
+                    }
+
+                    return destination();
+                }
+
+                message = "You do not have the enough!";
+            }
+
+            break;
+
+        case Choice::Type::SELL:
+
+            if (choice.Items.size() > 0)
+            {
+                if (available[current])
+                {
+                    Character::LOSE_ITEMS(player, {choice.Items[0].Type});
+
+                    Character::GAIN_MONEY(player, choice.Value);
+
+                    return destination();
+                }
+
+                message = "You do not have that!";
+            }
+
+            break;
+
+        case Choice::Type::LOSE_ITEMS:
+        case Choice::Type::GIVE_ITEMS:
+
+            if (available[current])
+            {
+                Character::LOSE_ITEMS(player, items);
+
+                return destination();
+            }
+
+            message = "You do not have the required item(s)!";
+
+            break;
+
+        case Choice::Type::GIVE:
+
+            if (player.Items.size() >= choice.Value)
+            {
+                auto limit = player.Items.size() - choice.Value;
+
+                while (player.Items.size() > limit)
+                {
+                    Terminal::Inventory(player, story, player.Items, Control::Type::LOSE, limit);
+                }
+
+                return destination();
+            }
+            else if (player.Items.size() > 0)
+            {
+                Character::LOSE_POSSESSIONS(player);
+
+                return destination();
+            }
+
+            message = "You do not have anything to give!";
+
+            break;
+
+        case Choice::Type::BRIBE:
+
+            Terminal::LoseItems(player, items, choice.Value);
+
+            return destination();
+
+        case Choice::Type::GET_CODEWORD:
+
+            Character::GET_CODEWORDS(player, choice.Codewords);
+
+            return destination();
+
+        case Choice::Type::LOSE_CODEWORD:
+
+            Character::REMOVE_CODEWORD(player, choice.Codewords[0]);
+
+            return destination();
+
+        case Choice::Type::LOSE_ALL:
+
+            Character::LOSE_ALL(player);
+
+            return destination();
+
+        case Choice::Type::LOSE_MONEY:
+
+            if (available[current])
+            {
+                player.Money -= choice.Value;
+
+                return destination();
+            }
+
+            message = "You do not have enough money!";
+
+            break;
+
+        case Choice::Type::GAIN_MONEY:
+
+            player.Money += choice.Value;
+
+            return destination();
+
+        case Choice::Type::MONEY:
+
+            if (available[current])
+            {
+                return destination();
+            }
+
+            message = "You do not have enough money!";
+
+            break;
+
+        case Choice::Type::LIFE:
+
+            Character::GAIN_LIFE(player, choice.Value);
+
+            return player.Life > 0 ? destination() : (Story::Base *)&notImplemented;
+
+        case Choice::Type::EAT:
+        case Choice::Type::EAT_HEAL:
+        {
+            auto consumed = Terminal::Eat(player, choice.Items, choice.Value);
+
+            if (consumed < 0)
+            {
+                message = "There is nothing in possessions that you can eat.";
+            }
+            else if (choice.Type == Choice::Type::EAT_HEAL)
+            {
+                Character::GAIN_LIFE(player, choice.Value);
+
+                return destination();
+            }
+            else
+            {
+                Character::GAIN_LIFE(player, consumed - choice.Value);
+
+                if (player.Life > 0)
+                {
+                    return destination();
+                }
+
+                message = "You died of hunger! This adventure is now over.";
+            }
+
+            break;
+        }
+
+        case Choice::Type::SKILL_ANY:
+        case Choice::Type::SKILL_ITEM:
+
+            if (available[current])
+            {
+                return destination();
+            }
+
+            if ((state.Skills & Requirement::Bit(choice.Skill)) != 0)
+            {
+                message = choice.Type == Choice::Type::SKILL_ANY ? "You do not have any of the required item(s) to use with this skill!" : "You do not have the required item!";
+            }
+            else
+            {
+                message = "You do not possess the required skill!";
+            }
+
+            break;
+
+        case Choice::Type::SKILL:
+
+            if (available[current])
+            {
+                return destination();
+            }
+
+            if ((state.Skills & Requirement::Bit(choice.Skill)) != 0)
+            {
+                auto item = player.Skills[Character::FIND_SKILL(player, choice.Skill)].Requirement;
+
+                message = (state.Carried & Requirement::Bit(item)) != 0 ? "The item you are carrying is not loaded!" : "You do not have the required item to use with this skill!";
+            }
+            else
+            {
+                message = "You do not possess the required skill!";
+            }
+
+            break;
+
+        case Choice::Type::DONATE:
+
+            if (available[current])
+            {
+                return Terminal::Donate(player) ? destination() : story;
+            }
+
+            message = "You do not have any money!";
+
+            break;
+
+        case Choice::Type::GIFT:
+
+            if (available[current])
+            {
+                return (Story::Base *)findStory(Terminal::Gift(story, player, choice.Gifts, choice.Destination));
+            }
+
+            message = "You do not have any items to give!";
+
+            break;
+
+        case Choice::Type::LOSE_SKILLS:
+
+            if (Terminal::LoseSkills(player, choice.Value) && player.Skills.size() <= choice.Value)
+            {
+                return choice.Destination != story->ID ? destination() : story;
+            }
+
+            break;
+
+        default:
+
+            if (available[current])
+            {
+                return destination();
+            }
+
+            message = "You cannot choose this!";
+
+            break;
+        }
+
+        return NULL;
+    }
+
+    // Losses and gains that must be settled before the player leaves the section. Returns false if the player backed out.
+    bool Settle(Character::Base &player, Story::Base *story)
+    {
+        if (story->LimitSkills > 0)
+        {
+            if (!Terminal::LoseSkills(player, story->LimitSkills))
+            {
+                return false;
+            }
+
+            story->LimitSkills = 0;
+        }
+
+        if (story->Take.size() > 0 && story->Limit > 0)
+        {
+            if (!Terminal::Take(player, story->Take, story->Limit, true))
+            {
+                return false;
+            }
+
+            story->Limit = 0;
+        }
+
+        if (story->Limit > 0 && story->ToLose.size() > story->Limit)
+        {
+            while (story->ToLose.size() > story->Limit)
+            {
+                Terminal::Inventory(player, story, story->ToLose, Control::Type::LOSE, story->Limit);
+            }
+        }
+
+        Terminal::Drop(player, story);
+
+        return true;
+    }
+
+    // Same flow as processStory. Returns when the player quits or the adventure is over.
+    void Play(Character::Base &player, Story::Base *story)
+    {
+        Character::Base saveCharacter;
+
+        while (true)
+        {
+            player.StoryID = story->ID;
+
+            saveCharacter = player;
+
+            auto jump = story->Background(player);
+
+            if (jump >= 0)
+            {
+                story = (Story::Base *)findStory(jump);
+
+                continue;
+            }
+
+            story->Event(player);
+
+            Terminal::Heading(story->Title ? story->Title : "Section " + std::to_string(story->ID));
+
+            Terminal::Print(story->Text);
+
+            if (player.IsBlessed && saveCharacter.Life > player.Life)
+            {
+                Terminal::Print("");
+
+                if (Terminal::Confirm("You have lost some Life Points. Do you wish to use the War God's Blessing?"))
+                {
+                    player.IsBlessed = false;
+
+                    player.Life = saveCharacter.Life;
+
+                    Terminal::Print("You used the blessing to RECOVER the LOST Life Points.");
+                }
+            }
+
+            auto over = story->Type != Story::Type::NORMAL || player.Life <= 0 || story->ID == notImplemented.ID;
+
+            Story::Base *next = NULL;
+
+            while (next == NULL)
+            {
+                Terminal::Print("");
+
+                Terminal::Status(player);
+
+                Terminal::Print("");
+
+                if (over)
+                {
+                    Terminal::Print(player.Life <= 0 ? "You have died. This adventure is over." : "This adventure is over.");
+                }
+                else if (story->Choices.size() > 0)
+                {
+                    for (auto i = 0; i < story->Choices.size(); i++)
+                    {
+                        Terminal::Option(i + 1, story->Choices[i].Text);
+                    }
+                }
+                else
+                {
+                    Terminal::Option(1, "Continue");
+                }
+
+                auto commands = std::string(over ? "" : "c) character  i) items  s) save  ") + "l) load  q) quit";
+
+                if (!over)
+                {
+                    if (story->Controls == Story::Controls::SHOP || story->Controls == Story::Controls::BUY_AND_SELL || story->Controls == Story::Controls::BARTER_AND_SHOP)
+                    {
+                        commands += "  b) buy";
+                    }
+
+                    if (story->Controls == Story::Controls::SELL || story->Controls == Story::Controls::BUY_AND_SELL)
+                    {
+                        commands += "  v) sell";
+                    }
+
+                    if (story->Controls == Story::Controls::TRADE)
+                    {
+                        commands += "  t) trade";
+                    }
+
+                    if (story->Controls == Story::Controls::BARTER || story->Controls == Story::Controls::BARTER_AND_SHOP)
+                    {
+                        commands += "  x) barter";
+                    }
+                }
+
+                if (Terminal::Debug)
+                {
+                    commands += "  f WORDS) find  g ID) go to";
+                }
+
+                Terminal::Print(commands);
+
+                auto answer = Terminal::Input();
+
+                if (answer == "q")
+                {
+                    return;
+                }
+                else if (answer == "l")
+                {
+                    auto loaded = saveCharacter;
+
+                    if (Terminal::Game(loaded, false) == Control::Type::LOAD && loaded.StoryID >= 0 && loaded.Life > 0)
+                    {
+                        player = loaded;
+
+                        next = (Story::Base *)findStory(player.StoryID);
+
+                        Terminal::Print("Game loaded!");
+                    }
+                }
+                else if (Terminal::Debug && answer.length() > 2 && answer.substr(0, 2) == "f ")
+                {
+                    auto found = Search::Find(answer.substr(2));
+
+                    for (auto id : found)
+                    {
+                        auto section = (Story::Base *)findStory(id);
+
+                        Terminal::Print(std::to_string(id) + "\t" + (section->Title ? section->Title : ""));
+                    }
+
+                    Terminal::Print(std::to_string(found.size()) + " section(s) found");
+                }
+                else if (Terminal::Debug && answer.length() > 2 && answer.substr(0, 2) == "g ")
+                {
+                    next = (Story::Base *)findStory(std::atoi(answer.substr(2).c_str()));
+                }
+                else if (over)
+                {
+                    continue;
+                }
+                else if (answer == "c")
+                {
+                    Terminal::Sheet(player);
+                }
+                else if (answer == "i")
+                {
+                    Terminal::Inventory(player, story, player.Items, Control::Type::USE, 0);
+                }
+                else if (answer == "s")
+                {
+                    if (Terminal::Game(saveCharacter, true) == Control::Type::SAVE)
+                    {
+                        Terminal::Print("Game saved!");
+                    }
+                }
+                else if (answer == "b" && commands.find("b) buy") != std::string::npos)
+                {
+                    Terminal::Shop(player, story, Control::Type::BUY);
+                }
+                else if (answer == "v" && commands.find("v) sell") != std::string::npos)
+                {
+                    Terminal::Shop(player, story, Control::Type::SELL);
+                }
+                else if (answer == "t" && commands.find("t) trade") != std::string::npos)
+                {
+                    Terminal::Trade(player, story->Trade.first, story->Trade.second);
+                }
+                else if (answer == "x" && commands.find("x) barter") != std::string::npos)
+                {
+                    Terminal::Barter(player, story, story->Barter);
+                }
+                else
+                {
+                    auto choice = Terminal::Number(answer) - 1;
+
+                    auto choices = story->Choices.size() > 0 ? story->Choices.size() : 1;
+
+                    if (choice < 0 || choice >= choices || !Terminal::Settle(player, story))
+                    {
+                        continue;
+                    }
+
+                    auto message = std::string();
+
+                    auto result = story->Choices.size() > 0 ? Terminal::Choose(player, story, choice, message) : (Story::Base *)findStory(story->Continue(player));
+
+                    if (message.length() > 0)
+                    {
+                        Terminal::Print(message);
+                    }
+
+                    if (result && result->ID != story->ID)
+                    {
+                        if (story->Bye)
+                        {
+                            Terminal::Print("");
+
+                            Terminal::Print(story->Bye);
+
+                            Terminal::Continue();
+                        }
+
+                        next = result;
+                    }
+                    else if (player.Life <= 0)
+                    {
+                        over = true;
+                    }
+                }
+            }
+
+            story = next;
+        }
+    }
+
+    Character::Base Custom()
+    {
+        auto player = Character::Base();
+
+        auto entries = std::vector<std::string>();
+
+        for (auto &skill : Skill::ALL)
+        {
+            entries.push_back(std::string(skill.Name) + ": " + skill.Description);
+        }
+
+        auto selection = std::vector<int>();
+
+        auto message = "Select " + std::to_string(player.SKILLS_LIMIT) + " skills";
+
+        while (Terminal::Select(message, entries, selection, player.SKILLS_LIMIT, true))
+        {
+            if (selection.size() == player.SKILLS_LIMIT)
+            {
+                Character::CUSTOM.Skills.clear();
+
+                Character::CUSTOM.Items.clear();
+
+                for (auto i : selection)
+                {
+                    Character::CUSTOM.Skills.push_back(Skill::ALL[i]);
+
+                    if (Skill::ALL[i].Type == Skill::Type::SWORDPLAY)
+                    {
+                        Character::CUSTOM.Items.push_back(Item::SWORD);
+                    }
+                    else if (Skill::ALL[i].Type == Skill::Type::SPELLS)
+                    {
+                        Character::CUSTOM.Items.push_back(Item::MAGIC_WAND);
+                    }
+                    else if (Skill::ALL[i].Type == Skill::Type::TARGETING)
+                    {
+                        Character::CUSTOM.Items.push_back(Item::BLOWGUN);
+                    }
+                    else if (Skill::ALL[i].Type == Skill::Type::CHARMS)
+                    {
+                        Character::CUSTOM.Items.push_back(Item::MAGIC_AMULET);
+                    }
+                }
+
+                Character::CUSTOM.Money = 12;
+
+                Character::CUSTOM.Life = 10;
+
+                return Character::CUSTOM;
+            }
+
+            Terminal::Print("Please select " + std::to_string(player.SKILLS_LIMIT) + " skills.");
+        }
+
+        return player;
+    }
+
+    // StoryID is -1 if the player went back
+    Character::Base Select()
+    {
+        while (true)
+        {
+            Terminal::Heading("Select Character");
+
+            for (auto i = 0; i < Character::Classes.size(); i++)
+            {
+                auto &character = Character::Classes[i];
+
+                Terminal::Option(i + 1, character.Name + ": " + character.Description);
+                Terminal::Option(0, "Skills: " + Terminal::List(character.Skills));
+                Terminal::Option(0, "Possessions: " + Terminal::List(character.Items) + ", " + std::to_string(character.Money) + " cacao");
+            }
+
+            Terminal::Print("Choose a character, c for a custom character, or b to go back.");
+
+            auto answer = Terminal::Input();
+
+            if (answer == "b")
+            {
+                auto player = Character::Base();
+
+                player.StoryID = -1;
+
+                return player;
+            }
+            else if (answer == "c")
+            {
+                auto player = Terminal::Custom();
+
+                if (player.Skills.size() == player.SKILLS_LIMIT)
+                {
+                    return player;
+                }
+            }
+            else
+            {
+                auto choice = Terminal::Number(answer) - 1;
+
+                if (choice >= 0 && choice < Character::Classes.size())
+                {
+                    return Character::Classes[choice];
+                }
+            }
+        }
+    }
+} // namespace Terminal
+
+int main(int argc, char **argv)
+{
+    auto storyID = 0;
+
+    if (getenv("COLUMNS") && std::atoi(getenv("COLUMNS")) > 20)
+    {
+        Terminal::Columns = std::atoi(getenv("COLUMNS"));
+    }
+
+    if (getenv("LINES") && std::atoi(getenv("LINES")) > 2)
+    {
+        Terminal::Rows = std::atoi(getenv("LINES"));
+    }
+
+#if defined(_WIN32)
+    Terminal::Paging = _isatty(_fileno(stdin)) && _isatty(_fileno(stdout));
+#else
+    Terminal::Paging = isatty(STDIN_FILENO) && isatty(STDOUT_FILENO);
+#endif
+
+    // Usage: SkullsTTY.exe [--columns N] [--lines N] [--no-pager] [--debug] [story]
+    for (auto arg = 1; arg < argc; arg++)
+    {
+        auto option = std::string(argv[arg]);
+
+        if (option == "--columns" && arg + 1 < argc)
+        {
+            arg++;
+
+            Terminal::Columns = std::max(20, std::atoi(argv[arg]));
+        }
+        else if (option == "--lines" && arg + 1 < argc)
+        {
+            arg++;
+
+            Terminal::Rows = std::max(3, std::atoi(argv[arg]));
+        }
+        else if (option == "--no-pager")
+        {
+            Terminal::Paging = false;
+        }
+        else if (option == "--debug")
+        {
+            Terminal::Debug = true;
+        }
+        else
+        {
+            storyID = std::atoi(argv[arg]);
+        }
+    }
+
+    InitializeStories();
+
+    // the index runs every section's Event, so it is built before any section is played
+    if (Terminal::Debug)
+    {
+        Search::Build();
+    }
+
+    while (true)
+    {
+        Terminal::Heading("Necklace of Skulls");
+
+        Terminal::Option(1, "New Game");
+        Terminal::Option(2, "Load Game");
+        Terminal::Option(3, "Exit");
+
+        auto answer = Terminal::Number(Terminal::Input());
+
+        if (answer == 1)
+        {
+            auto player = Terminal::Select();
+
+            if (player.StoryID != -1)
+            {
+                Terminal::Play(player, (Story::Base *)findStory(storyID));
+            }
+
+            storyID = 0;
+        }
+        else if (answer == 2)
+        {
+            auto player = Character::Base();
+
+            if (Terminal::Game(player, false) == Control::Type::LOAD && player.StoryID >= 0 && player.Life > 0)
+            {
+                Terminal::Play(player, (Story::Base *)findStory(player.StoryID));
+            }
+        }
+        else if (answer == 3)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
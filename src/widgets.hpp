@@ -0,0 +1,387 @@
+#ifndef __WIDGETS__HPP__
+#define __WIDGETS__HPP__
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "constants.hpp"
+#include "render.hpp"
+#include "handles.hpp"
+#include "memory.hpp"
+#include "textures.hpp"
+
+// Retained widgets: screens declare their nodes once, only nodes whose content changed are laid out (rendered to a texture) again
+namespace Widget
+{
+    class Base
+    {
+    public:
+        int X = 0;
+        int Y = 0;
+
+        int W = 0;
+        int H = 0;
+
+        bool Visible = true;
+
+        // Layout needs to be recomputed before the next render
+        bool Dirty = true;
+
+        virtual void Layout(SDL_Renderer *renderer)
+        {
+            Dirty = false;
+        }
+
+        virtual void Render(SDL_Renderer *renderer) = 0;
+
+        virtual ~Base()
+        {
+        }
+    };
+
+    // Solid rectangle
+    class Panel : public Base
+    {
+    public:
+        Uint32 Color = intWH;
+
+        Panel(Uint32 color, int w, int h, int x, int y)
+        {
+            Color = color;
+            W = w;
+            H = h;
+            X = x;
+            Y = y;
+        }
+
+        void Render(SDL_Renderer *renderer)
+        {
+            SDL_Rect rect;
+
+            rect.w = W;
+            rect.h = H;
+            rect.x = X;
+            rect.y = Y;
+
+            Render::SetColor(renderer, Color);
+            SDL_RenderFillRect(renderer, &rect);
+        }
+    };
+
+    // Wrapped text on a box (same output as putText) whose texture is only rebuilt when text, colors or size change
+    class Label : public Base
+    {
+    private:
+        Handle::Texture texture;
+
+        // visible portion of the text and the height of the box after layout
+        int text_w = 0;
+        int text_h = 0;
+        int box_h = 0;
+
+    public:
+        std::string Text = "";
+
+        TTF_Font *Font = NULL;
+
+        int Space = 0;
+
+        int Style = TTF_STYLE_NORMAL;
+
+        SDL_Color Fg = clrBK;
+
+        Uint32 Bg = intBE;
+
+        Label(const char *text, TTF_Font *font, int space, SDL_Color fg, Uint32 bg, int style, int w, int h, int x, int y)
+        {
+            Text = text ? text : "";
+            Font = font;
+            Space = space;
+            Fg = fg;
+            Bg = bg;
+            Style = style;
+            W = w;
+            H = h;
+            X = x;
+            Y = y;
+        }
+
+        void Set(std::string text)
+        {
+            if (text != Text)
+            {
+                Text = text;
+
+                Dirty = true;
+            }
+        }
+
+        void Set(std::string text, Uint32 bg)
+        {
+            Set(text);
+
+            Bg = bg;
+        }
+
+        void Set(std::string text, SDL_Color fg, Uint32 bg)
+        {
+            if (fg.r != Fg.r || fg.g != Fg.g || fg.b != Fg.b || fg.a != Fg.a)
+            {
+                Fg = fg;
+
+                Dirty = true;
+            }
+
+            Set(text, bg);
+        }
+
+        void Layout(SDL_Renderer *renderer)
+        {
+            texture.reset();
+
+            text_w = 0;
+            text_h = 0;
+            box_h = 0;
+
+            if (renderer && Font && Text.length() > 0)
+            {
+                TTF_SetFontStyle(Font, Style);
+
+                // in the renderer's format, so that the upload is a plain copy
+                auto surface = Handle::Surface(Textures::Native(Memory::Type::TEXT, Memory::Track(Memory::Type::TEXT, TTF_RenderText_Blended_Wrapped(Font, Text.c_str(), Fg, W - 2 * Space))));
+
+                if (surface)
+                {
+                    box_h = (surface->h + 2 * Space) < H ? H : (surface->h + 2 * Space);
+
+                    text_w = surface->w;
+                    text_h = surface->h < (box_h - 2 * Space) ? surface->h : (box_h - 2 * Space);
+
+                    texture.reset(Memory::CreateTexture(renderer, surface.get()));
+                }
+            }
+
+            Dirty = false;
+        }
+
+        void Render(SDL_Renderer *renderer)
+        {
+            if (texture)
+            {
+                SDL_Rect src;
+                SDL_Rect dst;
+
+                src.w = text_w;
+                src.h = text_h;
+                src.x = 0;
+                src.y = 0;
+
+                dst.w = text_w;
+                dst.h = text_h;
+                dst.x = Space > 0 ? X + Space : X + (W - text_w) / 2;
+                dst.y = Space > 0 ? Y + Space : Y + (H - text_h) / 2;
+
+                SDL_Rect box;
+
+                box.w = W;
+                box.h = box_h;
+                box.x = X;
+                box.y = Y;
+
+                // translucent boxes (over the picture of a section) are blended
+                auto translucent = A(Bg) < 0xFF;
+
+                if (translucent)
+                {
+                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+                }
+
+                Render::SetColor(renderer, Bg);
+                SDL_RenderFillRect(renderer, &box);
+
+                if (translucent)
+                {
+                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+                }
+
+                SDL_RenderCopy(renderer, texture.get(), &src, &dst);
+            }
+        }
+    };
+
+    // Owns the widgets of a screen and draws them in the order they were added
+    class Tree
+    {
+    private:
+        std::vector<std::unique_ptr<Widget::Base>> nodes = std::vector<std::unique_ptr<Widget::Base>>();
+
+    public:
+        template <typename T, typename... Args>
+        T *Add(Args &&... args)
+        {
+            auto node = new T(std::forward<Args>(args)...);
+
+            nodes.push_back(std::unique_ptr<Widget::Base>(node));
+
+            return node;
+        }
+
+        // Force every node to be laid out again (e.g. after a resolution change)
+        void Invalidate()
+        {
+            for (auto &node : nodes)
+            {
+                node->Dirty = true;
+            }
+        }
+
+        void Render(SDL_Renderer *renderer)
+        {
+            for (auto &node : nodes)
+            {
+                if (node->Visible)
+                {
+                    if (node->Dirty)
+                    {
+                        node->Layout(renderer);
+                    }
+
+                    node->Render(renderer);
+                }
+            }
+        }
+    };
+
+    // Recycle pool of rasterized list rows keyed by their content, so that scrolling a list only renders the rows that come into view
+    class Rows
+    {
+    private:
+        class Entry
+        {
+        public:
+            Handle::SharedSurface Surface;
+
+            // position in the recency order
+            std::list<std::string>::iterator Order;
+
+            long long Bytes = 0;
+        };
+
+        std::unordered_map<std::string, Entry> pool = std::unordered_map<std::string, Entry>();
+
+        // least recently used first
+        std::list<std::string> order = std::list<std::string>();
+
+        int generation = -1;
+
+        // pixels of the rows in the pool
+        long long bytes = 0;
+
+        void evict()
+        {
+            auto found = pool.find(order.front());
+
+            if (found != pool.end())
+            {
+                bytes -= found->second.Bytes;
+
+                pool.erase(found);
+            }
+
+            order.pop_front();
+        }
+
+    public:
+        // Maximum number of rows kept
+        int Capacity = 256;
+
+        // Maximum pixel bytes of the rows kept, 0 for none. The accounting bucket is shared with other users, so it is
+        // not what this pool evicts to.
+        long long Budget = 0;
+
+        // Accounting bucket of the rows in this pool
+        Memory::Type Type = Memory::Type::ROWS;
+
+        Rows()
+        {
+        }
+
+        Rows(int capacity, Memory::Type type, long long budget)
+        {
+            Capacity = capacity;
+
+            Type = type;
+
+            Budget = budget;
+        }
+
+        // Drops the pool's references, rows still held by buttons are freed with them
+        void Clear()
+        {
+            pool.clear();
+
+            order.clear();
+
+            bytes = 0;
+        }
+
+        // Returns the pooled row (shared with the pool, e.g. by a Button), rasterizing it only when it is not in the pool
+        Handle::SharedSurface Get(const std::string &key, std::function<SDL_Surface *()> rasterize)
+        {
+            if (generation != Video.Generation)
+            {
+                Clear();
+
+                generation = Video.Generation;
+            }
+
+            auto found = pool.find(key);
+
+            if (found != pool.end())
+            {
+                // most recently used
+                order.splice(order.end(), order, found->second.Order);
+
+                return found->second.Surface;
+            }
+
+            auto surface = Memory::Track(Type, rasterize());
+
+            if (surface == NULL)
+            {
+                return NULL;
+            }
+
+            auto size = (long long)surface->pitch * surface->h;
+
+            // evict the least recently used rows when over the capacity or the byte budget of this pool
+            while ((pool.size() >= Capacity || (Budget > 0 && bytes + size > Budget)) && order.size() > 0)
+            {
+                evict();
+            }
+
+            auto row = Handle::Share(surface);
+
+            pool[key] = Entry{row, order.insert(order.end(), key), size};
+
+            bytes += size;
+
+            return row;
+        }
+    };
+
+    // Shared by the item, skill and saved game lists
+    inline Widget::Rows ListRows = Widget::Rows(256, Memory::Type::ROWS, 8LL << 20);
+
+    // Strings drawn every frame by putText and renderTextButtons, so that they are rasterized once instead of per frame
+    inline Widget::Rows TextRows = Widget::Rows(128, Memory::Type::TEXT, 4LL << 20);
+} // namespace Widget
+
+#endif